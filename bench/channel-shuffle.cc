@@ -17,7 +17,7 @@
 #include <benchmark/benchmark.h>
 
 
-static void channel_shuffle_nc_x8(benchmark::State& state) {
+static void run_channel_shuffle_nc_x8(benchmark::State& state, pthreadpool_t threadpool) {
   const size_t batchSize = static_cast<size_t>(state.range(0));
   const size_t groups = static_cast<size_t>(state.range(1));
   const size_t groupChannels = static_cast<size_t>(state.range(2));
@@ -53,7 +53,7 @@ static void channel_shuffle_nc_x8(benchmark::State& state) {
   }
 
   for (auto _ : state) {
-    status = qnnp_run_operator(channelShuffleOperator, nullptr /* thread pool */);
+    status = qnnp_run_operator(channelShuffleOperator, threadpool);
     if (status != qnnp_status_success) {
       state.SkipWithError("failed to run X8 Channel Shuffle operator");
     }
@@ -71,6 +71,20 @@ static void channel_shuffle_nc_x8(benchmark::State& state) {
   }
 }
 
+static void channel_shuffle_nc_x8(benchmark::State& state) {
+  run_channel_shuffle_nc_x8(state, nullptr /* thread pool */);
+}
+
+static void channel_shuffle_nc_x8_multithreaded(benchmark::State& state) {
+  pthreadpool_t threadpool = pthreadpool_create(0 /* number of threads */);
+  if (threadpool == nullptr) {
+    state.SkipWithError("failed to create thread pool");
+    return;
+  }
+  run_channel_shuffle_nc_x8(state, threadpool);
+  pthreadpool_destroy(threadpool);
+}
+
 static void ShuffleNetV1G2Arguments(benchmark::internal::Benchmark* b)
 {
   b->ArgNames({"N", "G", "GC"});
@@ -228,6 +242,15 @@ BENCHMARK(channel_shuffle_nc_x8)->Apply(ShuffleNetV2x1_0Arguments);
 BENCHMARK(channel_shuffle_nc_x8)->Apply(ShuffleNetV2x1_5Arguments);
 BENCHMARK(channel_shuffle_nc_x8)->Apply(ShuffleNetV2x2_0Arguments);
 
+BENCHMARK(channel_shuffle_nc_x8_multithreaded)->UseRealTime()->Apply(ShuffleNetV1G2Arguments);
+BENCHMARK(channel_shuffle_nc_x8_multithreaded)->UseRealTime()->Apply(ShuffleNetV1G3Arguments);
+BENCHMARK(channel_shuffle_nc_x8_multithreaded)->UseRealTime()->Apply(ShuffleNetV1G4Arguments);
+BENCHMARK(channel_shuffle_nc_x8_multithreaded)->UseRealTime()->Apply(ShuffleNetV1G8Arguments);
+BENCHMARK(channel_shuffle_nc_x8_multithreaded)->UseRealTime()->Apply(ShuffleNetV2x0_5Arguments);
+BENCHMARK(channel_shuffle_nc_x8_multithreaded)->UseRealTime()->Apply(ShuffleNetV2x1_0Arguments);
+BENCHMARK(channel_shuffle_nc_x8_multithreaded)->UseRealTime()->Apply(ShuffleNetV2x1_5Arguments);
+BENCHMARK(channel_shuffle_nc_x8_multithreaded)->UseRealTime()->Apply(ShuffleNetV2x2_0Arguments);
+
 #ifndef QNNPACK_BENCHMARK_NO_MAIN
 BENCHMARK_MAIN();
 #endif
@@ -68,17 +68,39 @@ def main(args):
             build.cc("operator-run.c"),
             # Operators
             build.cc("add.c"),
+            build.cc("argmax.c"),
             build.cc("average-pooling.c"),
+            build.cc("batch-matmul.c"),
             build.cc("channel-shuffle.c"),
             build.cc("clamp.c"),
+            build.cc("concat.c"),
             build.cc("convolution.c"),
+            build.cc("convolution1d.c"),
             build.cc("deconvolution.c"),
+            build.cc("depth-to-space.c"),
+            build.cc("dequantize.c"),
+            build.cc("elementwise-chain.c"),
+            build.cc("elu.c"),
+            build.cc("embedding-lookup.c"),
             build.cc("fully-connected.c"),
+            build.cc("gelu.c"),
             build.cc("global-average-pooling.c"),
+            build.cc("hardswish.c"),
             build.cc("leaky-relu.c"),
+            build.cc("lut.c"),
             build.cc("max-pooling.c"),
+            build.cc("normalize.c"),
+            build.cc("pad.c"),
+            build.cc("quantize.c"),
+            build.cc("reduce.c"),
+            build.cc("resize.c"),
+            build.cc("rnn-cell.c"),
             build.cc("sigmoid.c"),
             build.cc("softargmax.c"),
+            build.cc("space-to-depth.c"),
+            build.cc("tanh.c"),
+            build.cc("top-k.c"),
+            build.cc("transpose.c"),
             # Scalar micro-kernels
             build.cc("u8lut32norm/scalar.c"),
             build.cc("x8lut/scalar.c"),
@@ -93,6 +115,9 @@ def main(args):
             if build.target.is_arm or build.target.is_arm64:
                 qnnpack_objects += [
                     build.cc("q8add/neon.c"),
+                    build.cc("q8dequant/neon.c"),
+                    build.cc("q8quant/neon.c"),
+                    build.cc("q8packb/8c1-neon.c"),
                     build.cc("q8gemm/4x8-neon.c"),
                     build.cc("q8gemm/4x-sumrows-neon.c"),
                     build.cc("q8gemm/4x8c2-xzp-neon.c"),
@@ -101,6 +126,7 @@ def main(args):
                     build.cc("q8conv/4x8-neon.c"),
                     build.cc("q8conv/8x8-neon.c"),
                     build.cc("q8updw/9c8-neon.c"),
+                    build.cc("q8updw/mc8-neon.c"),
                     build.cc("q8mpdw/25c8-neon.c"),
                     build.cc("q8gavgpool/mp8x7-neon.c"),
                     build.cc("q8gavgpool/up8x7-neon.c"),
@@ -111,7 +137,10 @@ def main(args):
                     build.cc("u8maxpool/16x9p8q-neon.c"),
                     build.cc("u8maxpool/sub16-neon.c"),
                     build.cc("u8clamp/neon.c"),
+                    build.cc("u8ibilinear/c8-neon.c"),
+                    build.cc("u8argmax/neon.c"),
                     build.cc("u8rmax/neon.c"),
+                    build.cc("x8transpose/8x8-neon.c"),
                     build.cc("x8zip/x2-neon.c"),
                     build.cc("x8zip/x3-neon.c"),
                     build.cc("x8zip/x4-neon.c"),
@@ -136,11 +165,24 @@ def main(args):
                 with build.options(isa=x86.sse2):
                     qnnpack_objects += [
                         build.cc("q8add/sse2.c"),
+                        build.cc("q8dequant/sse2.c"),
+                        build.cc("q8quant/sse2.c"),
+                        build.cc("q8packb/2c4-sse2.c"),
+                        build.cc("q8packb/4c2-sse2.c"),
                         build.cc("q8gemm/2x4c8-sse2.c"),
                         build.cc("q8gemm/4x4c2-sse2.c"),
+                        build.cc("q8gemm/8x2c4-sse2.c"),
                         build.cc("q8conv/4x4c2-sse2.c"),
+                        build.cc("q8conv/8x2c4-sse2.c"),
+                        build.cc("q8dconv/4x4c2-sse2.c"),
+                        build.cc("q8dwpx/mc4-sse2.c"),
+                        build.cc("q8dwrow/3x3c8-sse2.c"),
                         build.cc("q8mpdw/25c8-sse2.c"),
                         build.cc("q8updw/9c8-sse2.c"),
+                        build.cc("q8updw/mc8-sse2.c"),
+                        build.cc("q8winograd/gemm-4x4c8-sse2.c"),
+                        build.cc("q8winograd/input-f2k3c8-sse2.c"),
+                        build.cc("q8winograd/output-f2k3c4-sse2.c"),
                         build.cc("q8gavgpool/mp8x7-sse2.c"),
                         build.cc("q8gavgpool/up8x7-sse2.c"),
                         build.cc("q8gavgpool/up8xm-sse2.c"),
@@ -150,7 +192,10 @@ def main(args):
                         build.cc("u8maxpool/16x9p8q-sse2.c"),
                         build.cc("u8maxpool/sub16-sse2.c"),
                         build.cc("u8clamp/sse2.c"),
+                        build.cc("u8ibilinear/c8-sse2.c"),
+                        build.cc("u8argmax/sse2.c"),
                         build.cc("u8rmax/sse2.c"),
+                        build.cc("x8transpose/8x8-sse2.c"),
                         build.cc("x8zip/x2-sse2.c"),
                         build.cc("x8zip/x3-sse2.c"),
                         build.cc("x8zip/x4-sse2.c"),
@@ -168,28 +213,59 @@ def main(args):
         build.unittest("q8conv-test", build.cxx("q8conv.cc"))
         build.unittest("q8updw-test", build.cxx("q8updw.cc"))
         build.unittest("q8mpdw-test", build.cxx("q8mpdw.cc"))
+        build.unittest("q8dwrow-test", build.cxx("q8dwrow.cc"))
+        build.unittest("q8dwpx-test", build.cxx("q8dwpx.cc"))
         build.unittest("q8avgpool-test", build.cxx("q8avgpool.cc"))
         build.unittest("q8gavgpool-test", build.cxx("q8gavgpool.cc"))
         build.unittest("q8uvadd-test", build.cxx("q8uvadd.cc"))
         build.unittest("u8maxpool-test", build.cxx("u8maxpool.cc"))
         build.unittest("u8clamp-test", build.cxx("u8clamp.cc"))
+        build.unittest("q8quant-test", build.cxx("q8quant.cc"))
+        build.unittest("q8packb-test", build.cxx("q8packb.cc"))
+        build.unittest("q8dequant-test", build.cxx("q8dequant.cc"))
+        build.unittest("u8ibilinear-test", build.cxx("u8ibilinear.cc"))
         build.unittest("u8rmax-test", build.cxx("u8rmax.cc"))
+        build.unittest("u8argmax-test", build.cxx("u8argmax.cc"))
         build.unittest("u8lut32norm-test", build.cxx("u8lut32norm.cc"))
         build.unittest("hgemm-test", build.cxx("hgemm.cc"))
         build.unittest("sgemm-test", build.cxx("sgemm.cc"))
         build.unittest("x8zip-test", build.cxx("x8zip.cc"))
+        build.unittest("x8transpose-test", build.cxx("x8transpose.cc"))
         build.unittest("x8lut-test", build.cxx("x8lut.cc"))
 
         build.unittest("add-test", build.cxx("add.cc"))
         build.unittest("average-pooling-test", build.cxx("average-pooling.cc"))
         build.unittest("channel-shuffle-test", build.cxx("channel-shuffle.cc"))
         build.unittest("clamp-test", build.cxx("clamp.cc"))
+        build.unittest("concat-test", build.cxx("concat.cc"))
+        build.unittest("quantize-test", build.cxx("quantize.cc"))
+        build.unittest("dequantize-test", build.cxx("dequantize.cc"))
+        build.unittest("normalize-test", build.cxx("normalize.cc"))
+        build.unittest("transpose-test", build.cxx("transpose.cc"))
+        build.unittest("depth-to-space-test", build.cxx("depth-to-space.cc"))
+        build.unittest("space-to-depth-test", build.cxx("space-to-depth.cc"))
+        build.unittest("pad-test", build.cxx("pad.cc"))
+        build.unittest("argmax-test", build.cxx("argmax.cc"))
+        build.unittest("top-k-test", build.cxx("top-k.cc"))
+        build.unittest("reduce-test", build.cxx("reduce.cc"))
+        build.unittest("batch-matmul-test", build.cxx("batch-matmul.cc"))
+        build.unittest("embedding-lookup-test", build.cxx("embedding-lookup.cc"))
+        build.unittest("rnn-cell-test", build.cxx("rnn-cell.cc"))
+        build.unittest("elementwise-chain-test", build.cxx("elementwise-chain.cc"))
+        build.unittest("hardswish-test", build.cxx("hardswish.cc"))
+        build.unittest("tanh-test", build.cxx("tanh.cc"))
+        build.unittest("gelu-test", build.cxx("gelu.cc"))
+        build.unittest("elu-test", build.cxx("elu.cc"))
+        build.unittest("lut-test", build.cxx("lut.cc"))
         build.unittest("convolution-test", build.cxx("convolution.cc"))
+        build.unittest("convolution1d-test", build.cxx("convolution1d.cc"))
+        build.unittest("convolution3d-test", build.cxx("convolution3d.cc"))
         build.unittest("deconvolution-test", build.cxx("deconvolution.cc"))
         build.unittest("fully-connected-test", build.cxx("fully-connected.cc"))
         build.unittest("global-average-pooling-test", build.cxx("global-average-pooling.cc"))
         build.unittest("leaky-relu-test", build.cxx("leaky-relu.cc"))
         build.unittest("max-pooling-test", build.cxx("max-pooling.cc"))
+        build.unittest("resize-test", build.cxx("resize.cc"))
         build.unittest("sigmoid-test", build.cxx("sigmoid.cc"))
         build.unittest("softargmax-test", build.cxx("softargmax.cc"))
         build.unittest("requantization-test", [build.cxx("requantization.cc")] + requantization_objects)
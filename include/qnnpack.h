@@ -37,6 +37,28 @@ enum qnnp_status qnnp_deinitialize(void);
 
 typedef struct qnnp_operator* qnnp_operator_t;
 
+/**
+ * Pad the sequence only on the left, so that each output depends on the current and past inputs only.
+ */
+#define QNNP_FLAG_CAUSAL_PADDING 0x00000001
+
+/**
+ * Keep the last (kernel_width - 1) * dilation_width input frames between runs, so that each run consumes only new
+ * frames and produces only new outputs. Implies causal padding.
+ */
+#define QNNP_FLAG_STREAMING 0x00000002
+
+/**
+ * Align the centers of the corner pixels of the input and output images in resize operators, rather than the corners
+ * of the images themselves.
+ */
+#define QNNP_FLAG_ALIGN_CORNERS 0x00000004
+
+/**
+ * Store the B operand of batched matrix multiplication as N x K rather than K x N, i.e. multiply by its transpose.
+ */
+#define QNNP_FLAG_TRANSPOSE_B 0x00000008
+
 enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -63,6 +85,40 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
     uint8_t output_max,
     qnnp_operator_t* convolution);
 
+/**
+ * Convolution whose input channels are permuted: channel c of the convolution input, in the order of kernel channels,
+ * is read from channel input_channel_permutation[c] of the input pixel. This absorbs a preceding channel shuffle with
+ * G groups of K channels, which corresponds to input_channel_permutation[k * G + g] = g * K + k. Permutations that keep
+ * long runs of adjacent input channels in a group are folded into the kernel; others are gathered into an internal
+ * buffer before every run, which is no slower than a standalone channel shuffle operator.
+ */
+enum qnnp_status qnnp_create_permuted_convolution2d_nhwc_q8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    const size_t* input_channel_permutation,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* convolution);
+
 enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
     qnnp_operator_t convolution,
     size_t batch_size,
@@ -74,6 +130,84 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
     size_t output_stride,
     pthreadpool_t threadpool);
 
+enum qnnp_status qnnp_create_convolution1d_nwc_q8(
+    uint32_t input_padding_left,
+    uint32_t input_padding_right,
+    uint32_t kernel_width,
+    uint32_t subsampling_width,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* convolution);
+
+enum qnnp_status qnnp_setup_convolution1d_nwc_q8(
+    qnnp_operator_t convolution,
+    size_t batch_size,
+    size_t input_width,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride,
+    pthreadpool_t threadpool);
+
+enum qnnp_status qnnp_reset_convolution1d_nwc_q8(
+    qnnp_operator_t convolution);
+
+enum qnnp_status qnnp_create_convolution3d_ndhwc_q8(
+    uint32_t input_padding_front,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_back,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_depth,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_depth,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_depth,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* convolution);
+
+enum qnnp_status qnnp_setup_convolution3d_ndhwc_q8(
+    qnnp_operator_t convolution,
+    size_t batch_size,
+    size_t input_depth,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride,
+    pthreadpool_t threadpool);
+
 enum qnnp_status qnnp_create_deconvolution2d_nhwc_q8(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -137,6 +271,33 @@ enum qnnp_status qnnp_setup_fully_connected_nc_q8(
     size_t output_stride,
     pthreadpool_t threadpool);
 
+enum qnnp_status qnnp_create_batch_matmul_q8(
+    uint8_t a_zero_point,
+    float a_scale,
+    uint8_t b_zero_point,
+    float b_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* batch_matmul);
+
+/*
+ * Multiplies batch_size pairs of dense row-major matrices: output[i] (m x n) = a[i] (m x k) times b[i] (k x n, or
+ * n x k with QNNP_FLAG_TRANSPOSE_B). Unlike the weights of fully connected operators, B is packed on every run, so
+ * both operands may be activations, e.g. queries and keys of attention heads.
+ */
+enum qnnp_status qnnp_setup_batch_matmul_q8(
+    qnnp_operator_t batch_matmul,
+    size_t batch_size,
+    size_t m,
+    size_t k,
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* output);
+
 enum qnnp_status qnnp_create_global_average_pooling_nwc_q8(
     size_t channels,
     uint8_t input_zero_point,
@@ -225,6 +386,152 @@ enum qnnp_status qnnp_setup_channel_shuffle_nc_x8(
     uint8_t* output,
     size_t output_stride);
 
+/**
+ * Maximum number of dimensions of a tensor permuted by the transpose operator.
+ */
+#define QNNP_MAX_TRANSPOSE_DIMS 6
+
+/*
+ * Permutes the dimensions of a dense row-major tensor of bytes: dimension i of the output is dimension perm[i] of the
+ * input. NHWC to NCHW conversion is perm = {0, 3, 1, 2}, and PyTorch pixel shuffle with block size b is perm =
+ * {0, 1, 4, 2, 5, 3} applied to the NHWC input viewed with shape {N, H, W, C, b, b}.
+ */
+enum qnnp_status qnnp_create_transpose_nd_x8(
+    qnnp_operator_t* transpose);
+
+enum qnnp_status qnnp_setup_transpose_nd_x8(
+    qnnp_operator_t transpose,
+    size_t num_dims,
+    const size_t* shape,
+    const size_t* perm,
+    const void* input,
+    void* output);
+
+/*
+ * Depth-to-space in TensorFlow (DCR) channel order: output pixel (y * block_size + by, x * block_size + bx) takes the
+ * output_channels channels starting at (by * block_size + bx) * output_channels in input pixel (y, x).
+ */
+enum qnnp_status qnnp_create_depth_to_space_nhwc_x8(
+    size_t output_channels,
+    uint32_t block_size,
+    qnnp_operator_t* depth_to_space);
+
+enum qnnp_status qnnp_setup_depth_to_space_nhwc_x8(
+    qnnp_operator_t depth_to_space,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    size_t input_pixel_stride,
+    void* output,
+    size_t output_pixel_stride);
+
+/*
+ * Space-to-depth, the inverse of depth-to-space: input height and width must be multiples of block_size.
+ */
+enum qnnp_status qnnp_create_space_to_depth_nhwc_x8(
+    size_t input_channels,
+    uint32_t block_size,
+    qnnp_operator_t* space_to_depth);
+
+enum qnnp_status qnnp_setup_space_to_depth_nhwc_x8(
+    qnnp_operator_t space_to_depth,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    size_t input_pixel_stride,
+    void* output,
+    size_t output_pixel_stride);
+
+/**
+ * @brief Values of the border pixels produced by the pad operator.
+ */
+enum qnnp_padding_mode {
+  /** Border pixels take a constant value in all channels. */
+  qnnp_padding_mode_constant = 0,
+  /** Border pixels mirror the input across its edge pixels, excluding the edge pixels themselves. */
+  qnnp_padding_mode_reflect = 1,
+  /** Border pixels replicate the nearest edge pixel of the input. */
+  qnnp_padding_mode_edge = 2,
+};
+
+enum qnnp_status qnnp_create_pad_nhwc_x8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    size_t channels,
+    enum qnnp_padding_mode padding_mode,
+    uint8_t padding_value,
+    qnnp_operator_t* pad);
+
+/*
+ * If the input is the interior of the output, i.e. input == output + (input_padding_top * output_width +
+ * input_padding_left) * output_pixel_stride with input_pixel_stride == output_pixel_stride, the operator only fills
+ * the border pixels. A producer writes there directly after qnnp_set_output_row_stride.
+ */
+enum qnnp_status qnnp_setup_pad_nhwc_x8(
+    qnnp_operator_t pad,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    size_t input_pixel_stride,
+    void* output,
+    size_t output_pixel_stride);
+
+/*
+ * Overrides the distances, in elements, between output rows and between output images of a set up NHWC operator,
+ * which are otherwise output_width * output_pixel_stride and output_height times that. This lets the operator write
+ * into the interior of a larger buffer, such as the output of a subsequent pad operator. Supported by 2D convolution,
+ * max pooling, average pooling and pad operators; stays in effect until the next setup call.
+ */
+enum qnnp_status qnnp_set_output_row_stride(
+    qnnp_operator_t op,
+    size_t output_row_stride,
+    size_t output_image_stride);
+
+enum qnnp_status qnnp_create_resize_bilinear2d_nhwc_q8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* resize);
+
+enum qnnp_status qnnp_setup_resize_bilinear2d_nhwc_q8(
+    qnnp_operator_t resize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool);
+
+/**
+ * Nearest-neighbor resize: every output pixel copies the input pixel that contains its center in half-pixel
+ * coordinates, or with QNNP_FLAG_ALIGN_CORNERS the input pixel nearest to its corner-aligned position.
+ */
+enum qnnp_status qnnp_create_resize_nearest2d_nhwc_q8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* resize);
+
+enum qnnp_status qnnp_setup_resize_nearest2d_nhwc_q8(
+    qnnp_operator_t resize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool);
+
 enum qnnp_status qnnp_create_add_nc_q8(
     size_t channels,
     uint8_t a_zero_point,
@@ -247,6 +554,32 @@ enum qnnp_status qnnp_setup_add_nc_q8(
     uint8_t* sum,
     size_t sum_stride);
 
+/*
+ * Concatenation of inputs along the channel dimension.
+ *
+ * Input #i occupies channels [offset_i, offset_i + input_channels[i]) of the output, where offset_i is the sum of
+ * channel counts of the preceding inputs. An input quantized with the output zero point and scale may be produced
+ * in place: a producer operator set up with output pointer output + offset_i and output stride equal to the
+ * concatenation output stride writes directly into its slice, and such inputs are neither copied nor requantized.
+ * Other inputs are copied or requantized into the output.
+ */
+enum qnnp_status qnnp_create_concat_nc_q8(
+    size_t inputs,
+    const size_t* input_channels,
+    const uint8_t* input_zero_points,
+    const float* input_scales,
+    uint8_t output_zero_point,
+    float output_scale,
+    qnnp_operator_t* concat);
+
+enum qnnp_status qnnp_setup_concat_nc_q8(
+    qnnp_operator_t concat,
+    size_t batch_size,
+    const uint8_t** inputs,
+    const size_t* input_strides,
+    uint8_t* output,
+    size_t output_stride);
+
 enum qnnp_status qnnp_create_clamp_nc_u8(
     size_t channels,
     uint8_t output_min,
@@ -261,6 +594,78 @@ enum qnnp_status qnnp_setup_clamp_nc_u8(
     uint8_t* output,
     size_t output_stride);
 
+enum qnnp_status qnnp_create_quantize_nc_f32_q8(
+    size_t channels,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* quantize);
+
+enum qnnp_status qnnp_setup_quantize_nc_f32_q8(
+    qnnp_operator_t quantize,
+    size_t batch_size,
+    const float* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride);
+
+enum qnnp_status qnnp_create_dequantize_nc_q8_f32(
+    size_t channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    qnnp_operator_t* dequantize);
+
+enum qnnp_status qnnp_setup_dequantize_nc_q8_f32(
+    qnnp_operator_t dequantize,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    float* output,
+    size_t output_stride);
+
+/*
+ * Input preprocessing: converts planar NCHW images into NHWC quantized tensors, normalizing channel c as
+ * (x - mean[c]) / stddev[c] before quantization with output zero point and scale.
+ */
+enum qnnp_status qnnp_create_normalize_nchw_f32_nhwc_q8(
+    size_t channels,
+    const float* mean,
+    const float* stddev,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* normalize);
+
+enum qnnp_status qnnp_setup_normalize_nchw_f32_nhwc_q8(
+    qnnp_operator_t normalize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    uint8_t* output,
+    size_t output_pixel_stride);
+
+enum qnnp_status qnnp_create_normalize_nchw_u8_nhwc_q8(
+    size_t channels,
+    const float* mean,
+    const float* stddev,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* normalize);
+
+enum qnnp_status qnnp_setup_normalize_nchw_u8_nhwc_q8(
+    qnnp_operator_t normalize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    uint8_t* output,
+    size_t output_pixel_stride);
+
 enum qnnp_status qnnp_create_sigmoid_nc_q8(
     size_t channels,
     uint8_t input_zero_point,
@@ -298,6 +703,97 @@ enum qnnp_status qnnp_setup_leaky_relu_nc_q8(
     uint8_t* output,
     size_t output_stride);
 
+enum qnnp_status qnnp_create_hardswish_nc_q8(
+    size_t channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* hardswish);
+
+enum qnnp_status qnnp_setup_hardswish_nc_q8(
+    qnnp_operator_t hardswish,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride);
+
+enum qnnp_status qnnp_create_tanh_nc_q8(
+    size_t channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* tanh_op);
+
+enum qnnp_status qnnp_setup_tanh_nc_q8(
+    qnnp_operator_t tanh_op,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride);
+
+/* GELU in its exact form, x * Phi(x), rather than the tanh approximation */
+enum qnnp_status qnnp_create_gelu_nc_q8(
+    size_t channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* gelu);
+
+enum qnnp_status qnnp_setup_gelu_nc_q8(
+    qnnp_operator_t gelu,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride);
+
+enum qnnp_status qnnp_create_elu_nc_q8(
+    size_t channels,
+    float alpha,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* elu);
+
+enum qnnp_status qnnp_setup_elu_nc_q8(
+    qnnp_operator_t elu,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride);
+
+/*
+ * Lookup table operator maps every 8-bit input to table[input], and covers any activation function which the
+ * caller tabulates for its own quantization parameters. The 256-entry table is copied on creation.
+ */
+enum qnnp_status qnnp_create_lut_nc_x8(
+    size_t channels,
+    const uint8_t* table,
+    qnnp_operator_t* lut);
+
+enum qnnp_status qnnp_setup_lut_nc_x8(
+    qnnp_operator_t lut,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride);
+
 enum qnnp_status qnnp_create_softargmax_nc_q8(
     size_t channels,
     float input_scale,
@@ -313,6 +809,190 @@ enum qnnp_status qnnp_setup_softargmax_nc_q8(
     uint8_t* output,
     size_t output_stride);
 
+/*
+ * Arg-max over the channels of every batch element: output[i] is the index of the largest channel of input row i,
+ * or of the first such channel if several share the largest value.
+ */
+enum qnnp_status qnnp_create_argmax_nc_u8(
+    size_t channels,
+    qnnp_operator_t* argmax);
+
+enum qnnp_status qnnp_setup_argmax_nc_u8(
+    qnnp_operator_t argmax,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint32_t* output);
+
+/*
+ * Top-k over the channels of every batch element: writes the indices, and optionally the values, of the k largest
+ * channels in decreasing order of value, with channels of equal value in increasing order of index.
+ */
+enum qnnp_status qnnp_create_top_k_nc_u8(
+    size_t channels,
+    size_t k,
+    qnnp_operator_t* top_k);
+
+enum qnnp_status qnnp_setup_top_k_nc_u8(
+    qnnp_operator_t top_k,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output_values,
+    uint32_t* output_indices,
+    size_t output_stride);
+
+/**
+ * Maximum number of dimensions of a tensor reduced by the reduce operator.
+ */
+#define QNNP_MAX_REDUCE_DIMS 4
+
+/**
+ * @brief Function applied to the reduced elements by the reduce operator.
+ */
+enum qnnp_reduce_operation {
+  qnnp_reduce_operation_sum = 0,
+  qnnp_reduce_operation_mean = 1,
+  qnnp_reduce_operation_max = 2,
+  qnnp_reduce_operation_min = 3,
+};
+
+enum qnnp_status qnnp_create_reduce_nd_q8(
+    enum qnnp_reduce_operation operation,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* reduce);
+
+/*
+ * Reduces a dense row-major tensor over the listed axes. The output is dense too, with the shape of the input less
+ * the reduced dimensions (or, equivalently, with the reduced dimensions kept with size 1).
+ */
+enum qnnp_status qnnp_setup_reduce_nd_q8(
+    qnnp_operator_t reduce,
+    size_t num_dims,
+    const size_t* shape,
+    size_t num_axes,
+    const size_t* axes,
+    const uint8_t* input,
+    uint8_t* output);
+
+/*
+ * Embedding bag: output row b pools, with the sum or the mean, the table rows listed in indices[offsets[b]] up to,
+ * but excluding, indices[offsets[b + 1]]; offsets has num_bags + 1 entries. Without offsets every index forms a bag
+ * of its own, which gathers the table rows. Only sum and mean operations are supported.
+ */
+enum qnnp_status qnnp_create_embedding_lookup_q8(
+    size_t embedding_dim,
+    enum qnnp_reduce_operation pooling,
+    uint8_t table_zero_point,
+    float table_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* embedding_lookup);
+
+enum qnnp_status qnnp_setup_embedding_lookup_q8(
+    qnnp_operator_t embedding_lookup,
+    size_t num_embeddings,
+    const uint8_t* table,
+    size_t table_stride,
+    size_t num_indices,
+    const uint32_t* indices,
+    size_t num_bags,
+    const uint32_t* offsets,
+    uint8_t* output,
+    size_t output_stride);
+
+/* Recurrent cell operators requantize gate pre-activations to this scale, with zero point 128, before activations */
+#define QNNP_RNN_GATE_SCALE 0.0625f
+
+/*
+ * LSTM cell: pre-activations of the i, f, g, and o gates, in this order, are computed as W_x x + b_x + W_h h + b_h,
+ * with input weights W_x of [4 * hidden_size][input_size] shape and recurrent weights W_h of
+ * [4 * hidden_size][hidden_size] shape. Biases have input_scale * kernel_scale scale and zero zero point. The cell
+ * computes c' = sigmoid(f) * c + sigmoid(i) * tanh(g) and h' = sigmoid(o) * tanh(c'). The hidden state shares the
+ * quantization of the input, so that h' may be fed back as h, and the cell state has its own quantization.
+ */
+enum qnnp_status qnnp_create_lstm_cell_q8(
+    size_t input_size,
+    size_t hidden_size,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* input_weights,
+    const uint8_t* recurrent_weights,
+    const int32_t* input_bias,
+    const int32_t* recurrent_bias,
+    uint8_t cell_zero_point,
+    float cell_scale,
+    qnnp_operator_t* lstm_cell);
+
+/* Hidden and cell state outputs may alias hidden and cell state inputs */
+enum qnnp_status qnnp_setup_lstm_cell_q8(
+    qnnp_operator_t lstm_cell,
+    size_t batch_size,
+    const uint8_t* input,
+    const uint8_t* hidden,
+    const uint8_t* cell,
+    uint8_t* hidden_output,
+    uint8_t* cell_output);
+
+/*
+ * GRU cell: weights and biases of the r, z, and n gates, in this order, have the layout of LSTM cell weights and
+ * biases with 3 gates. The cell computes r = sigmoid(W_xr x + b_xr + W_hr h + b_hr), z likewise,
+ * n = tanh(W_xn x + b_xn + r * (W_hn h + b_hn)), and h' = (1 - z) * n + z * h.
+ */
+enum qnnp_status qnnp_create_gru_cell_q8(
+    size_t input_size,
+    size_t hidden_size,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* input_weights,
+    const uint8_t* recurrent_weights,
+    const int32_t* input_bias,
+    const int32_t* recurrent_bias,
+    qnnp_operator_t* gru_cell);
+
+/* Hidden state output may alias hidden state input */
+enum qnnp_status qnnp_setup_gru_cell_q8(
+    qnnp_operator_t gru_cell,
+    size_t batch_size,
+    const uint8_t* input,
+    const uint8_t* hidden,
+    uint8_t* hidden_output);
+
+/*
+ * Fuses a chain of elementwise operators, applied one after another, into one operator which makes a single pass over
+ * memory. The first operator may be an add operator, and all others must be clamp operators or lookup table based
+ * operators, such as sigmoid or leaky ReLU, with the same number of channels. The output quantization of every
+ * operator must match the input quantization of the next one. Successive unary operators are composed into a single
+ * lookup table, and clamps are folded into table bounds or into the output range of the add. The chained operators
+ * are not referenced after this call.
+ */
+enum qnnp_status qnnp_create_elementwise_chain_nc_q8(
+    size_t num_operators,
+    const qnnp_operator_t* operators,
+    qnnp_operator_t* elementwise_chain);
+
+/* Second input is the B operand of a leading add operator, and must be NULL if the chain has none */
+enum qnnp_status qnnp_setup_elementwise_chain_nc_q8(
+    qnnp_operator_t elementwise_chain,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    const uint8_t* input2,
+    size_t input2_stride,
+    uint8_t* output,
+    size_t output_stride);
+
 enum qnnp_status qnnp_run_operator(
     qnnp_operator_t op,
     pthreadpool_t threadpool);
@@ -11,6 +11,9 @@ include $(CLEAR_VARS)
 LOCAL_MODULE := qnnpack_aarch32_neon_ukernels
 LOCAL_SRC_FILES += \
 	src/q8add/neon.c \
+	src/q8dequant/neon.c \
+	src/q8quant/neon.c \
+	src/q8packb/8c1-neon.c \
 	src/q8gavgpool/mp8x7-neon.c \
 	src/q8gavgpool/up8x7-neon.c \
 	src/q8gavgpool/up8xm-neon.c \
@@ -22,13 +25,17 @@ LOCAL_SRC_FILES += \
 	src/q8gemm/4x8c2-xzp-aarch32-neon.S \
 	src/q8gemm/4x-sumrows-neon.c \
 	src/q8updw/9c8-aarch32-neon.S \
+	src/q8updw/mc8-neon.c \
 	src/q8mpdw/25c8-neon.c \
 	src/u8maxpool/sub16-neon.c \
 	src/u8maxpool/16x9p8q-neon.c \
 	src/u8clamp/neon.c \
+	src/u8ibilinear/c8-neon.c \
+	src/u8argmax/neon.c \
 	src/u8rmax/neon.c \
 	src/u8lut32norm/scalar.c \
 	src/x8lut/scalar.c \
+	src/x8transpose/8x8-neon.c \
 	src/x8zip/x2-neon.c \
 	src/x8zip/x3-neon.c \
 	src/x8zip/x4-neon.c \
@@ -44,6 +51,9 @@ include $(CLEAR_VARS)
 LOCAL_MODULE := qnnpack_aarch64_neon_ukernels
 LOCAL_SRC_FILES += \
 	src/q8add/neon.c \
+	src/q8dequant/neon.c \
+	src/q8quant/neon.c \
+	src/q8packb/8c1-neon.c \
 	src/q8gavgpool/mp8x7-neon.c \
 	src/q8gavgpool/up8x7-neon.c \
 	src/q8gavgpool/up8xm-neon.c \
@@ -53,13 +63,17 @@ LOCAL_SRC_FILES += \
 	src/q8conv/8x8-aarch64-neon.S \
 	src/q8gemm/8x8-aarch64-neon.S \
 	src/q8updw/9c8-neon.c \
+	src/q8updw/mc8-neon.c \
 	src/q8mpdw/25c8-neon.c \
 	src/u8maxpool/sub16-neon.c \
 	src/u8maxpool/16x9p8q-neon.c \
 	src/u8clamp/neon.c \
+	src/u8ibilinear/c8-neon.c \
+	src/u8argmax/neon.c \
 	src/u8rmax/neon.c \
 	src/u8lut32norm/scalar.c \
 	src/x8lut/scalar.c \
+	src/x8transpose/8x8-neon.c \
 	src/x8zip/x2-neon.c \
 	src/x8zip/x3-neon.c \
 	src/x8zip/x4-neon.c \
@@ -75,6 +89,10 @@ include $(CLEAR_VARS)
 LOCAL_MODULE := qnnpack_sse2_ukernels
 LOCAL_SRC_FILES += \
 	src/q8add/sse2.c \
+	src/q8dequant/sse2.c \
+	src/q8quant/sse2.c \
+	src/q8packb/2c4-sse2.c \
+	src/q8packb/4c2-sse2.c \
 	src/q8gavgpool/mp8x7-sse2.c \
 	src/q8gavgpool/up8x7-sse2.c \
 	src/q8gavgpool/up8xm-sse2.c \
@@ -82,15 +100,27 @@ LOCAL_SRC_FILES += \
 	src/q8avgpool/up8x9-sse2.c \
 	src/q8avgpool/up8xm-sse2.c \
 	src/q8conv/4x4c2-sse2.c \
+	src/q8conv/8x2c4-sse2.c \
 	src/q8gemm/4x4c2-sse2.c \
+	src/q8gemm/8x2c4-sse2.c \
+	src/q8dconv/4x4c2-sse2.c \
+	src/q8dwpx/mc4-sse2.c \
+	src/q8dwrow/3x3c8-sse2.c \
 	src/q8mpdw/25c8-sse2.c \
 	src/q8updw/9c8-sse2.c \
+	src/q8updw/mc8-sse2.c \
+	src/q8winograd/gemm-4x4c8-sse2.c \
+	src/q8winograd/input-f2k3c8-sse2.c \
+	src/q8winograd/output-f2k3c4-sse2.c \
 	src/u8maxpool/sub16-sse2.c \
 	src/u8maxpool/16x9p8q-sse2.c \
 	src/u8clamp/sse2.c \
+	src/u8ibilinear/c8-sse2.c \
+	src/u8argmax/sse2.c \
 	src/u8rmax/sse2.c \
 	src/u8lut32norm/scalar.c \
 	src/x8lut/scalar.c \
+	src/x8transpose/8x8-sse2.c \
 	src/x8zip/x2-sse2.c \
 	src/x8zip/x3-sse2.c \
 	src/x8zip/x4-sse2.c \
@@ -105,17 +135,39 @@ include $(CLEAR_VARS)
 LOCAL_MODULE = qnnpack_operators
 LOCAL_SRC_FILES := \
 	src/add.c \
+	src/argmax.c \
 	src/average-pooling.c \
+	src/batch-matmul.c \
 	src/channel-shuffle.c \
 	src/clamp.c \
+	src/concat.c \
 	src/convolution.c \
+	src/convolution1d.c \
 	src/deconvolution.c \
+	src/depth-to-space.c \
+	src/dequantize.c \
+	src/elementwise-chain.c \
+	src/elu.c \
+	src/embedding-lookup.c \
 	src/fully-connected.c \
+	src/gelu.c \
 	src/global-average-pooling.c \
+	src/hardswish.c \
 	src/leaky-relu.c \
+	src/lut.c \
 	src/max-pooling.c \
+	src/normalize.c \
+	src/pad.c \
+	src/quantize.c \
+	src/reduce.c \
+	src/resize.c \
+	src/rnn-cell.c \
 	src/sigmoid.c \
 	src/softargmax.c \
+	src/space-to-depth.c \
+	src/tanh.c \
+	src/top-k.c \
+	src/transpose.c \
 	src/operator-run.c
 LOCAL_C_INCLUDES := $(LOCAL_PATH)/include $(LOCAL_PATH)/src
 LOCAL_CFLAGS := -std=c99 -Wall -O2
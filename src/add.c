@@ -99,6 +99,8 @@ enum qnnp_status qnnp_create_add_nc_q8(
   }
 
   add_op->channels = channels;
+  add_op->output_min = sum_min;
+  add_op->output_max = sum_max;
   add_op->add_quantization_params =
     qnnp_compute_add_quantization_params(
       a_zero_point, b_zero_point, sum_zero_point,
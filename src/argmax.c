@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/math.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_argmax_nc_u8(
+    size_t channels,
+    qnnp_operator_t* argmax_out)
+{
+  qnnp_operator_t argmax_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_argmax_nc_u8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create ArgMax operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  if (channels > UINT32_MAX) {
+    qnnp_log_error(
+      "failed to create ArgMax operator with %zu channels: number of channels must not exceed %" PRIu32,
+      channels, UINT32_MAX);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  argmax_op = calloc(1, sizeof(struct qnnp_operator));
+  if (argmax_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  argmax_op->channels = channels;
+
+  argmax_op->ukernel_type = qnnp_ukernel_type_argmax;
+  argmax_op->format = qnnp_format_quint8;
+
+  *argmax_out = argmax_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(argmax_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_argmax_nc_u8(
+    qnnp_operator_t argmax,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint32_t* output)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_argmax_nc_u8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup ArgMax operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_stride < argmax->channels) {
+    qnnp_log_error(
+      "failed to setup ArgMax operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      input_stride, argmax->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  /* Long rows are split into blocks, and the maximum of every block is kept in the workspace until reduction */
+  const size_t blocks = divide_round_up(argmax->channels, QNNP_SELECTION_BLOCK_CHANNELS);
+  if (blocks > 1) {
+    const size_t workspace_size = batch_size * blocks * sizeof(uint64_t);
+    void* workspace = realloc(argmax->workspace, workspace_size);
+    if (workspace == NULL) {
+      qnnp_log_error("failed to allocate %zu bytes for ArgMax workspace", workspace_size);
+      return qnnp_status_out_of_memory;
+    }
+    argmax->workspace = workspace;
+  }
+
+  argmax->batch_size = batch_size;
+  argmax->input = input;
+  argmax->input_pixel_stride = input_stride;
+  argmax->output = output;
+
+  return qnnp_status_success;
+}
@@ -231,6 +231,8 @@ enum qnnp_status qnnp_setup_average_pooling2d_nhwc_q8(
       average_pooling->stride_width);
   average_pooling->output = output;
   average_pooling->output_pixel_stride = output_pixel_stride;
+  average_pooling->output_row_stride = average_pooling->output_width * output_pixel_stride;
+  average_pooling->output_image_stride = average_pooling->output_height * average_pooling->output_row_stride;
 
   size_t valid_batch_size = 0;
   if (input == average_pooling->last_input &&
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_batch_matmul_q8(
+    uint8_t a_zero_point,
+    float a_scale,
+    uint8_t b_zero_point,
+    float b_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* batch_matmul_out)
+{
+  qnnp_operator_t batch_matmul = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_batch_matmul_q8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (a_scale <= 0.0f || !isnormal(a_scale)) {
+    qnnp_log_error(
+      "failed to create batch matrix multiplication operator with %.7g A scale: scale must be finite and positive",
+      a_scale);
+    goto error;
+  }
+
+  if (b_scale <= 0.0f || !isnormal(b_scale)) {
+    qnnp_log_error(
+      "failed to create batch matrix multiplication operator with %.7g B scale: scale must be finite and positive",
+      b_scale);
+    goto error;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    qnnp_log_error(
+      "failed to create batch matrix multiplication operator with %.7g output scale: "
+      "scale must be finite and positive",
+      output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    qnnp_log_error(
+      "failed to create batch matrix multiplication operator with [%" PRIu8 ", %" PRIu8 "] output range: "
+      "range min must be below range max",
+      output_min, output_max);
+    goto error;
+  }
+
+  if ((flags & ~QNNP_FLAG_TRANSPOSE_B) != 0) {
+    qnnp_log_error(
+      "failed to create batch matrix multiplication operator with 0x%08" PRIx32 " flags: "
+      "only QNNP_FLAG_TRANSPOSE_B is supported",
+      flags);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  const float requantization_scale = a_scale * b_scale / output_scale;
+  if (requantization_scale >= 1.0f) {
+    qnnp_log_error(
+      "failed to create batch matrix multiplication operator with %.7g A scale, %.7g B scale, and %.7g output scale: "
+      "requantization scale %.7g is greater or equal to 1.0",
+      a_scale, b_scale, output_scale, requantization_scale);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  batch_matmul = calloc(1, sizeof(struct qnnp_operator));
+  if (batch_matmul == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  batch_matmul->input_zero_point = a_zero_point;
+  batch_matmul->kernel_zero_point = b_zero_point;
+
+  batch_matmul->conv_quantization_params =
+    qnnp_compute_conv_quantization_params(
+      a_zero_point, b_zero_point,
+      requantization_scale, output_zero_point, output_min, output_max);
+
+  batch_matmul->ukernel_type = qnnp_ukernel_type_batch_matmul;
+  batch_matmul->format = qnnp_format_quint8;
+  batch_matmul->flags = flags;
+
+  *batch_matmul_out = batch_matmul;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(batch_matmul);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_batch_matmul_q8(
+    qnnp_operator_t batch_matmul,
+    size_t batch_size,
+    size_t m,
+    size_t k,
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* output)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_batch_matmul_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error(
+      "failed to setup batch matrix multiplication operator with batch size %zu: batch size must be non-zero",
+      batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (m == 0 || k == 0 || n == 0) {
+    qnnp_log_error(
+      "failed to setup batch matrix multiplication operator with %zux%zu by %zux%zu matrices: "
+      "matrix dimensions must be non-zero",
+      m, k, k, n);
+    return qnnp_status_invalid_parameter;
+  }
+
+  const struct q8conv_parameters* q8conv_params = &qnnp_params.q8conv;
+  if (n <= qnnp_params.q8conv_narrow.nr) {
+    q8conv_params = &qnnp_params.q8conv_narrow;
+  }
+  batch_matmul->q8conv_params = q8conv_params;
+
+  /* B operands are packed for the GEMM micro-kernels into the workspace on every run */
+  const uint32_t nr = q8conv_params->nr;
+  const uint32_t kr = q8conv_params->kr;
+  const size_t n_stride = (n + (nr - 1)) & -nr;
+  const size_t k_stride = (k + (kr - 1)) & -kr;
+  const size_t workspace_size = batch_size * n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t));
+  void* workspace = realloc(batch_matmul->workspace, workspace_size);
+  if (workspace == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for packed B operands", workspace_size);
+    return qnnp_status_out_of_memory;
+  }
+  batch_matmul->workspace = workspace;
+
+  batch_matmul->batch_size = batch_size;
+  batch_matmul->output_height = m;
+  batch_matmul->group_input_channels = k;
+  batch_matmul->group_output_channels = n;
+  batch_matmul->input = a;
+  batch_matmul->input2 = b;
+  batch_matmul->output = output;
+
+  return qnnp_status_success;
+}
@@ -55,6 +55,8 @@ enum qnnp_status qnnp_create_clamp_nc_u8(
   }
 
   clamp_op->channels = channels;
+  clamp_op->output_min = output_min;
+  clamp_op->output_max = output_max;
   clamp_op->u8_clamping_params = qnnp_compute_u8_clamping_params(output_min, output_max);
 
   clamp_op->ukernel_type = qnnp_ukernel_type_clamp;
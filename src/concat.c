@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_concat_nc_q8(
+    size_t inputs,
+    const size_t* input_channels,
+    const uint8_t* input_zero_points,
+    const float* input_scales,
+    uint8_t output_zero_point,
+    float output_scale,
+    qnnp_operator_t* concat_out)
+{
+  qnnp_operator_t concat_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_concat_nc_q8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (inputs == 0) {
+    qnnp_log_error(
+      "failed to create concatenation operator with %zu inputs: number of inputs must be non-zero", inputs);
+    goto error;
+  }
+
+  for (size_t i = 0; i < inputs; i++) {
+    if (input_channels[i] == 0) {
+      qnnp_log_error(
+        "failed to create concatenation operator with %zu channels in input #%zu: number of channels must be non-zero",
+        input_channels[i], i);
+      goto error;
+    }
+
+    if (input_scales[i] <= 0.0f || !isnormal(input_scales[i])) {
+      qnnp_log_error(
+        "failed to create concatenation operator with %.7g scale in input #%zu: scale must be finite and positive",
+        input_scales[i], i);
+      goto error;
+    }
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    qnnp_log_error(
+      "failed to create concatenation operator with %.7g output scale: scale must be finite and positive", output_scale);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  for (size_t i = 0; i < inputs; i++) {
+    const float input_output_scale = input_scales[i] / output_scale;
+    if (input_output_scale < 0x1.0p-13f || input_output_scale >= 0x1.0p+8f) {
+      qnnp_log_error(
+        "failed to create concatenation operator with %.7g input-to-output scale ratio in input #%zu: "
+        "scale ratio must be in [2**-13, 2**8) range",
+        input_output_scale, i);
+      goto error;
+    }
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  concat_op = calloc(1, sizeof(struct qnnp_operator));
+  if (concat_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  const size_t concat_inputs_size = inputs * sizeof(struct qnnp_concat_input);
+  concat_op->concat_inputs = calloc(1, concat_inputs_size);
+  if (concat_op->concat_inputs == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for concatenation input descriptors", concat_inputs_size);
+    goto error;
+  }
+
+  size_t channels = 0;
+  for (size_t i = 0; i < inputs; i++) {
+    struct qnnp_concat_input* concat_input = &concat_op->concat_inputs[i];
+    concat_input->channels = input_channels[i];
+    concat_input->channel_offset = channels;
+    channels += input_channels[i];
+
+    /*
+     * Inputs quantized like the output are copied verbatim. Other inputs are requantized with the add micro-kernel
+     * applied to two copies of the same input, each scaled by half of the input-to-output scale ratio.
+     */
+    concat_input->requantize = input_zero_points[i] != output_zero_point || input_scales[i] != output_scale;
+    if (concat_input->requantize) {
+      const float half_input_output_scale = 0.5f * (input_scales[i] / output_scale);
+      concat_input->add_quantization_params =
+        qnnp_compute_add_quantization_params(
+          input_zero_points[i], input_zero_points[i], output_zero_point,
+          half_input_output_scale, half_input_output_scale,
+          0, UINT8_MAX);
+    }
+  }
+
+  concat_op->inputs = inputs;
+  concat_op->channels = channels;
+
+  concat_op->ukernel_type = qnnp_ukernel_type_concat;
+  concat_op->format = qnnp_format_quint8;
+
+  *concat_out = concat_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(concat_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_concat_nc_q8(
+    qnnp_operator_t concat_op,
+    size_t batch_size,
+    const uint8_t** inputs,
+    const size_t* input_strides,
+    uint8_t* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_concat_nc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup concatenation operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_stride < concat_op->channels) {
+    qnnp_log_error(
+      "failed to setup concatenation operator with output stride %zu: stride must be at least the number of output channels (%zu)",
+      output_stride, concat_op->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < concat_op->inputs; i++) {
+    struct qnnp_concat_input* concat_input = &concat_op->concat_inputs[i];
+    if (input_strides[i] < concat_input->channels) {
+      qnnp_log_error(
+        "failed to setup concatenation operator with stride %zu in input #%zu: "
+        "stride must be at least the number of input channels (%zu)",
+        input_strides[i], i, concat_input->channels);
+      return qnnp_status_invalid_parameter;
+    }
+
+    concat_input->input = inputs[i];
+    concat_input->input_pixel_stride = input_strides[i];
+    /* Producers which wrote directly into the output slice of this input leave nothing to do */
+    concat_input->bound = !concat_input->requantize &&
+      inputs[i] == output + concat_input->channel_offset && input_strides[i] == output_stride;
+  }
+
+  concat_op->batch_size = batch_size;
+  concat_op->output = output;
+  concat_op->output_pixel_stride = output_stride;
+
+  return qnnp_status_success;
+}
@@ -35,20 +35,289 @@ static inline size_t compute_output_dimension(
   return (padded_input_dimension - effective_kernel_dimension) / subsampling_dimension + 1;
 }
 
-enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
+/* Range [begin, end) of output positions whose kernel window lies entirely inside the unpadded input */
+static inline void compute_interior_output_range(
+    size_t padding_dimension,
+    size_t input_dimension,
+    size_t kernel_dimension,
+    size_t dilation_dimension,
+    size_t subsampling_dimension,
+    size_t output_dimension,
+    size_t* begin,
+    size_t* end)
+{
+  const size_t effective_kernel_dimension = (kernel_dimension - 1) * dilation_dimension + 1;
+  *begin = min(divide_round_up(padding_dimension, subsampling_dimension), output_dimension);
+  *end = *begin;
+  if (padding_dimension + input_dimension >= effective_kernel_dimension) {
+    *end = max(*begin, min(output_dimension,
+      (padding_dimension + input_dimension - effective_kernel_dimension) / subsampling_dimension + 1));
+  }
+}
+
+/*
+ * F(2x2, 3x3) Winograd output is computed as 4x the exact convolution sum in 32-bit wrap-around arithmetic, so it
+ * is exact only if 4x the largest possible convolution sum fits into a signed 32-bit integer.
+ */
+static bool winograd_f2k3_is_exact(
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    uint8_t kernel_zero_point,
+    const uint8_t* kernel)
+{
+  const uint32_t max_input = max(input_zero_point, UINT8_MAX - input_zero_point);
+  uint32_t max_kernel = 0;
+  for (size_t i = 0; i < group_output_channels * 9 * group_input_channels; i++) {
+    const uint32_t abs_kernel = kernel[i] >= kernel_zero_point ?
+      (uint32_t) (kernel[i] - kernel_zero_point) : (uint32_t) (kernel_zero_point - kernel[i]);
+    max_kernel = max(max_kernel, abs_kernel);
+  }
+  return UINT64_C(36) * (uint64_t) group_input_channels * (uint64_t) (max_input * max_kernel) <
+    UINT64_C(0x80000000);
+}
+
+/* Layers with few output channels would waste most of the default nr-wide tile */
+static const struct q8conv_parameters* select_q8conv_parameters(size_t group_output_channels) {
+  if (group_output_channels <= qnnp_params.q8conv_narrow.nr) {
+    return &qnnp_params.q8conv_narrow;
+  }
+  return &qnnp_params.q8conv;
+}
+
+/*
+ * Tiny groups are merged into block-diagonal super-groups when that saves micro-kernel work. Every group pads its
+ * input channels to the kr-element reduction step and its output channels to the nr-wide tile of the micro-kernel
+ * selected for it; merged groups share this padding, but also compute the off-diagonal blocks. Ties go to larger
+ * super-groups, which need fewer micro-kernel calls.
+ */
+static uint32_t compute_merged_groups(
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels)
+{
+  uint32_t merged_groups = 1;
+  size_t merged_cost = SIZE_MAX;
+  for (uint32_t m = 1; m <= groups; m++) {
+    if (groups % m != 0) {
+      continue;
+    }
+    const struct q8conv_parameters* q8conv_params = select_q8conv_parameters(m * group_output_channels);
+    const size_t cost = (groups / m) *
+      round_up(m * group_output_channels, q8conv_params->nr) * round_up(m * group_input_channels, q8conv_params->kr);
+    if (cost <= merged_cost) {
+      merged_groups = m;
+      merged_cost = cost;
+    }
+  }
+  return merged_groups;
+}
+
+/*
+ * Input channels of a group that are adjacent in the input pixel form runs. Runs are read through their own
+ * indirection pointers as extra kernel taps of window_channels channels each: a window starts at its run, or ends at
+ * the last channel of the pixel if the run is too close to it, and the kernel holds the zero point for the window
+ * channels outside the run. Runs longer than a window are split, and groups with fewer windows than others are padded
+ * with all-zero taps. The window length is chosen to minimize the number of taps while padding the reduction over
+ * input channels by at most an eighth. If no window length does, the permutation is not folded: input_channel_runs is
+ * set to zero, and the input is gathered in convolution channel order before every run instead.
+ */
+static enum qnnp_status permute_input_channels(
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t kernel_size,
+    uint32_t kr,
+    bool fold,
+    const uint8_t* kernel,
+    uint8_t kernel_zero_point,
+    const size_t* input_channel_permutation,
+    size_t* input_channel_runs_out,
+    size_t* window_channels_out,
+    size_t** input_channel_offsets_out,
+    uint8_t** permuted_kernel_out)
+{
+  const size_t channels = groups * group_input_channels;
+  size_t* inverse_permutation = malloc(sizeof(size_t) * channels);
+  size_t* group_windows = calloc(groups, sizeof(size_t));
+  if (inverse_permutation == NULL || group_windows == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for inverse input channel permutation", sizeof(size_t) * channels);
+    free(inverse_permutation);
+    free(group_windows);
+    return qnnp_status_out_of_memory;
+  }
+  for (size_t channel = 0; channel < channels; channel++) {
+    inverse_permutation[channel] = SIZE_MAX;
+  }
+  for (size_t channel = 0; channel < channels; channel++) {
+    const size_t input_channel = input_channel_permutation[channel];
+    if (input_channel >= channels || inverse_permutation[input_channel] != SIZE_MAX) {
+      qnnp_log_error(
+        "failed to create convolution with %zu input channel permutation entry %zu: "
+        "entries must be a permutation of input channels",
+        channel, input_channel);
+      free(inverse_permutation);
+      free(group_windows);
+      return qnnp_status_invalid_parameter;
+    }
+    inverse_permutation[input_channel] = channel;
+  }
+
+  size_t input_channel_runs = 0;
+  size_t window_channels = 0;
+  if (fold) {
+    size_t max_run_channels = 0;
+    for (size_t run_start = 0; run_start < channels; ) {
+      const size_t group = inverse_permutation[run_start] / group_input_channels;
+      size_t run_end = run_start + 1;
+      while (run_end < channels && inverse_permutation[run_end] / group_input_channels == group) {
+        run_end++;
+      }
+      max_run_channels = max(max_run_channels, run_end - run_start);
+      run_start = run_end;
+    }
+
+    const size_t max_cost = round_up(group_input_channels, kr) + group_input_channels / 8;
+    const size_t max_window_channels = min(round_up(max_run_channels, kr), channels);
+    for (size_t window = kr; window <= max_window_channels; window += kr) {
+      memset(group_windows, 0, sizeof(size_t) * groups);
+      size_t windows = 0;
+      for (size_t run_start = 0; run_start < channels; ) {
+        const size_t group = inverse_permutation[run_start] / group_input_channels;
+        size_t run_end = run_start + 1;
+        while (run_end < channels && inverse_permutation[run_end] / group_input_channels == group) {
+          run_end++;
+        }
+        group_windows[group] += divide_round_up(run_end - run_start, window);
+        windows = max(windows, group_windows[group]);
+        run_start = run_end;
+      }
+      if (windows * window <= max_cost && (input_channel_runs == 0 || windows <= input_channel_runs)) {
+        input_channel_runs = windows;
+        window_channels = window;
+      }
+    }
+  }
+  if (input_channel_runs == 0) {
+    free(inverse_permutation);
+    free(group_windows);
+    *input_channel_runs_out = 0;
+    *window_channels_out = group_input_channels;
+    *input_channel_offsets_out = NULL;
+    *permuted_kernel_out = NULL;
+    return qnnp_status_success;
+  }
+
+  const size_t group_windows_size = groups * input_channel_runs;
+  size_t* input_channel_offsets = malloc(sizeof(size_t) * group_windows_size);
+  size_t* window_run_starts = calloc(group_windows_size, sizeof(size_t));
+  size_t* window_run_ends = calloc(group_windows_size, sizeof(size_t));
+  const size_t permuted_kernel_size =
+    sizeof(uint8_t) * groups * group_output_channels * kernel_size * input_channel_runs * window_channels;
+  uint8_t* permuted_kernel = malloc(permuted_kernel_size);
+  if (input_channel_offsets == NULL || window_run_starts == NULL || window_run_ends == NULL || permuted_kernel == NULL) {
+    qnnp_log_error("failed to allocate permuted convolution kernel for %zu input channels", channels);
+    free(input_channel_offsets);
+    free(window_run_starts);
+    free(window_run_ends);
+    free(permuted_kernel);
+    free(group_windows);
+    free(inverse_permutation);
+    return qnnp_status_out_of_memory;
+  }
+
+  /* Runs never cross a group boundary, so each window is assigned to the group of its first channel */
+  memset(group_windows, 0, sizeof(size_t) * groups);
+  for (size_t run_start = 0; run_start < channels; ) {
+    const size_t group = inverse_permutation[run_start] / group_input_channels;
+    size_t run_end = run_start + 1;
+    while (run_end < channels && inverse_permutation[run_end] / group_input_channels == group) {
+      run_end++;
+    }
+    for (size_t window_start = run_start; window_start < run_end; window_start += window_channels) {
+      const size_t window = group * input_channel_runs + group_windows[group]++;
+      input_channel_offsets[window] = min(window_start, channels - window_channels);
+      window_run_starts[window] = window_start;
+      window_run_ends[window] = min(window_start + window_channels, run_end);
+    }
+    run_start = run_end;
+  }
+  for (uint32_t group = 0; group < groups; group++) {
+    for (size_t window = group_windows[group]; window < input_channel_runs; window++) {
+      input_channel_offsets[group * input_channel_runs + window] = input_channel_offsets[group * input_channel_runs];
+    }
+  }
+
+  memset(permuted_kernel, kernel_zero_point, permuted_kernel_size);
+  for (uint32_t group = 0; group < groups; group++) {
+    for (size_t output_channel = 0; output_channel < group_output_channels; output_channel++) {
+      for (size_t kernel_index = 0; kernel_index < kernel_size; kernel_index++) {
+        const size_t row = (group * group_output_channels + output_channel) * kernel_size + kernel_index;
+        for (size_t run = 0; run < input_channel_runs; run++) {
+          const size_t window = group * input_channel_runs + run;
+          const size_t window_offset = input_channel_offsets[window];
+          for (size_t input_channel = window_run_starts[window]; input_channel < window_run_ends[window]; input_channel++) {
+            const size_t group_input_channel = inverse_permutation[input_channel] - group * group_input_channels;
+            permuted_kernel[(row * input_channel_runs + run) * window_channels + input_channel - window_offset] =
+              kernel[row * group_input_channels + group_input_channel];
+          }
+        }
+      }
+    }
+  }
+
+  free(window_run_starts);
+  free(window_run_ends);
+  free(group_windows);
+  free(inverse_permutation);
+  *input_channel_runs_out = input_channel_runs;
+  *window_channels_out = window_channels;
+  *input_channel_offsets_out = input_channel_offsets;
+  *permuted_kernel_out = permuted_kernel;
+  return qnnp_status_success;
+}
+
+/* Returns the number of groups if the permutation is a channel shuffle, which the zip micro-kernels gather, or zero */
+static size_t detect_channel_shuffle(size_t channels, const size_t* input_channel_permutation)
+{
+  for (size_t groups = 2; groups <= channels; groups++) {
+    if (channels % groups != 0) {
+      continue;
+    }
+    const size_t group_channels = channels / groups;
+    bool shuffle = true;
+    for (size_t channel = 0; channel < group_channels && shuffle; channel++) {
+      for (size_t group = 0; group < groups; group++) {
+        shuffle &= input_channel_permutation[channel * groups + group] == group * group_channels + channel;
+      }
+    }
+    if (shuffle) {
+      return groups;
+    }
+  }
+  return 0;
+}
+
+static enum qnnp_status create_convolution_ndhwc_q8(
+    uint32_t input_padding_front,
     uint32_t input_padding_top,
     uint32_t input_padding_right,
+    uint32_t input_padding_back,
     uint32_t input_padding_bottom,
     uint32_t input_padding_left,
+    uint32_t kernel_depth,
     uint32_t kernel_height,
     uint32_t kernel_width,
+    uint32_t subsampling_depth,
     uint32_t subsampling_height,
     uint32_t subsampling_width,
+    uint32_t dilation_depth,
     uint32_t dilation_height,
     uint32_t dilation_width,
     uint32_t groups,
     size_t group_input_channels,
     size_t group_output_channels,
+    const size_t* input_channel_permutation,
     uint8_t input_zero_point,
     float input_scale,
     uint8_t kernel_zero_point,
@@ -62,14 +331,30 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
     qnnp_operator_t* convolution_out)
 {
   qnnp_operator_t convolution = NULL;
-  enum qnnp_status status = qnnp_status_uninitialized;
+  uint8_t* merged_kernel = NULL;
+  uint8_t* permuted_kernel = NULL;
+  enum qnnp_status status = qnnp_status_invalid_parameter;
 
-  if (!qnnp_params.initialized) {
-    qnnp_log_error("qnnp_create_convolution2d_nhwc_q8 failed because QNNPACK is not properly initialized");
+  if (kernel_depth == 0) {
+    qnnp_log_error(
+      "failed to create convolution with %" PRIu32 " kernel depth: kernel dimensions must be non-zero",
+      kernel_depth);
     goto error;
   }
 
-  status = qnnp_status_invalid_parameter;
+  if (subsampling_depth == 0) {
+    qnnp_log_error(
+      "failed to create convolution with %" PRIu32 " depth subsampling: subsampling dimensions must be non-zero",
+      subsampling_depth);
+    goto error;
+  }
+
+  if (dilation_depth == 0) {
+    qnnp_log_error(
+      "failed to create convolution with %" PRIu32 " depth dilation: dilation dimensions must be non-zero",
+      dilation_depth);
+    goto error;
+  }
 
   if (kernel_width == 0 || kernel_height == 0) {
     qnnp_log_error(
@@ -173,24 +458,140 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
     goto error;
   }
 
-  const size_t kernel_size = kernel_height * kernel_width;
+  if (input_channel_permutation != NULL) {
+    bool identity = true;
+    for (size_t channel = 0; channel < groups * group_input_channels; channel++) {
+      identity &= input_channel_permutation[channel] == channel;
+    }
+    if (identity) {
+      input_channel_permutation = NULL;
+    }
+  }
+
+  const size_t kernel_size = kernel_depth * kernel_height * kernel_width;
+  /* Depthwise kernels see the (depth, height) taps of a kernel column as a single taller column */
+  const uint32_t column_height = kernel_depth * kernel_height;
 
   enum qnnp_ukernel_type ukernel_type = qnnp_ukernel_type_none;
-  const bool any_padding = (input_padding_left | input_padding_top | input_padding_right | input_padding_bottom) != 0;
-  if ((kernel_size == 9 || kernel_size == 25) && group_input_channels == 1 && group_output_channels == 1 && groups > 1) {
+  const bool any_padding = (input_padding_front | input_padding_left | input_padding_top |
+    input_padding_back | input_padding_right | input_padding_bottom) != 0;
+  const bool volumetric = kernel_depth != 1 || subsampling_depth != 1 ||
+    (input_padding_front | input_padding_back) != 0;
+  if (group_input_channels == 1 && group_output_channels == 1 && groups > 1) {
     ukernel_type = qnnp_ukernel_type_dwconv;
+  } else if (volumetric) {
+    ukernel_type = qnnp_ukernel_type_conv;
   } else if (kernel_size == 1 && subsampling_height == 1 && subsampling_width == 1 && !any_padding) {
     ukernel_type = group_input_channels >= qnnp_params.q8conv_xzp.kthreshold ?
       qnnp_ukernel_type_xzp_gemm : qnnp_ukernel_type_gemm;
+  } else if (kernel_height == 3 && kernel_width == 3 && subsampling_height == 1 && subsampling_width == 1 &&
+      dilation_height == 1 && dilation_width == 1 && groups == 1 &&
+      group_input_channels >= qnnp_params.q8winograd.cthreshold &&
+      group_output_channels >= qnnp_params.q8winograd.cthreshold &&
+      winograd_f2k3_is_exact(group_input_channels, group_output_channels, input_zero_point, kernel_zero_point, kernel))
+  {
+    ukernel_type = qnnp_ukernel_type_winograd;
+  } else if (groups == 1 && group_input_channels < 8 && kernel_width * group_input_channels >= 8 && dilation_width == 1) {
+    /*
+     * Few input channels: treat each kernel row as a single tap over kernel_width contiguous pixels, so that the
+     * micro-kernel reduces over kernel_width * group_input_channels elements without per-pixel padding.
+     */
+    ukernel_type = qnnp_ukernel_type_row_conv;
   } else {
     ukernel_type = qnnp_ukernel_type_conv;
   }
+
+  size_t input_channel_runs = 1;
+  if (input_channel_permutation != NULL) {
+    /* Depthwise micro-kernels read whole pixels, so permuted depthwise input is always gathered */
+    size_t window_channels = group_input_channels;
+    status = permute_input_channels(
+      groups, group_input_channels, group_output_channels, kernel_size,
+      select_q8conv_parameters(group_output_channels)->kr, ukernel_type != qnnp_ukernel_type_dwconv,
+      kernel, kernel_zero_point, input_channel_permutation,
+      &input_channel_runs, &window_channels, &convolution->input_channel_offsets, &permuted_kernel);
+    if (status != qnnp_status_success) {
+      goto error;
+    }
+    status = qnnp_status_out_of_memory;
+    if (input_channel_runs != 0) {
+      /* Runs of permuted input channels are read through the indirection buffer, which only the generic path uses */
+      ukernel_type = qnnp_ukernel_type_conv;
+      kernel = permuted_kernel;
+      group_input_channels = window_channels;
+    } else {
+      const size_t channels = groups * group_input_channels;
+      convolution->input_channel_permutation = malloc(sizeof(size_t) * channels);
+      if (convolution->input_channel_permutation == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for input channel permutation", sizeof(size_t) * channels);
+        goto error;
+      }
+      memcpy(convolution->input_channel_permutation, input_channel_permutation, sizeof(size_t) * channels);
+      convolution->input_shuffle_groups = detect_channel_shuffle(channels, input_channel_permutation);
+      convolution->channels = channels;
+      input_channel_runs = 1;
+    }
+  }
+
+  if ((ukernel_type == qnnp_ukernel_type_conv || ukernel_type == qnnp_ukernel_type_gemm) && groups > 1 &&
+      convolution->input_channel_offsets == NULL)
+  {
+    const uint32_t merged_groups = compute_merged_groups(groups, group_input_channels, group_output_channels);
+    if (merged_groups > 1) {
+      const size_t merged_group_input_channels = merged_groups * group_input_channels;
+      const size_t merged_kernel_size =
+        sizeof(uint8_t) * groups * group_output_channels * kernel_size * merged_group_input_channels;
+      merged_kernel = malloc(merged_kernel_size);
+      if (merged_kernel == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for merged group kernel", merged_kernel_size);
+        goto error;
+      }
+      /* Off-diagonal blocks hold the kernel zero point and contribute nothing to the accumulators */
+      memset(merged_kernel, kernel_zero_point, merged_kernel_size);
+      for (uint32_t group = 0; group < groups; group++) {
+        const size_t merged_channel_offset = (group % merged_groups) * group_input_channels;
+        for (size_t output_channel = 0; output_channel < group_output_channels; output_channel++) {
+          for (size_t kernel_index = 0; kernel_index < kernel_size; kernel_index++) {
+            const size_t row = (group * group_output_channels + output_channel) * kernel_size + kernel_index;
+            memcpy(
+              merged_kernel + row * merged_group_input_channels + merged_channel_offset,
+              kernel + row * group_input_channels,
+              group_input_channels);
+          }
+        }
+      }
+      kernel = merged_kernel;
+      groups /= merged_groups;
+      group_input_channels = merged_group_input_channels;
+      group_output_channels *= merged_groups;
+    }
+  }
+
+  const struct q8conv_parameters* q8conv_params = select_q8conv_parameters(group_output_channels);
+  convolution->q8conv_params = q8conv_params;
+  if (ukernel_type == qnnp_ukernel_type_conv && !volumetric && convolution->input_channel_offsets == NULL &&
+      q8conv_params->dconv != NULL)
+  {
+    /* Interior output pixels address their input windows arithmetically, only border tiles use indirection */
+    ukernel_type = qnnp_ukernel_type_direct_conv;
+  }
   size_t zero_size = 0, zero_offset = 0;
 
   switch (ukernel_type) {
     case qnnp_ukernel_type_dwconv:
     {
-      const uint32_t cr = qnnp_params.q8dw9.cr;
+      /* Few channels leave most lanes of a channel block empty, so they share a vector among several output pixels */
+      const bool is_narrow = groups <= qnnp_params.q8dwpx.cr;
+      /* The 25-tap micro-kernel walks a 5x5 window in fixed column passes, so other 25-tap shapes use the generic one */
+      const bool is_5x5 = !is_narrow && column_height == 5 && kernel_width == 5;
+      uint32_t cr = qnnp_params.q8dwm.cr;
+      if (is_narrow) {
+        cr = qnnp_params.q8dwpx.vr;
+      } else if (kernel_size == 9) {
+        cr = qnnp_params.q8dw9.cr;
+      } else if (is_5x5) {
+        cr = qnnp_params.q8dw25.cr;
+      }
       const uint32_t c_stride = (groups + (cr - 1)) & -cr;
       convolution->group_stride = c_stride;
       const size_t packed_weights_size = (sizeof(uint8_t) * kernel_size + sizeof(int32_t)) * c_stride;
@@ -200,34 +601,37 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
         goto error;
       }
 
-      switch (kernel_size) {
-        case 9:
-          pack_q8dw_w(
-            kernel_height, kernel_width,
-            groups, cr,
-            input_zero_point, kernel_zero_point,
-            kernel, bias, convolution->packed_weights);
-          break;
-        case 25:
-          /* change this later */
-          pack_q8dw_w_dilation(
-            kernel_height, kernel_width,
-            groups, cr,
-            0, kernel_height, 0, 2,
-            kernel, bias, convolution->packed_weights, true);
-          pack_q8dw_w_dilation(
-            kernel_height, kernel_width,
-            groups, cr,
-            0, kernel_height, 2, 4,
-            kernel, bias, convolution->packed_weights + (10 + sizeof(int32_t) / sizeof(uint8_t)) * c_stride, false);
-          pack_q8dw_w_dilation(
-            kernel_height, kernel_width,
-            groups, cr,
-            0, kernel_height, 4, 5,
-            kernel, bias, convolution->packed_weights + (20 + sizeof(int32_t) / sizeof(uint8_t)) * c_stride, false);
-          break;
-        default:
-          QNNP_UNREACHABLE;
+      if (is_narrow) {
+        /* Channels rounded up to a power of 2, as the micro-kernel assigns lanes */
+        const size_t pixel_lanes = groups > 2 ? 4 : groups;
+        pack_q8dwpx_w(
+          column_height, kernel_width,
+          groups, pixel_lanes, cr,
+          input_zero_point, kernel_zero_point,
+          kernel, bias, convolution->packed_weights);
+      } else if (is_5x5) {
+        /* change this later */
+        pack_q8dw_w_dilation(
+          column_height, kernel_width,
+          groups, cr,
+          0, column_height, 0, 2,
+          kernel, bias, convolution->packed_weights, true);
+        pack_q8dw_w_dilation(
+          column_height, kernel_width,
+          groups, cr,
+          0, column_height, 2, 4,
+          kernel, bias, convolution->packed_weights + (10 + sizeof(int32_t) / sizeof(uint8_t)) * c_stride, false);
+        pack_q8dw_w_dilation(
+          column_height, kernel_width,
+          groups, cr,
+          0, column_height, 4, 5,
+          kernel, bias, convolution->packed_weights + (20 + sizeof(int32_t) / sizeof(uint8_t)) * c_stride, false);
+      } else {
+        pack_q8dw_w(
+          column_height, kernel_width,
+          groups, cr,
+          input_zero_point, kernel_zero_point,
+          kernel, bias, convolution->packed_weights);
       }
 
       if (groups >= 8) {
@@ -268,16 +672,73 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
       }
       break;
     }
+    case qnnp_ukernel_type_winograd:
+    {
+      const uint32_t nr = qnnp_params.q8winograd.nr;
+      const uint32_t kr = qnnp_params.q8winograd.kr;
+      const uint32_t kc = qnnp_params.q8winograd.kc;
+      const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+      const size_t k_stride = (group_input_channels + (kc - 1)) & -kc;
+
+      const size_t packed_weights_size = sizeof(int32_t) * n_stride + sizeof(int16_t) * 16 * n_stride * k_stride;
+      convolution->packed_weights = malloc(packed_weights_size);
+      if (convolution->packed_weights == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
+        goto error;
+      }
+      /* The transformed GEMM reduces over zero-padded channels */
+      memset(convolution->packed_weights, 0, packed_weights_size);
+
+      pack_q8winograd_f2k3_w(
+          group_output_channels, group_input_channels,
+          nr, kr, k_stride,
+          kernel_zero_point,
+          kernel, bias, convolution->packed_weights);
+
+      zero_size = sizeof(uint8_t) * group_input_channels;
+      zero_offset = 0;
+      break;
+    }
+    case qnnp_ukernel_type_row_conv:
+    {
+      const uint32_t nr = q8conv_params->nr;
+      const uint32_t kr = q8conv_params->kr;
+      const size_t row_channels = kernel_width * group_input_channels;
+      const uint32_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+      const uint32_t k_stride = (row_channels + (kr - 1)) & -kr;
+
+      const size_t packed_weights_size = (sizeof(uint8_t) * kernel_height * k_stride + sizeof(int32_t)) * n_stride;
+      convolution->packed_weights = malloc(packed_weights_size);
+      if (convolution->packed_weights == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
+        goto error;
+      }
+      memset(convolution->packed_weights, kernel_zero_point, packed_weights_size);
+
+      pack_q8conv_w(
+          group_output_channels, kernel_height, row_channels,
+          nr, kr,
+          input_zero_point, kernel_zero_point,
+          kernel, bias,
+          convolution->packed_weights);
+
+      zero_size = sizeof(uint8_t) * k_stride;
+      zero_offset = 0;
+      break;
+    }
     case qnnp_ukernel_type_gemm:
     case qnnp_ukernel_type_conv:
+    case qnnp_ukernel_type_direct_conv:
     {
-      const uint32_t nr = qnnp_params.q8conv.nr;
-      const uint32_t kr = qnnp_params.q8conv.kr;
+      const uint32_t nr = q8conv_params->nr;
+      const uint32_t kr = q8conv_params->kr;
       const uint32_t n_stride = (group_output_channels + (nr - 1)) & -nr;
       const uint32_t k_stride = (group_input_channels + (kr - 1)) & -kr;
+      /* Every run of permuted input channels is packed as a separate kernel tap */
+      const size_t packed_kernel_size = kernel_size * input_channel_runs;
 
       const size_t packed_group_weights_size =
-        (sizeof(uint8_t) * kernel_size * k_stride + sizeof(int32_t)) * n_stride;
+        (sizeof(uint8_t) * packed_kernel_size * k_stride + sizeof(int32_t)) * n_stride;
       convolution->packed_weights = malloc(packed_group_weights_size * groups);
       if (convolution->packed_weights == NULL) {
         qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_group_weights_size * groups);
@@ -285,6 +746,14 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
       }
       memset(convolution->packed_weights, kernel_zero_point, packed_group_weights_size * groups);
 
+      /*
+       * Small groups are tiled jointly: a task computes a block of output pixels for several consecutive groups,
+       * which share the cache lines of their input and output pixels, instead of streaming the whole input per group.
+       */
+      if (ukernel_type != qnnp_ukernel_type_direct_conv) {
+        convolution->group_tile = (uint32_t) min(groups, max(1, QNNP_GROUP_TILE_WEIGHTS_SIZE / packed_group_weights_size));
+      }
+
       switch (ukernel_type) {
         case qnnp_ukernel_type_gemm:
           for (uint32_t group = 0; group < groups; group++) {
@@ -298,12 +767,13 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
           }
           break;
         case qnnp_ukernel_type_conv:
+        case qnnp_ukernel_type_direct_conv:
           for (uint32_t group = 0; group < groups; group++) {
             pack_q8conv_w(
-                group_output_channels, kernel_size, group_input_channels,
+                group_output_channels, packed_kernel_size, group_input_channels,
                 nr, kr,
                 input_zero_point, kernel_zero_point,
-                kernel + group * group_output_channels * kernel_size * group_input_channels,
+                kernel + group * group_output_channels * packed_kernel_size * group_input_channels,
                 bias + group * group_output_channels,
                 (void*) ((uintptr_t) convolution->packed_weights + group * packed_group_weights_size));
           }
@@ -325,7 +795,8 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
       QNNP_UNREACHABLE;
   }
 
-  if (any_padding) {
+  /* Winograd tiles may extend past the output image even without padding */
+  if (any_padding || ukernel_type == qnnp_ukernel_type_winograd) {
     void* zero_buffer = malloc(zero_size);
     if (zero_buffer == NULL) {
       qnnp_log_error("failed to allocate %zu bytes for zero padding", zero_size);
@@ -336,21 +807,33 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
     convolution->zero_pointer = (void*) ((uintptr_t) zero_buffer + zero_offset);
   }
 
+  free(merged_kernel);
+  merged_kernel = NULL;
+  free(permuted_kernel);
+  permuted_kernel = NULL;
+
+  convolution->input_padding_front = input_padding_front;
   convolution->input_padding_top = input_padding_top;
   convolution->input_padding_right = input_padding_right;
+  convolution->input_padding_back = input_padding_back;
   convolution->input_padding_bottom = input_padding_bottom;
   convolution->input_padding_left = input_padding_left;
 
+  convolution->kernel_depth = kernel_depth;
   convolution->kernel_height = kernel_height;
   convolution->kernel_width = kernel_width;
+  convolution->stride_depth = subsampling_depth;
   convolution->stride_height = subsampling_height;
   convolution->stride_width = subsampling_width;
+  convolution->dilation_depth = dilation_depth;
   convolution->dilation_height = dilation_height;
   convolution->dilation_width = dilation_width;
   convolution->groups = groups;
   convolution->group_input_channels = group_input_channels;
   convolution->group_output_channels = group_output_channels;
+  convolution->input_channel_runs = input_channel_runs;
 
+  convolution->input_zero_point = input_zero_point;
   convolution->kernel_zero_point = kernel_zero_point;
 
   if (ukernel_type == qnnp_ukernel_type_xzp_gemm) {
@@ -371,45 +854,212 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
   return qnnp_status_success;
 
 error:
+  free(merged_kernel);
+  free(permuted_kernel);
   qnnp_delete_operator(convolution);
   return status;
 }
 
-enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
+enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* convolution_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_convolution2d_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_convolution_ndhwc_q8(
+    0, input_padding_top, input_padding_right, 0, input_padding_bottom, input_padding_left,
+    1, kernel_height, kernel_width,
+    1, subsampling_height, subsampling_width,
+    1, dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels, NULL,
+    input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale,
+    kernel, bias,
+    output_zero_point, output_scale, output_min, output_max,
+    convolution_out);
+}
+
+enum qnnp_status qnnp_create_permuted_convolution2d_nhwc_q8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    const size_t* input_channel_permutation,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* convolution_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_permuted_convolution2d_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_convolution_ndhwc_q8(
+    0, input_padding_top, input_padding_right, 0, input_padding_bottom, input_padding_left,
+    1, kernel_height, kernel_width,
+    1, subsampling_height, subsampling_width,
+    1, dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels, input_channel_permutation,
+    input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale,
+    kernel, bias,
+    output_zero_point, output_scale, output_min, output_max,
+    convolution_out);
+}
+
+enum qnnp_status qnnp_create_convolution3d_ndhwc_q8(
+    uint32_t input_padding_front,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_back,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_depth,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_depth,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_depth,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* convolution_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_convolution3d_ndhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_convolution_ndhwc_q8(
+    input_padding_front, input_padding_top, input_padding_right,
+    input_padding_back, input_padding_bottom, input_padding_left,
+    kernel_depth, kernel_height, kernel_width,
+    subsampling_depth, subsampling_height, subsampling_width,
+    dilation_depth, dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels, NULL,
+    input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale,
+    kernel, bias,
+    output_zero_point, output_scale, output_min, output_max,
+    convolution_out);
+}
+
+static enum qnnp_status setup_convolution_ndhwc_q8(
     qnnp_operator_t convolution,
     size_t batch_size,
+    size_t input_depth,
     size_t input_height,
     size_t input_width,
     const uint8_t* input,
     size_t input_pixel_stride,
     uint8_t* output,
-    size_t output_pixel_stride,
-    pthreadpool_t threadpool)
+    size_t output_pixel_stride)
 {
-  if (!qnnp_params.initialized) {
-    qnnp_log_error("qnnp_setup_convolution2d_nhwc_q8 failed because QNNPACK is not properly initialized");
-    return qnnp_status_uninitialized;
-  }
-
   if (batch_size == 0) {
     qnnp_log_error("failed to setup convolution with batch size %zu: batch size must be non-zero", batch_size);
     return qnnp_status_invalid_parameter;
   }
 
-  if (input_width == 0 || input_height == 0) {
+  if (input_width == 0 || input_height == 0 || input_depth == 0) {
     qnnp_log_error(
-      "failed to setup convolution with %zux%zu input: input dimensions must be non-zero",
+      "failed to setup convolution with %zux%zux%zu input: input dimensions must be non-zero",
       input_width,
-      input_height);
+      input_height,
+      input_depth);
     return qnnp_status_invalid_parameter;
   }
 
+  if (convolution->kernel_depth == 1 && convolution->stride_depth == 1 &&
+      (convolution->input_padding_front | convolution->input_padding_back) == 0)
+  {
+    /* Without a depth window every output frame depends on one input frame only, and frames fold into the batch */
+    batch_size *= input_depth;
+    input_depth = 1;
+  }
+
+  if (convolution->input_channel_permutation != NULL) {
+    /* The operator reads the gathered pixels, which are staged after the 8 bytes micro-kernels may read before them */
+    const size_t channels = convolution->channels;
+    const size_t permuted_input_size = sizeof(uint8_t) * (8 + batch_size * input_depth * input_height * input_width * channels);
+    void* permuted_input = realloc(convolution->permuted_input, permuted_input_size);
+    if (permuted_input == NULL) {
+      qnnp_log_error("failed to allocate %zu bytes for permuted input", permuted_input_size);
+      return qnnp_status_out_of_memory;
+    }
+    convolution->permuted_input = permuted_input;
+    convolution->permuted_input_source = input;
+    convolution->permuted_input_source_stride = input_pixel_stride;
+    input = (const uint8_t*) permuted_input + 8;
+    input_pixel_stride = channels;
+  }
+
   convolution->batch_size = batch_size;
+  convolution->input_depth = input_depth;
   convolution->input_height = input_height;
   convolution->input_width = input_width;
   convolution->input = input;
   convolution->input_pixel_stride = input_pixel_stride;
 
+  convolution->output_depth = compute_output_dimension(
+      convolution->input_padding_front + input_depth + convolution->input_padding_back,
+      convolution->kernel_depth,
+      convolution->dilation_depth,
+      convolution->stride_depth);
   convolution->output_height = compute_output_dimension(
       convolution->input_padding_top + input_height + convolution->input_padding_bottom,
       convolution->kernel_height,
@@ -422,6 +1072,8 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
       convolution->stride_width);
   convolution->output = output;
   convolution->output_pixel_stride = output_pixel_stride;
+  convolution->output_row_stride = convolution->output_width * output_pixel_stride;
+  convolution->output_image_stride = convolution->output_depth * convolution->output_height * convolution->output_row_stride;
 
   switch (convolution->ukernel_type) {
     case qnnp_ukernel_type_gemm:
@@ -442,13 +1094,16 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
     case qnnp_ukernel_type_conv:
     {
       const size_t groups = convolution->groups;
+      const size_t kernel_depth = convolution->kernel_depth;
       const size_t kernel_height = convolution->kernel_height;
       const size_t kernel_width = convolution->kernel_width;
-      const size_t kernel_size = kernel_height * kernel_width;
+      /* Runs of permuted input channels are read as consecutive taps of each kernel position */
+      const size_t input_channel_runs = convolution->input_channel_offsets != NULL ? convolution->input_channel_runs : 1;
+      const size_t kernel_size = kernel_depth * kernel_height * kernel_width * input_channel_runs;
       const size_t output_height = convolution->output_height;
       const size_t output_width = convolution->output_width;
-      const size_t output_size = output_height * output_width;
-      const size_t output_tile_size = qnnp_params.q8conv.mr;
+      const size_t output_size = convolution->output_depth * output_height * output_width;
+      const size_t output_tile_size = convolution->q8conv_params->mr;
       const size_t tiled_output_size = round_up(output_size, output_tile_size);
       const size_t indirection_buffer_size = sizeof(void*) * batch_size * groups * tiled_output_size * kernel_size;
 
@@ -461,6 +1116,7 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
 
       const void* zero = convolution->zero_pointer;
       const struct fxdiv_divisor_size_t output_width_divisor = fxdiv_init_size_t(output_width);
+      const struct fxdiv_divisor_size_t output_height_divisor = fxdiv_init_size_t(output_height);
       for (size_t group = 0; group < groups; group++) {
         for (size_t image = 0; image < batch_size; image++) {
           for (size_t output_tile_start = 0; output_tile_start < tiled_output_size; output_tile_start += output_tile_size) {
@@ -469,30 +1125,38 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
               const size_t output_index = min(tiled_output_index, output_size - 1);
               const struct fxdiv_result_size_t output_index_components =
                 fxdiv_divide_size_t(output_index, output_width_divisor);
-              const size_t output_y = output_index_components.quotient;
+              const struct fxdiv_result_size_t output_row_components =
+                fxdiv_divide_size_t(output_index_components.quotient, output_height_divisor);
+              const size_t output_z = output_row_components.quotient;
+              const size_t output_y = output_row_components.remainder;
               const size_t output_x = output_index_components.remainder;
-              for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
-                const size_t input_y =
-                  output_y * convolution->stride_height + kernel_y * convolution->dilation_height - convolution->input_padding_top;
-                if (input_y < input_height) {
+              for (size_t kernel_z = 0; kernel_z < kernel_depth; kernel_z++) {
+                const size_t input_z =
+                  output_z * convolution->stride_depth + kernel_z * convolution->dilation_depth - convolution->input_padding_front;
+                for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+                  const size_t input_y =
+                    output_y * convolution->stride_height + kernel_y * convolution->dilation_height - convolution->input_padding_top;
+                  const bool valid_row = input_z < input_depth && input_y < input_height;
                   for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
                     const size_t input_x =
                       output_x * convolution->stride_width + kernel_x * convolution->dilation_width - convolution->input_padding_left;
-                    const size_t index =
-                      (group * batch_size + image) * tiled_output_size * kernel_size + output_tile_start * kernel_size + (kernel_y * kernel_width + kernel_x) * output_tile_size + output_tile_offset;
-                    if (input_x < input_width) {
-                      indirection_buffer[index] =
-                        input + ((image * input_height + input_y) * input_width + input_x) * input_pixel_stride + group * convolution->group_input_channels;
-                    } else {
-                      indirection_buffer[index] = zero;
+                    for (size_t run = 0; run < input_channel_runs; run++) {
+                      const size_t index =
+                        (group * batch_size + image) * tiled_output_size * kernel_size + output_tile_start * kernel_size +
+                        (((kernel_z * kernel_height + kernel_y) * kernel_width + kernel_x) * input_channel_runs + run) * output_tile_size +
+                        output_tile_offset;
+                      if (valid_row && input_x < input_width) {
+                        const size_t input_channel_offset = convolution->input_channel_offsets != NULL ?
+                          convolution->input_channel_offsets[group * input_channel_runs + run] :
+                          group * convolution->group_input_channels;
+                        indirection_buffer[index] =
+                          input + (((image * input_depth + input_z) * input_height + input_y) * input_width + input_x) * input_pixel_stride +
+                          input_channel_offset;
+                      } else {
+                        indirection_buffer[index] = zero;
+                      }
                     }
                   }
-                } else {
-                  for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
-                    const size_t index =
-                      (group * batch_size + image) * tiled_output_size * kernel_size + output_tile_start * kernel_size + (kernel_y * kernel_width + kernel_x) * output_tile_size + output_tile_offset;
-                    indirection_buffer[index] = zero;
-                  }
                 }
               }
             }
@@ -501,7 +1165,7 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
       }
       return qnnp_status_success;
     }
-    case qnnp_ukernel_type_dwconv:
+    case qnnp_ukernel_type_direct_conv:
     {
       const size_t groups = convolution->groups;
       const size_t kernel_height = convolution->kernel_height;
@@ -509,9 +1173,224 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
       const size_t kernel_size = kernel_height * kernel_width;
       const size_t output_height = convolution->output_height;
       const size_t output_width = convolution->output_width;
+      const size_t output_tile_size = convolution->q8conv_params->mr;
+
+      size_t output_y_begin, output_y_end, output_x_begin, output_x_end;
+      compute_interior_output_range(
+        convolution->input_padding_top, input_height, kernel_height,
+        convolution->dilation_height, convolution->stride_height, output_height,
+        &output_y_begin, &output_y_end);
+      compute_interior_output_range(
+        convolution->input_padding_left, input_width, kernel_width,
+        convolution->dilation_width, convolution->stride_width, output_width,
+        &output_x_begin, &output_x_end);
+      if (output_y_begin == output_y_end || output_x_begin == output_x_end) {
+        output_y_begin = output_y_end = 0;
+        output_x_begin = output_x_end = 0;
+      }
+      convolution->interior_output_y_begin = output_y_begin;
+      convolution->interior_output_y_end = output_y_end;
+      convolution->interior_output_x_begin = output_x_begin;
+      convolution->interior_output_x_end = output_x_end;
+
+      /*
+       * Only border pixels get indirection entries. They are tiled per output row: the whole row for rows with
+       * vertical padding, and the left and right border segments separately for interior rows.
+       */
+      const size_t row_tiles = divide_round_up(output_width, output_tile_size);
+      const size_t interior_row_tiles =
+        divide_round_up(output_x_begin, output_tile_size) + divide_round_up(output_width - output_x_end, output_tile_size);
+      const size_t interior_rows = output_y_end - output_y_begin;
+      const size_t image_tiles = (output_height - interior_rows) * row_tiles + interior_rows * interior_row_tiles;
+      const size_t indirection_buffer_size =
+        sizeof(void*) * batch_size * groups * image_tiles * output_tile_size * kernel_size;
+      if (indirection_buffer_size == 0) {
+        return qnnp_status_success;
+      }
+
+      const void** indirection_buffer = (const void**) realloc(convolution->indirection_buffer, indirection_buffer_size);
+      if (indirection_buffer == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+        return qnnp_status_out_of_memory;
+      }
+      convolution->indirection_buffer = indirection_buffer;
+
+      const void* zero = convolution->zero_pointer;
+      for (size_t group = 0; group < groups; group++) {
+        for (size_t image = 0; image < batch_size; image++) {
+          const void** tile_indirection = indirection_buffer + (group * batch_size + image) * image_tiles * output_tile_size * kernel_size;
+          for (size_t output_y = 0; output_y < output_height; output_y++) {
+            const bool interior_row = output_y >= output_y_begin && output_y < output_y_end;
+            const size_t segments[2][2] = {
+              { 0, interior_row ? output_x_begin : output_width },
+              { interior_row ? output_x_end : output_width, output_width },
+            };
+            for (size_t segment = 0; segment < 2; segment++) {
+              const size_t segment_begin = segments[segment][0];
+              const size_t segment_end = segments[segment][1];
+              for (size_t output_tile_start = segment_begin; output_tile_start < segment_end; output_tile_start += output_tile_size) {
+                for (size_t output_tile_offset = 0; output_tile_offset < output_tile_size; output_tile_offset++) {
+                  const size_t output_x = min(output_tile_start + output_tile_offset, segment_end - 1);
+                  for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+                    const size_t input_y =
+                      output_y * convolution->stride_height + kernel_y * convolution->dilation_height - convolution->input_padding_top;
+                    for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
+                      const size_t input_x =
+                        output_x * convolution->stride_width + kernel_x * convolution->dilation_width - convolution->input_padding_left;
+                      const size_t index = (kernel_y * kernel_width + kernel_x) * output_tile_size + output_tile_offset;
+                      if (input_y < input_height && input_x < input_width) {
+                        tile_indirection[index] =
+                          input + ((image * input_height + input_y) * input_width + input_x) * input_pixel_stride +
+                          group * convolution->group_input_channels;
+                      } else {
+                        tile_indirection[index] = zero;
+                      }
+                    }
+                  }
+                }
+                tile_indirection += output_tile_size * kernel_size;
+              }
+            }
+          }
+        }
+      }
+      return qnnp_status_success;
+    }
+    case qnnp_ukernel_type_row_conv:
+    {
+      const size_t group_input_channels = convolution->group_input_channels;
+      const size_t kernel_height = convolution->kernel_height;
+      const size_t output_height = convolution->output_height;
+      const size_t output_width = convolution->output_width;
+      const size_t output_size = output_height * output_width;
+      const size_t output_tile_size = convolution->q8conv_params->mr;
+      const size_t tiled_output_size = round_up(output_size, output_tile_size);
+      const size_t indirection_buffer_size = sizeof(void*) * batch_size * tiled_output_size * kernel_height;
+
+      const void** indirection_buffer = (const void**) realloc(convolution->indirection_buffer, indirection_buffer_size);
+      if (indirection_buffer == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+        return qnnp_status_out_of_memory;
+      }
+      convolution->indirection_buffer = indirection_buffer;
+
+      /*
+       * Kernel rows read kernel_width pixels as one contiguous run. Horizontally padded or strided input is copied
+       * into a padded staging buffer on every run; its padding columns are filled here once.
+       */
+      const bool staged =
+        (convolution->input_padding_left | convolution->input_padding_right) != 0 ||
+        input_pixel_stride != group_input_channels;
+      const size_t staged_width = convolution->input_padding_left + input_width + convolution->input_padding_right;
+      if (staged) {
+        const size_t staged_size = sizeof(uint8_t) * batch_size * input_height * staged_width * group_input_channels;
+        void* workspace = realloc(convolution->workspace, staged_size);
+        if (workspace == NULL) {
+          qnnp_log_error("failed to allocate %zu bytes for staged input", staged_size);
+          return qnnp_status_out_of_memory;
+        }
+        memset(workspace, convolution->input_zero_point, staged_size);
+        convolution->workspace = workspace;
+      }
+
+      const void* zero = convolution->zero_pointer;
+      const struct fxdiv_divisor_size_t output_width_divisor = fxdiv_init_size_t(output_width);
+      for (size_t image = 0; image < batch_size; image++) {
+        for (size_t output_tile_start = 0; output_tile_start < tiled_output_size; output_tile_start += output_tile_size) {
+          for (size_t output_tile_offset = 0; output_tile_offset < output_tile_size; output_tile_offset++) {
+            const size_t tiled_output_index = output_tile_start + output_tile_offset;
+            const size_t output_index = min(tiled_output_index, output_size - 1);
+            const struct fxdiv_result_size_t output_index_components =
+              fxdiv_divide_size_t(output_index, output_width_divisor);
+            const size_t output_y = output_index_components.quotient;
+            const size_t output_x = output_index_components.remainder;
+            for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+              const size_t input_y =
+                output_y * convolution->stride_height + kernel_y * convolution->dilation_height - convolution->input_padding_top;
+              const size_t index =
+                image * tiled_output_size * kernel_height + output_tile_start * kernel_height + kernel_y * output_tile_size + output_tile_offset;
+              if (input_y < input_height) {
+                if (staged) {
+                  indirection_buffer[index] = (const uint8_t*) convolution->workspace +
+                    ((image * input_height + input_y) * staged_width + output_x * convolution->stride_width) * group_input_channels;
+                } else {
+                  indirection_buffer[index] =
+                    input + ((image * input_height + input_y) * input_width + output_x * convolution->stride_width) * input_pixel_stride;
+                }
+              } else {
+                indirection_buffer[index] = zero;
+              }
+            }
+          }
+        }
+      }
+      return qnnp_status_success;
+    }
+    case qnnp_ukernel_type_winograd:
+    {
+      const size_t group_input_channels = convolution->group_input_channels;
+      const size_t group_output_channels = convolution->group_output_channels;
+      const size_t tiles_height = divide_round_up(convolution->output_height, 2);
+      const size_t tiles_width = divide_round_up(convolution->output_width, 2);
+      const size_t tiles = batch_size * tiles_height * tiles_width;
+      const size_t indirection_buffer_size = sizeof(void*) * tiles * 16;
+
+      const void** indirection_buffer = (const void**) realloc(convolution->indirection_buffer, indirection_buffer_size);
+      if (indirection_buffer == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+        return qnnp_status_out_of_memory;
+      }
+      convolution->indirection_buffer = indirection_buffer;
+
+      const size_t k_stride = round_up(group_input_channels, qnnp_params.q8winograd.kc);
+      const size_t transformed_input_size = sizeof(int16_t) * 16 * tiles * k_stride;
+      const size_t workspace_size = transformed_input_size + sizeof(int32_t) * 16 * tiles * group_output_channels;
+      void* workspace = realloc(convolution->workspace, workspace_size);
+      if (workspace == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for Winograd workspace", workspace_size);
+        return qnnp_status_out_of_memory;
+      }
+      convolution->workspace = workspace;
+      if (k_stride != group_input_channels) {
+        /* Input transform writes only group_input_channels elements per tile */
+        memset(workspace, 0, transformed_input_size);
+      }
+
+      const void* zero = convolution->zero_pointer;
+      for (size_t image = 0; image < batch_size; image++) {
+        for (size_t tile_y = 0; tile_y < tiles_height; tile_y++) {
+          for (size_t tile_x = 0; tile_x < tiles_width; tile_x++) {
+            for (size_t tile_row = 0; tile_row < 4; tile_row++) {
+              const size_t input_y = tile_y * 2 + tile_row - convolution->input_padding_top;
+              for (size_t tile_col = 0; tile_col < 4; tile_col++) {
+                const size_t input_x = tile_x * 2 + tile_col - convolution->input_padding_left;
+                const size_t index = ((image * tiles_height + tile_y) * tiles_width + tile_x) * 16 + tile_row * 4 + tile_col;
+                if (input_y < input_height && input_x < input_width) {
+                  indirection_buffer[index] = input + ((image * input_height + input_y) * input_width + input_x) * input_pixel_stride;
+                } else {
+                  indirection_buffer[index] = zero;
+                }
+              }
+            }
+          }
+        }
+      }
+      return qnnp_status_success;
+    }
+    case qnnp_ukernel_type_dwconv:
+    {
+      const size_t kernel_depth = convolution->kernel_depth;
+      const size_t kernel_height = convolution->kernel_height;
+      const size_t kernel_width = convolution->kernel_width;
+      /* Taps of one kernel column over (depth, height) are stored together as a single column */
+      const size_t column_height = kernel_depth * kernel_height;
+      const size_t kernel_size = column_height * kernel_width;
+      const size_t output_depth = convolution->output_depth;
+      const size_t output_height = convolution->output_height;
+      const size_t output_width = convolution->output_width;
       const size_t width_step = convolution->dilation_width == 1 ? convolution->stride_width : kernel_width;
-      const size_t indirection_buffer_size = sizeof(void*) * batch_size * output_height *
-        (kernel_size + (output_width * width_step - 1) * kernel_height);
+      const size_t row_stride = kernel_size + (output_width * width_step - 1) * column_height;
+      const size_t indirection_buffer_size = sizeof(void*) * batch_size * output_depth * output_height * row_stride;
 
       const void** indirection_buffer =
         (const void**) realloc(convolution->indirection_buffer, indirection_buffer_size);
@@ -523,34 +1402,32 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
 
       const void* zero = convolution->zero_pointer;
       for (size_t image = 0; image < batch_size; image++) {
-        for (size_t output_y = 0; output_y < output_height; output_y++) {
-          for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
-            const size_t input_y =
-              output_y * convolution->stride_height + kernel_y * convolution->dilation_height - convolution->input_padding_top;
-            if (input_y < input_height) {
-              for (size_t output_x = 0; output_x < output_width; output_x++) {
-                for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
-                  const size_t input_x =
-                    output_x * convolution->stride_width + kernel_x * convolution->dilation_width - convolution->input_padding_left;
-                  const size_t index =
-                    (image * output_height + output_y) * (kernel_size + (output_width * width_step - 1) * kernel_height) +
-                    output_x * width_step * kernel_height + kernel_x * kernel_height + kernel_y;
-                  if (input_x < input_width) {
-                    indirection_buffer[index] = input + ((image * input_height + input_y) * input_width + input_x) * input_pixel_stride;
-                  } else {
-                    indirection_buffer[index] = zero;
+        for (size_t output_z = 0; output_z < output_depth; output_z++) {
+          for (size_t output_y = 0; output_y < output_height; output_y++) {
+            const size_t row = (image * output_depth + output_z) * output_height + output_y;
+            for (size_t kernel_z = 0; kernel_z < kernel_depth; kernel_z++) {
+              const size_t input_z =
+                output_z * convolution->stride_depth + kernel_z * convolution->dilation_depth - convolution->input_padding_front;
+              for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+                const size_t input_y =
+                  output_y * convolution->stride_height + kernel_y * convolution->dilation_height - convolution->input_padding_top;
+                const bool valid_row = input_z < input_depth && input_y < input_height;
+                const size_t column_offset = kernel_z * kernel_height + kernel_y;
+                for (size_t output_x = 0; output_x < output_width; output_x++) {
+                  for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
+                    const size_t input_x =
+                      output_x * convolution->stride_width + kernel_x * convolution->dilation_width - convolution->input_padding_left;
+                    const size_t index =
+                      row * row_stride + output_x * width_step * column_height + kernel_x * column_height + column_offset;
+                    if (valid_row && input_x < input_width) {
+                      indirection_buffer[index] =
+                        input + (((image * input_depth + input_z) * input_height + input_y) * input_width + input_x) * input_pixel_stride;
+                    } else {
+                      indirection_buffer[index] = zero;
+                    }
                   }
                 }
               }
-            } else {
-              for (size_t output_x = 0; output_x < output_width; output_x++) {
-                for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
-                  const size_t index =
-                    (image * output_height + output_y) * (kernel_size + (output_width * width_step - 1) * kernel_height) +
-                    output_x * width_step * kernel_height + kernel_x * kernel_height + kernel_y;
-                  indirection_buffer[index] = zero;
-                }
-              }
             }
           }
         }
@@ -561,3 +1438,50 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
       QNNP_UNREACHABLE;
   }
 }
+
+enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
+    qnnp_operator_t convolution,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_convolution2d_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return setup_convolution_ndhwc_q8(
+    convolution,
+    batch_size, 1, input_height, input_width,
+    input, input_pixel_stride,
+    output, output_pixel_stride);
+}
+
+enum qnnp_status qnnp_setup_convolution3d_ndhwc_q8(
+    qnnp_operator_t convolution,
+    size_t batch_size,
+    size_t input_depth,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_convolution3d_ndhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return setup_convolution_ndhwc_q8(
+    convolution,
+    batch_size, input_depth, input_height, input_width,
+    input, input_pixel_stride,
+    output, output_pixel_stride);
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+/*
+ * 1D convolution is a 2D convolution over a single-row image. With kernel_height == 1 and input_height == 1 the
+ * indirection buffer degenerates into a sliding window over the sequence: depthwise convolutions of any length map to
+ * the generic-tap depthwise micro-kernel, pointwise convolutions map to GEMM, and other convolutions use one tap per
+ * kernel element (or per kernel row for few input channels).
+ *
+ * In streaming mode the operator is created without padding, and every image of the input is staged after the last
+ * (kernel_width - 1) * dilation_width frames of the previous run (initially the input zero point, i.e. causal
+ * padding). The indirection buffer points taps into this staging buffer, so a run only computes outputs for new
+ * frames.
+ */
+enum qnnp_status qnnp_create_convolution1d_nwc_q8(
+    uint32_t input_padding_left,
+    uint32_t input_padding_right,
+    uint32_t kernel_width,
+    uint32_t subsampling_width,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* convolution_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_convolution1d_nwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (kernel_width == 0) {
+    qnnp_log_error("failed to create 1D convolution with kernel width %" PRIu32 ": kernel width must be non-zero",
+      kernel_width);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (dilation_width == 0) {
+    qnnp_log_error("failed to create 1D convolution with dilation %" PRIu32 ": dilation must be non-zero",
+      dilation_width);
+    return qnnp_status_invalid_parameter;
+  }
+
+  const bool streaming = (flags & QNNP_FLAG_STREAMING) != 0;
+  if (flags & (QNNP_FLAG_CAUSAL_PADDING | QNNP_FLAG_STREAMING)) {
+    if ((input_padding_left | input_padding_right) != 0) {
+      qnnp_log_error(
+        "failed to create causal 1D convolution with %" PRIu32 "+%" PRIu32 " padding: "
+        "padding is implied by causal padding mode and must be zero",
+        input_padding_left, input_padding_right);
+      return qnnp_status_invalid_parameter;
+    }
+    if (!streaming) {
+      input_padding_left = (kernel_width - 1) * dilation_width;
+    }
+  }
+
+  qnnp_operator_t convolution = NULL;
+  const enum qnnp_status status = qnnp_create_convolution2d_nhwc_q8(
+    0 /* top */, input_padding_right, 0 /* bottom */, input_padding_left,
+    1 /* kernel height */, kernel_width,
+    1 /* subsampling height */, subsampling_width,
+    1 /* dilation height */, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale,
+    kernel, bias,
+    output_zero_point, output_scale, output_min, output_max,
+    &convolution);
+  if (status != qnnp_status_success) {
+    return status;
+  }
+
+  convolution->flags = flags;
+  if (streaming) {
+    convolution->stream_history_width = (kernel_width - 1) * dilation_width;
+  }
+
+  *convolution_out = convolution;
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_setup_convolution1d_nwc_q8(
+    qnnp_operator_t convolution,
+    size_t batch_size,
+    size_t input_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_convolution1d_nwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (convolution->kernel_height != 1 || convolution->input_padding_top != 0 || convolution->input_padding_bottom != 0) {
+    qnnp_log_error("failed to setup 1D convolution: operator was not created as a 1D convolution");
+    return qnnp_status_invalid_parameter;
+  }
+
+  const size_t history_width = convolution->stream_history_width;
+  if ((convolution->flags & QNNP_FLAG_STREAMING) && history_width != 0) {
+    if (input_width % convolution->stride_width != 0) {
+      qnnp_log_error(
+        "failed to setup streaming 1D convolution with %zu input frames: "
+        "number of frames must be a multiple of subsampling %" PRIu32,
+        input_width, convolution->stride_width);
+      return qnnp_status_invalid_parameter;
+    }
+
+    const size_t channels = convolution->groups * convolution->group_input_channels;
+    const size_t staged_width = history_width + input_width;
+    const size_t last_batch_size = convolution->batch_size;
+    const size_t last_staged_width = convolution->input_width;
+    if (convolution->stream_buffer == NULL || batch_size != last_batch_size || staged_width != last_staged_width) {
+      /* 8 leading bytes keep micro-kernel reads before the first frame in bounds */
+      const size_t stream_buffer_size = sizeof(uint8_t) * (8 + batch_size * staged_width * channels);
+      uint8_t* stream_buffer = malloc(stream_buffer_size);
+      if (stream_buffer == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for streaming buffer", stream_buffer_size);
+        return qnnp_status_out_of_memory;
+      }
+      memset(stream_buffer, convolution->input_zero_point, stream_buffer_size);
+
+      /* History survives a change of the number of frames per run, but not a change of the batch size */
+      if (convolution->stream_buffer != NULL && batch_size == last_batch_size) {
+        const uint8_t* last_stream_buffer = (const uint8_t*) convolution->stream_buffer;
+        for (size_t image = 0; image < batch_size; image++) {
+          memcpy(
+            stream_buffer + 8 + image * staged_width * channels,
+            last_stream_buffer + 8 + image * last_staged_width * channels,
+            history_width * channels);
+        }
+      }
+      free(convolution->stream_buffer);
+      convolution->stream_buffer = stream_buffer;
+    }
+
+    convolution->stream_input = input;
+    convolution->stream_input_pixel_stride = input_pixel_stride;
+
+    return qnnp_setup_convolution2d_nhwc_q8(
+      convolution,
+      batch_size,
+      1 /* input height */, staged_width,
+      (const uint8_t*) convolution->stream_buffer + 8, channels,
+      output, output_pixel_stride,
+      threadpool);
+  }
+
+  return qnnp_setup_convolution2d_nhwc_q8(
+    convolution,
+    batch_size,
+    1 /* input height */, input_width,
+    input, input_pixel_stride,
+    output, output_pixel_stride,
+    threadpool);
+}
+
+enum qnnp_status qnnp_reset_convolution1d_nwc_q8(
+    qnnp_operator_t convolution)
+{
+  if (!(convolution->flags & QNNP_FLAG_STREAMING)) {
+    qnnp_log_error("failed to reset 1D convolution: operator was not created in streaming mode");
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (convolution->stream_buffer != NULL) {
+    const size_t channels = convolution->groups * convolution->group_input_channels;
+    uint8_t* stream_buffer = (uint8_t*) convolution->stream_buffer + 8;
+    for (size_t image = 0; image < convolution->batch_size; image++) {
+      memset(
+        stream_buffer + image * convolution->input_width * channels,
+        convolution->input_zero_point,
+        convolution->stream_history_width * channels);
+    }
+  }
+  return qnnp_status_success;
+}
@@ -132,8 +132,14 @@ enum qnnp_status qnnp_create_deconvolution2d_nhwc_q8(
     goto error;
   }
 
-  const uint32_t nr = qnnp_params.q8conv.nr;
-  const uint32_t kr = qnnp_params.q8conv.kr;
+  const struct q8conv_parameters* q8conv_params = &qnnp_params.q8conv;
+  if (group_output_channels <= qnnp_params.q8conv_narrow.nr) {
+    q8conv_params = &qnnp_params.q8conv_narrow;
+  }
+  deconvolution->q8conv_params = q8conv_params;
+
+  const uint32_t nr = q8conv_params->nr;
+  const uint32_t kr = q8conv_params->kr;
 
   const uint32_t n_stride = (group_output_channels + (nr - 1)) & -nr;
   const uint32_t k_stride = (group_input_channels + (kr - 1)) & -kr;
@@ -179,6 +185,7 @@ enum qnnp_status qnnp_create_deconvolution2d_nhwc_q8(
   deconvolution->adjustment_height = adjustment_height;
   deconvolution->adjustment_width = adjustment_width;
 
+  deconvolution->kernel_depth = 1;
   deconvolution->kernel_height = kernel_height;
   deconvolution->kernel_width = kernel_width;
   deconvolution->stride_height = stride_height;
@@ -241,6 +248,7 @@ enum qnnp_status qnnp_setup_deconvolution2d_nhwc_q8(
   deconvolution->input_width = input_width;
   deconvolution->input = input;
   deconvolution->input_pixel_stride = input_pixel_stride;
+  deconvolution->output_depth = 1;
   deconvolution->output = output;
   deconvolution->output_pixel_stride = output_pixel_stride;
 
@@ -255,10 +263,12 @@ enum qnnp_status qnnp_setup_deconvolution2d_nhwc_q8(
   const size_t output_width = deconvolution->output_width = compute_output_dimension(
     input_width, deconvolution->input_padding_left + deconvolution->input_padding_right,
     deconvolution->adjustment_width, kernel_width, deconvolution->dilation_width, stride_width);
+  deconvolution->output_row_stride = output_width * output_pixel_stride;
+  deconvolution->output_image_stride = output_height * deconvolution->output_row_stride;
 
   const size_t groups = deconvolution->groups;
   const size_t output_size = output_height * output_width;
-  const size_t output_tile_size = qnnp_params.q8conv.mr;
+  const size_t output_tile_size = deconvolution->q8conv_params->mr;
   const size_t tiled_output_size = round_up(output_size, output_tile_size);
   const size_t indirection_buffer_size = sizeof(void*) * batch_size * groups * tiled_output_size * kernel_size;
 
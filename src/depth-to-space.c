@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_depth_to_space_nhwc_x8(
+    size_t output_channels,
+    uint32_t block_size,
+    qnnp_operator_t* depth_to_space_out)
+{
+  qnnp_operator_t depth_to_space_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_depth_to_space_nhwc_x8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (output_channels == 0) {
+    qnnp_log_error(
+      "failed to create depth-to-space operator with %zu output channels: number of channels must be non-zero",
+      output_channels);
+    goto error;
+  }
+
+  if (block_size <= 1) {
+    qnnp_log_error(
+      "failed to create depth-to-space operator with %" PRIu32 " block size: block size must be greater than 1",
+      block_size);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  depth_to_space_op = calloc(1, sizeof(struct qnnp_operator));
+  if (depth_to_space_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  depth_to_space_op->channels = output_channels;
+  depth_to_space_op->stride_height = block_size;
+  depth_to_space_op->stride_width = block_size;
+
+  depth_to_space_op->ukernel_type = qnnp_ukernel_type_depth_to_space;
+  depth_to_space_op->format = qnnp_format_quint8;
+
+  *depth_to_space_out = depth_to_space_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(depth_to_space_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_depth_to_space_nhwc_x8(
+    qnnp_operator_t depth_to_space_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    size_t input_pixel_stride,
+    void* output,
+    size_t output_pixel_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_depth_to_space_nhwc_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup depth-to-space operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_width == 0 || input_height == 0) {
+    qnnp_log_error(
+      "failed to setup depth-to-space operator with %zux%zu input: input dimensions must be non-zero",
+      input_width, input_height);
+    return qnnp_status_invalid_parameter;
+  }
+
+  const size_t block_size = depth_to_space_op->stride_height;
+  const size_t input_channels = block_size * block_size * depth_to_space_op->channels;
+  if (input_pixel_stride < input_channels) {
+    qnnp_log_error(
+      "failed to setup depth-to-space operator with input pixel stride %zu: "
+      "stride must be at least the number of input channels (%zu)",
+      input_pixel_stride, input_channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_pixel_stride < depth_to_space_op->channels) {
+    qnnp_log_error(
+      "failed to setup depth-to-space operator with output pixel stride %zu: "
+      "stride must be at least the number of output channels (%zu)",
+      output_pixel_stride, depth_to_space_op->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  depth_to_space_op->batch_size = batch_size;
+  depth_to_space_op->input_height = input_height;
+  depth_to_space_op->input_width = input_width;
+  depth_to_space_op->input = input;
+  depth_to_space_op->input_pixel_stride = input_pixel_stride;
+  depth_to_space_op->output_height = input_height * block_size;
+  depth_to_space_op->output_width = input_width * block_size;
+  depth_to_space_op->output = output;
+  depth_to_space_op->output_pixel_stride = output_pixel_stride;
+
+  return qnnp_status_success;
+}
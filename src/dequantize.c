@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_dequantize_nc_q8_f32(
+    size_t channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    qnnp_operator_t* dequantize_out)
+{
+  qnnp_operator_t dequantize_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_dequantize_nc_q8_f32 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create Dequantize operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    qnnp_log_error(
+      "failed to create Dequantize operator with %.7g input scale: scale must be finite and positive", input_scale);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  dequantize_op = calloc(1, sizeof(struct qnnp_operator));
+  if (dequantize_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  dequantize_op->channels = channels;
+  dequantize_op->q8_dequantization_params = qnnp_compute_q8_dequantization_params(input_zero_point, input_scale);
+
+  dequantize_op->ukernel_type = qnnp_ukernel_type_dequantize;
+  dequantize_op->format = qnnp_format_quint8;
+
+  *dequantize_out = dequantize_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(dequantize_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_dequantize_nc_q8_f32(
+    qnnp_operator_t dequantize,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    float* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_dequantize_nc_q8_f32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup Dequantize operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  dequantize->batch_size = batch_size;
+  dequantize->input = input;
+  dequantize->input_pixel_stride = input_stride;
+  dequantize->output = output;
+  dequantize->output_pixel_stride = output_stride;
+
+  return qnnp_status_success;
+}
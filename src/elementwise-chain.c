@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_elementwise_chain_nc_q8(
+    size_t num_operators,
+    const qnnp_operator_t* operators,
+    qnnp_operator_t* elementwise_chain_out)
+{
+  qnnp_operator_t elementwise_chain = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_elementwise_chain_nc_q8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (num_operators == 0) {
+    qnnp_log_error(
+      "failed to create elementwise chain operator with %zu operators: number of operators must be non-zero",
+      num_operators);
+    goto error;
+  }
+
+  for (size_t i = 0; i < num_operators; i++) {
+    if (operators[i] == NULL) {
+      qnnp_log_error("failed to create elementwise chain operator: operator #%zu is NULL", i);
+      goto error;
+    }
+
+    if (operators[i]->channels != operators[0]->channels) {
+      qnnp_log_error(
+        "failed to create elementwise chain operator: operator #%zu has %zu channels, but operator #0 has %zu",
+        i, operators[i]->channels, operators[0]->channels);
+      goto error;
+    }
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  const bool has_add = operators[0]->ukernel_type == qnnp_ukernel_type_add;
+  for (size_t i = has_add ? 1 : 0; i < num_operators; i++) {
+    const enum qnnp_ukernel_type ukernel_type = operators[i]->ukernel_type;
+    if (ukernel_type != qnnp_ukernel_type_clamp && ukernel_type != qnnp_ukernel_type_lut) {
+      qnnp_log_error(
+        "failed to create elementwise chain operator: operator #%zu is neither a clamp nor a lookup table operator%s",
+        i, i == 0 ? ", nor an add operator" : "");
+      goto error;
+    }
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  elementwise_chain = calloc(1, sizeof(struct qnnp_operator));
+  if (elementwise_chain == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  elementwise_chain->lookup_table = malloc(256 * sizeof(uint8_t));
+  if (elementwise_chain->lookup_table == NULL) {
+    qnnp_log_error("failed to allocate 256 bytes for lookup table");
+    goto error;
+  }
+
+  /* Compose unary operators into a single table; a clamp is a table too */
+  uint8_t* lookup_table = elementwise_chain->lookup_table;
+  for (uint32_t i = 0; i < 256; i++) {
+    lookup_table[i] = (uint8_t) i;
+  }
+  for (size_t i = has_add ? 1 : 0; i < num_operators; i++) {
+    const qnnp_operator_t op = operators[i];
+    if (op->ukernel_type == qnnp_ukernel_type_clamp) {
+      const uint8_t output_min = op->output_min;
+      const uint8_t output_max = op->output_max;
+      for (uint32_t j = 0; j < 256; j++) {
+        const uint8_t value = lookup_table[j];
+        lookup_table[j] = value < output_min ? output_min : value > output_max ? output_max : value;
+      }
+    } else {
+      const uint8_t* op_lookup_table = op->lookup_table;
+      for (uint32_t j = 0; j < 256; j++) {
+        lookup_table[j] = op_lookup_table[lookup_table[j]];
+      }
+    }
+  }
+
+  /* Tables which only clamp are replaced by clamps, which are folded into the add if the chain starts with one */
+  const uint8_t table_min = lookup_table[0];
+  const uint8_t table_max = lookup_table[255];
+  bool is_clamp = table_min <= table_max;
+  for (uint32_t i = 0; i < 256 && is_clamp; i++) {
+    const uint8_t value = (uint8_t) i;
+    is_clamp = lookup_table[i] == (value < table_min ? table_min : value > table_max ? table_max : value);
+  }
+
+  elementwise_chain->channels = operators[0]->channels;
+  elementwise_chain->inputs = has_add ? 2 : 1;
+  if (has_add) {
+    elementwise_chain->add_quantization_params = operators[0]->add_quantization_params;
+    if (is_clamp) {
+      const uint8_t add_min = operators[0]->output_min;
+      const uint8_t add_max = operators[0]->output_max;
+      /* Either range may lie outside the other, which makes the output constant */
+      const uint8_t output_min = add_min < table_min ? table_min : add_min > table_max ? table_max : add_min;
+      const uint8_t output_max = add_max > table_max ? table_max : add_max < table_min ? table_min : add_max;
+      qnnp_update_add_quantization_params_output_range(
+        &elementwise_chain->add_quantization_params, output_min, output_max);
+      elementwise_chain->ukernel_type = qnnp_ukernel_type_add;
+    } else {
+      elementwise_chain->ukernel_type = qnnp_ukernel_type_add_lut;
+    }
+  } else if (is_clamp && table_min < table_max) {
+    elementwise_chain->u8_clamping_params = qnnp_compute_u8_clamping_params(table_min, table_max);
+    elementwise_chain->ukernel_type = qnnp_ukernel_type_clamp;
+  } else {
+    elementwise_chain->ukernel_type = qnnp_ukernel_type_lut;
+  }
+  elementwise_chain->format = qnnp_format_quint8;
+
+  *elementwise_chain_out = elementwise_chain;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(elementwise_chain);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_elementwise_chain_nc_q8(
+    qnnp_operator_t elementwise_chain,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    const uint8_t* input2,
+    size_t input2_stride,
+    uint8_t* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_elementwise_chain_nc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error(
+      "failed to setup elementwise chain operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if ((input2 != NULL) != (elementwise_chain->inputs == 2)) {
+    qnnp_log_error(
+      "failed to setup elementwise chain operator: second input must be %s for a chain %s an add operator",
+      elementwise_chain->inputs == 2 ? "specified" : "NULL",
+      elementwise_chain->inputs == 2 ? "starting with" : "without");
+    return qnnp_status_invalid_parameter;
+  }
+
+  elementwise_chain->batch_size = batch_size;
+  elementwise_chain->input = input;
+  elementwise_chain->input_pixel_stride = input_stride;
+  elementwise_chain->input2 = input2;
+  elementwise_chain->input2_pixel_stride = input2_stride;
+  elementwise_chain->output = output;
+  elementwise_chain->output_pixel_stride = output_stride;
+
+  return qnnp_status_success;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/lut.h>
+
+
+static float compute_elu(float x, const void* params) {
+  const float alpha = *((const float*) params);
+  return x < 0.0f ? alpha * expm1f(x) : x;
+}
+
+enum qnnp_status qnnp_create_elu_nc_q8(
+    size_t channels,
+    float alpha,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* elu_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_elu_nc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (alpha <= 0.0f || !isnormal(alpha)) {
+    qnnp_log_error(
+      "failed to create ELU operator with %.7g alpha: alpha must be finite and positive", alpha);
+    return qnnp_status_invalid_parameter;
+  }
+
+  uint8_t table[256];
+  const enum qnnp_status status = qnnp_compute_lut_q8(
+    "ELU", compute_elu, &alpha,
+    input_zero_point, input_scale,
+    output_zero_point, output_scale,
+    output_min, output_max,
+    table);
+  if (status != qnnp_status_success) {
+    return status;
+  }
+
+  return qnnp_create_lut_nc_x8(channels, table, elu_out);
+}
+
+enum qnnp_status qnnp_setup_elu_nc_q8(
+    qnnp_operator_t elu,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride)
+{
+  return qnnp_setup_lut_nc_x8(elu, batch_size, input, input_stride, output, output_stride);
+}
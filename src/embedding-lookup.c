@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_embedding_lookup_q8(
+    size_t embedding_dim,
+    enum qnnp_reduce_operation pooling,
+    uint8_t table_zero_point,
+    float table_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* embedding_lookup_out)
+{
+  qnnp_operator_t embedding_lookup = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_embedding_lookup_q8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (embedding_dim == 0) {
+    qnnp_log_error(
+      "failed to create embedding lookup operator with embedding dimension %zu: dimension must be non-zero",
+      embedding_dim);
+    goto error;
+  }
+
+  if (table_scale <= 0.0f || !isnormal(table_scale)) {
+    qnnp_log_error(
+      "failed to create embedding lookup operator with %.7g table scale: scale must be finite and positive",
+      table_scale);
+    goto error;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    qnnp_log_error(
+      "failed to create embedding lookup operator with %.7g output scale: scale must be finite and positive",
+      output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    qnnp_log_error(
+      "failed to create embedding lookup operator with [%" PRIu8 ", %" PRIu8 "] output range: "
+      "range min must be below range max",
+      output_min, output_max);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  if (pooling != qnnp_reduce_operation_sum && pooling != qnnp_reduce_operation_mean) {
+    qnnp_log_error(
+      "failed to create embedding lookup operator with pooling operation %d: only sum and mean are supported",
+      (int) pooling);
+    goto error;
+  }
+
+  const float table_output_scale = table_scale / output_scale;
+  if (table_output_scale < 0x1.0p-8f || table_output_scale >= 0x1.0p+8f) {
+    qnnp_log_error(
+      "failed to create embedding lookup operator with %.7g table-to-output scale ratio: "
+      "scale ratio must be in [2**-8, 2**8) range",
+      table_output_scale);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  embedding_lookup = calloc(1, sizeof(struct qnnp_operator));
+  if (embedding_lookup == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  /* Pooling micro-kernels read the zero row in place of missing rows past the end of a bag */
+  void* zero_buffer = calloc(embedding_dim, sizeof(uint8_t));
+  if (zero_buffer == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for zero padding", embedding_dim * sizeof(uint8_t));
+    goto error;
+  }
+  embedding_lookup->zero_buffer = zero_buffer;
+  embedding_lookup->zero_pointer = zero_buffer;
+
+  embedding_lookup->channels = embedding_dim;
+  embedding_lookup->reduce_operation = pooling;
+  embedding_lookup->input_zero_point = table_zero_point;
+  embedding_lookup->output_zero_point = output_zero_point;
+  embedding_lookup->input_scale = table_scale;
+  embedding_lookup->output_scale = output_scale;
+  embedding_lookup->output_min = output_min;
+  embedding_lookup->output_max = output_max;
+
+  embedding_lookup->ukernel_type = qnnp_ukernel_type_embedding_lookup;
+  embedding_lookup->format = qnnp_format_quint8;
+
+  *embedding_lookup_out = embedding_lookup;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(embedding_lookup);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_embedding_lookup_q8(
+    qnnp_operator_t embedding_lookup,
+    size_t num_embeddings,
+    const uint8_t* table,
+    size_t table_stride,
+    size_t num_indices,
+    const uint32_t* indices,
+    size_t num_bags,
+    const uint32_t* offsets,
+    uint8_t* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_embedding_lookup_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (num_embeddings == 0) {
+    qnnp_log_error(
+      "failed to setup embedding lookup operator with %zu embeddings: number of embeddings must be non-zero",
+      num_embeddings);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (table_stride < embedding_lookup->channels) {
+    qnnp_log_error(
+      "failed to setup embedding lookup operator with table stride %zu: "
+      "stride must be at least the embedding dimension (%zu)",
+      table_stride, embedding_lookup->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_stride < embedding_lookup->channels) {
+    qnnp_log_error(
+      "failed to setup embedding lookup operator with output stride %zu: "
+      "stride must be at least the embedding dimension (%zu)",
+      output_stride, embedding_lookup->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (num_bags == 0) {
+    qnnp_log_error(
+      "failed to setup embedding lookup operator with %zu bags: number of bags must be non-zero", num_bags);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (offsets == NULL && num_indices != num_bags) {
+    qnnp_log_error(
+      "failed to setup embedding lookup operator with %zu indices and %zu bags without offsets: "
+      "every index must form a bag of its own",
+      num_indices, num_bags);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (num_indices > INT32_MAX / UINT8_MAX) {
+    qnnp_log_error(
+      "failed to setup embedding lookup operator with %zu indices: "
+      "at most %d indices are supported to keep pooled sums in 32-bit range",
+      num_indices, INT32_MAX / UINT8_MAX);
+    return qnnp_status_unsupported_parameter;
+  }
+
+  /*
+   * Pooled rows are passed to average pooling micro-kernels through an indirection buffer, rebuilt on every run
+   * because indices may change between runs. Micro-kernels may read up to (mr - 1) pointers past the end of a bag.
+   */
+  const size_t bag_padding = qnnp_params.q8avgpool.mr - 1;
+  const size_t indirection_buffer_size = sizeof(void*) * (num_indices + num_bags * bag_padding);
+  const void** indirection_buffer =
+    (const void**) realloc(embedding_lookup->indirection_buffer, indirection_buffer_size);
+  if (indirection_buffer == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+    return qnnp_status_out_of_memory;
+  }
+  embedding_lookup->indirection_buffer = indirection_buffer;
+
+  embedding_lookup->embedding_rows = num_embeddings;
+  embedding_lookup->embedding_indices_count = num_indices;
+  embedding_lookup->embedding_indices = indices;
+  embedding_lookup->embedding_offsets = offsets;
+  embedding_lookup->batch_size = num_bags;
+  embedding_lookup->input = table;
+  embedding_lookup->input_pixel_stride = table_stride;
+  embedding_lookup->output = output;
+  embedding_lookup->output_pixel_stride = output_stride;
+
+  return qnnp_status_success;
+}
@@ -84,8 +84,14 @@ enum qnnp_status qnnp_create_fully_connected_nc_q8(
     goto error;
   }
 
-  const uint32_t nr = qnnp_params.q8conv.nr;
-  const uint32_t kr = qnnp_params.q8conv.kr;
+  const struct q8conv_parameters* q8conv_params = &qnnp_params.q8conv;
+  if (output_channels <= qnnp_params.q8conv_narrow.nr) {
+    q8conv_params = &qnnp_params.q8conv_narrow;
+  }
+  fully_connected->q8conv_params = q8conv_params;
+
+  const uint32_t nr = q8conv_params->nr;
+  const uint32_t kr = q8conv_params->kr;
 
   const uint32_t n_stride = (output_channels + (nr - 1)) & -nr;
   const uint32_t k_stride = (input_channels + (kr - 1)) & -kr;
@@ -156,6 +162,8 @@ enum qnnp_status qnnp_setup_fully_connected_nc_q8(
   convolution->output_width = 1;
   convolution->output = output;
   convolution->output_pixel_stride = output_stride;
+  convolution->output_row_stride = output_stride;
+  convolution->output_image_stride = batch_size * output_stride;
 
   return qnnp_status_success;
 }
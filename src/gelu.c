@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/lut.h>
+
+
+/* gelu(x) = x * Phi(x), where Phi is the standard normal cumulative distribution function */
+static float compute_gelu(float x, const void* params) {
+  return 0.5f * x * (1.0f + erff(x * 0x1.6A09E6p-1f));
+}
+
+enum qnnp_status qnnp_create_gelu_nc_q8(
+    size_t channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* gelu_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_gelu_nc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  uint8_t table[256];
+  const enum qnnp_status status = qnnp_compute_lut_q8(
+    "GELU", compute_gelu, NULL,
+    input_zero_point, input_scale,
+    output_zero_point, output_scale,
+    output_min, output_max,
+    table);
+  if (status != qnnp_status_success) {
+    return status;
+  }
+
+  return qnnp_create_lut_nc_x8(channels, table, gelu_out);
+}
+
+enum qnnp_status qnnp_setup_gelu_nc_q8(
+    qnnp_operator_t gelu,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride)
+{
+  return qnnp_setup_lut_nc_x8(gelu, batch_size, input, input_stride, output, output_stride);
+}
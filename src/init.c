@@ -17,16 +17,23 @@
 #include <qnnpack/log.h>
 #include <qnnpack/params.h>
 #include <qnnpack/q8add.h>
+#include <qnnpack/q8dequant.h>
 #include <qnnpack/q8conv.h>
+#include <qnnpack/q8packb.h>
 #include <qnnpack/q8dw.h>
 #include <qnnpack/q8avgpool.h>
 #include <qnnpack/q8gavgpool.h>
 #include <qnnpack/q8gemm.h>
+#include <qnnpack/q8winograd.h>
+#include <qnnpack/q8quant.h>
 #include <qnnpack/u8maxpool.h>
+#include <qnnpack/u8argmax.h>
 #include <qnnpack/u8clamp.h>
+#include <qnnpack/u8ibilinear.h>
 #include <qnnpack/u8rmax.h>
 #include <qnnpack/u8lut32norm.h>
 #include <qnnpack/x8lut.h>
+#include <qnnpack/x8transpose.h>
 #include <qnnpack/x8zip.h>
 
 static pthread_once_t init_guard = PTHREAD_ONCE_INIT;
@@ -44,6 +51,7 @@ static void init(void) {
   qnnp_params.q8conv = (struct q8conv_parameters) {
       .gemm = q8gemm_ukernel_4x8__aarch32_neon,
       .conv = q8conv_ukernel_4x8__aarch32_neon,
+      .packb = q8packb_ukernel_8c1__neon,
       .mr = 4,
       .nr = 8,
       .kr = 1,
@@ -70,6 +78,9 @@ static void init(void) {
     default:
       break;
   }
+  qnnp_params.q8winograd = (struct q8winograd_parameters) {
+      .cthreshold = SIZE_MAX,
+  };
   qnnp_params.q8dw9 = (struct q8updw_parameters) {
       .updw = q8updw_ukernel_9c8__aarch32_neon,
       .cr = 8,
@@ -78,6 +89,10 @@ static void init(void) {
       .mpdw = q8mpdw_ukernel_25c8__neon,
       .cr = 8,
   };
+  qnnp_params.q8dwm = (struct q8updwm_parameters) {
+      .updwm = q8updw_ukernel_mc8__neon,
+      .cr = 8,
+  };
   qnnp_params.q8sum_rows = (struct q8sum_rows_parameters) {
       .sum_rows = q8sumrows_ukernel_4x__neon,
       .m = 4,
@@ -113,14 +128,20 @@ static void init(void) {
       .x4 = qnnp_x8zip_x4__neon,
       .xm = qnnp_x8zip_xm__neon,
   };
+  qnnp_params.x8transpose = x8transpose_ukernel_8x8__neon;
   qnnp_params.u8clamp = u8clamp_ukernel__neon;
+  qnnp_params.q8quant = q8quant_ukernel__neon;
+  qnnp_params.q8dequant = q8dequant_ukernel__neon;
+  qnnp_params.u8ibilinear = u8ibilinear_ukernel_c8__neon;
   qnnp_params.u8rmax = u8rmax_ukernel__neon;
+  qnnp_params.u8argmax = u8argmax_ukernel__neon;
   qnnp_params.u8lut32norm = u8lut32norm_ukernel__scalar;
   qnnp_params.x8lut = x8lut_ukernel__scalar;
 #elif CPUINFO_ARCH_ARM64
   qnnp_params.q8conv = (struct q8conv_parameters) {
       .gemm = q8gemm_ukernel_8x8__aarch64_neon,
       .conv = q8conv_ukernel_8x8__aarch64_neon,
+      .packb = q8packb_ukernel_8c1__neon,
       .mr = 8,
       .nr = 8,
       .kr = 1,
@@ -128,6 +149,9 @@ static void init(void) {
   qnnp_params.q8conv_xzp = (struct q8conv_xzp_parameters) {
       .kthreshold = SIZE_MAX,
   };
+  qnnp_params.q8winograd = (struct q8winograd_parameters) {
+      .cthreshold = SIZE_MAX,
+  };
   qnnp_params.q8dw9 = (struct q8updw_parameters) {
       .updw = q8updw_ukernel_9c8__neon,
       .cr = 8,
@@ -136,6 +160,10 @@ static void init(void) {
       .mpdw = q8mpdw_ukernel_25c8__neon,
       .cr = 8,
   };
+  qnnp_params.q8dwm = (struct q8updwm_parameters) {
+      .updwm = q8updw_ukernel_mc8__neon,
+      .cr = 8,
+  };
   qnnp_params.q8add = (struct q8add_parameters) {
       .uvadd = q8uvadd_ukernel__neon,
   };
@@ -167,8 +195,13 @@ static void init(void) {
       .x4 = qnnp_x8zip_x4__neon,
       .xm = qnnp_x8zip_xm__neon,
   };
+  qnnp_params.x8transpose = x8transpose_ukernel_8x8__neon;
   qnnp_params.u8clamp = u8clamp_ukernel__neon;
+  qnnp_params.q8quant = q8quant_ukernel__neon;
+  qnnp_params.q8dequant = q8dequant_ukernel__neon;
+  qnnp_params.u8ibilinear = u8ibilinear_ukernel_c8__neon;
   qnnp_params.u8rmax = u8rmax_ukernel__neon;
+  qnnp_params.u8argmax = u8argmax_ukernel__neon;
   qnnp_params.u8lut32norm = u8lut32norm_ukernel__scalar;
   qnnp_params.x8lut = x8lut_ukernel__scalar;
 #elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
@@ -179,13 +212,33 @@ static void init(void) {
   qnnp_params.q8conv = (struct q8conv_parameters){
       .gemm = q8gemm_ukernel_4x4c2__sse2,
       .conv = q8conv_ukernel_4x4c2__sse2,
+      .dconv = q8dconv_ukernel_4x4c2__sse2,
+      .packb = q8packb_ukernel_4c2__sse2,
       .mr = 4,
       .nr = 4,
       .kr = 2,
   };
+  qnnp_params.q8conv_narrow = (struct q8conv_parameters) {
+      .gemm = q8gemm_ukernel_8x2c4__sse2,
+      .conv = q8conv_ukernel_8x2c4__sse2,
+      .packb = q8packb_ukernel_2c4__sse2,
+      .mr = 8,
+      .nr = 2,
+      .kr = 4,
+  };
   qnnp_params.q8conv_xzp = (struct q8conv_xzp_parameters) {
       .kthreshold = SIZE_MAX,
   };
+  qnnp_params.q8winograd = (struct q8winograd_parameters) {
+      .input = q8winograd_input_ukernel_f2k3c8__sse2,
+      .gemm = q8winograd_gemm_ukernel_4x4c8__sse2,
+      .output = q8winograd_output_ukernel_f2k3c4__sse2,
+      .mr = 4,
+      .nr = 4,
+      .kr = 2,
+      .kc = 8,
+      .cthreshold = 32,
+  };
   qnnp_params.q8dw9 = (struct q8updw_parameters) {
       .updw = q8updw_ukernel_9c8__sse2,
       .cr = 8,
@@ -194,6 +247,19 @@ static void init(void) {
       .mpdw = q8mpdw_ukernel_25c8__sse2,
       .cr = 8,
   };
+  qnnp_params.q8dwm = (struct q8updwm_parameters) {
+      .updwm = q8updw_ukernel_mc8__sse2,
+      .cr = 8,
+  };
+  qnnp_params.q8dwpx = (struct q8dwpx_parameters) {
+      .updwm = q8dwpx_ukernel_mc4__sse2,
+      .cr = 4,
+      .vr = 8,
+  };
+  qnnp_params.q8dw9row = (struct q8dwrow_parameters) {
+      .stride1 = q8dwrow_ukernel_3x3s1c8__sse2,
+      .stride2 = q8dwrow_ukernel_3x3s2c8__sse2,
+  };
   qnnp_params.q8add = (struct q8add_parameters) {
       .uvadd = q8uvadd_ukernel__sse2,
   };
@@ -225,8 +291,13 @@ static void init(void) {
       .x4 = qnnp_x8zip_x4__sse2,
       .xm = qnnp_x8zip_xm__sse2,
   };
+  qnnp_params.x8transpose = x8transpose_ukernel_8x8__sse2;
   qnnp_params.u8clamp = u8clamp_ukernel__sse2;
+  qnnp_params.q8quant = q8quant_ukernel__sse2;
+  qnnp_params.q8dequant = q8dequant_ukernel__sse2;
+  qnnp_params.u8ibilinear = u8ibilinear_ukernel_c8__sse2;
   qnnp_params.u8rmax = u8rmax_ukernel__sse2;
+  qnnp_params.u8argmax = u8argmax_ukernel__sse2;
   qnnp_params.u8lut32norm = u8lut32norm_ukernel__scalar;
   qnnp_params.x8lut = x8lut_ukernel__scalar;
 #else
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/lut.h>
+
+
+enum qnnp_status qnnp_create_lut_nc_x8(
+    size_t channels,
+    const uint8_t* table,
+    qnnp_operator_t* lut_out)
+{
+  qnnp_operator_t lut_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_lut_nc_x8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create lookup table operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (table == NULL) {
+    qnnp_log_error("failed to create lookup table operator: table must be specified");
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  lut_op = calloc(1, sizeof(struct qnnp_operator));
+  if (lut_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  lut_op->lookup_table = malloc(256 * sizeof(uint8_t));
+  if (lut_op->lookup_table == NULL) {
+    qnnp_log_error("failed to allocate 256 bytes for lookup table");
+    goto error;
+  }
+
+  memcpy(lut_op->lookup_table, table, 256 * sizeof(uint8_t));
+
+  lut_op->channels = channels;
+
+  lut_op->ukernel_type = qnnp_ukernel_type_lut;
+  lut_op->format = qnnp_format_quint8;
+
+  *lut_out = lut_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(lut_op);
+  return status;
+}
+
+enum qnnp_status qnnp_compute_lut_q8(
+    const char* name,
+    qnnp_lut_function function,
+    const void* function_params,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint8_t table[256])
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    qnnp_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite and positive", name, input_scale);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    qnnp_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite and positive", name, output_scale);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    qnnp_log_error(
+      "failed to create %s operator with [%" PRIu8 ", %" PRIu8 "] output range: range min must be below range max",
+      name, output_min, output_max);
+    return qnnp_status_invalid_parameter;
+  }
+
+  const float scaled_min_less_zero_point = (float) ((int32_t) output_min - (int32_t) output_zero_point);
+  const float scaled_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  for (int32_t i = 0; i < 256; i++) {
+    const float x = input_scale * (float) (i - (int32_t) (uint32_t) input_zero_point);
+    const float y = function(x, function_params);
+    float scaled_y = y / output_scale;
+    if (scaled_y < scaled_min_less_zero_point) {
+      scaled_y = scaled_min_less_zero_point;
+    }
+    if (scaled_y > scaled_max_less_zero_point) {
+      scaled_y = scaled_max_less_zero_point;
+    }
+    table[(uint32_t) i] = (uint8_t) (lrintf(scaled_y) + (long) output_zero_point);
+  }
+
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_setup_lut_nc_x8(
+    qnnp_operator_t lut,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_lut_nc_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup lookup table operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  lut->batch_size = batch_size;
+  lut->input = input;
+  lut->input_pixel_stride = input_stride;
+  lut->output = output;
+  lut->output_pixel_stride = output_stride;
+
+  return qnnp_status_success;
+}
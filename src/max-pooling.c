@@ -178,6 +178,8 @@ enum qnnp_status qnnp_setup_max_pooling2d_nhwc_u8(
       max_pooling->stride_width);
   max_pooling->output = output;
   max_pooling->output_pixel_stride = output_pixel_stride;
+  max_pooling->output_row_stride = max_pooling->output_width * output_pixel_stride;
+  max_pooling->output_image_stride = max_pooling->output_height * max_pooling->output_row_stride;
 
   size_t valid_batch_size = 0;
   if (input == max_pooling->last_input &&
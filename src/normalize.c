@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+static enum qnnp_status create_normalize_nchw_nhwc_q8(
+    size_t channels,
+    const float* mean,
+    const float* stddev,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    enum qnnp_format format,
+    qnnp_operator_t* normalize_out)
+{
+  qnnp_operator_t normalize_op = NULL;
+  enum qnnp_status status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create Normalize operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  for (size_t c = 0; c < channels; c++) {
+    if (!isfinite(mean[c])) {
+      qnnp_log_error(
+        "failed to create Normalize operator with %.7g mean in channel #%zu: mean must be finite", mean[c], c);
+      goto error;
+    }
+
+    if (stddev[c] <= 0.0f || !isnormal(stddev[c])) {
+      qnnp_log_error(
+        "failed to create Normalize operator with %.7g standard deviation in channel #%zu: "
+        "standard deviation must be finite and positive",
+        stddev[c], c);
+      goto error;
+    }
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    qnnp_log_error(
+      "failed to create Normalize operator with %.7g output scale: scale must be finite and positive", output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    qnnp_log_error(
+      "failed to create Normalize operator with [%" PRIu8 ", %" PRIu8 "] output range: range min must be below range max",
+      output_min, output_max);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  if (channels > QNNP_NORMALIZE_BLOCK_BYTES) {
+    qnnp_log_error(
+      "failed to create Normalize operator with %zu channels: number of channels must not exceed %d",
+      channels, QNNP_NORMALIZE_BLOCK_BYTES);
+    goto error;
+  }
+
+  for (size_t c = 0; c < channels; c++) {
+    const float scale = 1.0f / (stddev[c] * output_scale);
+    if (!isnormal(scale)) {
+      qnnp_log_error(
+        "failed to create Normalize operator with %.7g standard deviation in channel #%zu and %.7g output scale: "
+        "combined scale must be a normalized number",
+        stddev[c], c, output_scale);
+      goto error;
+    }
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  normalize_op = calloc(1, sizeof(struct qnnp_operator));
+  if (normalize_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  /* Normalization and quantization are folded into a per-channel affine transformation x * scale + bias */
+  switch (format) {
+    case qnnp_format_float32:
+    {
+      const size_t params_size = channels * sizeof(union qnnp_q8_quantization_params);
+      normalize_op->packed_weights = malloc(params_size);
+      if (normalize_op->packed_weights == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for per-channel quantization parameters", params_size);
+        goto error;
+      }
+
+      union qnnp_q8_quantization_params* params = normalize_op->packed_weights;
+      for (size_t c = 0; c < channels; c++) {
+        const float scale = 1.0f / (stddev[c] * output_scale);
+        params[c] = qnnp_compute_q8_affine_quantization_params(
+          scale, -mean[c] * scale, output_zero_point, output_min, output_max);
+      }
+      break;
+    }
+    case qnnp_format_quint8:
+    {
+      /* Every channel of a uint8 input has only 256 possible values, which are tabulated */
+      const size_t lookup_table_size = channels * 256 * sizeof(uint8_t);
+      normalize_op->lookup_table = malloc(lookup_table_size);
+      if (normalize_op->lookup_table == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for Normalize lookup table", lookup_table_size);
+        goto error;
+      }
+
+      uint8_t* lookup_table = normalize_op->lookup_table;
+      const float output_min_less_zero_point = (float) ((int32_t) output_min - (int32_t) output_zero_point);
+      const float output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+      for (size_t c = 0; c < channels; c++) {
+        const float scale = 1.0f / (stddev[c] * output_scale);
+        const float bias = -mean[c] * scale;
+        for (int32_t i = 0; i < 256; i++) {
+          float y = (float) i * scale + bias;
+          if (y < output_min_less_zero_point) {
+            y = output_min_less_zero_point;
+          }
+          if (y > output_max_less_zero_point) {
+            y = output_max_less_zero_point;
+          }
+          lookup_table[c * 256 + (uint32_t) i] = (uint8_t) (lrintf(y) + (long) output_zero_point);
+        }
+      }
+      break;
+    }
+    default:
+      QNNP_UNREACHABLE;
+  }
+
+  normalize_op->channels = channels;
+
+  normalize_op->ukernel_type = qnnp_ukernel_type_normalize;
+  normalize_op->format = format;
+
+  *normalize_out = normalize_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(normalize_op);
+  return status;
+}
+
+static enum qnnp_status setup_normalize_nchw_nhwc_q8(
+    qnnp_operator_t normalize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    uint8_t* output,
+    size_t output_pixel_stride)
+{
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup Normalize operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_width == 0 || input_height == 0) {
+    qnnp_log_error(
+      "failed to setup Normalize operator with %zux%zu input: input dimensions must be non-zero",
+      input_width, input_height);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_pixel_stride < normalize->channels) {
+    qnnp_log_error(
+      "failed to setup Normalize operator with output pixel stride %zu: "
+      "stride must be at least the number of channels (%zu)",
+      output_pixel_stride, normalize->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  normalize->batch_size = batch_size;
+  normalize->input_height = input_height;
+  normalize->input_width = input_width;
+  normalize->input = input;
+  normalize->output = output;
+  normalize->output_pixel_stride = output_pixel_stride;
+
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_create_normalize_nchw_f32_nhwc_q8(
+    size_t channels,
+    const float* mean,
+    const float* stddev,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* normalize_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_normalize_nchw_f32_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_normalize_nchw_nhwc_q8(
+    channels, mean, stddev,
+    output_zero_point, output_scale, output_min, output_max,
+    qnnp_format_float32, normalize_out);
+}
+
+enum qnnp_status qnnp_setup_normalize_nchw_f32_nhwc_q8(
+    qnnp_operator_t normalize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    uint8_t* output,
+    size_t output_pixel_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_normalize_nchw_f32_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return setup_normalize_nchw_nhwc_q8(
+    normalize, batch_size, input_height, input_width, input, output, output_pixel_stride);
+}
+
+enum qnnp_status qnnp_create_normalize_nchw_u8_nhwc_q8(
+    size_t channels,
+    const float* mean,
+    const float* stddev,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* normalize_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_normalize_nchw_u8_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_normalize_nchw_nhwc_q8(
+    channels, mean, stddev,
+    output_zero_point, output_scale, output_min, output_max,
+    qnnp_format_quint8, normalize_out);
+}
+
+enum qnnp_status qnnp_setup_normalize_nchw_u8_nhwc_q8(
+    qnnp_operator_t normalize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    uint8_t* output,
+    size_t output_pixel_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_normalize_nchw_u8_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return setup_normalize_nchw_nhwc_q8(
+    normalize, batch_size, input_height, input_width, input, output, output_pixel_stride);
+}
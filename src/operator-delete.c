@@ -21,8 +21,14 @@ enum qnnp_status qnnp_delete_operator(qnnp_operator_t op)
   free(op->indirection_buffer);
   free(op->packed_weights);
   free(op->a_sum);
+  free(op->workspace);
+  free(op->stream_buffer);
   free(op->zero_buffer);
   free(op->lookup_table);
+  free(op->input_channel_offsets);
+  free(op->input_channel_permutation);
+  free(op->permuted_input);
+  free(op->concat_inputs);
   free(op);
   return qnnp_status_success;
 }
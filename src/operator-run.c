@@ -7,6 +7,8 @@
  */
 
 #include <assert.h>
+#include <math.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -16,9 +18,89 @@
 #include <qnnpack/log.h>
 #include <qnnpack/common.h>
 #include <qnnpack/math.h>
+#include <qnnpack/pack.h>
 #include <qnnpack/params.h>
+#include <qnnpack/requantization.h>
 
 
+/*
+ * Output pixels of GEMM and convolution operators whose output rows are strided, see qnnp_set_output_row_stride.
+ * Pixels are indexed consecutively through the rows of all images; a zero width marks contiguous output rows.
+ */
+struct output_rows {
+  size_t width;
+  size_t image_pixels;
+  size_t row_stride;
+  size_t image_stride;
+};
+
+/* Largest mr x nr output tile of the GEMM and convolution micro-kernels */
+#define OUTPUT_TILE_SIZE 64
+#define OUTPUT_TILE_STRIDE 8
+
+static struct output_rows init_output_rows(qnnp_operator_t op, size_t image_pixels)
+{
+  const size_t row_stride = op->output_width * op->output_pixel_stride;
+  const bool strided = op->output_row_stride != row_stride ||
+    op->output_image_stride != image_pixels / op->output_width * row_stride;
+  return (struct output_rows) {
+    .width = strided ? op->output_width : 0,
+    .image_pixels = image_pixels,
+    .row_stride = op->output_row_stride,
+    .image_stride = op->output_image_stride,
+  };
+}
+
+static inline size_t output_pixel_offset(const struct output_rows* rows, size_t pixel, size_t pixel_stride)
+{
+  if (rows->width == 0) {
+    return pixel * pixel_stride;
+  }
+  const size_t image = pixel / rows->image_pixels;
+  const size_t image_pixel = pixel - image * rows->image_pixels;
+  const size_t y = image_pixel / rows->width;
+  const size_t x = image_pixel - y * rows->width;
+  return image * rows->image_stride + y * rows->row_stride + x * pixel_stride;
+}
+
+/*
+ * Returns where the micro-kernel stores a tile of mr output pixels and sets its row stride. Tiles within one output row
+ * are stored in place, and tiles that span several strided rows go to the scratch tile, which finish_output_tile copies.
+ */
+static inline uint8_t* start_output_tile(
+    const struct output_rows* rows,
+    uint8_t* c,
+    size_t c_stride,
+    size_t pixel,
+    size_t mr,
+    uint8_t* tile,
+    size_t* tile_stride)
+{
+  if (rows->width != 0 && (pixel % rows->image_pixels) % rows->width + mr > rows->width) {
+    *tile_stride = OUTPUT_TILE_STRIDE;
+    return tile;
+  }
+  *tile_stride = c_stride;
+  return c + output_pixel_offset(rows, pixel, c_stride);
+}
+
+static inline void finish_output_tile(
+    const struct output_rows* rows,
+    uint8_t* c,
+    size_t c_stride,
+    size_t pixel,
+    size_t mr,
+    size_t nr,
+    const uint8_t* tile,
+    const uint8_t* tile_c)
+{
+  if (tile_c == tile) {
+    for (size_t m = 0; m < mr; m++) {
+      memcpy(c + output_pixel_offset(rows, pixel + m, c_stride), tile + m * OUTPUT_TILE_STRIDE, nr);
+    }
+  }
+}
+
 struct q8gemm_context {
   size_t k;
   size_t k_stride;
@@ -29,8 +111,10 @@ struct q8gemm_context {
   const uint8_t* packed_w;
   uint8_t* c;
   size_t c_stride;
+  struct output_rows c_rows;
   union qnnp_conv_quantization_params quantization_params;
   const q8gemm_ukernel_function ukernel;
+  uint32_t nr;
 };
 
 static void compute_q8gemm(
@@ -51,18 +135,144 @@ static void compute_q8gemm(
   const uint8_t* restrict a = context->a;
   const size_t a_stride = context->a_stride;
   const void* restrict packed_w = context->packed_w;
-  uint8_t* restrict c = context->c;
+  uint8_t* restrict c = context->c + nr_block_start + group_index * n;
   const size_t c_stride = context->c_stride;
+  const size_t pixel = pixel_index + mr_block_start;
 
+  uint8_t tile[OUTPUT_TILE_SIZE];
+  size_t tile_stride;
+  uint8_t* tile_c = start_output_tile(&context->c_rows, c, c_stride, pixel, mr_block_size, tile, &tile_stride);
   context->ukernel(
       mr_block_size,
       nr_block_size,
       k,
-      a + (pixel_index + mr_block_start) * a_stride + group_index * k,
+      a + pixel * a_stride + group_index * k,
       a_stride,
       (const void*) ((uintptr_t) packed_w + (nr_block_start + group_index * n_stride) * (k_stride * sizeof(uint8_t) + sizeof(int32_t))),
-      c + (pixel_index + mr_block_start) * c_stride + nr_block_start + group_index * n,
-      c_stride,
+      tile_c,
+      tile_stride,
+      &context->quantization_params);
+  finish_output_tile(&context->c_rows, c, c_stride, pixel, mr_block_size, nr_block_size, tile, tile_c);
+}
+
+static void compute_q8gemm_grouped(
+    const struct q8gemm_context context[restrict static 1],
+    size_t mr_block_start,
+    size_t group_start,
+    size_t mr_block_size,
+    size_t group_range)
+{
+  const size_t k = context->k;
+  const size_t k_stride = context->k_stride;
+  const size_t n = context->n;
+  const size_t n_stride = context->n_stride;
+  const size_t nr = context->nr;
+  const size_t a_stride = context->a_stride;
+  const size_t c_stride = context->c_stride;
+  const uint8_t* a = context->a + mr_block_start * a_stride + group_start * k;
+  const void* packed_w = (const void*) ((uintptr_t) context->packed_w +
+    group_start * n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+  uint8_t* c = context->c + group_start * n;
+
+  uint8_t tile[OUTPUT_TILE_SIZE];
+  for (size_t group = 0; group < group_range; group++) {
+    for (size_t nr_block_start = 0; nr_block_start < n; nr_block_start += nr) {
+      const size_t nr_block_size = min(n - nr_block_start, nr);
+      size_t tile_stride;
+      uint8_t* tile_c = start_output_tile(
+        &context->c_rows, c + nr_block_start, c_stride, mr_block_start, mr_block_size, tile, &tile_stride);
+      context->ukernel(
+          mr_block_size,
+          nr_block_size,
+          k,
+          a,
+          a_stride,
+          (const void*) ((uintptr_t) packed_w + nr_block_start * (k_stride * sizeof(uint8_t) + sizeof(int32_t))),
+          tile_c,
+          tile_stride,
+          &context->quantization_params);
+      finish_output_tile(
+        &context->c_rows, c + nr_block_start, c_stride, mr_block_start, mr_block_size, nr_block_size, tile, tile_c);
+    }
+    a += k;
+    packed_w = (const void*) ((uintptr_t) packed_w + n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+    c += n;
+  }
+}
+
+struct batch_matmul_context {
+  size_t k;
+  size_t k_stride;
+  size_t n;
+  size_t n_stride;
+  uint32_t nr;
+  uint32_t kr;
+  const uint8_t* a;
+  size_t a_batch_stride;
+  const uint8_t* b;
+  size_t b_batch_stride;
+  size_t b_k_stride;
+  size_t b_n_stride;
+  void* packed_b;
+  size_t packed_b_batch_stride;
+  uint8_t* c;
+  size_t c_batch_stride;
+  uint8_t a_zero_point;
+  uint8_t b_zero_point;
+  union qnnp_conv_quantization_params quantization_params;
+  q8gemm_ukernel_function ukernel;
+  /* Packs row-major B panels; NULL if B is transposed and packed by the portable code */
+  q8packb_ukernel_function packb_ukernel;
+};
+
+static void compute_batch_matmul_pack(
+    const struct batch_matmul_context context[restrict static 1],
+    size_t batch_index,
+    size_t nr_block_index)
+{
+  const size_t nr_block_start = nr_block_index * context->nr;
+  const size_t nr_block_size = min(context->n - nr_block_start, context->nr);
+  const uint8_t* b = context->b + batch_index * context->b_batch_stride + nr_block_start * context->b_n_stride;
+  void* packed_b = (void*) ((uintptr_t) context->packed_b + batch_index * context->packed_b_batch_stride +
+    nr_block_start * (context->k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+  if (context->packb_ukernel != NULL) {
+    context->packb_ukernel(
+      context->k, nr_block_size,
+      b, context->b_k_stride,
+      context->a_zero_point, context->b_zero_point,
+      packed_b);
+  } else {
+    pack_q8gemm_b(
+      nr_block_size, context->k,
+      context->nr, context->kr,
+      context->a_zero_point, context->b_zero_point,
+      b, context->b_k_stride, context->b_n_stride,
+      packed_b);
+  }
+}
+
+static void compute_batch_matmul(
+    const struct batch_matmul_context context[restrict static 1],
+    size_t batch_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t batch_range /* always 1 */,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t k = context->k;
+  const size_t n = context->n;
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      k,
+      context->a + batch_index * context->a_batch_stride + mr_block_start * k,
+      k * sizeof(uint8_t),
+      (const void*) ((uintptr_t) context->packed_b + batch_index * context->packed_b_batch_stride +
+        nr_block_start * (context->k_stride * sizeof(uint8_t) + sizeof(int32_t))),
+      context->c + batch_index * context->c_batch_stride + mr_block_start * n + nr_block_start,
+      n * sizeof(uint8_t),
       &context->quantization_params);
 }
 
@@ -173,8 +383,10 @@ struct q8conv_context {
   const void* packed_w;
   uint8_t* c;
   size_t c_stride;
+  struct output_rows c_rows;
   union qnnp_conv_quantization_params quantization_params;
   const q8conv_ukernel_function ukernel;
+  uint32_t nr;
 };
 
 static void compute_q8conv(
@@ -198,9 +410,13 @@ static void compute_q8conv(
   const size_t n_stride = context->n_stride;
   const uint8_t** restrict indirect_a = context->indirect_a;
   const void* restrict packed_w = context->packed_w;
-  uint8_t* restrict c = context->c;
+  uint8_t* restrict c = context->c + group_index * n + nr_block_start;
   const size_t c_stride = context->c_stride;
+  const size_t pixel = mr_block_start + image_index * m;
 
+  uint8_t tile[OUTPUT_TILE_SIZE];
+  size_t tile_stride;
+  uint8_t* tile_c = start_output_tile(&context->c_rows, c, c_stride, pixel, mr_block_size, tile, &tile_stride);
   context->ukernel(
       mr_block_size,
       nr_block_size,
@@ -208,14 +424,323 @@ static void compute_q8conv(
       ks,
       indirect_a + (mr_block_start + (image_index + group_index * bs) * m_stride) * ks,
       (const void*) ((uintptr_t) packed_w + (nr_block_start + group_index * n_stride) * (kc_stride * sizeof(uint8_t) + sizeof(int32_t))),
-      c + (mr_block_start + image_index * m) * c_stride + group_index * n + nr_block_start,
-      c_stride,
+      tile_c,
+      tile_stride,
+      &context->quantization_params);
+  finish_output_tile(&context->c_rows, c, c_stride, pixel, mr_block_size, nr_block_size, tile, tile_c);
+}
+
+static void compute_q8conv_grouped(
+    const struct q8conv_context context[restrict static 1],
+    size_t image_index,
+    size_t mr_block_start,
+    size_t group_start,
+    size_t image_range /* always 1 */,
+    size_t mr_block_size,
+    size_t group_range)
+{
+  const size_t bs = context->bs;
+  const size_t ks = context->ks;
+  const size_t kc = context->kc;
+  const size_t kc_stride = context->kc_stride;
+  const size_t m_stride = context->m_stride;
+  const size_t n = context->n;
+  const size_t n_stride = context->n_stride;
+  const size_t nr = context->nr;
+  const size_t c_stride = context->c_stride;
+  const size_t pixel = mr_block_start + image_index * context->m;
+  uint8_t* c = context->c + group_start * n;
+
+  uint8_t tile[OUTPUT_TILE_SIZE];
+  for (size_t group_index = group_start; group_index < group_start + group_range; group_index++) {
+    const uint8_t** indirect_a = context->indirect_a + (mr_block_start + (image_index + group_index * bs) * m_stride) * ks;
+    const void* packed_w = (const void*) ((uintptr_t) context->packed_w +
+      group_index * n_stride * (kc_stride * sizeof(uint8_t) + sizeof(int32_t)));
+    for (size_t nr_block_start = 0; nr_block_start < n; nr_block_start += nr) {
+      const size_t nr_block_size = min(n - nr_block_start, nr);
+      size_t tile_stride;
+      uint8_t* tile_c = start_output_tile(
+        &context->c_rows, c + nr_block_start, c_stride, pixel, mr_block_size, tile, &tile_stride);
+      context->ukernel(
+          mr_block_size,
+          nr_block_size,
+          kc,
+          ks,
+          indirect_a,
+          (const void*) ((uintptr_t) packed_w + nr_block_start * (kc_stride * sizeof(uint8_t) + sizeof(int32_t))),
+          tile_c,
+          tile_stride,
+          &context->quantization_params);
+      finish_output_tile(
+        &context->c_rows, c + nr_block_start, c_stride, pixel, mr_block_size, nr_block_size, tile, tile_c);
+    }
+    c += n;
+  }
+}
+
+struct q8dconv_context {
+  size_t bs;
+  size_t kc;
+  size_t kc_stride;
+  size_t n;
+  size_t n_stride;
+  size_t kernel_height;
+  size_t kernel_width;
+  const uint8_t* a;
+  size_t a_image_stride;
+  size_t a_row_stride;
+  size_t a_pixel_stride;
+  size_t a_window_row_stride;
+  size_t a_window_col_stride;
+  size_t a_group_stride;
+  size_t input_padding_top;
+  size_t input_padding_left;
+  size_t stride_height;
+  size_t stride_width;
+  const uint8_t** indirect_a;
+  size_t indirect_image_tiles;
+  size_t row_tiles;
+  size_t interior_row_tiles;
+  size_t output_height;
+  size_t output_width;
+  size_t output_y_begin;
+  size_t output_y_end;
+  size_t output_x_begin;
+  size_t output_x_end;
+  const void* packed_w;
+  uint8_t* c;
+  size_t c_stride;
+  size_t c_row_stride;
+  size_t c_image_stride;
+  union qnnp_conv_quantization_params quantization_params;
+  q8conv_ukernel_function conv_ukernel;
+  q8dconv_ukernel_function dconv_ukernel;
+  uint32_t mr;
+};
+
+static void compute_q8dconv(
+    const struct q8dconv_context context[restrict static 1],
+    size_t group_index,
+    size_t image_index,
+    size_t output_y,
+    size_t nr_block_start,
+    size_t group_range /* always 1 */,
+    size_t image_range /* always 1 */,
+    size_t output_y_range /* always 1 */,
+    size_t nr_block_size)
+{
+  const size_t mr = context->mr;
+  const size_t kc = context->kc;
+  const size_t ks = context->kernel_height * context->kernel_width;
+  const size_t output_width = context->output_width;
+  const size_t output_y_begin = context->output_y_begin;
+  const size_t output_y_end = context->output_y_end;
+  const size_t c_stride = context->c_stride;
+  const void* packed_w = (const void*) ((uintptr_t) context->packed_w +
+    (nr_block_start + group_index * context->n_stride) * (context->kc_stride * sizeof(uint8_t) + sizeof(int32_t)));
+  uint8_t* c = context->c + image_index * context->c_image_stride + output_y * context->c_row_stride +
+    group_index * context->n + nr_block_start;
+
+  /* Border tiles of the rows above this one precede its tiles in the indirection buffer */
+  const size_t row_tile_offset =
+    min(output_y, output_y_begin) * context->row_tiles +
+    doz(min(output_y, output_y_end), output_y_begin) * context->interior_row_tiles +
+    doz(output_y, output_y_end) * context->row_tiles;
+  const uint8_t** indirect_a = context->indirect_a +
+    ((group_index * context->bs + image_index) * context->indirect_image_tiles + row_tile_offset) * mr * ks;
+
+  size_t output_x_begin = output_width;
+  size_t output_x_end = output_width;
+  if (output_y >= output_y_begin && output_y < output_y_end) {
+    output_x_begin = context->output_x_begin;
+    output_x_end = context->output_x_end;
+  }
+
+  for (size_t output_x = 0; output_x < output_x_begin; output_x += mr) {
+    context->conv_ukernel(
+        min(output_x_begin - output_x, mr), nr_block_size, kc, ks,
+        indirect_a, packed_w, c + output_x * c_stride, c_stride,
+        &context->quantization_params);
+    indirect_a += mr * ks;
+  }
+  if (output_x_begin != output_x_end) {
+    const size_t a_stride = context->stride_width * context->a_pixel_stride;
+    const uint8_t* a = context->a + image_index * context->a_image_stride + group_index * context->a_group_stride +
+      (output_y * context->stride_height - context->input_padding_top) * context->a_row_stride +
+      (output_x_begin * context->stride_width - context->input_padding_left) * context->a_pixel_stride;
+    for (size_t output_x = output_x_begin; output_x < output_x_end; output_x += mr) {
+      context->dconv_ukernel(
+          min(output_x_end - output_x, mr), nr_block_size, kc,
+          context->kernel_height, context->kernel_width,
+          a, a_stride, context->a_window_row_stride, context->a_window_col_stride,
+          packed_w, c + output_x * c_stride, c_stride,
+          &context->quantization_params);
+      a += mr * a_stride;
+    }
+  }
+  for (size_t output_x = output_x_end; output_x < output_width; output_x += mr) {
+    context->conv_ukernel(
+        min(output_width - output_x, mr), nr_block_size, kc, ks,
+        indirect_a, packed_w, c + output_x * c_stride, c_stride,
+        &context->quantization_params);
+    indirect_a += mr * ks;
+  }
+}
+
+struct row_conv_staging_context {
+  const uint8_t* input;
+  size_t input_pixel_stride;
+  size_t input_width;
+  size_t channels;
+  uint8_t* staged_input;
+  size_t staged_row_stride;
+  size_t staged_row_offset;
+};
+
+static void compute_row_conv_staging(
+    const struct row_conv_staging_context context[restrict static 1],
+    size_t row)
+{
+  const size_t input_pixel_stride = context->input_pixel_stride;
+  const size_t input_width = context->input_width;
+  const size_t channels = context->channels;
+  const uint8_t* input = context->input + row * input_width * input_pixel_stride;
+  uint8_t* staged_input = context->staged_input + row * context->staged_row_stride + context->staged_row_offset;
+
+  if (input_pixel_stride == channels) {
+    memcpy(staged_input, input, input_width * channels);
+  } else {
+    for (size_t x = 0; x < input_width; x++) {
+      memcpy(staged_input, input, channels);
+      staged_input += channels;
+      input += input_pixel_stride;
+    }
+  }
+}
+
+struct q8winograd_input_context {
+  size_t channels;
+  size_t k_stride;
+  size_t tiles;
+  const uint8_t** indirect_input;
+  int16_t* transformed_input;
+  union qnnp_conv_quantization_params quantization_params;
+  const q8winograd_input_ukernel_function ukernel;
+};
+
+static void compute_q8winograd_input(
+    const struct q8winograd_input_context context[restrict static 1],
+    size_t tile_index)
+{
+  const size_t k_stride = context->k_stride;
+
+  context->ukernel(
+      context->channels,
+      context->indirect_input + tile_index * 16,
+      context->transformed_input + tile_index * k_stride,
+      context->tiles * k_stride * sizeof(int16_t),
+      &context->quantization_params);
+}
+
+struct q8winograd_gemm_context {
+  size_t k_stride;
+  size_t tiles;
+  size_t n;
+  size_t n_stride;
+  const int16_t* transformed_input;
+  const int16_t* packed_w;
+  int32_t* transformed_output;
+  const q8winograd_gemm_ukernel_function ukernel;
+};
+
+static void compute_q8winograd_gemm(
+    const struct q8winograd_gemm_context context[restrict static 1],
+    size_t position,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t position_range /* always 1 */,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t k_stride = context->k_stride;
+  const size_t tiles = context->tiles;
+  const size_t n = context->n;
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      k_stride,
+      context->transformed_input + (position * tiles + mr_block_start) * k_stride,
+      k_stride * sizeof(int16_t),
+      context->packed_w + (position * context->n_stride + nr_block_start) * k_stride,
+      context->transformed_output + (position * tiles + mr_block_start) * n + nr_block_start,
+      n * sizeof(int32_t));
+}
+
+struct q8winograd_output_context {
+  size_t channels;
+  size_t tiles;
+  size_t tiles_height;
+  size_t tiles_width;
+  const int32_t* transformed_output;
+  const int32_t* bias;
+  uint8_t* output;
+  size_t output_height;
+  size_t output_width;
+  size_t output_pixel_stride;
+  size_t output_row_stride;
+  size_t output_image_stride;
+  union qnnp_conv_quantization_params quantization_params;
+  const q8winograd_output_ukernel_function ukernel;
+};
+
+static void compute_q8winograd_output(
+    const struct q8winograd_output_context context[restrict static 1],
+    size_t image,
+    size_t tile_y,
+    size_t tile_x,
+    size_t image_range /* always 1 */,
+    size_t tile_y_range /* always 1 */,
+    size_t tile_x_range /* always 1 */)
+{
+  const size_t channels = context->channels;
+  const size_t output_height = context->output_height;
+  const size_t output_width = context->output_width;
+  const size_t output_pixel_stride = context->output_pixel_stride;
+  const size_t tile_index = (image * context->tiles_height + tile_y) * context->tiles_width + tile_x;
+  const size_t output_y = tile_y * 2;
+  const size_t output_x = tile_x * 2;
+
+  /* Pixels outside of the output image alias the top-left pixel, which the micro-kernel stores last */
+  uint8_t* output[4];
+  output[0] = context->output + image * context->output_image_stride + output_y * context->output_row_stride +
+    output_x * output_pixel_stride;
+  output[1] = output[0];
+  output[2] = output[0];
+  output[3] = output[0];
+  if (output_x + 1 < output_width) {
+    output[1] = output[0] + output_pixel_stride;
+  }
+  if (output_y + 1 < output_height) {
+    output[2] = output[0] + context->output_row_stride;
+    if (output_x + 1 < output_width) {
+      output[3] = output[2] + output_pixel_stride;
+    }
+  }
+
+  context->ukernel(
+      channels,
+      context->transformed_output + tile_index * channels,
+      context->tiles * channels * sizeof(int32_t),
+      context->bias,
+      output,
       &context->quantization_params);
 }
 
 struct q8dw_context {
   size_t groups;
   size_t group_stride;
+  size_t kernel_size;
   const uint8_t** indirection_buffer;
   size_t indirection_buffer_row_stride;
   size_t indirection_buffer_col_stride;
@@ -223,13 +748,22 @@ struct q8dw_context {
   uint8_t* output;
   size_t output_height;
   size_t output_width;
+  size_t output_image_stride;
   size_t output_row_stride;
   size_t output_col_increment;
   union qnnp_conv_quantization_params quantization_params;
   union {
     const q8updw_ukernel_function unipass_ukernel;
     const q8mpdw_ukernel_function multipass_ukernel;
+    const q8updwm_ukernel_function generic_ukernel;
   };
+  /* Direct row processing of output pixels [output_x_begin, output_x_end), whose input columns are all inside the image */
+  const q8dwrow_ukernel_function row_ukernel;
+  size_t output_x_begin;
+  size_t output_x_end;
+  size_t input_pixel_stride;
+  size_t output_pixel_stride;
+  const void* zero;
 };
 
 static void compute_q8updw(
@@ -244,12 +778,69 @@ static void compute_q8updw(
     context->output_width,
     context->indirection_buffer + (image * output_height + output_y) * context->indirection_buffer_row_stride,
     context->packed_weights,
-    context->output + (image * output_height + output_y) * context->output_row_stride,
+    context->output + image * context->output_image_stride + output_y * context->output_row_stride,
     context->indirection_buffer_col_stride,
     context->output_col_increment,
     &context->quantization_params);
 }
 
+static void compute_q8dwrow(
+    const struct q8dw_context context[restrict static 1],
+    size_t image,
+    size_t output_y)
+{
+  const size_t output_height = context->output_height;
+  const size_t output_width = context->output_width;
+  const size_t output_pixel_stride = context->output_pixel_stride;
+  const size_t indirection_buffer_col_step = context->indirection_buffer_col_stride / sizeof(void*);
+  const uint8_t** indirection_buffer =
+    context->indirection_buffer + (image * output_height + output_y) * context->indirection_buffer_row_stride;
+  uint8_t* output = context->output + image * context->output_image_stride + output_y * context->output_row_stride;
+
+  size_t output_x_begin = context->output_x_begin;
+  size_t output_x_end = context->output_x_end;
+  const uint8_t** row_input = indirection_buffer + output_x_begin * indirection_buffer_col_step;
+  /* Rows in the vertical padding point to a single zero pixel, which can't be walked along the row */
+  if (row_input[0] == context->zero || row_input[1] == context->zero || row_input[2] == context->zero) {
+    output_x_begin = output_width;
+    output_x_end = output_width;
+  }
+
+  if (output_x_begin != 0) {
+    context->unipass_ukernel(
+      context->groups,
+      output_x_begin,
+      indirection_buffer,
+      context->packed_weights,
+      output,
+      context->indirection_buffer_col_stride,
+      context->output_col_increment,
+      &context->quantization_params);
+  }
+  if (output_x_begin != output_x_end) {
+    context->row_ukernel(
+      context->groups,
+      output_x_end - output_x_begin,
+      row_input[0], row_input[1], row_input[2],
+      context->input_pixel_stride,
+      context->packed_weights,
+      output + output_x_begin * output_pixel_stride,
+      output_pixel_stride,
+      &context->quantization_params);
+  }
+  if (output_x_end != output_width) {
+    context->unipass_ukernel(
+      context->groups,
+      output_width - output_x_end,
+      indirection_buffer + output_x_end * indirection_buffer_col_step,
+      context->packed_weights,
+      output + output_x_end * output_pixel_stride,
+      context->indirection_buffer_col_stride,
+      context->output_col_increment,
+      &context->quantization_params);
+  }
+}
+
 static void compute_q8mpdw(
     const struct q8dw_context context[restrict static 1],
     size_t image,
@@ -264,7 +855,26 @@ static void compute_q8mpdw(
     context->indirection_buffer + (image * output_height + output_y) * context->indirection_buffer_row_stride,
     context->packed_weights,
     multipass_acc,
-    context->output + (image * output_height + output_y) * context->output_row_stride,
+    context->output + image * context->output_image_stride + output_y * context->output_row_stride,
+    context->indirection_buffer_col_stride,
+    context->output_col_increment,
+    &context->quantization_params);
+}
+
+static void compute_q8updwm(
+    const struct q8dw_context context[restrict static 1],
+    size_t image,
+    size_t output_y)
+{
+  const size_t output_height = context->output_height;
+
+  context->generic_ukernel(
+    context->groups,
+    context->output_width,
+    context->kernel_size,
+    context->indirection_buffer + (image * output_height + output_y) * context->indirection_buffer_row_stride,
+    context->packed_weights,
+    context->output + image * context->output_image_stride + output_y * context->output_row_stride,
     context->indirection_buffer_col_stride,
     context->output_col_increment,
     &context->quantization_params);
@@ -304,6 +914,58 @@ static void compute_max_pooling(
     &context->params);
 }
 
+struct resize_bilinear_context {
+  const void** indirect_input;
+  const int16_t* weights;
+  void* output;
+  size_t output_pixel_stride;
+  size_t output_height;
+  size_t output_width;
+  size_t channels;
+  u8ibilinear_ukernel_function ukernel;
+};
+
+static void compute_resize_bilinear(
+    const struct resize_bilinear_context context[restrict static 1],
+    size_t batch_index,
+    size_t output_y)
+{
+  const size_t output_width = context->output_width;
+  const size_t pixel_index = (batch_index * context->output_height + output_y) * output_width;
+
+  context->ukernel(
+    output_width, context->channels,
+    (const uint8_t**) context->indirect_input + pixel_index * 4,
+    context->weights + pixel_index * 2,
+    (uint8_t*) context->output + pixel_index * context->output_pixel_stride,
+    (context->output_pixel_stride - context->channels) * sizeof(uint8_t));
+}
+
+struct resize_nearest_context {
+  const void** indirect_input;
+  void* output;
+  size_t output_pixel_stride;
+  size_t output_height;
+  size_t output_width;
+  size_t channels;
+};
+
+static void compute_resize_nearest(
+    const struct resize_nearest_context context[restrict static 1],
+    size_t batch_index,
+    size_t output_y)
+{
+  const size_t output_width = context->output_width;
+  const size_t pixel_index = (batch_index * context->output_height + output_y) * output_width;
+  const void** indirect_input = context->indirect_input + pixel_index;
+  uint8_t* output = (uint8_t*) context->output + pixel_index * context->output_pixel_stride;
+
+  for (size_t output_x = 0; output_x < output_width; output_x++) {
+    memcpy(output, indirect_input[output_x], context->channels * sizeof(uint8_t));
+    output += context->output_pixel_stride;
+  }
+}
+
 struct average_pooling_context {
   const void** indirect_input;
   size_t indirect_input_batch_stride;
@@ -468,37 +1130,1096 @@ static void compute_q8add_contiguous(
   context->ukernel(size, a, b, y, &context->quantization_params);
 }
 
-struct channel_shuffle_context {
-  const void* x;
-  size_t x_stride;
-  void* y;
-  size_t y_stride;
+struct add_lut_context {
   size_t n;
-  size_t m;
-  union {
-    xzipc_ukernel_function fixed_ukernel;
-    xzipv_ukernel_function variable_ukernel;
-  };
-};
-
+  const uint8_t* a;
+  size_t a_stride;
+  const uint8_t* b;
+  size_t b_stride;
+  const uint8_t* t;
+  uint8_t* y;
+  size_t y_stride;
+  union qnnp_add_quantization_params quantization_params;
+  q8uvadd_ukernel_function add_ukernel;
+  x8lut_ukernel_function lut_ukernel;
+};
+
+static void compute_add_lut_contiguous(
+    const struct add_lut_context context[restrict static 1],
+    size_t offset,
+    size_t size)
+{
+  uint8_t sum[QNNP_ADD_LUT_BLOCK_SIZE];
+  context->add_ukernel(size, context->a + offset, context->b + offset, sum, &context->quantization_params);
+  context->lut_ukernel(size, sum, context->t, context->y + offset);
+}
+
+static void compute_add_lut_strided(
+    const struct add_lut_context context[restrict static 1],
+    size_t batch_index)
+{
+  const size_t n = context->n;
+  const uint8_t* a = context->a + batch_index * context->a_stride;
+  const uint8_t* b = context->b + batch_index * context->b_stride;
+  uint8_t* y = context->y + batch_index * context->y_stride;
+
+  uint8_t sum[QNNP_ADD_LUT_BLOCK_SIZE];
+  for (size_t offset = 0; offset < n; offset += QNNP_ADD_LUT_BLOCK_SIZE) {
+    const size_t size = min(n - offset, QNNP_ADD_LUT_BLOCK_SIZE);
+    context->add_ukernel(size, a + offset, b + offset, sum, &context->quantization_params);
+    context->lut_ukernel(size, sum, context->t, y + offset);
+  }
+}
+
+struct concat_context {
+  size_t inputs;
+  const struct qnnp_concat_input* concat_inputs;
+  void* y;
+  size_t y_stride;
+  q8uvadd_ukernel_function ukernel;
+};
+
+static void compute_concat(
+    const struct concat_context context[restrict static 1],
+    size_t block_start,
+    size_t block_size)
+{
+  const size_t inputs = context->inputs;
+  const struct qnnp_concat_input* concat_inputs = context->concat_inputs;
+  const size_t y_stride = context->y_stride;
+
+  /* Every task assembles complete output rows, so each row is written by one thread in a single pass */
+  for (size_t batch_index = block_start; batch_index < block_start + block_size; batch_index++) {
+    uint8_t* y_row = (uint8_t*) ((uintptr_t) context->y + batch_index * y_stride);
+    for (size_t i = 0; i < inputs; i++) {
+      const struct qnnp_concat_input* concat_input = &concat_inputs[i];
+      if (concat_input->bound) {
+        continue;
+      }
+
+      const uint8_t* x = (const uint8_t*) ((uintptr_t) concat_input->input + batch_index * concat_input->input_pixel_stride);
+      uint8_t* y = y_row + concat_input->channel_offset;
+      if (concat_input->requantize) {
+        context->ukernel(concat_input->channels, x, x, y, &concat_input->add_quantization_params);
+      } else {
+        memcpy(y, x, concat_input->channels);
+      }
+    }
+  }
+}
+
+struct channel_shuffle_context {
+  const void* x;
+  size_t x_stride;
+  void* y;
+  size_t y_stride;
+  size_t n;
+  size_t m;
+  union {
+    xzipc_ukernel_function fixed_ukernel;
+    xzipv_ukernel_function variable_ukernel;
+  };
+};
+
 static void compute_channel_shuffle_fixed(
     const struct channel_shuffle_context context[restrict static 1],
-    size_t index)
+    size_t block_start,
+    size_t block_size)
+{
+  const void* x = (const void*) ((uintptr_t) context->x + block_start * context->x_stride);
+  void* y = (void*) ((uintptr_t) context->y + block_start * context->y_stride);
+
+  do {
+    context->fixed_ukernel(context->n, x, y);
+    x = (const void*) ((uintptr_t) x + context->x_stride);
+    y = (void*) ((uintptr_t) y + context->y_stride);
+  } while (--block_size != 0);
+}
+
+static void compute_channel_shuffle_variable(
+    const struct channel_shuffle_context context[restrict static 1],
+    size_t block_start,
+    size_t block_size)
+{
+  const void* x = (const void*) ((uintptr_t) context->x + block_start * context->x_stride);
+  void* y = (void*) ((uintptr_t) context->y + block_start * context->y_stride);
+
+  do {
+    context->variable_ukernel(context->n, context->m, x, y);
+    x = (const void*) ((uintptr_t) x + context->x_stride);
+    y = (void*) ((uintptr_t) y + context->y_stride);
+  } while (--block_size != 0);
+}
+
+/*
+ * Channel shuffle of pixels pixels with groups groups of group_channels channels. A single pixel is often only a few
+ * hundred bytes, so every task shuffles a block of pixels.
+ */
+static void shuffle_channels(
+    pthreadpool_t threadpool,
+    size_t pixels,
+    size_t groups,
+    size_t group_channels,
+    const void* x,
+    size_t x_stride,
+    void* y,
+    size_t y_stride)
+{
+  struct channel_shuffle_context channel_shuffle_context = {
+    .x = x,
+    .x_stride = x_stride * sizeof(uint8_t),
+    .y = y,
+    .y_stride = y_stride * sizeof(uint8_t),
+    .n = group_channels * sizeof(uint8_t),
+    .m = groups,
+  };
+  pthreadpool_function_1d_tiled_t compute_function = NULL;
+  switch (groups) {
+    case 2:
+      compute_function = (pthreadpool_function_1d_tiled_t) compute_channel_shuffle_fixed;
+      channel_shuffle_context.fixed_ukernel = qnnp_params.x8zip.x2;
+      break;
+    case 3:
+      compute_function = (pthreadpool_function_1d_tiled_t) compute_channel_shuffle_fixed;
+      channel_shuffle_context.fixed_ukernel = qnnp_params.x8zip.x3;
+      break;
+    case 4:
+      compute_function = (pthreadpool_function_1d_tiled_t) compute_channel_shuffle_fixed;
+      channel_shuffle_context.fixed_ukernel = qnnp_params.x8zip.x4;
+      break;
+    default:
+      compute_function = (pthreadpool_function_1d_tiled_t) compute_channel_shuffle_variable;
+      channel_shuffle_context.variable_ukernel = qnnp_params.x8zip.xm;
+      break;
+    case 0:
+    case 1:
+      QNNP_UNREACHABLE;
+  }
+  const size_t block_size = divide_round_up(4096, groups * group_channels);
+  pthreadpool_compute_1d_tiled(
+    threadpool,
+    compute_function,
+    &channel_shuffle_context,
+    pixels, block_size);
+}
+
+struct channel_gather_context {
+  const uint8_t* x;
+  size_t x_stride;
+  uint8_t* y;
+  size_t y_stride;
+  size_t channels;
+  const size_t* permutation;
+};
+
+static void compute_channel_gather(
+    const struct channel_gather_context context[restrict static 1],
+    size_t block_start,
+    size_t block_size)
+{
+  const size_t channels = context->channels;
+  const size_t* permutation = context->permutation;
+  const uint8_t* x = context->x + block_start * context->x_stride;
+  uint8_t* y = context->y + block_start * context->y_stride;
+
+  do {
+    for (size_t channel = 0; channel < channels; channel++) {
+      y[channel] = x[permutation[channel]];
+    }
+    x += context->x_stride;
+    y += context->y_stride;
+  } while (--block_size != 0);
+}
+
+struct transpose_context {
+  const uint8_t* x;
+  uint8_t* y;
+  /* Output dimensions iterated outside of the copied runs or transposed tiles, outermost first */
+  size_t outer_dims;
+  size_t outer_shape[QNNP_MAX_TRANSPOSE_DIMS];
+  size_t outer_x_stride[QNNP_MAX_TRANSPOSE_DIMS];
+  size_t outer_y_stride[QNNP_MAX_TRANSPOSE_DIMS];
+  size_t n;
+  size_t x_stride;
+  size_t y_stride;
+  x8transpose_ukernel_function ukernel;
+};
+
+static inline void compute_transpose_offsets(
+    const struct transpose_context context[restrict static 1],
+    size_t index,
+    size_t x_offset[restrict static 1],
+    size_t y_offset[restrict static 1])
+{
+  size_t x = 0, y = 0;
+  for (size_t i = context->outer_dims; i != 0; i--) {
+    const size_t size = context->outer_shape[i - 1];
+    const size_t coordinate = index % size;
+    index /= size;
+    x += coordinate * context->outer_x_stride[i - 1];
+    y += coordinate * context->outer_y_stride[i - 1];
+  }
+  *x_offset = x;
+  *y_offset = y;
+}
+
+static void compute_transpose_contiguous(
+    const struct transpose_context context[restrict static 1],
+    size_t block_start,
+    size_t block_size)
+{
+  memcpy(context->y + block_start, context->x + block_start, block_size);
+}
+
+static void compute_transpose_copy(
+    const struct transpose_context context[restrict static 1],
+    size_t block_start,
+    size_t block_size)
+{
+  for (size_t index = block_start; index < block_start + block_size; index++) {
+    size_t x_offset, y_offset;
+    compute_transpose_offsets(context, index, &x_offset, &y_offset);
+    memcpy(context->y + y_offset, context->x + x_offset, context->n);
+  }
+}
+
+static void compute_transpose_tile(
+    const struct transpose_context context[restrict static 1],
+    size_t index,
+    size_t column_start,
+    size_t row_start,
+    size_t index_range,
+    size_t columns,
+    size_t rows)
+{
+  size_t x_offset, y_offset;
+  compute_transpose_offsets(context, index, &x_offset, &y_offset);
+
+  context->ukernel(
+    rows, columns,
+    context->x + x_offset + row_start * context->x_stride + column_start,
+    context->x_stride,
+    context->y + y_offset + column_start * context->y_stride + row_start,
+    context->y_stride);
+}
+
+struct depth_to_space_context {
+  const uint8_t* x;
+  size_t x_stride;
+  uint8_t* y;
+  size_t y_stride;
+  size_t width;
+  size_t block_size;
+  size_t channels;
+};
+
+static void compute_depth_to_space(
+    const struct depth_to_space_context context[restrict static 1],
+    size_t input_y,
+    size_t block_y)
+{
+  const size_t width = context->width;
+  const size_t block_size = context->block_size;
+  const size_t channels = context->channels;
+  const size_t x_stride = context->x_stride;
+  const size_t y_stride = context->y_stride;
+  const uint8_t* x = context->x + input_y * width * x_stride + block_y * block_size * channels;
+  uint8_t* y = context->y + (input_y * block_size + block_y) * width * block_size * y_stride;
+
+  if (y_stride == channels) {
+    /* Output pixels of a block row are adjacent, so each input pixel contributes one run */
+    const size_t n = block_size * channels;
+    for (size_t i = 0; i < width; i++) {
+      memcpy(y, x, n);
+      x += x_stride;
+      y += n;
+    }
+  } else {
+    for (size_t i = 0; i < width; i++) {
+      for (size_t block_x = 0; block_x < block_size; block_x++) {
+        memcpy(y, x + block_x * channels, channels);
+        y += y_stride;
+      }
+      x += x_stride;
+    }
+  }
+}
+
+static void compute_space_to_depth(
+    const struct depth_to_space_context context[restrict static 1],
+    size_t output_y,
+    size_t block_y)
+{
+  const size_t width = context->width;
+  const size_t block_size = context->block_size;
+  const size_t channels = context->channels;
+  const size_t x_stride = context->x_stride;
+  const size_t y_stride = context->y_stride;
+  const uint8_t* x = context->x + (output_y * block_size + block_y) * width * block_size * x_stride;
+  uint8_t* y = context->y + output_y * width * y_stride + block_y * block_size * channels;
+
+  if (x_stride == channels) {
+    /* Input pixels of a block row are adjacent, so each output pixel receives one run */
+    const size_t n = block_size * channels;
+    for (size_t i = 0; i < width; i++) {
+      memcpy(y, x, n);
+      x += n;
+      y += y_stride;
+    }
+  } else {
+    for (size_t i = 0; i < width; i++) {
+      for (size_t block_x = 0; block_x < block_size; block_x++) {
+        memcpy(y + block_x * channels, x, channels);
+        x += x_stride;
+      }
+      y += y_stride;
+    }
+  }
+}
+
+struct pad_context {
+  const uint8_t* x;
+  size_t x_pixel_stride;
+  size_t x_row_stride;
+  size_t x_image_stride;
+  size_t input_height;
+  size_t input_width;
+  uint8_t* y;
+  size_t y_pixel_stride;
+  size_t y_row_stride;
+  size_t y_image_stride;
+  size_t output_width;
+  size_t padding_top;
+  size_t padding_left;
+  size_t channels;
+  enum qnnp_padding_mode padding_mode;
+  uint8_t padding_value;
+  /* Input is the interior of the output, and only the border pixels are written */
+  bool bound;
+};
+
+static inline void pad_fill_pixels(
+    const struct pad_context context[restrict static 1],
+    uint8_t* y,
+    size_t n)
+{
+  const size_t channels = context->channels;
+  const size_t y_pixel_stride = context->y_pixel_stride;
+  if (y_pixel_stride == channels) {
+    memset(y, context->padding_value, n * channels);
+  } else {
+    for (size_t i = 0; i < n; i++) {
+      memset(y, context->padding_value, channels);
+      y += y_pixel_stride;
+    }
+  }
+}
+
+static inline size_t pad_source_index(enum qnnp_padding_mode padding_mode, ptrdiff_t index, size_t size)
+{
+  if (index < 0) {
+    return padding_mode == qnnp_padding_mode_reflect ? (size_t) -index : 0;
+  } else if ((size_t) index >= size) {
+    return padding_mode == qnnp_padding_mode_reflect ? 2 * (size - 1) - (size_t) index : size - 1;
+  } else {
+    return (size_t) index;
+  }
+}
+
+static void compute_pad(
+    const struct pad_context context[restrict static 1],
+    size_t image,
+    size_t output_y)
+{
+  const size_t channels = context->channels;
+  const size_t input_width = context->input_width;
+  const size_t output_width = context->output_width;
+  const size_t padding_left = context->padding_left;
+  const size_t x_pixel_stride = context->x_pixel_stride;
+  const size_t y_pixel_stride = context->y_pixel_stride;
+  const enum qnnp_padding_mode padding_mode = context->padding_mode;
+  uint8_t* y = context->y + image * context->y_image_stride + output_y * context->y_row_stride;
+
+  const ptrdiff_t input_y = (ptrdiff_t) output_y - (ptrdiff_t) context->padding_top;
+  const bool border_row = input_y < 0 || (size_t) input_y >= context->input_height;
+  if (padding_mode == qnnp_padding_mode_constant && border_row) {
+    pad_fill_pixels(context, y, output_width);
+    return;
+  }
+  const uint8_t* x = context->x + image * context->x_image_stride +
+    pad_source_index(padding_mode, input_y, context->input_height) * context->x_row_stride;
+
+  if (padding_mode == qnnp_padding_mode_constant) {
+    pad_fill_pixels(context, y, padding_left);
+    pad_fill_pixels(context, y + (padding_left + input_width) * y_pixel_stride,
+      output_width - padding_left - input_width);
+  } else {
+    for (size_t output_x = 0; output_x < padding_left; output_x++) {
+      const ptrdiff_t input_x = (ptrdiff_t) output_x - (ptrdiff_t) padding_left;
+      memcpy(y + output_x * y_pixel_stride,
+        x + pad_source_index(padding_mode, input_x, input_width) * x_pixel_stride, channels);
+    }
+    for (size_t output_x = padding_left + input_width; output_x < output_width; output_x++) {
+      const ptrdiff_t input_x = (ptrdiff_t) output_x - (ptrdiff_t) padding_left;
+      memcpy(y + output_x * y_pixel_stride,
+        x + pad_source_index(padding_mode, input_x, input_width) * x_pixel_stride, channels);
+    }
+  }
+
+  /* Interior pixels of a bound input are already in place, except in border rows replicated from interior rows */
+  if (!context->bound || border_row) {
+    y += padding_left * y_pixel_stride;
+    if (x_pixel_stride == channels && y_pixel_stride == channels) {
+      memcpy(y, x, input_width * channels);
+    } else {
+      for (size_t i = 0; i < input_width; i++) {
+        memcpy(y, x, channels);
+        x += x_pixel_stride;
+        y += y_pixel_stride;
+      }
+    }
+  }
+}
+
+struct argmax_context {
+  const uint8_t* x;
+  size_t x_stride;
+  size_t n;
+  size_t blocks;
+  uint64_t* block_maxima;
+  uint32_t* y;
+  u8argmax_ukernel_function ukernel;
+};
+
+static void compute_argmax(
+    const struct argmax_context context[restrict static 1],
+    size_t batch_index)
+{
+  size_t index;
+  context->ukernel(context->n, context->x + batch_index * context->x_stride, &index);
+  context->y[batch_index] = (uint32_t) index;
+}
+
+static void compute_argmax_block(
+    const struct argmax_context context[restrict static 1],
+    size_t batch_index,
+    size_t block_index)
+{
+  const size_t block_start = block_index * QNNP_SELECTION_BLOCK_CHANNELS;
+  const size_t block_size = min(context->n - block_start, QNNP_SELECTION_BLOCK_CHANNELS);
+
+  size_t index;
+  const uint8_t max = context->ukernel(block_size, context->x + batch_index * context->x_stride + block_start, &index);
+  /* Packed such that a larger value, and then a smaller index, compares greater */
+  context->block_maxima[batch_index * context->blocks + block_index] =
+    ((uint64_t) max << 32) | (uint64_t) (UINT32_MAX - (uint32_t) (block_start + index));
+}
+
+static void compute_argmax_reduce(
+    const struct argmax_context context[restrict static 1],
+    size_t batch_index)
+{
+  const uint64_t* block_maxima = context->block_maxima + batch_index * context->blocks;
+  uint64_t max = block_maxima[0];
+  for (size_t i = 1; i < context->blocks; i++) {
+    max = block_maxima[i] > max ? block_maxima[i] : max;
+  }
+  context->y[batch_index] = UINT32_MAX - (uint32_t) max;
+}
+
+struct top_k_context {
+  const uint8_t* x;
+  size_t x_stride;
+  size_t n;
+  size_t k;
+  size_t blocks;
+  uint32_t* histograms;
+  uint8_t* thresholds;
+  uint8_t* y_values;
+  uint32_t* y_indices;
+  size_t y_stride;
+};
+
+static void compute_top_k_histogram(
+    const struct top_k_context context[restrict static 1],
+    size_t batch_index,
+    size_t block_index)
+{
+  const size_t block_start = block_index * QNNP_SELECTION_BLOCK_CHANNELS;
+  const size_t block_size = min(context->n - block_start, QNNP_SELECTION_BLOCK_CHANNELS);
+  const uint8_t* x = context->x + batch_index * context->x_stride + block_start;
+  uint32_t* histogram = context->histograms + (batch_index * context->blocks + block_index) * 256;
+
+  memset(histogram, 0, 256 * sizeof(uint32_t));
+  for (size_t i = 0; i < block_size; i++) {
+    histogram[x[i]] += 1;
+  }
+}
+
+static void compute_top_k_offsets(
+    const struct top_k_context context[restrict static 1],
+    size_t batch_index)
+{
+  const size_t blocks = context->blocks;
+  uint32_t* histograms = context->histograms + batch_index * blocks * 256;
+
+  uint32_t offsets[256] = { 0 };
+  for (size_t b = 0; b < blocks; b++) {
+    for (size_t v = 0; v < 256; v++) {
+      offsets[v] += histograms[b * 256 + v];
+    }
+  }
+
+  /*
+   * Values from 255 down to the threshold fill the k outputs; channels of the threshold value beyond the k-th output
+   * are dropped. Counts become output positions of the first channel of each value, in decreasing order of value.
+   */
+  size_t threshold = 255;
+  uint32_t position = 0;
+  for (;;) {
+    const uint32_t count = offsets[threshold];
+    offsets[threshold] = position;
+    position += count;
+    if (position >= context->k) {
+      break;
+    }
+    threshold -= 1;
+  }
+
+  /* Blocks take consecutive output positions within each value, preserving the order of channel indices */
+  for (size_t b = 0; b < blocks; b++) {
+    for (size_t v = threshold; v < 256; v++) {
+      const uint32_t count = histograms[b * 256 + v];
+      histograms[b * 256 + v] = offsets[v];
+      offsets[v] += count;
+    }
+  }
+  context->thresholds[batch_index] = (uint8_t) threshold;
+}
+
+static void compute_top_k_select(
+    const struct top_k_context context[restrict static 1],
+    size_t batch_index,
+    size_t block_index)
+{
+  const size_t block_start = block_index * QNNP_SELECTION_BLOCK_CHANNELS;
+  const size_t block_size = min(context->n - block_start, QNNP_SELECTION_BLOCK_CHANNELS);
+  const uint8_t* x = context->x + batch_index * context->x_stride + block_start;
+  uint32_t* positions = context->histograms + (batch_index * context->blocks + block_index) * 256;
+  const uint8_t threshold = context->thresholds[batch_index];
+  const size_t k = context->k;
+  uint8_t* y_values = context->y_values;
+  uint32_t* y_indices = context->y_indices + batch_index * context->y_stride;
+
+  for (size_t i = 0; i < block_size; i++) {
+    const uint8_t vx = x[i];
+    if (vx >= threshold) {
+      const uint32_t position = positions[vx]++;
+      if (position < k) {
+        y_indices[position] = (uint32_t) (block_start + i);
+        if (y_values != NULL) {
+          y_values[batch_index * context->y_stride + position] = vx;
+        }
+      }
+    }
+  }
+}
+
+static void compute_top_k(
+    const struct top_k_context context[restrict static 1],
+    size_t batch_index)
+{
+  compute_top_k_histogram(context, batch_index, 0);
+  compute_top_k_offsets(context, batch_index);
+  compute_top_k_select(context, batch_index, 0);
+}
+
+struct reduce_rows_context {
+  const uint8_t* x;
+  size_t x_outer_stride;
+  size_t x_row_stride;
+  size_t rows;
+  size_t channels;
+  const uint8_t* zero;
+  uint8_t* y;
+  size_t y_outer_stride;
+  enum qnnp_reduce_operation operation;
+  union qnnp_avgpool_quantization_params quantization_params;
+  uint32_t mr;
+  uint32_t nr;
+  q8gavgpool_up_ukernel_function ltnr_ukernel;
+  q8gavgpool_up_ukernel_function unipass_ukernel;
+  q8gavgpool_mp_ukernel_function multipass_ukernel;
+};
+
+static void compute_reduce_rows_sum(
+    const struct reduce_rows_context context[restrict static 1],
+    size_t outer_index,
+    size_t block_index)
+{
+  const size_t block_start = block_index * QNNP_REDUCE_BLOCK_CHANNELS;
+  const size_t block_size = min(context->channels - block_start, QNNP_REDUCE_BLOCK_CHANNELS);
+  const uint8_t* x = context->x + outer_index * context->x_outer_stride + block_start;
+  uint8_t* y = context->y + outer_index * context->y_outer_stride + block_start;
+
+  if (block_size < context->nr) {
+    context->ltnr_ukernel(
+      context->rows, block_size, x, context->x_row_stride, context->zero, y, &context->quantization_params);
+  } else if (context->rows <= context->mr) {
+    context->unipass_ukernel(
+      context->rows, block_size, x, context->x_row_stride, context->zero, y, &context->quantization_params);
+  } else {
+    QNNP_ALIGN(16) int32_t multipass_buffer[QNNP_REDUCE_BLOCK_CHANNELS];
+    context->multipass_ukernel(
+      context->rows, block_size, x, context->x_row_stride, context->zero, multipass_buffer, y,
+      &context->quantization_params);
+  }
+}
+
+static void compute_reduce_rows_extremum(
+    const struct reduce_rows_context context[restrict static 1],
+    size_t outer_index,
+    size_t block_index)
+{
+  const size_t block_start = block_index * QNNP_REDUCE_BLOCK_CHANNELS;
+  const size_t block_size = min(context->channels - block_start, QNNP_REDUCE_BLOCK_CHANNELS);
+  const uint8_t* x = context->x + outer_index * context->x_outer_stride + block_start;
+  uint8_t* y = context->y + outer_index * context->y_outer_stride + block_start;
+  const size_t x_row_stride = context->x_row_stride;
+  const size_t rows = context->rows;
+
+  uint8_t extremum[QNNP_REDUCE_BLOCK_CHANNELS];
+  memcpy(extremum, x, block_size);
+  if (context->operation == qnnp_reduce_operation_max) {
+    for (size_t r = 1; r < rows; r++) {
+      const uint8_t* row = x + r * x_row_stride;
+      for (size_t c = 0; c < block_size; c++) {
+        extremum[c] = row[c] > extremum[c] ? row[c] : extremum[c];
+      }
+    }
+  } else {
+    for (size_t r = 1; r < rows; r++) {
+      const uint8_t* row = x + r * x_row_stride;
+      for (size_t c = 0; c < block_size; c++) {
+        extremum[c] = row[c] < extremum[c] ? row[c] : extremum[c];
+      }
+    }
+  }
+
+  const int32_t bias = context->quantization_params.scalar.bias;
+  for (size_t c = 0; c < block_size; c++) {
+    y[c] = qnnp_avgpool_quantize((int32_t) (uint32_t) extremum[c] + bias, context->quantization_params);
+  }
+}
+
+struct reduce_context {
+  const uint8_t* x;
+  size_t y_dims;
+  size_t y_shape[QNNP_MAX_REDUCE_DIMS];
+  size_t y_x_stride[QNNP_MAX_REDUCE_DIMS];
+  size_t dims;
+  size_t shape[QNNP_MAX_REDUCE_DIMS];
+  size_t x_stride[QNNP_MAX_REDUCE_DIMS];
+  size_t run;
+  size_t run_chunk;
+  size_t run_chunks;
+  size_t segments;
+  size_t block_segments;
+  size_t blocks;
+  int32_t* partials;
+  uint8_t* y;
+  enum qnnp_reduce_operation operation;
+  union qnnp_avgpool_quantization_params quantization_params;
+  u8rmax_ukernel_function rmax_ukernel;
+};
+
+/* Offset of the element with the given linear index in the dimensions, from the outermost one, with the strides */
+static size_t reduce_offset(size_t index, size_t dims, const size_t shape[], const size_t stride[])
+{
+  size_t offset = 0;
+  for (size_t i = dims; i != 0; i--) {
+    offset += (index % shape[i - 1]) * stride[i - 1];
+    index /= shape[i - 1];
+  }
+  return offset;
+}
+
+static void compute_reduce_partial(
+    const struct reduce_context context[restrict static 1],
+    size_t output_start,
+    size_t block_index,
+    size_t output_range,
+    size_t block_range /* always 1 */)
+{
+  assert(block_range == 1);
+
+  const size_t segment_start = block_index * context->block_segments;
+  const size_t segment_end = min(segment_start + context->block_segments, context->segments);
+  const size_t run = context->run;
+  const size_t run_chunk = context->run_chunk;
+  const size_t run_chunks = context->run_chunks;
+  const enum qnnp_reduce_operation operation = context->operation;
+
+  for (size_t output_index = output_start; output_index < output_start + output_range; output_index++) {
+    const uint8_t* x = context->x +
+      reduce_offset(output_index, context->y_dims, context->y_shape, context->y_x_stride);
+    int32_t acc = operation == qnnp_reduce_operation_min ? UINT8_MAX : 0;
+    for (size_t segment = segment_start; segment < segment_end; segment++) {
+      const size_t chunk_start = (segment % run_chunks) * run_chunk;
+      const size_t n = min(run - chunk_start, run_chunk);
+      const uint8_t* chunk = x + chunk_start +
+        reduce_offset(segment / run_chunks, context->dims, context->shape, context->x_stride);
+      switch (operation) {
+        case qnnp_reduce_operation_sum:
+        case qnnp_reduce_operation_mean:
+        {
+          uint32_t sum = 0;
+          for (size_t i = 0; i < n; i++) {
+            sum += (uint32_t) chunk[i];
+          }
+          acc += (int32_t) sum;
+          break;
+        }
+        case qnnp_reduce_operation_max:
+        {
+          const int32_t max = (int32_t) (uint32_t) context->rmax_ukernel(n, chunk);
+          acc = max > acc ? max : acc;
+          break;
+        }
+        case qnnp_reduce_operation_min:
+        {
+          uint8_t min = chunk[0];
+          for (size_t i = 1; i < n; i++) {
+            min = chunk[i] < min ? chunk[i] : min;
+          }
+          acc = (int32_t) (uint32_t) min < acc ? (int32_t) (uint32_t) min : acc;
+          break;
+        }
+      }
+    }
+    context->partials[output_index * context->blocks + block_index] = acc;
+  }
+}
+
+static void compute_reduce_combine(
+    const struct reduce_context context[restrict static 1],
+    size_t output_start,
+    size_t output_range)
+{
+  const size_t blocks = context->blocks;
+  const enum qnnp_reduce_operation operation = context->operation;
+  const int32_t bias = context->quantization_params.scalar.bias;
+
+  for (size_t output_index = output_start; output_index < output_start + output_range; output_index++) {
+    const int32_t* partials = context->partials + output_index * blocks;
+    int32_t acc = partials[0];
+    for (size_t b = 1; b < blocks; b++) {
+      switch (operation) {
+        case qnnp_reduce_operation_sum:
+        case qnnp_reduce_operation_mean:
+          acc += partials[b];
+          break;
+        case qnnp_reduce_operation_max:
+          acc = partials[b] > acc ? partials[b] : acc;
+          break;
+        case qnnp_reduce_operation_min:
+          acc = partials[b] < acc ? partials[b] : acc;
+          break;
+      }
+    }
+    context->y[output_index] = qnnp_avgpool_quantize(acc + bias, context->quantization_params);
+  }
+}
+
+struct embedding_gather_context {
+  const uint8_t* table;
+  size_t table_stride;
+  size_t table_rows;
+  const uint32_t* indices;
+  size_t indices_count;
+  size_t row_size;
+  uint8_t* output;
+  size_t output_stride;
+};
+
+static void compute_embedding_gather(
+    const struct embedding_gather_context context[restrict static 1],
+    size_t index_start,
+    size_t index_range)
+{
+  const uint8_t* table = context->table;
+  const size_t table_stride = context->table_stride;
+  const uint32_t* indices = context->indices;
+  const size_t indices_count = context->indices_count;
+  const size_t row_size = context->row_size;
+
+  for (size_t i = index_start; i < index_start + index_range; i++) {
+    if (i + QNNP_EMBEDDING_PREFETCH_DISTANCE < indices_count) {
+      const uint8_t* next_row = table + indices[i + QNNP_EMBEDDING_PREFETCH_DISTANCE] * table_stride;
+      for (size_t k = 0; k < row_size; k += 64) {
+        __builtin_prefetch(next_row + k);
+      }
+    }
+    assert(indices[i] < context->table_rows);
+    memcpy(context->output + i * context->output_stride, table + indices[i] * table_stride, row_size);
+  }
+}
+
+struct embedding_bag_context {
+  const uint8_t* table;
+  size_t table_stride;
+  size_t table_rows;
+  const uint32_t* indices;
+  const uint32_t* offsets;
+  const void** indirect_input;
+  size_t bag_padding;
+  size_t channels;
+  size_t packed_channels;
+  const uint8_t* zero;
+  uint8_t* output;
+  size_t output_stride;
+  bool mean;
+  int32_t input_zero_point;
+  float scale;
+  uint8_t output_zero_point;
+  uint8_t output_min;
+  uint8_t output_max;
+  uint32_t mr;
+  uint32_t kr;
+  q8avgpool_up_ukernel_function ltkr_ukernel;
+  q8avgpool_up_ukernel_function unipass_ukernel;
+  q8avgpool_mp_ukernel_function multipass_ukernel;
+};
+
+static inline size_t embedding_bag_start(
+    const struct embedding_bag_context context[restrict static 1],
+    size_t bag_index)
 {
-  const void* x = (const void*) ((uintptr_t) context->x + index * context->x_stride);
-  void* y = (void*) ((uintptr_t) context->y + index * context->y_stride);
+  const uint32_t* offsets = context->offsets;
+  return offsets == NULL ? bag_index : (size_t) (offsets[bag_index] - offsets[0]);
+}
 
-  context->fixed_ukernel(context->n, x, y);
+static inline size_t embedding_bag_size(
+    const struct embedding_bag_context context[restrict static 1],
+    size_t bag_index)
+{
+  const uint32_t* offsets = context->offsets;
+  return offsets == NULL ? 1 : (size_t) (offsets[bag_index + 1] - offsets[bag_index]);
 }
 
-static void compute_channel_shuffle_variable(
-    const struct channel_shuffle_context context[restrict static 1],
-    size_t index)
+/* Lists the table rows of a bag in its slice of the indirection buffer, and prefetches them */
+static void prepare_embedding_bag(
+    const struct embedding_bag_context context[restrict static 1],
+    size_t bag_index)
+{
+  const size_t bag_start = embedding_bag_start(context, bag_index);
+  const size_t bag_size = embedding_bag_size(context, bag_index);
+  const size_t bag_padding = context->bag_padding;
+  const uint32_t* indices = context->indices + (context->offsets == NULL ? 0 : context->offsets[0]) + bag_start;
+  const void** indirect_input = context->indirect_input + bag_start + bag_index * bag_padding;
+  const uint8_t* table = context->table;
+  const size_t table_stride = context->table_stride;
+  const size_t channels = context->channels;
+
+  for (size_t i = 0; i < bag_size; i++) {
+    assert(indices[i] < context->table_rows);
+    const uint8_t* row = table + indices[i] * table_stride;
+    for (size_t k = 0; k < channels; k += 64) {
+      __builtin_prefetch(row + k);
+    }
+    indirect_input[i] = row;
+  }
+  for (size_t i = 0; i < bag_padding; i++) {
+    indirect_input[bag_size + i] = context->zero;
+  }
+}
+
+static void compute_embedding_bags(
+    const struct embedding_bag_context context[restrict static 1],
+    size_t bag_start,
+    size_t bag_range)
+{
+  const size_t channels = context->channels;
+
+  /* Rows of the next bag are prefetched while the current bag is pooled */
+  prepare_embedding_bag(context, bag_start);
+  for (size_t bag_index = bag_start; bag_index < bag_start + bag_range; bag_index++) {
+    if (bag_index + 1 < bag_start + bag_range) {
+      prepare_embedding_bag(context, bag_index + 1);
+    }
+
+    const size_t bag_size = embedding_bag_size(context, bag_index);
+    uint8_t* output = context->output + bag_index * context->output_stride;
+    if (bag_size == 0) {
+      const uint8_t output_zero_point =
+        min(max(context->output_zero_point, context->output_min), context->output_max);
+      memset(output, output_zero_point, channels);
+      continue;
+    }
+
+    const uint8_t** indirect_input = (const uint8_t**)
+      (context->indirect_input + embedding_bag_start(context, bag_index) + bag_index * context->bag_padding);
+    const union qnnp_avgpool_quantization_params quantization_params =
+      qnnp_compute_avgpool_quantization_params(
+        -(int32_t) bag_size * context->input_zero_point,
+        context->mean ? context->scale / (float) bag_size : context->scale,
+        context->output_zero_point, context->output_min, context->output_max);
+    if (channels < context->kr) {
+      context->ltkr_ukernel(
+        1, bag_size, channels, indirect_input, context->zero, output, 0, 0, &quantization_params);
+    } else if (bag_size <= context->mr) {
+      context->unipass_ukernel(
+        1, bag_size, channels, indirect_input, context->zero, output, 0, 0, &quantization_params);
+    } else {
+      QNNP_ALIGN(16) int32_t multipass_buffer[context->packed_channels];
+      context->multipass_ukernel(
+        1, bag_size, channels, indirect_input, context->zero, multipass_buffer, output, 0, 0,
+        &quantization_params);
+    }
+  }
+}
+
+struct rnn_cell_context {
+  size_t input_size;
+  size_t hidden_size;
+  size_t block_k_start[QNNP_RNN_GATE_BLOCKS];
+  size_t block_k[QNNP_RNN_GATE_BLOCKS];
+  size_t packed_tile_size;
+  const uint8_t* x;
+  const uint8_t* h;
+  uint8_t* xh;
+  const uint8_t* packed_w;
+  const uint8_t* c;
+  uint8_t* c_output;
+  uint8_t* h_output;
+  const float* lookup_table;
+  float h_inverse_scale;
+  int32_t h_zero_point;
+  float c_inverse_scale;
+  int32_t c_zero_point;
+  uint32_t mr;
+  uint32_t nr;
+  uint32_t kr;
+  union qnnp_conv_quantization_params quantization_params;
+  q8gemm_ukernel_function ukernel;
+};
+
+static void compute_rnn_cell_concat(
+    const struct rnn_cell_context context[restrict static 1],
+    size_t batch_index)
+{
+  const size_t input_size = context->input_size;
+  const size_t hidden_size = context->hidden_size;
+  uint8_t* xh = context->xh + batch_index * (input_size + hidden_size);
+
+  memcpy(xh, context->x + batch_index * input_size, input_size);
+  memcpy(xh + input_size, context->h + batch_index * hidden_size, hidden_size);
+}
+
+/* Computes pre-activations of all gate blocks of a tile of hidden units, with gate block g at gates + g * mr * nr */
+static void compute_rnn_cell_gates(
+    const struct rnn_cell_context context[restrict static 1],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size,
+    uint8_t* gates)
+{
+  const size_t xh_stride = context->input_size + context->hidden_size;
+  const uint32_t mr = context->mr;
+  const uint32_t nr = context->nr;
+  const uint32_t kr = context->kr;
+  uintptr_t packed_w = (uintptr_t) context->packed_w + nr_block_start / nr * context->packed_tile_size;
+
+  for (size_t block = 0; block < QNNP_RNN_GATE_BLOCKS; block++) {
+    const size_t k = context->block_k[block];
+    context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      k,
+      context->xh + mr_block_start * xh_stride + context->block_k_start[block],
+      xh_stride,
+      (const void*) packed_w,
+      gates + block * mr * nr,
+      nr,
+      &context->quantization_params);
+    packed_w += nr * (((k + (kr - 1)) & -kr) * sizeof(uint8_t) + sizeof(int32_t));
+  }
+}
+
+static inline uint8_t rnn_cell_quantize(float x, float inverse_scale, int32_t zero_point)
 {
-  const void* x = (const void*) ((uintptr_t) context->x + index * context->x_stride);
-  void* y = (void*) ((uintptr_t) context->y + index * context->y_stride);
+  const int32_t q = (int32_t) lrintf(x * inverse_scale) + zero_point;
+  return (uint8_t) (q < 0 ? 0 : q > 255 ? 255 : q);
+}
+
+static void compute_lstm_cell(
+    const struct rnn_cell_context context[restrict static 1],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const uint32_t mr = context->mr;
+  const uint32_t nr = context->nr;
+  uint8_t gates[QNNP_RNN_GATE_BLOCKS * mr * nr];
+  compute_rnn_cell_gates(context, mr_block_start, nr_block_start, mr_block_size, nr_block_size, gates);
+
+  const float* sigmoid = context->lookup_table;
+  const float* tanh_gate = context->lookup_table + 256;
+  const float* tanh_cell = context->lookup_table + 512;
+  const float* dequantize_cell = context->lookup_table + 768;
+  const size_t hidden_size = context->hidden_size;
+  for (size_t m = 0; m < mr_block_size; m++) {
+    const size_t offset = (mr_block_start + m) * hidden_size + nr_block_start;
+    const uint8_t* c = context->c + offset;
+    uint8_t* c_output = context->c_output + offset;
+    uint8_t* h_output = context->h_output + offset;
+    for (size_t n = 0; n < nr_block_size; n++) {
+      const float i = sigmoid[gates[0 * mr * nr + m * nr + n]];
+      const float f = sigmoid[gates[1 * mr * nr + m * nr + n]];
+      const float g = tanh_gate[gates[2 * mr * nr + m * nr + n]];
+      const float o = sigmoid[gates[3 * mr * nr + m * nr + n]];
+      const uint8_t c_next = rnn_cell_quantize(
+        f * dequantize_cell[c[n]] + i * g, context->c_inverse_scale, context->c_zero_point);
+      c_output[n] = c_next;
+      h_output[n] = rnn_cell_quantize(o * tanh_cell[c_next], context->h_inverse_scale, context->h_zero_point);
+    }
+  }
+}
 
-  context->variable_ukernel(context->n, context->m, x, y);
+static void compute_gru_cell(
+    const struct rnn_cell_context context[restrict static 1],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const uint32_t mr = context->mr;
+  const uint32_t nr = context->nr;
+  uint8_t gates[QNNP_RNN_GATE_BLOCKS * mr * nr];
+  compute_rnn_cell_gates(context, mr_block_start, nr_block_start, mr_block_size, nr_block_size, gates);
+
+  const float* sigmoid = context->lookup_table;
+  const float* tanh_gate = context->lookup_table + 256;
+  const float* dequantize_hidden = context->lookup_table + 768;
+  const size_t input_size = context->input_size;
+  const size_t hidden_size = context->hidden_size;
+  for (size_t m = 0; m < mr_block_size; m++) {
+    /* Previous hidden state is read from the concatenated copy, as the output may overwrite the hidden state input */
+    const uint8_t* h = context->xh + (mr_block_start + m) * (input_size + hidden_size) + input_size + nr_block_start;
+    uint8_t* h_output = context->h_output + (mr_block_start + m) * hidden_size + nr_block_start;
+    for (size_t n = 0; n < nr_block_size; n++) {
+      const float r = sigmoid[gates[0 * mr * nr + m * nr + n]];
+      const float z = sigmoid[gates[1 * mr * nr + m * nr + n]];
+      const int32_t n_input = (int32_t) (uint32_t) gates[2 * mr * nr + m * nr + n] - 128;
+      const int32_t n_recurrent = (int32_t) (uint32_t) gates[3 * mr * nr + m * nr + n] - 128;
+      const uint8_t n_gate = rnn_cell_quantize((float) n_input + r * (float) n_recurrent, 1.0f, 128);
+      const float n_value = tanh_gate[n_gate];
+      h_output[n] = rnn_cell_quantize(
+        n_value + z * (dequantize_hidden[h[n]] - n_value), context->h_inverse_scale, context->h_zero_point);
+    }
+  }
 }
 
 struct lut_strided_context {
@@ -579,6 +2300,175 @@ static void compute_clamp_contiguous(
   context->ukernel(size, x, y, &context->params);
 }
 
+struct quantize_strided_context {
+  size_t n;
+  const float* x;
+  size_t x_stride;
+  uint8_t* y;
+  size_t y_stride;
+  q8quant_ukernel_function ukernel;
+  union qnnp_q8_quantization_params params;
+};
+
+static void compute_quantize_strided(
+    const struct quantize_strided_context context[restrict static 1],
+    size_t batch_index)
+{
+  const float* x = (const float*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  uint8_t* y = (uint8_t*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  context->ukernel(context->n, x, y, &context->params);
+}
+
+struct quantize_contiguous_context {
+  const float* x;
+  uint8_t* y;
+  q8quant_ukernel_function ukernel;
+  union qnnp_q8_quantization_params params;
+};
+
+static void compute_quantize_contiguous(
+    const struct quantize_contiguous_context context[restrict static 1],
+    size_t offset,
+    size_t size)
+{
+  context->ukernel(size, context->x + offset, context->y + offset, &context->params);
+}
+
+struct dequantize_strided_context {
+  size_t n;
+  const uint8_t* x;
+  size_t x_stride;
+  float* y;
+  size_t y_stride;
+  q8dequant_ukernel_function ukernel;
+  union qnnp_q8_dequantization_params params;
+};
+
+static void compute_dequantize_strided(
+    const struct dequantize_strided_context context[restrict static 1],
+    size_t batch_index)
+{
+  const uint8_t* x = (const uint8_t*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  float* y = (float*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  context->ukernel(context->n, x, y, &context->params);
+}
+
+struct dequantize_contiguous_context {
+  const uint8_t* x;
+  float* y;
+  q8dequant_ukernel_function ukernel;
+  union qnnp_q8_dequantization_params params;
+};
+
+static void compute_dequantize_contiguous(
+    const struct dequantize_contiguous_context context[restrict static 1],
+    size_t offset,
+    size_t size)
+{
+  context->ukernel(size, context->x + offset, context->y + offset, &context->params);
+}
+
+struct normalize_context {
+  size_t channels;
+  size_t input_height;
+  size_t input_width;
+  const void* input;
+  uint8_t* output;
+  size_t output_pixel_stride;
+  size_t block_width;
+  const union qnnp_q8_quantization_params* quantization_params;
+  const uint8_t* lookup_table;
+  q8quant_ukernel_function quant_ukernel;
+  x8lut_ukernel_function lut_ukernel;
+  struct x8zip_parameters zip_ukernels;
+};
+
+static inline void normalize_interleave(
+    const struct normalize_context context[restrict static 1],
+    size_t n,
+    const uint8_t* planar,
+    uint8_t* output)
+{
+  const size_t channels = context->channels;
+  const size_t output_pixel_stride = context->output_pixel_stride;
+  if (output_pixel_stride == channels) {
+    switch (channels) {
+      case 1:
+        memcpy(output, planar, n);
+        break;
+      case 2:
+        context->zip_ukernels.x2(n, planar, output);
+        break;
+      case 3:
+        context->zip_ukernels.x3(n, planar, output);
+        break;
+      case 4:
+        context->zip_ukernels.x4(n, planar, output);
+        break;
+      default:
+        context->zip_ukernels.xm(n, channels, planar, output);
+        break;
+    }
+  } else {
+    for (size_t i = 0; i < n; i++) {
+      for (size_t c = 0; c < channels; c++) {
+        output[c] = planar[c * n + i];
+      }
+      output += output_pixel_stride;
+    }
+  }
+}
+
+/*
+ * Every task converts one image row: blocks of pixels of each input plane are quantized into a small planar buffer,
+ * which is then interleaved into NHWC output pixels, so input and output are each traversed once.
+ */
+static void compute_normalize_f32(
+    const struct normalize_context context[restrict static 1],
+    size_t batch_index,
+    size_t input_y)
+{
+  const size_t channels = context->channels;
+  const size_t input_width = context->input_width;
+  const size_t plane_size = context->input_height * input_width;
+  const size_t block_width = context->block_width;
+  const float* input = (const float*) context->input + batch_index * channels * plane_size + input_y * input_width;
+  uint8_t* output = context->output +
+    (batch_index * context->input_height + input_y) * input_width * context->output_pixel_stride;
+
+  uint8_t planar[QNNP_NORMALIZE_BLOCK_BYTES];
+  for (size_t x = 0; x < input_width; x += block_width) {
+    const size_t n = min(block_width, input_width - x);
+    for (size_t c = 0; c < channels; c++) {
+      context->quant_ukernel(n, input + c * plane_size + x, planar + c * n, &context->quantization_params[c]);
+    }
+    normalize_interleave(context, n, planar, output + x * context->output_pixel_stride);
+  }
+}
+
+static void compute_normalize_u8(
+    const struct normalize_context context[restrict static 1],
+    size_t batch_index,
+    size_t input_y)
+{
+  const size_t channels = context->channels;
+  const size_t input_width = context->input_width;
+  const size_t plane_size = context->input_height * input_width;
+  const size_t block_width = context->block_width;
+  const uint8_t* input = (const uint8_t*) context->input + batch_index * channels * plane_size + input_y * input_width;
+  uint8_t* output = context->output +
+    (batch_index * context->input_height + input_y) * input_width * context->output_pixel_stride;
+
+  uint8_t planar[QNNP_NORMALIZE_BLOCK_BYTES];
+  for (size_t x = 0; x < input_width; x += block_width) {
+    const size_t n = min(block_width, input_width - x);
+    for (size_t c = 0; c < channels; c++) {
+      context->lut_ukernel(n, input + c * plane_size + x, context->lookup_table + c * 256, planar + c * n);
+    }
+    normalize_interleave(context, n, planar, output + x * context->output_pixel_stride);
+  }
+}
+
 struct u8softargmax_context {
   size_t n;
   const uint8_t* x;
@@ -604,70 +2494,220 @@ static void compute_u8softargmax(
   context->lut_norm_ukernel(n, x, t, y);
 }
 
+static void stage_stream_input(qnnp_operator_t op)
+{
+  const size_t channels = op->groups * op->group_input_channels;
+  const size_t history_width = op->stream_history_width;
+  const size_t staged_width = op->input_width;
+  const size_t input_width = staged_width - history_width;
+  const size_t input_pixel_stride = op->stream_input_pixel_stride;
+  for (size_t image = 0; image < op->batch_size; image++) {
+    const uint8_t* input = (const uint8_t*) op->stream_input + image * input_width * input_pixel_stride;
+    uint8_t* staged = (uint8_t*) op->stream_buffer + 8 + (image * staged_width + history_width) * channels;
+    if (input_pixel_stride == channels) {
+      memcpy(staged, input, input_width * channels);
+    } else {
+      for (size_t x = 0; x < input_width; x++) {
+        memcpy(staged + x * channels, input + x * input_pixel_stride, channels);
+      }
+    }
+  }
+}
+
+static void gather_permuted_input(qnnp_operator_t op, pthreadpool_t threadpool)
+{
+  const size_t channels = op->channels;
+  const size_t pixels = op->batch_size * op->input_depth * op->input_height * op->input_width;
+  const size_t groups = op->input_shuffle_groups;
+  if (groups != 0) {
+    shuffle_channels(
+      threadpool,
+      pixels, groups, channels / groups,
+      op->permuted_input_source, op->permuted_input_source_stride,
+      (void*) op->input, channels);
+  } else {
+    struct channel_gather_context channel_gather_context = {
+      .x = op->permuted_input_source,
+      .x_stride = op->permuted_input_source_stride,
+      .y = (uint8_t*) op->input,
+      .y_stride = channels,
+      .channels = channels,
+      .permutation = op->input_channel_permutation,
+    };
+    pthreadpool_compute_1d_tiled(
+      threadpool,
+      (pthreadpool_function_1d_tiled_t) compute_channel_gather,
+      &channel_gather_context,
+      pixels, divide_round_up(4096, channels));
+  }
+}
+
+static void retain_stream_history(qnnp_operator_t op)
+{
+  const size_t channels = op->groups * op->group_input_channels;
+  const size_t history_width = op->stream_history_width;
+  const size_t staged_width = op->input_width;
+  for (size_t image = 0; image < op->batch_size; image++) {
+    uint8_t* staged = (uint8_t*) op->stream_buffer + 8 + image * staged_width * channels;
+    memmove(staged, staged + (staged_width - history_width) * channels, history_width * channels);
+  }
+}
+
 enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
 {
+  if (op->stream_buffer != NULL) {
+    stage_stream_input(op);
+  }
+  if (op->input_channel_permutation != NULL) {
+    gather_permuted_input(op, threadpool);
+  }
+
   switch (op->ukernel_type) {
     case qnnp_ukernel_type_dwconv:
     {
       const size_t batch_size = op->batch_size;
       const size_t groups = op->groups;
-      const size_t kernel_height = op->kernel_height;
+      const size_t column_height = op->kernel_depth * op->kernel_height;
       const size_t kernel_width = op->kernel_width;
-      const size_t kernel_size = kernel_height * kernel_width;
+      const size_t kernel_size = column_height * kernel_width;
       const size_t width_step = op->dilation_width == 1 ? op->stride_width : op->kernel_width;
-      const size_t output_height = op->output_height;
+      /* Output frames of a volumetric convolution are processed as consecutive output rows */
+      const size_t output_height = op->output_depth * op->output_height;
       const size_t output_width = op->output_width;
 
-      switch (kernel_size) {
-        case 9:
-        {
-          struct q8dw_context q8dw_context = {
-              .groups = groups,
-              .indirection_buffer = (const uint8_t**) op->indirection_buffer,
-              .indirection_buffer_row_stride = kernel_size + (output_width * width_step - 1) * kernel_height,
-              .indirection_buffer_col_stride = kernel_height * width_step * sizeof(void*),
-              .packed_weights = op->packed_weights,
-              .output = op->output,
-              .output_height = output_height,
-              .output_width = output_width,
-              .output_row_stride = output_width * op->output_pixel_stride,
-              .output_col_increment = (op->output_pixel_stride - groups) * sizeof(uint8_t),
-              .quantization_params = op->conv_quantization_params,
-              .unipass_ukernel = qnnp_params.q8dw9.updw,
-          };
-          pthreadpool_compute_2d(
-              threadpool,
-              (pthreadpool_function_2d_t) compute_q8updw,
-              &q8dw_context,
-              batch_size, output_height);
-          break;
+      /* 3x3 windows with a unit horizontal dilation read interior pixels of each output row directly */
+      q8dwrow_ukernel_function row_ukernel = NULL;
+      size_t output_x_begin = 0, output_x_end = 0;
+      if (column_height == 3 && kernel_width == 3 && op->dilation_width == 1) {
+        switch (op->stride_width) {
+          case 1:
+            row_ukernel = qnnp_params.q8dw9row.stride1;
+            break;
+          case 2:
+            row_ukernel = qnnp_params.q8dw9row.stride2;
+            break;
         }
-        case 25:
-        {
-          struct q8dw_context q8dw_context = {
-              .groups = groups,
-              .group_stride = op->group_stride,
-              .indirection_buffer = (const uint8_t**) op->indirection_buffer,
-              .indirection_buffer_row_stride = kernel_size + (output_width * width_step - 1) * kernel_height,
-              .indirection_buffer_col_stride = kernel_height * width_step * sizeof(void*),
-              .packed_weights = op->packed_weights,
-              .output = op->output,
-              .output_height = output_height,
-              .output_width = output_width,
-              .output_row_stride = output_width * op->output_pixel_stride,
-              .output_col_increment = (op->output_pixel_stride - groups) * sizeof(uint8_t),
-              .quantization_params = op->conv_quantization_params,
-              .multipass_ukernel = qnnp_params.q8dw25.mpdw,
-          };
-          pthreadpool_compute_2d(
-              threadpool,
-              (pthreadpool_function_2d_t) compute_q8mpdw,
-              &q8dw_context,
-              batch_size, output_height);
-          break;
+        const size_t padded_input_width = op->input_padding_left + op->input_width;
+        if (padded_input_width >= kernel_width) {
+          output_x_begin = divide_round_up(op->input_padding_left, op->stride_width);
+          output_x_end = min(output_width, (padded_input_width - kernel_width) / op->stride_width + 1);
         }
-        default:
-          QNNP_UNREACHABLE;
+      }
+
+      if (groups <= qnnp_params.q8dwpx.cr) {
+        struct q8dw_context q8dw_context = {
+            .groups = groups,
+            .kernel_size = kernel_size,
+            .indirection_buffer = (const uint8_t**) op->indirection_buffer,
+            .indirection_buffer_row_stride = kernel_size + (output_width * width_step - 1) * column_height,
+            .indirection_buffer_col_stride = column_height * width_step * sizeof(void*),
+            .packed_weights = op->packed_weights,
+            .output = op->output,
+            .output_height = output_height,
+            .output_width = output_width,
+            .output_image_stride = op->output_image_stride,
+            .output_row_stride = op->output_row_stride,
+            .output_col_increment = (op->output_pixel_stride - groups) * sizeof(uint8_t),
+            .quantization_params = op->conv_quantization_params,
+            .generic_ukernel = qnnp_params.q8dwpx.updwm,
+        };
+        pthreadpool_compute_2d(
+            threadpool,
+            (pthreadpool_function_2d_t) compute_q8updwm,
+            &q8dw_context,
+            batch_size, output_height);
+      } else if (kernel_size == 9 && row_ukernel != NULL && output_x_begin < output_x_end) {
+        struct q8dw_context q8dw_context = {
+            .groups = groups,
+            .indirection_buffer = (const uint8_t**) op->indirection_buffer,
+            .indirection_buffer_row_stride = kernel_size + (output_width * width_step - 1) * column_height,
+            .indirection_buffer_col_stride = column_height * width_step * sizeof(void*),
+            .packed_weights = op->packed_weights,
+            .output = op->output,
+            .output_height = output_height,
+            .output_width = output_width,
+            .output_image_stride = op->output_image_stride,
+            .output_row_stride = op->output_row_stride,
+            .output_col_increment = (op->output_pixel_stride - groups) * sizeof(uint8_t),
+            .quantization_params = op->conv_quantization_params,
+            .unipass_ukernel = qnnp_params.q8dw9.updw,
+            .row_ukernel = row_ukernel,
+            .output_x_begin = output_x_begin,
+            .output_x_end = output_x_end,
+            .input_pixel_stride = op->input_pixel_stride * sizeof(uint8_t),
+            .output_pixel_stride = op->output_pixel_stride * sizeof(uint8_t),
+            .zero = op->zero_pointer,
+        };
+        pthreadpool_compute_2d(
+            threadpool,
+            (pthreadpool_function_2d_t) compute_q8dwrow,
+            &q8dw_context,
+            batch_size, output_height);
+      } else if (kernel_size == 9) {
+        struct q8dw_context q8dw_context = {
+            .groups = groups,
+            .indirection_buffer = (const uint8_t**) op->indirection_buffer,
+            .indirection_buffer_row_stride = kernel_size + (output_width * width_step - 1) * column_height,
+            .indirection_buffer_col_stride = column_height * width_step * sizeof(void*),
+            .packed_weights = op->packed_weights,
+            .output = op->output,
+            .output_height = output_height,
+            .output_width = output_width,
+            .output_image_stride = op->output_image_stride,
+            .output_row_stride = op->output_row_stride,
+            .output_col_increment = (op->output_pixel_stride - groups) * sizeof(uint8_t),
+            .quantization_params = op->conv_quantization_params,
+            .unipass_ukernel = qnnp_params.q8dw9.updw,
+        };
+        pthreadpool_compute_2d(
+            threadpool,
+            (pthreadpool_function_2d_t) compute_q8updw,
+            &q8dw_context,
+            batch_size, output_height);
+      } else if (column_height == 5 && kernel_width == 5) {
+        struct q8dw_context q8dw_context = {
+            .groups = groups,
+            .group_stride = op->group_stride,
+            .indirection_buffer = (const uint8_t**) op->indirection_buffer,
+            .indirection_buffer_row_stride = kernel_size + (output_width * width_step - 1) * column_height,
+            .indirection_buffer_col_stride = column_height * width_step * sizeof(void*),
+            .packed_weights = op->packed_weights,
+            .output = op->output,
+            .output_height = output_height,
+            .output_width = output_width,
+            .output_image_stride = op->output_image_stride,
+            .output_row_stride = op->output_row_stride,
+            .output_col_increment = (op->output_pixel_stride - groups) * sizeof(uint8_t),
+            .quantization_params = op->conv_quantization_params,
+            .multipass_ukernel = qnnp_params.q8dw25.mpdw,
+        };
+        pthreadpool_compute_2d(
+            threadpool,
+            (pthreadpool_function_2d_t) compute_q8mpdw,
+            &q8dw_context,
+            batch_size, output_height);
+      } else {
+        struct q8dw_context q8dw_context = {
+            .groups = groups,
+            .kernel_size = kernel_size,
+            .indirection_buffer = (const uint8_t**) op->indirection_buffer,
+            .indirection_buffer_row_stride = kernel_size + (output_width * width_step - 1) * column_height,
+            .indirection_buffer_col_stride = column_height * width_step * sizeof(void*),
+            .packed_weights = op->packed_weights,
+            .output = op->output,
+            .output_height = output_height,
+            .output_width = output_width,
+            .output_image_stride = op->output_image_stride,
+            .output_row_stride = op->output_row_stride,
+            .output_col_increment = (op->output_pixel_stride - groups) * sizeof(uint8_t),
+            .quantization_params = op->conv_quantization_params,
+            .generic_ukernel = qnnp_params.q8dwm.updwm,
+        };
+        pthreadpool_compute_2d(
+            threadpool,
+            (pthreadpool_function_2d_t) compute_q8updwm,
+            &q8dw_context,
+            batch_size, output_height);
       }
       break;
     }
@@ -736,9 +2776,9 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       const size_t groups = op->groups;
       const size_t group_input_channels = op->group_input_channels;
       const size_t group_output_channels = op->group_output_channels;
-      const uint32_t mr = qnnp_params.q8conv.mr;
-      const uint32_t nr = qnnp_params.q8conv.nr;
-      const uint32_t kr = qnnp_params.q8conv.kr;
+      const uint32_t mr = op->q8conv_params->mr;
+      const uint32_t nr = op->q8conv_params->nr;
+      const uint32_t kr = op->q8conv_params->kr;
       const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
       const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
 
@@ -753,16 +2793,77 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .packed_w = op->packed_weights,
           .c = op->output,
           .c_stride = op->output_pixel_stride,
+          .c_rows = init_output_rows(op, output_size),
           .quantization_params = op->conv_quantization_params,
-          .ukernel = qnnp_params.q8conv.gemm,
+          .ukernel = op->q8conv_params->gemm,
+          .nr = nr,
       };
 
-      pthreadpool_compute_4d_tiled(
+      if (op->group_tile > 1) {
+        pthreadpool_compute_2d_tiled(
+            threadpool,
+            (pthreadpool_function_2d_tiled_t) compute_q8gemm_grouped,
+            &q8gemm_context,
+            batch_size * output_size, groups,
+            mr, op->group_tile);
+      } else {
+        pthreadpool_compute_4d_tiled(
+            threadpool,
+            (pthreadpool_function_4d_tiled_t) compute_q8gemm,
+            &q8gemm_context,
+            groups, batch_size * output_size, output_size, group_output_channels,
+            1, output_size, mr, nr);
+      }
+      break;
+    }
+    case qnnp_ukernel_type_batch_matmul:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t m = op->output_height;
+      const size_t k = op->group_input_channels;
+      const size_t n = op->group_output_channels;
+      const uint32_t mr = op->q8conv_params->mr;
+      const uint32_t nr = op->q8conv_params->nr;
+      const uint32_t kr = op->q8conv_params->kr;
+      const size_t k_stride = (k + (kr - 1)) & -kr;
+      const size_t n_stride = (n + (nr - 1)) & -nr;
+      const bool transpose_b = (op->flags & QNNP_FLAG_TRANSPOSE_B) != 0;
+
+      struct batch_matmul_context context = {
+          .k = k,
+          .k_stride = k_stride,
+          .n = n,
+          .n_stride = n_stride,
+          .nr = nr,
+          .kr = kr,
+          .a = op->input,
+          .a_batch_stride = m * k * sizeof(uint8_t),
+          .b = op->input2,
+          .b_batch_stride = k * n * sizeof(uint8_t),
+          .b_k_stride = transpose_b ? 1 : n,
+          .b_n_stride = transpose_b ? k : 1,
+          .packed_b = op->workspace,
+          .packed_b_batch_stride = n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)),
+          .c = op->output,
+          .c_batch_stride = m * n * sizeof(uint8_t),
+          .a_zero_point = op->input_zero_point,
+          .b_zero_point = op->kernel_zero_point,
+          .quantization_params = op->conv_quantization_params,
+          .ukernel = op->q8conv_params->gemm,
+          .packb_ukernel = transpose_b ? NULL : op->q8conv_params->packb,
+      };
+
+      pthreadpool_compute_2d(
+          threadpool,
+          (pthreadpool_function_2d_t) compute_batch_matmul_pack,
+          &context,
+          batch_size, n_stride / nr);
+      pthreadpool_compute_3d_tiled(
           threadpool,
-          (pthreadpool_function_4d_tiled_t) compute_q8gemm,
-          &q8gemm_context,
-          groups, batch_size * output_size, output_size, group_output_channels,
-          1, output_size, mr, nr);
+          (pthreadpool_function_3d_tiled_t) compute_batch_matmul,
+          &context,
+          batch_size, m, n,
+          1, mr, nr);
       break;
     }
     case qnnp_ukernel_type_conv:
@@ -771,20 +2872,159 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       const size_t groups = op->groups;
       const size_t group_input_channels = op->group_input_channels;
       const size_t group_output_channels = op->group_output_channels;
-      const uint32_t mr = qnnp_params.q8conv.mr;
-      const uint32_t nr = qnnp_params.q8conv.nr;
-      const uint32_t kr = qnnp_params.q8conv.kr;
+      const uint32_t mr = op->q8conv_params->mr;
+      const uint32_t nr = op->q8conv_params->nr;
+      const uint32_t kr = op->q8conv_params->kr;
+      const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
+      const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+
+      const size_t output_size = op->output_depth * op->output_height * op->output_width;
+      const size_t input_channel_runs = op->input_channel_offsets != NULL ? op->input_channel_runs : 1;
+      const size_t kernel_size = op->kernel_depth * op->kernel_height * op->kernel_width * input_channel_runs;
+      const size_t m_stride = round_up(output_size, mr);
+      struct q8conv_context q8conv_context = {
+          .bs = batch_size,
+          .ks = kernel_size,
+          .kc = group_input_channels,
+          .kc_stride = k_stride * kernel_size,
+          .m = output_size,
+          .m_stride = m_stride,
+          .n = group_output_channels,
+          .n_stride = n_stride,
+          .indirect_a = (const uint8_t**) op->indirection_buffer,
+          .packed_w = op->packed_weights,
+          .c = op->output,
+          .c_stride = op->output_pixel_stride,
+          .c_rows = init_output_rows(op, output_size),
+          .quantization_params = op->conv_quantization_params,
+          .ukernel = op->q8conv_params->conv,
+          .nr = nr,
+      };
+
+      if (op->group_tile > 1) {
+        pthreadpool_compute_3d_tiled(
+            threadpool,
+            (pthreadpool_function_3d_tiled_t) compute_q8conv_grouped,
+            &q8conv_context,
+            batch_size, output_size, groups,
+            1, mr, op->group_tile);
+      } else {
+        pthreadpool_compute_4d_tiled(
+            threadpool,
+            (pthreadpool_function_4d_tiled_t) compute_q8conv,
+            &q8conv_context,
+            groups, batch_size, output_size, group_output_channels,
+            1, 1, mr, nr);
+      }
+      break;
+    }
+    case qnnp_ukernel_type_direct_conv:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t groups = op->groups;
+      const size_t group_input_channels = op->group_input_channels;
+      const size_t group_output_channels = op->group_output_channels;
+      const uint32_t mr = op->q8conv_params->mr;
+      const uint32_t nr = op->q8conv_params->nr;
+      const uint32_t kr = op->q8conv_params->kr;
       const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
       const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
 
-      const size_t output_size = op->output_height * op->output_width;
       const size_t kernel_size = op->kernel_height * op->kernel_width;
+      const size_t output_height = op->output_height;
+      const size_t output_width = op->output_width;
+      const size_t output_y_begin = op->interior_output_y_begin;
+      const size_t output_y_end = op->interior_output_y_end;
+      const size_t output_x_begin = op->interior_output_x_begin;
+      const size_t output_x_end = op->interior_output_x_end;
+      const size_t row_tiles = divide_round_up(output_width, mr);
+      const size_t interior_row_tiles = divide_round_up(output_x_begin, mr) + divide_round_up(output_width - output_x_end, mr);
+      const size_t interior_rows = output_y_end - output_y_begin;
+      const size_t input_row_stride = op->input_width * op->input_pixel_stride;
+      struct q8dconv_context q8dconv_context = {
+          .bs = batch_size,
+          .kc = group_input_channels,
+          .kc_stride = k_stride * kernel_size,
+          .n = group_output_channels,
+          .n_stride = n_stride,
+          .kernel_height = op->kernel_height,
+          .kernel_width = op->kernel_width,
+          .a = op->input,
+          .a_image_stride = op->input_height * input_row_stride,
+          .a_row_stride = input_row_stride,
+          .a_pixel_stride = op->input_pixel_stride,
+          .a_window_row_stride = op->dilation_height * input_row_stride,
+          .a_window_col_stride = op->dilation_width * op->input_pixel_stride,
+          .a_group_stride = group_input_channels,
+          .input_padding_top = op->input_padding_top,
+          .input_padding_left = op->input_padding_left,
+          .stride_height = op->stride_height,
+          .stride_width = op->stride_width,
+          .indirect_a = (const uint8_t**) op->indirection_buffer,
+          .indirect_image_tiles = (output_height - interior_rows) * row_tiles + interior_rows * interior_row_tiles,
+          .row_tiles = row_tiles,
+          .interior_row_tiles = interior_row_tiles,
+          .output_height = output_height,
+          .output_width = output_width,
+          .output_y_begin = output_y_begin,
+          .output_y_end = output_y_end,
+          .output_x_begin = output_x_begin,
+          .output_x_end = output_x_end,
+          .packed_w = op->packed_weights,
+          .c = op->output,
+          .c_stride = op->output_pixel_stride,
+          .c_row_stride = op->output_row_stride,
+          .c_image_stride = op->output_image_stride,
+          .quantization_params = op->conv_quantization_params,
+          .conv_ukernel = op->q8conv_params->conv,
+          .dconv_ukernel = op->q8conv_params->dconv,
+          .mr = mr,
+      };
+
+      pthreadpool_compute_4d_tiled(
+          threadpool,
+          (pthreadpool_function_4d_tiled_t) compute_q8dconv,
+          &q8dconv_context,
+          groups, batch_size, output_height, group_output_channels,
+          1, 1, 1, nr);
+      break;
+    }
+    case qnnp_ukernel_type_row_conv:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t group_input_channels = op->group_input_channels;
+      const size_t group_output_channels = op->group_output_channels;
+      const uint32_t mr = op->q8conv_params->mr;
+      const uint32_t nr = op->q8conv_params->nr;
+      const uint32_t kr = op->q8conv_params->kr;
+      const size_t row_channels = op->kernel_width * group_input_channels;
+      const size_t k_stride = (row_channels + (kr - 1)) & -kr;
+      const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+
+      if ((op->input_padding_left | op->input_padding_right) != 0 || op->input_pixel_stride != group_input_channels) {
+        struct row_conv_staging_context staging_context = {
+            .input = op->input,
+            .input_pixel_stride = op->input_pixel_stride,
+            .input_width = op->input_width,
+            .channels = group_input_channels,
+            .staged_input = op->workspace,
+            .staged_row_stride = (op->input_padding_left + op->input_width + op->input_padding_right) * group_input_channels,
+            .staged_row_offset = op->input_padding_left * group_input_channels,
+        };
+        pthreadpool_compute_1d(
+            threadpool,
+            (pthreadpool_function_1d_t) compute_row_conv_staging,
+            &staging_context,
+            batch_size * op->input_height);
+      }
+
+      const size_t output_size = op->output_height * op->output_width;
       const size_t m_stride = round_up(output_size, mr);
       struct q8conv_context q8conv_context = {
           .bs = batch_size,
-          .ks = kernel_size,
-          .kc = group_input_channels,
-          .kc_stride = k_stride * kernel_size,
+          .ks = op->kernel_height,
+          .kc = row_channels,
+          .kc_stride = k_stride * op->kernel_height,
           .m = output_size,
           .m_stride = m_stride,
           .n = group_output_channels,
@@ -793,18 +3033,91 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .packed_w = op->packed_weights,
           .c = op->output,
           .c_stride = op->output_pixel_stride,
+          .c_rows = init_output_rows(op, output_size),
           .quantization_params = op->conv_quantization_params,
-          .ukernel = qnnp_params.q8conv.conv,
+          .ukernel = op->q8conv_params->conv,
       };
 
       pthreadpool_compute_4d_tiled(
           threadpool,
           (pthreadpool_function_4d_tiled_t) compute_q8conv,
           &q8conv_context,
-          groups, batch_size, output_size, group_output_channels,
+          1, batch_size, output_size, group_output_channels,
           1, 1, mr, nr);
       break;
     }
+    case qnnp_ukernel_type_winograd:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t group_input_channels = op->group_input_channels;
+      const size_t group_output_channels = op->group_output_channels;
+      const uint32_t mr = qnnp_params.q8winograd.mr;
+      const uint32_t nr = qnnp_params.q8winograd.nr;
+      const uint32_t kc = qnnp_params.q8winograd.kc;
+      const size_t k_stride = (group_input_channels + (kc - 1)) & -kc;
+      const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+      const size_t tiles_height = divide_round_up(op->output_height, 2);
+      const size_t tiles_width = divide_round_up(op->output_width, 2);
+      const size_t tiles = batch_size * tiles_height * tiles_width;
+      int16_t* transformed_input = (int16_t*) op->workspace;
+      int32_t* transformed_output = (int32_t*) (transformed_input + 16 * tiles * k_stride);
+
+      struct q8winograd_input_context input_context = {
+          .channels = group_input_channels,
+          .k_stride = k_stride,
+          .tiles = tiles,
+          .indirect_input = (const uint8_t**) op->indirection_buffer,
+          .transformed_input = transformed_input,
+          .quantization_params = op->conv_quantization_params,
+          .ukernel = qnnp_params.q8winograd.input,
+      };
+      pthreadpool_compute_1d(
+          threadpool,
+          (pthreadpool_function_1d_t) compute_q8winograd_input,
+          &input_context,
+          tiles);
+
+      struct q8winograd_gemm_context gemm_context = {
+          .k_stride = k_stride,
+          .tiles = tiles,
+          .n = group_output_channels,
+          .n_stride = n_stride,
+          .transformed_input = transformed_input,
+          .packed_w = (const int16_t*) ((uintptr_t) op->packed_weights + n_stride * sizeof(int32_t)),
+          .transformed_output = transformed_output,
+          .ukernel = qnnp_params.q8winograd.gemm,
+      };
+      pthreadpool_compute_3d_tiled(
+          threadpool,
+          (pthreadpool_function_3d_tiled_t) compute_q8winograd_gemm,
+          &gemm_context,
+          16, tiles, group_output_channels,
+          1, mr, nr);
+
+      struct q8winograd_output_context output_context = {
+          .channels = group_output_channels,
+          .tiles = tiles,
+          .tiles_height = tiles_height,
+          .tiles_width = tiles_width,
+          .transformed_output = transformed_output,
+          .bias = (const int32_t*) op->packed_weights,
+          .output = (uint8_t*) op->output,
+          .output_height = op->output_height,
+          .output_width = op->output_width,
+          .output_pixel_stride = op->output_pixel_stride,
+          .output_row_stride = op->output_row_stride,
+          .output_image_stride = op->output_image_stride,
+          .quantization_params = op->conv_quantization_params,
+          .ukernel = qnnp_params.q8winograd.output,
+      };
+      pthreadpool_compute_3d_tiled(
+          threadpool,
+          (pthreadpool_function_3d_tiled_t) compute_q8winograd_output,
+          &output_context,
+          batch_size, tiles_height, tiles_width,
+          1, 1, 1);
+      break;
+    }
     case qnnp_ukernel_type_average_pooling:
     {
       const uint32_t kr = qnnp_params.q8avgpool.kr;
@@ -819,7 +3132,6 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
 
       const size_t width_step = min(op->stride_width, pooling_width);
       const size_t indirect_input_height_stride = (pooling_size + (output_width * width_step - 1) * pooling_height) * sizeof(void*);
-      const size_t output_height_stride = output_width * op->output_pixel_stride;
 
       size_t multipass_adjustment = 0;
       if (channels >= kr && pooling_size > mr) {
@@ -830,8 +3142,8 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .indirect_input_batch_stride = output_height * indirect_input_height_stride,
           .indirect_input_height_stride = indirect_input_height_stride,
           .output = op->output,
-          .output_batch_stride = output_height * output_height_stride,
-          .output_height_stride = output_height_stride,
+          .output_batch_stride = op->output_image_stride,
+          .output_height_stride = op->output_row_stride,
           .output_width = output_width,
           .pooling_size = pooling_size,
           .channels = channels,
@@ -859,6 +3171,38 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       pthreadpool_compute_2d(threadpool, compute_function, &context, op->batch_size, output_height);
       break;
     }
+    case qnnp_ukernel_type_resize_bilinear:
+    {
+      struct resize_bilinear_context context = {
+          .indirect_input = op->indirection_buffer,
+          .weights = op->packed_weights,
+          .output = op->output,
+          .output_pixel_stride = op->output_pixel_stride,
+          .output_height = op->output_height,
+          .output_width = op->output_width,
+          .channels = op->channels,
+          .ukernel = qnnp_params.u8ibilinear,
+      };
+      pthreadpool_compute_2d(threadpool,
+        (pthreadpool_function_2d_t) compute_resize_bilinear, &context,
+        op->batch_size, op->output_height);
+      break;
+    }
+    case qnnp_ukernel_type_resize_nearest:
+    {
+      struct resize_nearest_context context = {
+          .indirect_input = op->indirection_buffer,
+          .output = op->output,
+          .output_pixel_stride = op->output_pixel_stride,
+          .output_height = op->output_height,
+          .output_width = op->output_width,
+          .channels = op->channels,
+      };
+      pthreadpool_compute_2d(threadpool,
+        (pthreadpool_function_2d_t) compute_resize_nearest, &context,
+        op->batch_size, op->output_height);
+      break;
+    }
     case qnnp_ukernel_type_max_pooling:
     {
       const uint32_t kr = qnnp_params.u8maxpool.kr;
@@ -873,7 +3217,6 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
 
       const size_t width_step = op->dilation_width > 1 ? pooling_width : min(op->stride_width, pooling_width);
       const size_t indirect_input_height_stride = (pooling_size + (output_width * width_step - 1) * pooling_height) * sizeof(void*);
-      const size_t output_height_stride = output_width * op->output_pixel_stride;
 
       size_t multipass_adjustment = pooling_size;
       if (channels >= kr) {
@@ -884,8 +3227,8 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .indirect_input_batch_stride = output_height * indirect_input_height_stride,
           .indirect_input_height_stride = indirect_input_height_stride,
           .output = op->output,
-          .output_batch_stride = output_height * output_height_stride,
-          .output_height_stride = output_height_stride,
+          .output_batch_stride = op->output_image_stride,
+          .output_height_stride = op->output_row_stride,
           .output_width = output_width,
           .pooling_size = pooling_size,
           .channels = channels,
@@ -941,6 +3284,41 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       }
       break;
     }
+    case qnnp_ukernel_type_add_lut:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t channels = op->channels;
+      const size_t a_stride = op->input_pixel_stride;
+      const size_t b_stride = op->input2_pixel_stride;
+      const size_t y_stride = op->output_pixel_stride;
+      struct add_lut_context context = {
+        .n = channels,
+        .a = op->input,
+        .a_stride = a_stride * sizeof(uint8_t),
+        .b = op->input2,
+        .b_stride = b_stride * sizeof(uint8_t),
+        .t = op->lookup_table,
+        .y = op->output,
+        .y_stride = y_stride * sizeof(uint8_t),
+        .quantization_params = op->add_quantization_params,
+        .add_ukernel = qnnp_params.q8add.uvadd,
+        .lut_ukernel = qnnp_params.x8lut,
+      };
+      if ((((a_stride ^ channels) | (b_stride ^ channels) | (y_stride ^ channels)) == 0) || batch_size == 1) {
+        pthreadpool_compute_1d_tiled(
+          threadpool,
+          (pthreadpool_function_1d_tiled_t) compute_add_lut_contiguous,
+          &context,
+          batch_size * channels * sizeof(uint8_t), QNNP_ADD_LUT_BLOCK_SIZE);
+      } else {
+        pthreadpool_compute_1d(
+          threadpool,
+          (pthreadpool_function_1d_t) compute_add_lut_strided,
+          &context,
+          batch_size);
+      }
+      break;
+    }
     case qnnp_ukernel_type_global_average_pooling:
     {
       const uint32_t nr = qnnp_params.q8gavgpool.nr;
@@ -1051,6 +3429,100 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       }
       break;
     }
+    case qnnp_ukernel_type_quantize:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t channels = op->channels;
+      const size_t x_stride = op->input_pixel_stride;
+      const size_t y_stride = op->output_pixel_stride;
+      if ((((x_stride ^ channels) | (y_stride ^ channels)) == 0) || batch_size == 1) {
+        const size_t block_size = 4096;
+        struct quantize_contiguous_context context = {
+          .x = op->input,
+          .y = op->output,
+          .ukernel = qnnp_params.q8quant,
+          .params = op->q8_quantization_params,
+        };
+        pthreadpool_compute_1d_tiled(
+          threadpool,
+          (pthreadpool_function_1d_tiled_t) compute_quantize_contiguous, &context,
+          batch_size * channels, block_size);
+      } else {
+        struct quantize_strided_context context = {
+          .n = channels,
+          .x = op->input,
+          .x_stride = x_stride * sizeof(float),
+          .y = op->output,
+          .y_stride = y_stride * sizeof(uint8_t),
+          .ukernel = qnnp_params.q8quant,
+          .params = op->q8_quantization_params,
+        };
+        pthreadpool_compute_1d(
+          threadpool,
+          (pthreadpool_function_1d_t) compute_quantize_strided, &context,
+          batch_size);
+      }
+      break;
+    }
+    case qnnp_ukernel_type_dequantize:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t channels = op->channels;
+      const size_t x_stride = op->input_pixel_stride;
+      const size_t y_stride = op->output_pixel_stride;
+      if ((((x_stride ^ channels) | (y_stride ^ channels)) == 0) || batch_size == 1) {
+        const size_t block_size = 4096;
+        struct dequantize_contiguous_context context = {
+          .x = op->input,
+          .y = op->output,
+          .ukernel = qnnp_params.q8dequant,
+          .params = op->q8_dequantization_params,
+        };
+        pthreadpool_compute_1d_tiled(
+          threadpool,
+          (pthreadpool_function_1d_tiled_t) compute_dequantize_contiguous, &context,
+          batch_size * channels, block_size);
+      } else {
+        struct dequantize_strided_context context = {
+          .n = channels,
+          .x = op->input,
+          .x_stride = x_stride * sizeof(uint8_t),
+          .y = op->output,
+          .y_stride = y_stride * sizeof(float),
+          .ukernel = qnnp_params.q8dequant,
+          .params = op->q8_dequantization_params,
+        };
+        pthreadpool_compute_1d(
+          threadpool,
+          (pthreadpool_function_1d_t) compute_dequantize_strided, &context,
+          batch_size);
+      }
+      break;
+    }
+    case qnnp_ukernel_type_normalize:
+    {
+      struct normalize_context context = {
+        .channels = op->channels,
+        .input_height = op->input_height,
+        .input_width = op->input_width,
+        .input = op->input,
+        .output = op->output,
+        .output_pixel_stride = op->output_pixel_stride,
+        .block_width = QNNP_NORMALIZE_BLOCK_BYTES / op->channels,
+        .quantization_params = op->packed_weights,
+        .lookup_table = op->lookup_table,
+        .quant_ukernel = qnnp_params.q8quant,
+        .lut_ukernel = qnnp_params.x8lut,
+        .zip_ukernels = qnnp_params.x8zip,
+      };
+      pthreadpool_compute_2d(
+        threadpool,
+        op->format == qnnp_format_float32 ?
+          (pthreadpool_function_2d_t) compute_normalize_f32 : (pthreadpool_function_2d_t) compute_normalize_u8,
+        &context,
+        op->batch_size, op->input_height);
+      break;
+    }
     case qnnp_ukernel_type_softargmax:
     {
       struct u8softargmax_context context = {
@@ -1069,48 +3541,460 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
         op->batch_size);
       break;
     }
+    case qnnp_ukernel_type_concat:
+    {
+      bool bound = true;
+      for (size_t i = 0; i < op->inputs; i++) {
+        bound &= op->concat_inputs[i].bound;
+      }
+      if (bound) {
+        /* All producers wrote into their output slices */
+        break;
+      }
+
+      struct concat_context context = {
+        .inputs = op->inputs,
+        .concat_inputs = op->concat_inputs,
+        .y = op->output,
+        .y_stride = op->output_pixel_stride * sizeof(uint8_t),
+        .ukernel = qnnp_params.q8add.uvadd,
+      };
+      const size_t block_size = divide_round_up(4096, op->channels);
+      pthreadpool_compute_1d_tiled(
+        threadpool,
+        (pthreadpool_function_1d_tiled_t) compute_concat,
+        &context,
+        op->batch_size, block_size);
+      break;
+    }
     case qnnp_ukernel_type_channel_shuffle:
+      shuffle_channels(
+        threadpool,
+        op->batch_size, op->groups, op->group_channels,
+        op->input, op->input_pixel_stride,
+        op->output, op->output_pixel_stride);
+      break;
+    case qnnp_ukernel_type_transpose:
     {
-      const size_t groups = op->groups;
-      struct channel_shuffle_context channel_shuffle_context = {
+      const size_t dims = op->transpose_dims;
+      const size_t* shape = op->transpose_shape;
+      const size_t* input_stride = op->transpose_input_stride;
+      const size_t* output_stride = op->transpose_output_stride;
+      struct transpose_context context = {
         .x = op->input,
-        .x_stride = op->input_pixel_stride * sizeof(uint8_t),
         .y = op->output,
-        .y_stride = op->output_pixel_stride * sizeof(uint8_t),
-        .n = op->group_channels * sizeof(uint8_t),
-        .m = groups,
+        .ukernel = qnnp_params.x8transpose,
       };
-      pthreadpool_function_1d_t compute_function = NULL;
-      switch (groups) {
-        case 2:
-          compute_function = (pthreadpool_function_1d_t) compute_channel_shuffle_fixed;
-          channel_shuffle_context.fixed_ukernel = qnnp_params.x8zip.x2;
-          break;
-        case 3:
-          compute_function = (pthreadpool_function_1d_t) compute_channel_shuffle_fixed;
-          channel_shuffle_context.fixed_ukernel = qnnp_params.x8zip.x3;
-          break;
-        case 4:
-          compute_function = (pthreadpool_function_1d_t) compute_channel_shuffle_fixed;
-          channel_shuffle_context.fixed_ukernel = qnnp_params.x8zip.x4;
+      if (input_stride[dims - 1] == 1) {
+        if (dims == 1) {
+          /* Identity permutation, possibly after dropping unit dimensions */
+          pthreadpool_compute_1d_tiled(
+            threadpool,
+            (pthreadpool_function_1d_tiled_t) compute_transpose_contiguous,
+            &context,
+            shape[0], 65536);
           break;
-        default:
-          compute_function = (pthreadpool_function_1d_t) compute_channel_shuffle_variable;
-          channel_shuffle_context.variable_ukernel = qnnp_params.x8zip.xm;
-          break;
-        case 0:
-        case 1:
-          QNNP_UNREACHABLE;
+        }
+
+        /* Innermost output dimension is contiguous in the input too: copy it in runs */
+        size_t outer_count = 1;
+        for (size_t i = 0; i + 1 < dims; i++) {
+          context.outer_shape[i] = shape[i];
+          context.outer_x_stride[i] = input_stride[i];
+          context.outer_y_stride[i] = output_stride[i];
+          outer_count *= shape[i];
+        }
+        context.outer_dims = dims - 1;
+        context.n = shape[dims - 1];
+        pthreadpool_compute_1d_tiled(
+          threadpool,
+          (pthreadpool_function_1d_tiled_t) compute_transpose_copy,
+          &context,
+          outer_count, divide_round_up(4096, context.n));
+      } else {
+        /*
+         * Transpose tiles of the plane spanned by the dimension contiguous in the input (columns) and the dimension
+         * contiguous in the output (rows), for every combination of the remaining dimensions.
+         */
+        size_t contiguous_dim = 0;
+        while (input_stride[contiguous_dim] != 1) {
+          contiguous_dim++;
+        }
+        assert(contiguous_dim < dims - 1);
+
+        size_t outer_count = 1;
+        size_t outer_dims = 0;
+        for (size_t i = 0; i + 1 < dims; i++) {
+          if (i != contiguous_dim) {
+            context.outer_shape[outer_dims] = shape[i];
+            context.outer_x_stride[outer_dims] = input_stride[i];
+            context.outer_y_stride[outer_dims] = output_stride[i];
+            outer_count *= shape[i];
+            outer_dims += 1;
+          }
+        }
+        context.outer_dims = outer_dims;
+        context.x_stride = input_stride[dims - 1];
+        context.y_stride = output_stride[contiguous_dim];
+        pthreadpool_compute_3d_tiled(
+          threadpool,
+          (pthreadpool_function_3d_tiled_t) compute_transpose_tile,
+          &context,
+          outer_count, shape[contiguous_dim], shape[dims - 1],
+          1, 64, 64);
+      }
+      break;
+    }
+    case qnnp_ukernel_type_pad:
+    {
+      const size_t padding_top = op->input_padding_top;
+      const size_t padding_left = op->input_padding_left;
+      const size_t output_pixel_stride = op->output_pixel_stride;
+      uint8_t* output = op->output;
+      const uint8_t* interior = output + padding_top * op->output_row_stride + padding_left * output_pixel_stride;
+      const bool bound = op->input == interior && op->input_pixel_stride == output_pixel_stride;
+      struct pad_context context = {
+        .x = op->input,
+        .x_pixel_stride = op->input_pixel_stride * sizeof(uint8_t),
+        .x_row_stride = bound ? op->output_row_stride : op->input_width * op->input_pixel_stride,
+        .x_image_stride = bound ? op->output_image_stride : op->input_height * op->input_width * op->input_pixel_stride,
+        .input_height = op->input_height,
+        .input_width = op->input_width,
+        .y = output,
+        .y_pixel_stride = output_pixel_stride * sizeof(uint8_t),
+        .y_row_stride = op->output_row_stride,
+        .y_image_stride = op->output_image_stride,
+        .output_width = op->output_width,
+        .padding_top = padding_top,
+        .padding_left = padding_left,
+        .channels = op->channels,
+        .padding_mode = op->padding_mode,
+        .padding_value = op->padding_value,
+        .bound = bound,
+      };
+      pthreadpool_compute_2d(
+        threadpool,
+        (pthreadpool_function_2d_t) compute_pad,
+        &context,
+        op->batch_size, op->output_height);
+      break;
+    }
+    case qnnp_ukernel_type_argmax:
+    {
+      const size_t blocks = divide_round_up(op->channels, QNNP_SELECTION_BLOCK_CHANNELS);
+      struct argmax_context context = {
+        .x = op->input,
+        .x_stride = op->input_pixel_stride * sizeof(uint8_t),
+        .n = op->channels,
+        .blocks = blocks,
+        .block_maxima = op->workspace,
+        .y = op->output,
+        .ukernel = qnnp_params.u8argmax,
+      };
+      if (blocks == 1) {
+        pthreadpool_compute_1d(
+          threadpool,
+          (pthreadpool_function_1d_t) compute_argmax,
+          &context,
+          op->batch_size);
+      } else {
+        pthreadpool_compute_2d(
+          threadpool,
+          (pthreadpool_function_2d_t) compute_argmax_block,
+          &context,
+          op->batch_size, blocks);
+        pthreadpool_compute_1d(
+          threadpool,
+          (pthreadpool_function_1d_t) compute_argmax_reduce,
+          &context,
+          op->batch_size);
+      }
+      break;
+    }
+    case qnnp_ukernel_type_top_k:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t blocks = divide_round_up(op->channels, QNNP_SELECTION_BLOCK_CHANNELS);
+      uint32_t* histograms = op->workspace;
+      struct top_k_context context = {
+        .x = op->input,
+        .x_stride = op->input_pixel_stride * sizeof(uint8_t),
+        .n = op->channels,
+        .k = op->top_k,
+        .blocks = blocks,
+        .histograms = histograms,
+        .thresholds = (uint8_t*) (histograms + batch_size * blocks * 256),
+        .y_values = op->output,
+        .y_indices = op->output_indices,
+        .y_stride = op->output_pixel_stride,
+      };
+      if (blocks == 1) {
+        pthreadpool_compute_1d(
+          threadpool,
+          (pthreadpool_function_1d_t) compute_top_k,
+          &context,
+          batch_size);
+      } else {
+        pthreadpool_compute_2d(
+          threadpool,
+          (pthreadpool_function_2d_t) compute_top_k_histogram,
+          &context,
+          batch_size, blocks);
+        pthreadpool_compute_1d(
+          threadpool,
+          (pthreadpool_function_1d_t) compute_top_k_offsets,
+          &context,
+          batch_size);
+        pthreadpool_compute_2d(
+          threadpool,
+          (pthreadpool_function_2d_t) compute_top_k_select,
+          &context,
+          batch_size, blocks);
+      }
+      break;
+    }
+    case qnnp_ukernel_type_reduce:
+    {
+      const size_t output_dims = op->reduce_output_dims;
+      const size_t dims = op->reduce_dims;
+      size_t outputs = 1;
+      for (size_t i = 0; i < output_dims; i++) {
+        outputs *= op->reduce_output_shape[i];
+      }
+
+      if (qnnp_operator_reduces_rows(op)) {
+        const size_t channels = op->reduce_output_shape[output_dims - 1];
+        const size_t rows = op->reduce_shape[0];
+        struct reduce_rows_context context = {
+          .x = op->input,
+          .x_outer_stride = rows * channels * sizeof(uint8_t),
+          .x_row_stride = channels * sizeof(uint8_t),
+          .rows = rows,
+          .channels = channels,
+          .zero = op->zero_pointer,
+          .y = op->output,
+          .y_outer_stride = channels * sizeof(uint8_t),
+          .operation = op->reduce_operation,
+          .quantization_params = op->avgpool_quantization_params,
+          .mr = qnnp_params.q8gavgpool.mr,
+          .nr = qnnp_params.q8gavgpool.nr,
+          .ltnr_ukernel = qnnp_params.q8gavgpool.ltnr,
+          .unipass_ukernel = qnnp_params.q8gavgpool.genr_lemr,
+          .multipass_ukernel = qnnp_params.q8gavgpool.genr_gtmr,
+        };
+        pthreadpool_function_2d_t compute_function = (pthreadpool_function_2d_t) compute_reduce_rows_sum;
+        if (op->reduce_operation == qnnp_reduce_operation_max || op->reduce_operation == qnnp_reduce_operation_min) {
+          compute_function = (pthreadpool_function_2d_t) compute_reduce_rows_extremum;
+        }
+        pthreadpool_compute_2d(
+          threadpool,
+          compute_function,
+          &context,
+          outputs / channels, divide_round_up(channels, QNNP_REDUCE_BLOCK_CHANNELS));
+      } else {
+        /* Same split into blocks as in qnnp_setup_reduce_nd_q8 */
+        size_t reduction_size = 1;
+        for (size_t i = 0; i < dims; i++) {
+          reduction_size *= op->reduce_shape[i];
+        }
+        const bool has_run = dims != 0 && op->reduce_stride[dims - 1] == 1;
+        const size_t run = has_run ? op->reduce_shape[dims - 1] : 1;
+        const size_t run_chunk = min(run, QNNP_REDUCE_BLOCK_ELEMENTS);
+        const size_t run_chunks = divide_round_up(run, run_chunk);
+        const size_t segments = reduction_size / run * run_chunks;
+        const size_t block_segments = QNNP_REDUCE_BLOCK_ELEMENTS / run_chunk;
+        const size_t blocks = divide_round_up(segments, block_segments);
+
+        struct reduce_context context = {
+          .x = op->input,
+          .y_dims = output_dims,
+          .dims = has_run ? dims - 1 : dims,
+          .run = run,
+          .run_chunk = run_chunk,
+          .run_chunks = run_chunks,
+          .segments = segments,
+          .block_segments = block_segments,
+          .blocks = blocks,
+          .partials = op->workspace,
+          .y = op->output,
+          .operation = op->reduce_operation,
+          .quantization_params = op->avgpool_quantization_params,
+          .rmax_ukernel = qnnp_params.u8rmax,
+        };
+        memcpy(context.y_shape, op->reduce_output_shape, sizeof(context.y_shape));
+        memcpy(context.y_x_stride, op->reduce_output_stride, sizeof(context.y_x_stride));
+        memcpy(context.shape, op->reduce_shape, sizeof(context.shape));
+        memcpy(context.x_stride, op->reduce_stride, sizeof(context.x_stride));
+
+        /* Every task reduces about QNNP_REDUCE_BLOCK_ELEMENTS elements, over one or several outputs */
+        const size_t block_elements = min(segments, block_segments) * run_chunk;
+        pthreadpool_compute_2d_tiled(
+          threadpool,
+          (pthreadpool_function_2d_tiled_t) compute_reduce_partial,
+          &context,
+          outputs, blocks,
+          max(QNNP_REDUCE_BLOCK_ELEMENTS / block_elements, 1), 1);
+        pthreadpool_compute_1d_tiled(
+          threadpool,
+          (pthreadpool_function_1d_tiled_t) compute_reduce_combine,
+          &context,
+          outputs,
+          QNNP_REDUCE_BLOCK_ELEMENTS);
+      }
+      break;
+    }
+    case qnnp_ukernel_type_embedding_lookup:
+    {
+      const size_t channels = op->channels;
+      const bool identity =
+        op->input_zero_point == op->output_zero_point && op->input_scale == op->output_scale &&
+        op->output_min == 0 && op->output_max == UINT8_MAX;
+      if (op->embedding_offsets == NULL && identity) {
+        struct embedding_gather_context context = {
+          .table = op->input,
+          .table_stride = op->input_pixel_stride * sizeof(uint8_t),
+          .table_rows = op->embedding_rows,
+          .indices = op->embedding_indices,
+          .indices_count = op->embedding_indices_count,
+          .row_size = channels * sizeof(uint8_t),
+          .output = op->output,
+          .output_stride = op->output_pixel_stride * sizeof(uint8_t),
+        };
+        pthreadpool_compute_1d_tiled(
+          threadpool,
+          (pthreadpool_function_1d_tiled_t) compute_embedding_gather,
+          &context,
+          op->embedding_indices_count,
+          QNNP_EMBEDDING_BLOCK_BAGS);
+      } else {
+        const uint32_t kr = qnnp_params.q8avgpool.kr;
+        struct embedding_bag_context context = {
+          .table = op->input,
+          .table_stride = op->input_pixel_stride * sizeof(uint8_t),
+          .table_rows = op->embedding_rows,
+          .indices = op->embedding_indices,
+          .offsets = op->embedding_offsets,
+          .indirect_input = op->indirection_buffer,
+          .bag_padding = qnnp_params.q8avgpool.mr - 1,
+          .channels = channels,
+          .packed_channels = (channels + (kr - 1)) & -kr,
+          .zero = op->zero_pointer,
+          .output = op->output,
+          .output_stride = op->output_pixel_stride * sizeof(uint8_t),
+          .mean = op->reduce_operation == qnnp_reduce_operation_mean,
+          .input_zero_point = (int32_t) (uint32_t) op->input_zero_point,
+          .scale = op->input_scale / op->output_scale,
+          .output_zero_point = op->output_zero_point,
+          .output_min = op->output_min,
+          .output_max = op->output_max,
+          .mr = qnnp_params.q8avgpool.mr,
+          .kr = kr,
+          .ltkr_ukernel = qnnp_params.q8avgpool.ltkr,
+          .unipass_ukernel = qnnp_params.q8avgpool.gekr_lemr,
+          .multipass_ukernel = qnnp_params.q8avgpool.gekr_gtmr,
+        };
+        pthreadpool_compute_1d_tiled(
+          threadpool,
+          (pthreadpool_function_1d_tiled_t) compute_embedding_bags,
+          &context,
+          op->batch_size,
+          QNNP_EMBEDDING_BLOCK_BAGS);
+      }
+      break;
+    }
+    case qnnp_ukernel_type_gru_cell:
+    case qnnp_ukernel_type_lstm_cell:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t input_size = op->group_input_channels;
+      const size_t hidden_size = op->group_output_channels;
+      const uint32_t mr = op->q8conv_params->mr;
+      const uint32_t nr = op->q8conv_params->nr;
+      const uint32_t kr = op->q8conv_params->kr;
+      struct rnn_cell_context context = {
+        .input_size = input_size,
+        .hidden_size = hidden_size,
+        .x = op->input,
+        .h = op->input2,
+        .xh = (uint8_t*) op->workspace + 8,
+        .packed_w = op->packed_weights,
+        .c = op->cell_state,
+        .c_output = op->cell_state_output,
+        .h_output = op->output,
+        .lookup_table = op->lookup_table,
+        .h_inverse_scale = 1.0f / op->input_scale,
+        .h_zero_point = (int32_t) (uint32_t) op->input_zero_point,
+        .c_inverse_scale = 1.0f / op->cell_scale,
+        .c_zero_point = (int32_t) (uint32_t) op->cell_zero_point,
+        .mr = mr,
+        .nr = nr,
+        .kr = kr,
+        .quantization_params = op->conv_quantization_params,
+        .ukernel = op->q8conv_params->gemm,
+      };
+      for (size_t block = 0; block < QNNP_RNN_GATE_BLOCKS; block++) {
+        qnnp_operator_get_rnn_cell_block_range(op, block, &context.block_k_start[block], &context.block_k[block]);
+        const size_t k_stride = (context.block_k[block] + (kr - 1)) & -kr;
+        context.packed_tile_size += nr * (k_stride * sizeof(uint8_t) + sizeof(int32_t));
       }
       pthreadpool_compute_1d(
         threadpool,
-        compute_function,
-        &channel_shuffle_context,
-        op->batch_size);
+        (pthreadpool_function_1d_t) compute_rnn_cell_concat,
+        &context,
+        batch_size);
+      pthreadpool_compute_2d_tiled(
+        threadpool,
+        op->ukernel_type == qnnp_ukernel_type_lstm_cell ?
+          (pthreadpool_function_2d_tiled_t) compute_lstm_cell : (pthreadpool_function_2d_tiled_t) compute_gru_cell,
+        &context,
+        batch_size, hidden_size,
+        mr, nr);
+      break;
+    }
+    case qnnp_ukernel_type_depth_to_space:
+    {
+      const size_t block_size = op->stride_height;
+      struct depth_to_space_context context = {
+        .x = op->input,
+        .x_stride = op->input_pixel_stride * sizeof(uint8_t),
+        .y = op->output,
+        .y_stride = op->output_pixel_stride * sizeof(uint8_t),
+        .width = op->input_width,
+        .block_size = block_size,
+        .channels = op->channels,
+      };
+      pthreadpool_compute_2d(
+        threadpool,
+        (pthreadpool_function_2d_t) compute_depth_to_space,
+        &context,
+        op->batch_size * op->input_height, block_size);
+      break;
+    }
+    case qnnp_ukernel_type_space_to_depth:
+    {
+      const size_t block_size = op->stride_height;
+      struct depth_to_space_context context = {
+        .x = op->input,
+        .x_stride = op->input_pixel_stride * sizeof(uint8_t),
+        .y = op->output,
+        .y_stride = op->output_pixel_stride * sizeof(uint8_t),
+        .width = op->output_width,
+        .block_size = block_size,
+        .channels = op->channels,
+      };
+      pthreadpool_compute_2d(
+        threadpool,
+        (pthreadpool_function_2d_t) compute_space_to_depth,
+        &context,
+        op->batch_size * op->output_height, block_size);
       break;
     }
     default:
       QNNP_UNREACHABLE;
   }
+
+  if (op->stream_buffer != NULL) {
+    retain_stream_history(op);
+  }
   return qnnp_status_success;
 }
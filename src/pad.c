@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/math.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_pad_nhwc_x8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    size_t channels,
+    enum qnnp_padding_mode padding_mode,
+    uint8_t padding_value,
+    qnnp_operator_t* pad_out)
+{
+  qnnp_operator_t pad_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_pad_nhwc_x8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create pad operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  switch (padding_mode) {
+    case qnnp_padding_mode_constant:
+    case qnnp_padding_mode_reflect:
+    case qnnp_padding_mode_edge:
+      break;
+    default:
+      qnnp_log_error(
+        "failed to create pad operator with padding mode %d: unknown padding mode", (int) padding_mode);
+      goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  pad_op = calloc(1, sizeof(struct qnnp_operator));
+  if (pad_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  pad_op->input_padding_top = input_padding_top;
+  pad_op->input_padding_right = input_padding_right;
+  pad_op->input_padding_bottom = input_padding_bottom;
+  pad_op->input_padding_left = input_padding_left;
+  pad_op->channels = channels;
+  pad_op->padding_mode = padding_mode;
+  pad_op->padding_value = padding_value;
+
+  pad_op->ukernel_type = qnnp_ukernel_type_pad;
+  pad_op->format = qnnp_format_quint8;
+
+  *pad_out = pad_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(pad_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_pad_nhwc_x8(
+    qnnp_operator_t pad_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    size_t input_pixel_stride,
+    void* output,
+    size_t output_pixel_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_pad_nhwc_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup pad operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_width == 0 || input_height == 0) {
+    qnnp_log_error(
+      "failed to setup pad operator with %zux%zu input: input dimensions must be non-zero",
+      input_width, input_height);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_pixel_stride < pad_op->channels) {
+    qnnp_log_error(
+      "failed to setup pad operator with input pixel stride %zu: "
+      "stride must be at least the number of channels (%zu)",
+      input_pixel_stride, pad_op->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_pixel_stride < pad_op->channels) {
+    qnnp_log_error(
+      "failed to setup pad operator with output pixel stride %zu: "
+      "stride must be at least the number of channels (%zu)",
+      output_pixel_stride, pad_op->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (pad_op->padding_mode == qnnp_padding_mode_reflect) {
+    if (max(pad_op->input_padding_top, pad_op->input_padding_bottom) >= input_height ||
+        max(pad_op->input_padding_left, pad_op->input_padding_right) >= input_width)
+    {
+      qnnp_log_error(
+        "failed to setup pad operator with %zux%zu input and %" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32 " padding: "
+        "reflection padding must be smaller than the input dimensions",
+        input_width, input_height,
+        pad_op->input_padding_left, pad_op->input_padding_right,
+        pad_op->input_padding_top, pad_op->input_padding_bottom);
+      return qnnp_status_invalid_parameter;
+    }
+  }
+
+  const size_t output_height = pad_op->input_padding_top + input_height + pad_op->input_padding_bottom;
+  const size_t output_width = pad_op->input_padding_left + input_width + pad_op->input_padding_right;
+
+  pad_op->batch_size = batch_size;
+  pad_op->input_height = input_height;
+  pad_op->input_width = input_width;
+  pad_op->input = input;
+  pad_op->input_pixel_stride = input_pixel_stride;
+  pad_op->output_height = output_height;
+  pad_op->output_width = output_width;
+  pad_op->output = output;
+  pad_op->output_pixel_stride = output_pixel_stride;
+  pad_op->output_row_stride = output_width * output_pixel_stride;
+  pad_op->output_image_stride = output_height * pad_op->output_row_stride;
+
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_set_output_row_stride(
+    qnnp_operator_t op,
+    size_t output_row_stride,
+    size_t output_image_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_set_output_row_stride failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  switch (op->ukernel_type) {
+    case qnnp_ukernel_type_dwconv:
+    case qnnp_ukernel_type_gemm:
+    case qnnp_ukernel_type_conv:
+    case qnnp_ukernel_type_direct_conv:
+    case qnnp_ukernel_type_row_conv:
+    case qnnp_ukernel_type_winograd:
+      if (op->output_depth > 1) {
+        qnnp_log_error(
+          "failed to set output row stride of convolution with %zu output frames: only 2D outputs are supported",
+          op->output_depth);
+        return qnnp_status_unsupported_parameter;
+      }
+      break;
+    case qnnp_ukernel_type_max_pooling:
+    case qnnp_ukernel_type_average_pooling:
+    case qnnp_ukernel_type_pad:
+      break;
+    default:
+      qnnp_log_error("failed to set output row stride: operator does not support strided output rows");
+      return qnnp_status_unsupported_parameter;
+  }
+
+  if (output_row_stride < op->output_width * op->output_pixel_stride) {
+    qnnp_log_error(
+      "failed to set output row stride %zu: stride must be at least the output width times pixel stride (%zu)",
+      output_row_stride, op->output_width * op->output_pixel_stride);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_image_stride < op->output_height * output_row_stride) {
+    qnnp_log_error(
+      "failed to set output image stride %zu: stride must be at least the output height times row stride (%zu)",
+      output_image_stride, op->output_height * output_row_stride);
+    return qnnp_status_invalid_parameter;
+  }
+
+  op->output_row_stride = output_row_stride;
+  op->output_image_stride = output_image_stride;
+
+  return qnnp_status_success;
+}
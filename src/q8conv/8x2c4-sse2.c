@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <immintrin.h>
+
+#include <qnnpack/q8conv.h>
+
+
+/*
+ * Narrow-N micro-kernel: two output channels with kr = 4, so that every 16-bit multiply-add lane contributes to one
+ * of the outputs. Each accumulator holds [n0:k0k1, n0:k2k3, n1:k0k1, n1:k2k3] partial sums.
+ */
+void q8conv_ukernel_8x2c4__sse2(
+    size_t mr,
+    size_t nr,
+    size_t kc,
+    size_t ks,
+    const uint8_t** restrict a,
+    const void* restrict w,
+    uint8_t* restrict c,
+    size_t c_stride,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m128i vbias = _mm_unpacklo_epi32(_mm_loadl_epi64((const __m128i*) w), _mm_setzero_si128());
+  __m128i vacc0x01 = vbias;
+  __m128i vacc1x01 = vbias;
+  __m128i vacc2x01 = vbias;
+  __m128i vacc3x01 = vbias;
+  __m128i vacc4x01 = vbias;
+  __m128i vacc5x01 = vbias;
+  __m128i vacc6x01 = vbias;
+  __m128i vacc7x01 = vbias;
+  w = (const void*) ((uintptr_t) w + 8);
+
+  const __m128i vb_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.kernel_zero_point);
+  const __m128i vzero = _mm_setzero_si128();
+  do {
+    const uint8_t* restrict a0 = *a++;
+    const uint8_t* restrict a1 = *a++;
+    const uint8_t* restrict a2 = *a++;
+    const uint8_t* restrict a3 = *a++;
+    const uint8_t* restrict a4 = *a++;
+    const uint8_t* restrict a5 = *a++;
+    const uint8_t* restrict a6 = *a++;
+    const uint8_t* restrict a7 = *a++;
+
+    size_t k = kc;
+    for (; k >= 8; k -= 8) {
+      const __m128i vxa0 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) a0), vzero);
+      a0 += 8;
+      const __m128i vxa1 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) a1), vzero);
+      a1 += 8;
+      const __m128i vxa2 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) a2), vzero);
+      a2 += 8;
+      const __m128i vxa3 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) a3), vzero);
+      a3 += 8;
+      const __m128i vxa4 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) a4), vzero);
+      a4 += 8;
+      const __m128i vxa5 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) a5), vzero);
+      a5 += 8;
+      const __m128i vxa6 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) a6), vzero);
+      a6 += 8;
+      const __m128i vxa7 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) a7), vzero);
+      a7 += 8;
+
+      const __m128i vb01 = _mm_loadu_si128((const __m128i*) w);
+      const __m128i vxb01c0123 = _mm_sub_epi16(_mm_unpacklo_epi8(vb01, vzero), vb_zero_point);
+      const __m128i vxb01c4567 = _mm_sub_epi16(_mm_unpackhi_epi8(vb01, vzero), vb_zero_point);
+      w = (const void*) ((uintptr_t) w + 16);
+
+      vacc0x01 = _mm_add_epi32(vacc0x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc1x01 = _mm_add_epi32(vacc1x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc2x01 = _mm_add_epi32(vacc2x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc3x01 = _mm_add_epi32(vacc3x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc4x01 = _mm_add_epi32(vacc4x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa4, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc5x01 = _mm_add_epi32(vacc5x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa5, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc6x01 = _mm_add_epi32(vacc6x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa6, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc7x01 = _mm_add_epi32(vacc7x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa7, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc0x01 = _mm_add_epi32(vacc0x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+      vacc1x01 = _mm_add_epi32(vacc1x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+      vacc2x01 = _mm_add_epi32(vacc2x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+      vacc3x01 = _mm_add_epi32(vacc3x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+      vacc4x01 = _mm_add_epi32(vacc4x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa4, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+      vacc5x01 = _mm_add_epi32(vacc5x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa5, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+      vacc6x01 = _mm_add_epi32(vacc6x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa6, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+      vacc7x01 = _mm_add_epi32(vacc7x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa7, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+    }
+    if (k != 0) {
+      const size_t a_predecrement = 8 - k;
+      const __m128i va_shift = _mm_cvtsi32_si128(8 * a_predecrement);
+
+      const __m128i vxa0 = _mm_unpacklo_epi8(
+        _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a0 - a_predecrement)), va_shift), vzero);
+      const __m128i vxa1 = _mm_unpacklo_epi8(
+        _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a1 - a_predecrement)), va_shift), vzero);
+      const __m128i vxa2 = _mm_unpacklo_epi8(
+        _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a2 - a_predecrement)), va_shift), vzero);
+      const __m128i vxa3 = _mm_unpacklo_epi8(
+        _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a3 - a_predecrement)), va_shift), vzero);
+      const __m128i vxa4 = _mm_unpacklo_epi8(
+        _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a4 - a_predecrement)), va_shift), vzero);
+      const __m128i vxa5 = _mm_unpacklo_epi8(
+        _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a5 - a_predecrement)), va_shift), vzero);
+      const __m128i vxa6 = _mm_unpacklo_epi8(
+        _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a6 - a_predecrement)), va_shift), vzero);
+      const __m128i vxa7 = _mm_unpacklo_epi8(
+        _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a7 - a_predecrement)), va_shift), vzero);
+
+      const __m128i vxb01c0123 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) w), vzero), vb_zero_point);
+      w = (const void*) ((uintptr_t) w + 8);
+
+      vacc0x01 = _mm_add_epi32(vacc0x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc1x01 = _mm_add_epi32(vacc1x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc2x01 = _mm_add_epi32(vacc2x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc3x01 = _mm_add_epi32(vacc3x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc4x01 = _mm_add_epi32(vacc4x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa4, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc5x01 = _mm_add_epi32(vacc5x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa5, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc6x01 = _mm_add_epi32(vacc6x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa6, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+      vacc7x01 = _mm_add_epi32(vacc7x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa7, _MM_SHUFFLE(1, 0, 1, 0)), vxb01c0123));
+
+      if (k > 4) {
+        const __m128i vxb01c4567 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) w), vzero), vb_zero_point);
+        w = (const void*) ((uintptr_t) w + 8);
+
+        vacc0x01 = _mm_add_epi32(vacc0x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+        vacc1x01 = _mm_add_epi32(vacc1x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+        vacc2x01 = _mm_add_epi32(vacc2x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+        vacc3x01 = _mm_add_epi32(vacc3x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+        vacc4x01 = _mm_add_epi32(vacc4x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa4, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+        vacc5x01 = _mm_add_epi32(vacc5x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa5, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+        vacc6x01 = _mm_add_epi32(vacc6x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa6, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+        vacc7x01 = _mm_add_epi32(vacc7x01, _mm_madd_epi16(_mm_shuffle_epi32(vxa7, _MM_SHUFFLE(3, 2, 3, 2)), vxb01c4567));
+      }
+    }
+  } while (--ks != 0);
+
+  /* Reduce pairs of partial sums: vaccXY holds [X:0, X:1, Y:0, Y:1] */
+  __m128i vacc01 = _mm_add_epi32(
+    _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vacc0x01), _mm_castsi128_ps(vacc1x01), _MM_SHUFFLE(2, 0, 2, 0))),
+    _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vacc0x01), _mm_castsi128_ps(vacc1x01), _MM_SHUFFLE(3, 1, 3, 1))));
+  __m128i vacc23 = _mm_add_epi32(
+    _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vacc2x01), _mm_castsi128_ps(vacc3x01), _MM_SHUFFLE(2, 0, 2, 0))),
+    _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vacc2x01), _mm_castsi128_ps(vacc3x01), _MM_SHUFFLE(3, 1, 3, 1))));
+  __m128i vacc45 = _mm_add_epi32(
+    _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vacc4x01), _mm_castsi128_ps(vacc5x01), _MM_SHUFFLE(2, 0, 2, 0))),
+    _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vacc4x01), _mm_castsi128_ps(vacc5x01), _MM_SHUFFLE(3, 1, 3, 1))));
+  __m128i vacc67 = _mm_add_epi32(
+    _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vacc6x01), _mm_castsi128_ps(vacc7x01), _MM_SHUFFLE(2, 0, 2, 0))),
+    _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(vacc6x01), _mm_castsi128_ps(vacc7x01), _MM_SHUFFLE(3, 1, 3, 1))));
+
+  const __m128i vmultiplier = _mm_load_si128((const __m128i*) quantization_params->sse2.multiplier);
+  const __m128i vrounding = _mm_load_si128((const __m128i*) quantization_params->sse2.rounding);
+
+  const __m128i vnmask01 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc01);
+  const __m128i vnmask23 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc23);
+  const __m128i vnmask45 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc45);
+  const __m128i vnmask67 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc67);
+
+  const __m128i vabsacc01 = _mm_sub_epi32(_mm_xor_si128(vacc01, vnmask01), vnmask01);
+  const __m128i vabsacc23 = _mm_sub_epi32(_mm_xor_si128(vacc23, vnmask23), vnmask23);
+  const __m128i vabsacc45 = _mm_sub_epi32(_mm_xor_si128(vacc45, vnmask45), vnmask45);
+  const __m128i vabsacc67 = _mm_sub_epi32(_mm_xor_si128(vacc67, vnmask67), vnmask67);
+
+  const __m128i vabsprod01x02 = _mm_mul_epu32(vabsacc01, vmultiplier);
+  const __m128i vabsprod23x02 = _mm_mul_epu32(vabsacc23, vmultiplier);
+  const __m128i vabsprod45x02 = _mm_mul_epu32(vabsacc45, vmultiplier);
+  const __m128i vabsprod67x02 = _mm_mul_epu32(vabsacc67, vmultiplier);
+
+  const __m128i vnmask01x02 = _mm_shuffle_epi32(vnmask01, _MM_SHUFFLE(2, 2, 0, 0));
+  const __m128i vnmask23x02 = _mm_shuffle_epi32(vnmask23, _MM_SHUFFLE(2, 2, 0, 0));
+  const __m128i vnmask45x02 = _mm_shuffle_epi32(vnmask45, _MM_SHUFFLE(2, 2, 0, 0));
+  const __m128i vnmask67x02 = _mm_shuffle_epi32(vnmask67, _MM_SHUFFLE(2, 2, 0, 0));
+
+  const __m128i vprod01x02 = _mm_sub_epi64(_mm_xor_si128(vabsprod01x02, vnmask01x02), vnmask01x02);
+  const __m128i vprod23x02 = _mm_sub_epi64(_mm_xor_si128(vabsprod23x02, vnmask23x02), vnmask23x02);
+  const __m128i vprod45x02 = _mm_sub_epi64(_mm_xor_si128(vabsprod45x02, vnmask45x02), vnmask45x02);
+  const __m128i vprod67x02 = _mm_sub_epi64(_mm_xor_si128(vabsprod67x02, vnmask67x02), vnmask67x02);
+
+  const __m128i vq31prod01x02 = _mm_srli_epi64(_mm_add_epi64(vprod01x02, vrounding), 31);
+  const __m128i vq31prod23x02 = _mm_srli_epi64(_mm_add_epi64(vprod23x02, vrounding), 31);
+  const __m128i vq31prod45x02 = _mm_srli_epi64(_mm_add_epi64(vprod45x02, vrounding), 31);
+  const __m128i vq31prod67x02 = _mm_srli_epi64(_mm_add_epi64(vprod67x02, vrounding), 31);
+
+  const __m128i vabsprod01x13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc01, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+  const __m128i vabsprod23x13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc23, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+  const __m128i vabsprod45x13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc45, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+  const __m128i vabsprod67x13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc67, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+
+  const __m128i vnmask01x13 = _mm_shuffle_epi32(vnmask01, _MM_SHUFFLE(3, 3, 1, 1));
+  const __m128i vnmask23x13 = _mm_shuffle_epi32(vnmask23, _MM_SHUFFLE(3, 3, 1, 1));
+  const __m128i vnmask45x13 = _mm_shuffle_epi32(vnmask45, _MM_SHUFFLE(3, 3, 1, 1));
+  const __m128i vnmask67x13 = _mm_shuffle_epi32(vnmask67, _MM_SHUFFLE(3, 3, 1, 1));
+
+  const __m128i vprod01x13 = _mm_sub_epi64(_mm_xor_si128(vabsprod01x13, vnmask01x13), vnmask01x13);
+  const __m128i vprod23x13 = _mm_sub_epi64(_mm_xor_si128(vabsprod23x13, vnmask23x13), vnmask23x13);
+  const __m128i vprod45x13 = _mm_sub_epi64(_mm_xor_si128(vabsprod45x13, vnmask45x13), vnmask45x13);
+  const __m128i vprod67x13 = _mm_sub_epi64(_mm_xor_si128(vabsprod67x13, vnmask67x13), vnmask67x13);
+
+  const __m128i vq31prod01x13 = _mm_srli_epi64(_mm_add_epi64(vprod01x13, vrounding), 31);
+  const __m128i vq31prod23x13 = _mm_srli_epi64(_mm_add_epi64(vprod23x13, vrounding), 31);
+  const __m128i vq31prod45x13 = _mm_srli_epi64(_mm_add_epi64(vprod45x13, vrounding), 31);
+  const __m128i vq31prod67x13 = _mm_srli_epi64(_mm_add_epi64(vprod67x13, vrounding), 31);
+
+  const __m128i vq31prod01 = _mm_shuffle_epi32(_mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod01x02), _mm_castsi128_ps(vq31prod01x13), _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+  const __m128i vq31prod23 = _mm_shuffle_epi32(_mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod23x02), _mm_castsi128_ps(vq31prod23x13), _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+  const __m128i vq31prod45 = _mm_shuffle_epi32(_mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod45x02), _mm_castsi128_ps(vq31prod45x13), _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+  const __m128i vq31prod67 = _mm_shuffle_epi32(_mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod67x02), _mm_castsi128_ps(vq31prod67x13), _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+
+  const __m128i vremainder_mask = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_mask);
+  const __m128i vrem01 =
+    _mm_add_epi32(_mm_and_si128(vq31prod01, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod01));
+  const __m128i vrem23 =
+    _mm_add_epi32(_mm_and_si128(vq31prod23, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod23));
+  const __m128i vrem45 =
+    _mm_add_epi32(_mm_and_si128(vq31prod45, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod45));
+  const __m128i vrem67 =
+    _mm_add_epi32(_mm_and_si128(vq31prod67, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod67));
+
+  const __m128i vremainder_threshold = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_threshold);
+  const __m128i vshift = _mm_load_si128((const __m128i*) quantization_params->sse2.shift);
+  vacc01 = _mm_sub_epi32(_mm_sra_epi32(vq31prod01, vshift), _mm_cmpgt_epi32(vrem01, vremainder_threshold));
+  vacc23 = _mm_sub_epi32(_mm_sra_epi32(vq31prod23, vshift), _mm_cmpgt_epi32(vrem23, vremainder_threshold));
+  vacc45 = _mm_sub_epi32(_mm_sra_epi32(vq31prod45, vshift), _mm_cmpgt_epi32(vrem45, vremainder_threshold));
+  vacc67 = _mm_sub_epi32(_mm_sra_epi32(vq31prod67, vshift), _mm_cmpgt_epi32(vrem67, vremainder_threshold));
+
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point);
+  const __m128i vout0123 = _mm_adds_epi16(_mm_packs_epi32(vacc01, vacc23), voutput_zero_point);
+  const __m128i vout4567 = _mm_adds_epi16(_mm_packs_epi32(vacc45, vacc67), voutput_zero_point);
+  __m128i vout = _mm_packus_epi16(vout0123, vout4567);
+  vout = _mm_min_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_max));
+  vout = _mm_max_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_min));
+
+  uint8_t* c0 = c;
+  uint8_t* c1 = (uint8_t*) ((uintptr_t) c0 + c_stride);
+  if (mr < 2) {
+    c1 = c0;
+  }
+  uint8_t* c2 = (uint8_t*) ((uintptr_t) c1 + c_stride);
+  if (mr <= 2) {
+    c2 = c1;
+  }
+  uint8_t* c3 = (uint8_t*) ((uintptr_t) c2 + c_stride);
+  if (mr < 4) {
+    c3 = c2;
+  }
+  uint8_t* c4 = (uint8_t*) ((uintptr_t) c3 + c_stride);
+  if (mr <= 4) {
+    c4 = c3;
+  }
+  uint8_t* c5 = (uint8_t*) ((uintptr_t) c4 + c_stride);
+  if (mr < 6) {
+    c5 = c4;
+  }
+  uint8_t* c6 = (uint8_t*) ((uintptr_t) c5 + c_stride);
+  if (mr <= 6) {
+    c6 = c5;
+  }
+  uint8_t* c7 = (uint8_t*) ((uintptr_t) c6 + c_stride);
+  if (mr != 8) {
+    c7 = c6;
+  }
+  if (nr == 2) {
+    *((uint16_t*) c0) = (uint16_t) _mm_extract_epi16(vout, 0);
+    *((uint16_t*) c1) = (uint16_t) _mm_extract_epi16(vout, 1);
+    *((uint16_t*) c2) = (uint16_t) _mm_extract_epi16(vout, 2);
+    *((uint16_t*) c3) = (uint16_t) _mm_extract_epi16(vout, 3);
+    *((uint16_t*) c4) = (uint16_t) _mm_extract_epi16(vout, 4);
+    *((uint16_t*) c5) = (uint16_t) _mm_extract_epi16(vout, 5);
+    *((uint16_t*) c6) = (uint16_t) _mm_extract_epi16(vout, 6);
+    *((uint16_t*) c7) = (uint16_t) _mm_extract_epi16(vout, 7);
+  } else {
+    *((uint8_t*) c0) = (uint8_t) _mm_extract_epi16(vout, 0);
+    *((uint8_t*) c1) = (uint8_t) _mm_extract_epi16(vout, 1);
+    *((uint8_t*) c2) = (uint8_t) _mm_extract_epi16(vout, 2);
+    *((uint8_t*) c3) = (uint8_t) _mm_extract_epi16(vout, 3);
+    *((uint8_t*) c4) = (uint8_t) _mm_extract_epi16(vout, 4);
+    *((uint8_t*) c5) = (uint8_t) _mm_extract_epi16(vout, 5);
+    *((uint8_t*) c6) = (uint8_t) _mm_extract_epi16(vout, 6);
+    *((uint8_t*) c7) = (uint8_t) _mm_extract_epi16(vout, 7);
+  }
+}
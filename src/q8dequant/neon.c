@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/q8dequant.h>
+
+
+void q8dequant_ukernel__neon(
+    size_t n,
+    const uint8_t* x,
+    float* y,
+    const union qnnp_q8_dequantization_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  const float scale = params->neon.scale;
+  const uint8x8_t vzero_point = vld1_dup_u8(&params->neon.input_zero_point);
+  for (; n >= 16; n -= 16) {
+    const uint8x16_t vx = vld1q_u8(x); x += 16;
+
+    /* Differences are in [-255, 255] range, so the wrapped unsigned subtraction is exact as a signed value */
+    const int16x8_t vxlo = vreinterpretq_s16_u16(vsubl_u8(vget_low_u8(vx), vzero_point));
+    const int16x8_t vxhi = vreinterpretq_s16_u16(vsubl_u8(vget_high_u8(vx), vzero_point));
+
+    vst1q_f32(y, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(vxlo))), scale)); y += 4;
+    vst1q_f32(y, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(vxlo))), scale)); y += 4;
+    vst1q_f32(y, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(vxhi))), scale)); y += 4;
+    vst1q_f32(y, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(vxhi))), scale)); y += 4;
+  }
+  if (n >= 8) {
+    const int16x8_t vx = vreinterpretq_s16_u16(vsubl_u8(vld1_u8(x), vzero_point)); x += 8;
+
+    vst1q_f32(y, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(vx))), scale)); y += 4;
+    vst1q_f32(y, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(vx))), scale)); y += 4;
+    n -= 8;
+  }
+  if (n != 0) {
+    const int32_t zero_point = (int32_t) (uint32_t) params->neon.input_zero_point;
+    do {
+      *y++ = (float) ((int32_t) (uint32_t) *x++ - zero_point) * scale;
+    } while (--n != 0);
+  }
+}
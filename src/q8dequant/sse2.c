@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/q8dequant.h>
+
+
+void q8dequant_ukernel__sse2(
+    size_t n,
+    const uint8_t* x,
+    float* y,
+    const union qnnp_q8_dequantization_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  const __m128 vscale = _mm_load_ps(params->sse2.scale);
+  const __m128i vzero_point = _mm_load_si128((const __m128i*) params->sse2.input_zero_point);
+  const __m128i vzero = _mm_setzero_si128();
+  for (; n >= 16; n -= 16) {
+    const __m128i vx = _mm_loadu_si128((const __m128i*) x);
+    x += 16;
+
+    const __m128i vxlo = _mm_sub_epi16(_mm_unpacklo_epi8(vx, vzero), vzero_point);
+    const __m128i vxhi = _mm_sub_epi16(_mm_unpackhi_epi8(vx, vzero), vzero_point);
+
+    /* Sign-extend differences to 32 bits: unpacking a vector with itself and shifting right keeps the upper copy */
+    const __m128 vy0 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(vxlo, vxlo), 16));
+    const __m128 vy1 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(vxlo, vxlo), 16));
+    const __m128 vy2 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(vxhi, vxhi), 16));
+    const __m128 vy3 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(vxhi, vxhi), 16));
+
+    _mm_storeu_ps(y, _mm_mul_ps(vy0, vscale));
+    _mm_storeu_ps(y + 4, _mm_mul_ps(vy1, vscale));
+    _mm_storeu_ps(y + 8, _mm_mul_ps(vy2, vscale));
+    _mm_storeu_ps(y + 12, _mm_mul_ps(vy3, vscale));
+    y += 16;
+  }
+  if (n >= 8) {
+    const __m128i vx = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) x), vzero), vzero_point);
+    x += 8;
+
+    const __m128 vy0 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(vx, vx), 16));
+    const __m128 vy1 = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(vx, vx), 16));
+
+    _mm_storeu_ps(y, _mm_mul_ps(vy0, vscale));
+    _mm_storeu_ps(y + 4, _mm_mul_ps(vy1, vscale));
+    y += 8;
+    n -= 8;
+  }
+  if (n != 0) {
+    const float scale = params->sse2.scale[0];
+    const int32_t zero_point = (int32_t) params->sse2.input_zero_point[0];
+    do {
+      *y++ = (float) ((int32_t) (uint32_t) *x++ - zero_point) * scale;
+    } while (--n != 0);
+  }
+}
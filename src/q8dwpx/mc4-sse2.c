@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <string.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/common.h>
+#include <qnnpack/math.h>
+#include <qnnpack/q8dw.h>
+
+
+static QNNP_INLINE uint32_t load_channels(const uint8_t* input, size_t channels)
+{
+  switch (channels) {
+    case 1:
+      return (uint32_t) input[0];
+    case 2:
+      return (uint32_t) *((const uint16_t*) input);
+    case 3:
+      return (uint32_t) *((const uint16_t*) input) | ((uint32_t) input[2] << 16);
+    default:
+      return *((const uint32_t*) input);
+  }
+}
+
+/*
+ * Gathers tap k of 8 / pixel_lanes output pixels into the 8 lanes of one vector, pixel_lanes lanes per pixel.
+ * Only the channels bytes of each pixel are read; lanes past them are zero.
+ */
+static QNNP_INLINE __m128i load_pixels(
+    const uint8_t** const pixels[restrict static 8],
+    size_t k,
+    size_t channels,
+    size_t pixel_lanes)
+{
+  __m128i vi;
+  switch (pixel_lanes) {
+    case 1:
+      vi = _mm_cvtsi32_si128((int) (
+        (uint32_t) pixels[0][k][0] | ((uint32_t) pixels[1][k][0] << 8) |
+        ((uint32_t) pixels[2][k][0] << 16) | ((uint32_t) pixels[3][k][0] << 24)));
+      vi = _mm_insert_epi16(vi, (int) ((uint32_t) pixels[4][k][0] | ((uint32_t) pixels[5][k][0] << 8)), 2);
+      vi = _mm_insert_epi16(vi, (int) ((uint32_t) pixels[6][k][0] | ((uint32_t) pixels[7][k][0] << 8)), 3);
+      break;
+    case 2:
+      vi = _mm_cvtsi32_si128((int) (load_channels(pixels[0][k], channels) | (load_channels(pixels[1][k], channels) << 16)));
+      vi = _mm_insert_epi16(vi, (int) load_channels(pixels[2][k], channels), 2);
+      vi = _mm_insert_epi16(vi, (int) load_channels(pixels[3][k], channels), 3);
+      break;
+    default:
+      vi = _mm_unpacklo_epi32(
+        _mm_cvtsi32_si128((int) load_channels(pixels[0][k], channels)),
+        _mm_cvtsi32_si128((int) load_channels(pixels[1][k], channels)));
+      break;
+  }
+  return _mm_unpacklo_epi8(vi, _mm_setzero_si128());
+}
+
+static QNNP_INLINE __m128i requantize(
+    __m128i vacc_lo,
+    __m128i vacc_hi,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m128i vmultiplier = _mm_load_si128((const __m128i*) quantization_params->sse2.multiplier);
+  const __m128i vrounding = _mm_load_si128((const __m128i*) quantization_params->sse2.rounding);
+
+  const __m128i vnmask_lo0123 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc_lo);
+  const __m128i vnmask_hi0123 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc_hi);
+
+  const __m128i vabsacc_lo0123 = _mm_sub_epi32(_mm_xor_si128(vacc_lo, vnmask_lo0123), vnmask_lo0123);
+  const __m128i vabsacc_hi0123 = _mm_sub_epi32(_mm_xor_si128(vacc_hi, vnmask_hi0123), vnmask_hi0123);
+
+  const __m128i vabsacc_lo1032 = _mm_shuffle_epi32(vabsacc_lo0123, _MM_SHUFFLE(2, 3, 0, 1));
+  const __m128i vabsacc_hi1032 = _mm_shuffle_epi32(vabsacc_hi0123, _MM_SHUFFLE(2, 3, 0, 1));
+
+  const __m128i vabsprod_lo02 = _mm_mul_epu32(vabsacc_lo0123, vmultiplier);
+  const __m128i vabsprod_hi02 = _mm_mul_epu32(vabsacc_hi0123, vmultiplier);
+
+  const __m128i vnmask_lo02 = _mm_shuffle_epi32(vnmask_lo0123, _MM_SHUFFLE(2, 2, 0, 0));
+  const __m128i vnmask_hi02 = _mm_shuffle_epi32(vnmask_hi0123, _MM_SHUFFLE(2, 2, 0, 0));
+
+  const __m128i vprod_lo02 = _mm_sub_epi64(_mm_xor_si128(vabsprod_lo02, vnmask_lo02), vnmask_lo02);
+  const __m128i vprod_hi02 = _mm_sub_epi64(_mm_xor_si128(vabsprod_hi02, vnmask_hi02), vnmask_hi02);
+
+  const __m128i vq31prod_lo02 = _mm_srli_epi64(_mm_add_epi64(vprod_lo02, vrounding), 31);
+  const __m128i vq31prod_hi02 = _mm_srli_epi64(_mm_add_epi64(vprod_hi02, vrounding), 31);
+
+  const __m128i vabsprod_lo13 = _mm_mul_epu32(vabsacc_lo1032, vmultiplier);
+  const __m128i vabsprod_hi13 = _mm_mul_epu32(vabsacc_hi1032, vmultiplier);
+
+  const __m128i vnmask_lo13 = _mm_shuffle_epi32(vnmask_lo0123, _MM_SHUFFLE(3, 3, 1, 1));
+  const __m128i vnmask_hi13 = _mm_shuffle_epi32(vnmask_hi0123, _MM_SHUFFLE(3, 3, 1, 1));
+
+  const __m128i vprod_lo13 = _mm_sub_epi64(_mm_xor_si128(vabsprod_lo13, vnmask_lo13), vnmask_lo13);
+  const __m128i vprod_hi13 = _mm_sub_epi64(_mm_xor_si128(vabsprod_hi13, vnmask_hi13), vnmask_hi13);
+
+  const __m128i vq31prod_lo13 = _mm_srli_epi64(_mm_add_epi64(vprod_lo13, vrounding), 31);
+  const __m128i vq31prod_hi13 = _mm_srli_epi64(_mm_add_epi64(vprod_hi13, vrounding), 31);
+
+  const __m128i vq31prod_lo0213 = _mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod_lo02), _mm_castsi128_ps(vq31prod_lo13), _MM_SHUFFLE(2, 0, 2, 0)));
+  const __m128i vq31prod_hi0213 = _mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod_hi02), _mm_castsi128_ps(vq31prod_hi13), _MM_SHUFFLE(2, 0, 2, 0)));
+
+  const __m128i vq31prod_lo0123 = _mm_shuffle_epi32(vq31prod_lo0213, _MM_SHUFFLE(3, 1, 2, 0));
+  const __m128i vq31prod_hi0123 = _mm_shuffle_epi32(vq31prod_hi0213, _MM_SHUFFLE(3, 1, 2, 0));
+
+  const __m128i vremainder_mask = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_mask);
+
+  const __m128i vrem_lo0123 =
+    _mm_add_epi32(_mm_and_si128(vq31prod_lo0123, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod_lo0123));
+  const __m128i vrem_hi0123 =
+    _mm_add_epi32(_mm_and_si128(vq31prod_hi0123, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod_hi0123));
+
+  const __m128i vremainder_threshold = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_threshold);
+  const __m128i vshift = _mm_load_si128((const __m128i*) quantization_params->sse2.shift);
+
+  const __m128i vout_lo = _mm_sub_epi32(_mm_sra_epi32(vq31prod_lo0123, vshift), _mm_cmpgt_epi32(vrem_lo0123, vremainder_threshold));
+  const __m128i vout_hi = _mm_sub_epi32(_mm_sra_epi32(vq31prod_hi0123, vshift), _mm_cmpgt_epi32(vrem_hi0123, vremainder_threshold));
+
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point);
+  __m128i vout = _mm_adds_epi16(_mm_packs_epi32(vout_lo, vout_hi), voutput_zero_point);
+  vout = _mm_packus_epi16(vout, vout);
+  vout = _mm_min_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_max));
+  vout = _mm_max_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_min));
+  return vout;
+}
+
+static QNNP_INLINE void compute(
+    size_t channels,
+    size_t pixel_lanes,
+    size_t output_width,
+    size_t kernel_size,
+    const uint8_t** input,
+    const void* weights,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const size_t pixels_per_vector = 8 / pixel_lanes;
+  const size_t output_stride = channels + output_increment;
+  const __m128i vkernel_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.kernel_zero_point);
+  const __m128i vzero = _mm_setzero_si128();
+  const __m128i vbias_lo = _mm_loadu_si128((const __m128i*) weights);
+  const __m128i vbias_hi = _mm_loadu_si128((const __m128i*) ((uintptr_t) weights + 16));
+
+  do {
+    /* Lanes past the last output pixel recompute it and are not stored */
+    const size_t n = min(output_width, pixels_per_vector);
+    const uint8_t** pixels[8];
+    for (size_t p = 0; p < pixels_per_vector; p++) {
+      pixels[p] = (const uint8_t**) ((uintptr_t) input + min(p, n - 1) * input_stride);
+    }
+
+    __m128i vacc_lo = vbias_lo;
+    __m128i vacc_hi = vbias_hi;
+    const void* w = (const void*) ((uintptr_t) weights + 32);
+    for (size_t k = 0; k < kernel_size; k++) {
+      const __m128i vxi = load_pixels(pixels, k, channels, pixel_lanes);
+      const __m128i vk = _mm_loadl_epi64((const __m128i*) w);
+      w = (const void*) ((uintptr_t) w + 8);
+      const __m128i vxk = _mm_sub_epi16(_mm_unpacklo_epi8(vk, vzero), vkernel_zero_point);
+      const __m128i vprod_odd  = _mm_mullo_epi16(vxi, vxk);
+      const __m128i vprod_even = _mm_mulhi_epi16(vxi, vxk);
+      vacc_lo = _mm_add_epi32(vacc_lo, _mm_unpacklo_epi16(vprod_odd, vprod_even));
+      vacc_hi = _mm_add_epi32(vacc_hi, _mm_unpackhi_epi16(vprod_odd, vprod_even));
+    }
+
+    QNNP_ALIGN(16) uint8_t vout_bytes[16];
+    _mm_store_si128((__m128i*) vout_bytes, requantize(vacc_lo, vacc_hi, quantization_params));
+    for (size_t p = 0; p < n; p++) {
+      memcpy(output, vout_bytes + p * pixel_lanes, channels);
+      output += output_stride;
+    }
+
+    input = (const uint8_t**) ((uintptr_t) input + n * input_stride);
+    output_width -= n;
+  } while (output_width != 0);
+}
+
+void q8dwpx_ukernel_mc4__sse2(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const uint8_t** input,
+    const void* weights,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  /* Each pixel takes channels rounded up to a power of 2 lanes, so that 8, 4, or 2 pixels share one vector */
+  switch (channels) {
+    case 1:
+      compute(1, 1, output_width, kernel_size, input, weights, output, input_stride, output_increment, quantization_params);
+      break;
+    case 2:
+      compute(2, 2, output_width, kernel_size, input, weights, output, input_stride, output_increment, quantization_params);
+      break;
+    case 3:
+      compute(3, 4, output_width, kernel_size, input, weights, output, input_stride, output_increment, quantization_params);
+      break;
+    default:
+      compute(4, 4, output_width, kernel_size, input, weights, output, input_stride, output_increment, quantization_params);
+      break;
+  }
+}
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stdbool.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/common.h>
+#include <qnnpack/q8dw.h>
+
+
+/* Three vertically adjacent input pixels of one 8-channel block, widened to 16 bits */
+struct column {
+  __m128i row0;
+  __m128i row1;
+  __m128i row2;
+};
+
+static QNNP_INLINE __m128i load_pixel(const uint8_t* input, bool partial, __m128i vi_shift)
+{
+  __m128i vi = _mm_loadl_epi64((const __m128i*) input);
+  if (partial) {
+    vi = _mm_srl_epi64(vi, vi_shift);
+  }
+  return _mm_unpacklo_epi8(vi, _mm_setzero_si128());
+}
+
+static QNNP_INLINE struct column load_column(
+    const uint8_t* i0,
+    const uint8_t* i1,
+    const uint8_t* i2,
+    size_t offset,
+    bool partial,
+    __m128i vi_shift)
+{
+  return (struct column) {
+    .row0 = load_pixel(i0 + offset, partial, vi_shift),
+    .row1 = load_pixel(i1 + offset, partial, vi_shift),
+    .row2 = load_pixel(i2 + offset, partial, vi_shift),
+  };
+}
+
+static QNNP_INLINE void multiply_accumulate(__m128i* vacc_lo, __m128i* vacc_hi, __m128i vxi, __m128i vxk)
+{
+  const __m128i vprod_odd  = _mm_mullo_epi16(vxi, vxk);
+  const __m128i vprod_even = _mm_mulhi_epi16(vxi, vxk);
+  *vacc_lo = _mm_add_epi32(*vacc_lo, _mm_unpacklo_epi16(vprod_odd, vprod_even));
+  *vacc_hi = _mm_add_epi32(*vacc_hi, _mm_unpackhi_epi16(vprod_odd, vprod_even));
+}
+
+static QNNP_INLINE void accumulate_column(__m128i* vacc_lo, __m128i* vacc_hi, struct column vx, const __m128i vxk[3])
+{
+  multiply_accumulate(vacc_lo, vacc_hi, vx.row0, vxk[0]);
+  multiply_accumulate(vacc_lo, vacc_hi, vx.row1, vxk[1]);
+  multiply_accumulate(vacc_lo, vacc_hi, vx.row2, vxk[2]);
+}
+
+static QNNP_INLINE __m128i requantize(
+    __m128i vacc_lo,
+    __m128i vacc_hi,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m128i vmultiplier = _mm_load_si128((const __m128i*) quantization_params->sse2.multiplier);
+  const __m128i vrounding = _mm_load_si128((const __m128i*) quantization_params->sse2.rounding);
+
+  const __m128i vnmask_lo0123 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc_lo);
+  const __m128i vnmask_hi0123 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc_hi);
+
+  const __m128i vabsacc_lo0123 = _mm_sub_epi32(_mm_xor_si128(vacc_lo, vnmask_lo0123), vnmask_lo0123);
+  const __m128i vabsacc_hi0123 = _mm_sub_epi32(_mm_xor_si128(vacc_hi, vnmask_hi0123), vnmask_hi0123);
+
+  const __m128i vabsacc_lo1032 = _mm_shuffle_epi32(vabsacc_lo0123, _MM_SHUFFLE(2, 3, 0, 1));
+  const __m128i vabsacc_hi1032 = _mm_shuffle_epi32(vabsacc_hi0123, _MM_SHUFFLE(2, 3, 0, 1));
+
+  const __m128i vabsprod_lo02 = _mm_mul_epu32(vabsacc_lo0123, vmultiplier);
+  const __m128i vabsprod_hi02 = _mm_mul_epu32(vabsacc_hi0123, vmultiplier);
+
+  const __m128i vnmask_lo02 = _mm_shuffle_epi32(vnmask_lo0123, _MM_SHUFFLE(2, 2, 0, 0));
+  const __m128i vnmask_hi02 = _mm_shuffle_epi32(vnmask_hi0123, _MM_SHUFFLE(2, 2, 0, 0));
+
+  const __m128i vprod_lo02 = _mm_sub_epi64(_mm_xor_si128(vabsprod_lo02, vnmask_lo02), vnmask_lo02);
+  const __m128i vprod_hi02 = _mm_sub_epi64(_mm_xor_si128(vabsprod_hi02, vnmask_hi02), vnmask_hi02);
+
+  const __m128i vq31prod_lo02 = _mm_srli_epi64(_mm_add_epi64(vprod_lo02, vrounding), 31);
+  const __m128i vq31prod_hi02 = _mm_srli_epi64(_mm_add_epi64(vprod_hi02, vrounding), 31);
+
+  const __m128i vabsprod_lo13 = _mm_mul_epu32(vabsacc_lo1032, vmultiplier);
+  const __m128i vabsprod_hi13 = _mm_mul_epu32(vabsacc_hi1032, vmultiplier);
+
+  const __m128i vnmask_lo13 = _mm_shuffle_epi32(vnmask_lo0123, _MM_SHUFFLE(3, 3, 1, 1));
+  const __m128i vnmask_hi13 = _mm_shuffle_epi32(vnmask_hi0123, _MM_SHUFFLE(3, 3, 1, 1));
+
+  const __m128i vprod_lo13 = _mm_sub_epi64(_mm_xor_si128(vabsprod_lo13, vnmask_lo13), vnmask_lo13);
+  const __m128i vprod_hi13 = _mm_sub_epi64(_mm_xor_si128(vabsprod_hi13, vnmask_hi13), vnmask_hi13);
+
+  const __m128i vq31prod_lo13 = _mm_srli_epi64(_mm_add_epi64(vprod_lo13, vrounding), 31);
+  const __m128i vq31prod_hi13 = _mm_srli_epi64(_mm_add_epi64(vprod_hi13, vrounding), 31);
+
+  const __m128i vq31prod_lo0213 = _mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod_lo02), _mm_castsi128_ps(vq31prod_lo13), _MM_SHUFFLE(2, 0, 2, 0)));
+  const __m128i vq31prod_hi0213 = _mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod_hi02), _mm_castsi128_ps(vq31prod_hi13), _MM_SHUFFLE(2, 0, 2, 0)));
+
+  const __m128i vq31prod_lo0123 = _mm_shuffle_epi32(vq31prod_lo0213, _MM_SHUFFLE(3, 1, 2, 0));
+  const __m128i vq31prod_hi0123 = _mm_shuffle_epi32(vq31prod_hi0213, _MM_SHUFFLE(3, 1, 2, 0));
+
+  const __m128i vremainder_mask = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_mask);
+
+  const __m128i vrem_lo0123 =
+    _mm_add_epi32(_mm_and_si128(vq31prod_lo0123, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod_lo0123));
+  const __m128i vrem_hi0123 =
+    _mm_add_epi32(_mm_and_si128(vq31prod_hi0123, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod_hi0123));
+
+  const __m128i vremainder_threshold = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_threshold);
+  const __m128i vshift = _mm_load_si128((const __m128i*) quantization_params->sse2.shift);
+
+  const __m128i vout_lo = _mm_sub_epi32(_mm_sra_epi32(vq31prod_lo0123, vshift), _mm_cmpgt_epi32(vrem_lo0123, vremainder_threshold));
+  const __m128i vout_hi = _mm_sub_epi32(_mm_sra_epi32(vq31prod_hi0123, vshift), _mm_cmpgt_epi32(vrem_hi0123, vremainder_threshold));
+
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point);
+  __m128i vout = _mm_adds_epi16(_mm_packs_epi32(vout_lo, vout_hi), voutput_zero_point);
+  vout = _mm_packus_epi16(vout, vout);
+  vout = _mm_min_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_max));
+  vout = _mm_max_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_min));
+  return vout;
+}
+
+static QNNP_INLINE void store(uint8_t* output, __m128i vout, size_t c)
+{
+  if (c == 8) {
+    _mm_storel_epi64((__m128i*) output, vout);
+    return;
+  }
+  if (c & 4) {
+    *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout);
+    output += 4;
+    vout = _mm_srli_epi64(vout, 32);
+  }
+  if (c & 2) {
+    *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout, 0);
+    output += 2;
+    vout = _mm_srli_epi32(vout, 16);
+  }
+  if (c & 1) {
+    *((uint8_t*) output) = (uint8_t) _mm_cvtsi128_si32(vout);
+  }
+}
+
+/*
+ * Computes output_width adjacent output pixels of one 8-channel block. Input columns shared by adjacent outputs are
+ * loaded once and kept in registers: with stride 1 every output loads one new column, with stride 2 two new columns.
+ */
+static QNNP_INLINE void compute_block(
+    size_t c,
+    size_t output_width,
+    const uint8_t* i0,
+    const uint8_t* i1,
+    const uint8_t* i2,
+    size_t input_pixel_stride,
+    const void* w,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1],
+    const size_t stride,
+    const bool partial)
+{
+  const __m128i vkernel_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.kernel_zero_point);
+  const __m128i vzero = _mm_setzero_si128();
+  const __m128i vi_shift = _mm_cvtsi32_si128(8 * (8 - c));
+
+  const __m128i vbias_lo = _mm_loadu_si128((const __m128i*) w);
+  const __m128i vbias_hi = _mm_loadu_si128((const __m128i*) ((uintptr_t) w + 16));
+  /* Taps are packed column by column: vxk[kx][ky] */
+  __m128i vxk[3][3];
+  for (size_t kx = 0; kx < 3; kx++) {
+    for (size_t ky = 0; ky < 3; ky++) {
+      const __m128i vk = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + 32 + (kx * 3 + ky) * 8));
+      vxk[kx][ky] = _mm_sub_epi16(_mm_unpacklo_epi8(vk, vzero), vkernel_zero_point);
+    }
+  }
+
+  size_t x_offset = 0;
+  struct column vx0 = load_column(i0, i1, i2, x_offset, partial, vi_shift);
+  struct column vx1 = vx0;
+  if (stride == 1) {
+    vx1 = load_column(i0, i1, i2, x_offset + input_pixel_stride, partial, vi_shift);
+  }
+
+  for (; output_width >= 2; output_width -= 2) {
+    __m128i vacc0_lo = vbias_lo, vacc0_hi = vbias_hi;
+    __m128i vacc1_lo = vbias_lo, vacc1_hi = vbias_hi;
+    if (stride == 1) {
+      const struct column vx2 = load_column(i0, i1, i2, x_offset + 2 * input_pixel_stride, partial, vi_shift);
+      const struct column vx3 = load_column(i0, i1, i2, x_offset + 3 * input_pixel_stride, partial, vi_shift);
+
+      accumulate_column(&vacc0_lo, &vacc0_hi, vx0, vxk[0]);
+      accumulate_column(&vacc0_lo, &vacc0_hi, vx1, vxk[1]);
+      accumulate_column(&vacc0_lo, &vacc0_hi, vx2, vxk[2]);
+      accumulate_column(&vacc1_lo, &vacc1_hi, vx1, vxk[0]);
+      accumulate_column(&vacc1_lo, &vacc1_hi, vx2, vxk[1]);
+      accumulate_column(&vacc1_lo, &vacc1_hi, vx3, vxk[2]);
+
+      vx0 = vx2;
+      vx1 = vx3;
+    } else {
+      vx1 = load_column(i0, i1, i2, x_offset + input_pixel_stride, partial, vi_shift);
+      const struct column vx2 = load_column(i0, i1, i2, x_offset + 2 * input_pixel_stride, partial, vi_shift);
+      const struct column vx3 = load_column(i0, i1, i2, x_offset + 3 * input_pixel_stride, partial, vi_shift);
+      const struct column vx4 = load_column(i0, i1, i2, x_offset + 4 * input_pixel_stride, partial, vi_shift);
+
+      accumulate_column(&vacc0_lo, &vacc0_hi, vx0, vxk[0]);
+      accumulate_column(&vacc0_lo, &vacc0_hi, vx1, vxk[1]);
+      accumulate_column(&vacc0_lo, &vacc0_hi, vx2, vxk[2]);
+      accumulate_column(&vacc1_lo, &vacc1_hi, vx2, vxk[0]);
+      accumulate_column(&vacc1_lo, &vacc1_hi, vx3, vxk[1]);
+      accumulate_column(&vacc1_lo, &vacc1_hi, vx4, vxk[2]);
+
+      vx0 = vx4;
+    }
+    x_offset += 2 * stride * input_pixel_stride;
+
+    store(output, requantize(vacc0_lo, vacc0_hi, quantization_params), c);
+    output += output_pixel_stride;
+    store(output, requantize(vacc1_lo, vacc1_hi, quantization_params), c);
+    output += output_pixel_stride;
+  }
+  if (output_width != 0) {
+    __m128i vacc_lo = vbias_lo, vacc_hi = vbias_hi;
+    if (stride == 2) {
+      vx1 = load_column(i0, i1, i2, x_offset + input_pixel_stride, partial, vi_shift);
+    }
+    const struct column vx2 = load_column(i0, i1, i2, x_offset + 2 * input_pixel_stride, partial, vi_shift);
+
+    accumulate_column(&vacc_lo, &vacc_hi, vx0, vxk[0]);
+    accumulate_column(&vacc_lo, &vacc_hi, vx1, vxk[1]);
+    accumulate_column(&vacc_lo, &vacc_hi, vx2, vxk[2]);
+
+    store(output, requantize(vacc_lo, vacc_hi, quantization_params), c);
+  }
+}
+
+static QNNP_INLINE void compute_row(
+    size_t channels,
+    size_t output_width,
+    const uint8_t* i0,
+    const uint8_t* i1,
+    const uint8_t* i2,
+    size_t input_pixel_stride,
+    const void* weights,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1],
+    const size_t stride)
+{
+  size_t c = channels;
+  const void* w = weights;
+  for (; c >= 8; c -= 8) {
+    compute_block(
+      8, output_width,
+      i0, i1, i2, input_pixel_stride,
+      w, output, output_pixel_stride,
+      quantization_params, stride, false);
+
+    i0 += 8;
+    i1 += 8;
+    i2 += 8;
+    w = (const void*) ((uintptr_t) w + 32 + 9 * 8);
+    output += 8;
+  }
+  if (c != 0) {
+    const size_t i_predecrement = 8 - c;
+    compute_block(
+      c, output_width,
+      i0 - i_predecrement, i1 - i_predecrement, i2 - i_predecrement, input_pixel_stride,
+      w, output, output_pixel_stride,
+      quantization_params, stride, true);
+  }
+}
+
+void q8dwrow_ukernel_3x3s1c8__sse2(
+    size_t channels,
+    size_t output_width,
+    const uint8_t* input_row0,
+    const uint8_t* input_row1,
+    const uint8_t* input_row2,
+    size_t input_pixel_stride,
+    const void* weights,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  compute_row(
+    channels, output_width,
+    input_row0, input_row1, input_row2, input_pixel_stride,
+    weights, output, output_pixel_stride,
+    quantization_params, 1);
+}
+
+void q8dwrow_ukernel_3x3s2c8__sse2(
+    size_t channels,
+    size_t output_width,
+    const uint8_t* input_row0,
+    const uint8_t* input_row1,
+    const uint8_t* input_row2,
+    size_t input_pixel_stride,
+    const void* weights,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  compute_row(
+    channels, output_width,
+    input_row0, input_row1, input_row2, input_pixel_stride,
+    weights, output, output_pixel_stride,
+    quantization_params, 2);
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/math.h>
+#include <qnnpack/q8packb.h>
+
+
+static inline __m128i load_row(const uint8_t* b, size_t n, uint8_t kzp) {
+  if (n == 2) {
+    return _mm_cvtsi32_si128((int) *((const uint16_t*) b));
+  }
+  /* The second column of a partial panel is padded with the kernel zero point */
+  return _mm_cvtsi32_si128((int) ((uint32_t) b[0] | ((uint32_t) kzp << 8)));
+}
+
+void q8packb_ukernel_2c4__sse2(
+    size_t k,
+    size_t n,
+    const uint8_t* b,
+    size_t b_stride,
+    uint8_t izp,
+    uint8_t kzp,
+    void* packed_b)
+{
+  assert(k != 0);
+  assert(n != 0);
+  assert(n <= 2);
+
+  int32_t* packed_bias = (int32_t*) packed_b;
+  uint8_t* packed_k = (uint8_t*) (packed_bias + 2);
+  const int32_t boff = (int32_t) k * (int32_t) izp * (int32_t) kzp;
+  /* Rows padding k to a multiple of kr hold the kernel zero point and are excluded from the column sums */
+  const int32_t kpad_sum = (int32_t) (-k & 3) * (int32_t) kzp;
+
+  const __m128i vkzp = _mm_set1_epi8((char) kzp);
+  const __m128i vzero = _mm_setzero_si128();
+  const __m128i vones = _mm_set1_epi16(1);
+  __m128i vacc = _mm_setzero_si128();
+  for (; k >= 8; k -= 8) {
+    const __m128i vb0 = load_row(b, n, kzp); b += b_stride;
+    const __m128i vb1 = load_row(b, n, kzp); b += b_stride;
+    const __m128i vb2 = load_row(b, n, kzp); b += b_stride;
+    const __m128i vb3 = load_row(b, n, kzp); b += b_stride;
+    const __m128i vb4 = load_row(b, n, kzp); b += b_stride;
+    const __m128i vb5 = load_row(b, n, kzp); b += b_stride;
+    const __m128i vb6 = load_row(b, n, kzp); b += b_stride;
+    const __m128i vb7 = load_row(b, n, kzp); b += b_stride;
+
+    /* Pairs of rows, then quads of rows, transpose a 2x4 tile into 2 columns of 4 consecutive K */
+    const __m128i vb01 = _mm_unpacklo_epi8(vb0, vb1);
+    const __m128i vb23 = _mm_unpacklo_epi8(vb2, vb3);
+    const __m128i vb45 = _mm_unpacklo_epi8(vb4, vb5);
+    const __m128i vb67 = _mm_unpacklo_epi8(vb6, vb7);
+    const __m128i vb0123 = _mm_unpacklo_epi16(vb01, vb23);
+    const __m128i vb4567 = _mm_unpacklo_epi16(vb45, vb67);
+    const __m128i vb01234567 = _mm_unpacklo_epi64(vb0123, vb4567);
+    _mm_storeu_si128((__m128i*) packed_k, vb01234567);
+    packed_k += 16;
+
+    vacc = _mm_add_epi32(vacc, _mm_madd_epi16(_mm_unpacklo_epi8(vb01234567, vzero), vones));
+    vacc = _mm_add_epi32(vacc, _mm_madd_epi16(_mm_unpackhi_epi8(vb01234567, vzero), vones));
+  }
+  while (k != 0) {
+    const __m128i vb0 = load_row(b, n, kzp); b += b_stride;
+    __m128i vb1 = vkzp;
+    __m128i vb2 = vkzp;
+    __m128i vb3 = vkzp;
+    if (k >= 2) {
+      vb1 = load_row(b, n, kzp); b += b_stride;
+      if (k >= 3) {
+        vb2 = load_row(b, n, kzp); b += b_stride;
+        if (k >= 4) {
+          vb3 = load_row(b, n, kzp); b += b_stride;
+        }
+      }
+    }
+    k -= min(k, 4);
+
+    const __m128i vb01 = _mm_unpacklo_epi8(vb0, vb1);
+    const __m128i vb23 = _mm_unpacklo_epi8(vb2, vb3);
+    const __m128i vb0123 = _mm_unpacklo_epi16(vb01, vb23);
+    _mm_storel_epi64((__m128i*) packed_k, vb0123);
+    packed_k += 8;
+
+    vacc = _mm_add_epi32(vacc, _mm_madd_epi16(_mm_unpacklo_epi8(vb0123, vzero), vones));
+  }
+
+  /* Each column's sum is split across a pair of 32-bit lanes */
+  int32_t ksum[4];
+  _mm_storeu_si128((__m128i*) ksum, vacc);
+  packed_bias[0] = boff - (ksum[0] + ksum[1] - kpad_sum) * (int32_t) izp;
+  packed_bias[1] = n == 2 ? boff - (ksum[2] + ksum[3] - kpad_sum) * (int32_t) izp : 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/q8packb.h>
+
+
+static inline uint8x8_t load_row(const uint8_t* b, size_t n, uint8_t kzp) {
+  if (n == 8) {
+    return vld1_u8(b);
+  }
+  /* Columns past n of a partial panel are padded with the kernel zero point */
+  uint8_t row[8] = { kzp, kzp, kzp, kzp, kzp, kzp, kzp, kzp };
+  for (size_t c = 0; c < n; c++) {
+    row[c] = b[c];
+  }
+  return vld1_u8(row);
+}
+
+void q8packb_ukernel_8c1__neon(
+    size_t k,
+    size_t n,
+    const uint8_t* b,
+    size_t b_stride,
+    uint8_t izp,
+    uint8_t kzp,
+    void* packed_b)
+{
+  assert(k != 0);
+  assert(n != 0);
+  assert(n <= 8);
+
+  int32_t* packed_bias = (int32_t*) packed_b;
+  uint8_t* packed_k = (uint8_t*) (packed_bias + 8);
+  const int32_t boff = (int32_t) k * (int32_t) izp * (int32_t) kzp;
+
+  /* With kr = 1 the packed tile of a row is the row itself */
+  uint32x4_t vacc_lo = vmovq_n_u32(0);
+  uint32x4_t vacc_hi = vmovq_n_u32(0);
+  for (; k >= 4; k -= 4) {
+    const uint8x8_t vb0 = load_row(b, n, kzp); b += b_stride;
+    const uint8x8_t vb1 = load_row(b, n, kzp); b += b_stride;
+    const uint8x8_t vb2 = load_row(b, n, kzp); b += b_stride;
+    const uint8x8_t vb3 = load_row(b, n, kzp); b += b_stride;
+
+    vst1_u8(packed_k, vb0); packed_k += 8;
+    vst1_u8(packed_k, vb1); packed_k += 8;
+    vst1_u8(packed_k, vb2); packed_k += 8;
+    vst1_u8(packed_k, vb3); packed_k += 8;
+
+    const uint16x8_t vsum = vaddq_u16(vaddl_u8(vb0, vb1), vaddl_u8(vb2, vb3));
+    vacc_lo = vaddw_u16(vacc_lo, vget_low_u16(vsum));
+    vacc_hi = vaddw_u16(vacc_hi, vget_high_u16(vsum));
+  }
+  for (; k != 0; k--) {
+    const uint8x8_t vb = load_row(b, n, kzp); b += b_stride;
+
+    vst1_u8(packed_k, vb); packed_k += 8;
+
+    const uint16x8_t vsum = vmovl_u8(vb);
+    vacc_lo = vaddw_u16(vacc_lo, vget_low_u16(vsum));
+    vacc_hi = vaddw_u16(vacc_hi, vget_high_u16(vsum));
+  }
+
+  int32_t ksum[8];
+  vst1q_s32(ksum, vreinterpretq_s32_u32(vacc_lo));
+  vst1q_s32(ksum + 4, vreinterpretq_s32_u32(vacc_hi));
+  for (size_t c = 0; c < 8; c++) {
+    packed_bias[c] = c < n ? boff - ksum[c] * (int32_t) izp : 0;
+  }
+}
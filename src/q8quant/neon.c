@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/q8quant.h>
+
+
+/*
+ * Lower clamp which maps NaN to the minimum, like the MAXPS operand order in the SSE2 micro-kernel: VMAX propagates
+ * NaN, while FMAXNM returns the numeric operand. ARMv7 selects the minimum for lanes that compare unequal to themselves.
+ */
+static inline float32x4_t clamp_min_f32(float32x4_t vx, float32x4_t vmin)
+{
+#ifdef __aarch64__
+  return vmaxnmq_f32(vx, vmin);
+#else
+  return vmaxq_f32(vbslq_f32(vceqq_f32(vx, vx), vx, vmin), vmin);
+#endif
+}
+
+void q8quant_ukernel__neon(
+    size_t n,
+    const float* x,
+    uint8_t* y,
+    const union qnnp_q8_quantization_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  const float32x4_t vscale = vld1q_dup_f32(&params->neon.scale);
+  const float32x4_t vbias = vld1q_dup_f32(&params->neon.bias);
+  const float32x4_t vmin = vld1q_dup_f32(&params->neon.output_min_less_zero_point);
+  const float32x4_t vmax = vld1q_dup_f32(&params->neon.output_max_less_zero_point);
+  const float32x4_t vfmagic = vdupq_n_f32(12582912.0f);
+  const int32x4_t vimagic = vld1q_dup_s32(&params->neon.magic_less_zero_point);
+  for (; n >= 16; n -= 16) {
+    const float32x4_t vx0 = vld1q_f32(x); x += 4;
+    const float32x4_t vx1 = vld1q_f32(x); x += 4;
+    const float32x4_t vx2 = vld1q_f32(x); x += 4;
+    const float32x4_t vx3 = vld1q_f32(x); x += 4;
+
+    /*
+     * Clamp transformed inputs to [output_min - zero point, output_max - zero point], and round to nearest with ties
+     * to even by adding 1.5 * 2**23 and subtracting it (less the output zero point) as an integer. The clamped range
+     * is well within the range of the magic trick, and the result needs no further saturation. NaN inputs select the
+     * minimum.
+     */
+    const float32x4_t vy0 = vminq_f32(clamp_min_f32(vaddq_f32(vmulq_f32(vx0, vscale), vbias), vmin), vmax);
+    const float32x4_t vy1 = vminq_f32(clamp_min_f32(vaddq_f32(vmulq_f32(vx1, vscale), vbias), vmin), vmax);
+    const float32x4_t vy2 = vminq_f32(clamp_min_f32(vaddq_f32(vmulq_f32(vx2, vscale), vbias), vmin), vmax);
+    const float32x4_t vy3 = vminq_f32(clamp_min_f32(vaddq_f32(vmulq_f32(vx3, vscale), vbias), vmin), vmax);
+
+    const int32x4_t vq0 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vy0, vfmagic)), vimagic);
+    const int32x4_t vq1 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vy1, vfmagic)), vimagic);
+    const int32x4_t vq2 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vy2, vfmagic)), vimagic);
+    const int32x4_t vq3 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vy3, vfmagic)), vimagic);
+
+    const int16x8_t vq01 = vcombine_s16(vmovn_s32(vq0), vmovn_s32(vq1));
+    const int16x8_t vq23 = vcombine_s16(vmovn_s32(vq2), vmovn_s32(vq3));
+    vst1q_u8(y, vreinterpretq_u8_s8(vcombine_s8(vmovn_s16(vq01), vmovn_s16(vq23)))); y += 16;
+  }
+  for (; n >= 4; n -= 4) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    const float32x4_t vy = vminq_f32(clamp_min_f32(vaddq_f32(vmulq_f32(vx, vscale), vbias), vmin), vmax);
+    const int32x4_t vq = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vy, vfmagic)), vimagic);
+    const uint8x8_t vq8 = vreinterpret_u8_s8(vmovn_s16(vcombine_s16(vmovn_s32(vq), vmovn_s32(vq))));
+    vst1_lane_u32(__builtin_assume_aligned(y, 1), vreinterpret_u32_u8(vq8), 0); y += 4;
+  }
+  for (; n != 0; n -= 1) {
+    const float32x4_t vx = vld1q_dup_f32(x); x += 1;
+
+    const float32x4_t vy = vminq_f32(clamp_min_f32(vaddq_f32(vmulq_f32(vx, vscale), vbias), vmin), vmax);
+    const int32x4_t vq = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vy, vfmagic)), vimagic);
+    *y++ = (uint8_t) vgetq_lane_s32(vq, 0);
+  }
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/q8quant.h>
+
+
+void q8quant_ukernel__sse2(
+    size_t n,
+    const float* x,
+    uint8_t* y,
+    const union qnnp_q8_quantization_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  const __m128 vscale = _mm_load_ps(params->sse2.scale);
+  const __m128 vbias = _mm_load_ps(params->sse2.bias);
+  const __m128 vmin = _mm_load_ps(params->sse2.output_min_less_zero_point);
+  const __m128 vmax = _mm_load_ps(params->sse2.output_max_less_zero_point);
+  const __m128i vzero_point = _mm_load_si128((const __m128i*) params->sse2.output_zero_point);
+  for (; n >= 16; n -= 16) {
+    const __m128 vx0 = _mm_loadu_ps(x);
+    const __m128 vx1 = _mm_loadu_ps(x + 4);
+    const __m128 vx2 = _mm_loadu_ps(x + 8);
+    const __m128 vx3 = _mm_loadu_ps(x + 12);
+    x += 16;
+
+    /*
+     * Clamp transformed inputs to [output_min - zero point, output_max - zero point] before conversion: out-of-range
+     * and NaN inputs would otherwise convert to INT32_MIN. The MAXPS operand order makes NaN inputs select the minimum.
+     */
+    const __m128 vy0 = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(vx0, vscale), vbias), vmin), vmax);
+    const __m128 vy1 = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(vx1, vscale), vbias), vmin), vmax);
+    const __m128 vy2 = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(vx2, vscale), vbias), vmin), vmax);
+    const __m128 vy3 = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(vx3, vscale), vbias), vmin), vmax);
+
+    /* CVTPS2DQ rounds to nearest with ties to even, like the FP32 requantization */
+    const __m128i vy01 = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vy0), _mm_cvtps_epi32(vy1)), vzero_point);
+    const __m128i vy23 = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vy2), _mm_cvtps_epi32(vy3)), vzero_point);
+    _mm_storeu_si128((__m128i*) y, _mm_packus_epi16(vy01, vy23));
+    y += 16;
+  }
+  for (; n >= 4; n -= 4) {
+    const __m128 vx = _mm_loadu_ps(x);
+    x += 4;
+
+    const __m128 vy = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(vx, vscale), vbias), vmin), vmax);
+    const __m128i vy16 = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vy), _mm_cvtps_epi32(vy)), vzero_point);
+    *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(_mm_packus_epi16(vy16, vy16));
+    y += 4;
+  }
+  for (; n != 0; n -= 1) {
+    const __m128 vx = _mm_load_ss(x);
+    x += 1;
+
+    const __m128 vy = _mm_min_ss(_mm_max_ss(_mm_add_ss(_mm_mul_ss(vx, vscale), vbias), vmin), vmax);
+    const __m128i vy16 = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vy), _mm_cvtps_epi32(vy)), vzero_point);
+    *y++ = (uint8_t) _mm_cvtsi128_si32(_mm_packus_epi16(vy16, vy16));
+  }
+}
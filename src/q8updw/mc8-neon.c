@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <arm_neon.h>
+
+#include <qnnpack/q8dw.h>
+
+
+void q8updw_ukernel_mc8__neon(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const uint8_t** input,
+    const void* weights,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const uint8x8_t vkernel_zero_point = vld1_dup_u8((const uint8_t*) &quantization_params->neon.kernel_zero_point);
+  const int32x4_t vmultiplier = vld1q_dup_s32(&quantization_params->neon.multiplier);
+  const int32x4_t vright_shift = vld1q_dup_s32(&quantization_params->neon.right_shift);
+  const int16x8_t voutput_zero_point = vld1q_dup_s16(&quantization_params->neon.output_zero_point);
+  const uint8x8_t voutput_min = vld1_dup_u8(&quantization_params->neon.output_min);
+  const uint8x8_t voutput_max = vld1_dup_u8(&quantization_params->neon.output_max);
+
+  do {
+    size_t c = channels;
+    size_t c_offset = 0;
+    const void* w = weights;
+    for (; c >= 8; c -= 8) {
+      int32x4_t vacc_lo = vld1q_s32(w); w = (void*) ((uintptr_t) w + sizeof(int32x4_t));
+      int32x4_t vacc_hi = vld1q_s32(w); w = (void*) ((uintptr_t) w + sizeof(int32x4_t));
+
+      for (size_t k = 0; k < kernel_size; k++) {
+        const uint8x8_t vk = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+        const uint8x8_t vi = vld1_u8(input[k] + c_offset);
+        const int16x8_t vxk = vreinterpretq_s16_u16(vsubl_u8(vk, vkernel_zero_point));
+        const int16x8_t vxi = vreinterpretq_s16_u16(vmovl_u8(vi));
+        vacc_lo = vmlal_s16(vacc_lo, vget_low_s16(vxk), vget_low_s16(vxi));
+        vacc_hi = vmlal_s16(vacc_hi, vget_high_s16(vxk), vget_high_s16(vxi));
+      }
+
+      vacc_lo = vqrdmulhq_s32(vacc_lo, vmultiplier);
+      vacc_hi = vqrdmulhq_s32(vacc_hi, vmultiplier);
+
+      const int32x4_t vzero_shift_mask = vreinterpretq_s32_u32(vceqq_s32(vright_shift, vmovq_n_s32(0)));
+      vacc_lo = vsraq_n_s32(vacc_lo, vbicq_s32(vacc_lo, vzero_shift_mask), 31);
+      vacc_hi = vsraq_n_s32(vacc_hi, vbicq_s32(vacc_hi, vzero_shift_mask), 31);
+
+      vacc_lo = vrshlq_s32(vacc_lo, vright_shift);
+      vacc_hi = vrshlq_s32(vacc_hi, vright_shift);
+
+#ifdef __aarch64__
+      const int16x8_t vacc = vqaddq_s16(vqmovn_high_s32(vqmovn_s32(vacc_lo), vacc_hi), voutput_zero_point);
+#else
+      const int16x8_t vacc = vqaddq_s16(vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi)), voutput_zero_point);
+#endif
+      uint8x8_t vout = vqmovun_s16(vacc);
+      vout = vmax_u8(vout, voutput_min);
+      vout = vmin_u8(vout, voutput_max);
+
+      vst1_u8(output, vout); output += 8;
+      c_offset += 8;
+    }
+    if (c != 0) {
+      const size_t c_predecrement = 8 - c;
+      const int64x1_t vi_shift = vmov_n_s64(-8 * c_predecrement);
+      c_offset -= c_predecrement;
+
+      int32x4_t vacc_lo = vld1q_s32(w); w = (void*) ((uintptr_t) w + sizeof(int32x4_t));
+      int32x4_t vacc_hi = vld1q_s32(w); w = (void*) ((uintptr_t) w + sizeof(int32x4_t));
+
+      for (size_t k = 0; k < kernel_size; k++) {
+        const uint8x8_t vk = vld1_u8(w); w = (void*) ((uintptr_t) w + sizeof(uint8x8_t));
+        const uint8x8_t vi = vreinterpret_u8_u64(vshl_u64(vreinterpret_u64_u8(vld1_u8(input[k] + c_offset)), vi_shift));
+        const int16x8_t vxk = vreinterpretq_s16_u16(vsubl_u8(vk, vkernel_zero_point));
+        const int16x8_t vxi = vreinterpretq_s16_u16(vmovl_u8(vi));
+        vacc_lo = vmlal_s16(vacc_lo, vget_low_s16(vxk), vget_low_s16(vxi));
+        vacc_hi = vmlal_s16(vacc_hi, vget_high_s16(vxk), vget_high_s16(vxi));
+      }
+
+      vacc_lo = vqrdmulhq_s32(vacc_lo, vmultiplier);
+      vacc_hi = vqrdmulhq_s32(vacc_hi, vmultiplier);
+
+      const int32x4_t vzero_shift_mask = vreinterpretq_s32_u32(vceqq_s32(vright_shift, vmovq_n_s32(0)));
+      vacc_lo = vsraq_n_s32(vacc_lo, vbicq_s32(vacc_lo, vzero_shift_mask), 31);
+      vacc_hi = vsraq_n_s32(vacc_hi, vbicq_s32(vacc_hi, vzero_shift_mask), 31);
+
+      vacc_lo = vrshlq_s32(vacc_lo, vright_shift);
+      vacc_hi = vrshlq_s32(vacc_hi, vright_shift);
+
+#ifdef __aarch64__
+      const int16x8_t vacc = vqaddq_s16(vqmovn_high_s32(vqmovn_s32(vacc_lo), vacc_hi), voutput_zero_point);
+#else
+      const int16x8_t vacc = vqaddq_s16(vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi)), voutput_zero_point);
+#endif
+      uint8x8_t vout = vqmovun_s16(vacc);
+      vout = vmax_u8(vout, voutput_min);
+      vout = vmin_u8(vout, voutput_max);
+
+      if (c & 4) {
+        vst1_lane_u32(__builtin_assume_aligned(output, 1), vreinterpret_u32_u8(vout), 0); output += 4;
+        vout = vext_u8(vout, vout, 4);
+      }
+      if (c & 2) {
+        vst1_lane_u16(__builtin_assume_aligned(output, 1), vreinterpret_u16_u8(vout), 0); output += 2;
+        vout = vext_u8(vout, vout, 2);
+      }
+      if (c & 1) {
+        vst1_lane_u8(__builtin_assume_aligned(output, 1), vout, 0); output++;
+      }
+    }
+
+    input = (const uint8_t**) ((uintptr_t) input + input_stride);
+    output = (uint8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
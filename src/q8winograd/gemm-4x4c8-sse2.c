@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <immintrin.h>
+
+#include <qnnpack/q8winograd.h>
+
+
+void q8winograd_gemm_ukernel_4x4c8__sse2(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const int16_t* restrict a,
+    size_t a_stride,
+    const int16_t* restrict w,
+    int32_t* restrict c,
+    size_t c_stride)
+{
+  __m128i vacc0x0123 = _mm_setzero_si128();
+  __m128i vacc1x0123 = _mm_setzero_si128();
+  __m128i vacc2x0123 = _mm_setzero_si128();
+  __m128i vacc3x0123 = _mm_setzero_si128();
+
+  const int16_t* a0 = a;
+  const int16_t* a1 = (const int16_t*) ((uintptr_t) a0 + a_stride);
+  if (mr < 2) {
+    a1 = a0;
+  }
+  const int16_t* a2 = (const int16_t*) ((uintptr_t) a1 + a_stride);
+  if (mr <= 2) {
+    a2 = a1;
+  }
+  const int16_t* a3 = (const int16_t*) ((uintptr_t) a2 + a_stride);
+  if (mr != 4) {
+    a3 = a2;
+  }
+
+  /* k is a multiple of 8, and packed weights are zero-padded accordingly */
+  for (; k != 0; k -= 8) {
+    const __m128i va0 = _mm_loadu_si128((const __m128i*) a0);
+    a0 += 8;
+    const __m128i va1 = _mm_loadu_si128((const __m128i*) a1);
+    a1 += 8;
+    const __m128i va2 = _mm_loadu_si128((const __m128i*) a2);
+    a2 += 8;
+    const __m128i va3 = _mm_loadu_si128((const __m128i*) a3);
+    a3 += 8;
+
+    const __m128i vb0 = _mm_loadu_si128((const __m128i*) w);
+    vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(_mm_shuffle_epi32(va0, _MM_SHUFFLE(0, 0, 0, 0)), vb0));
+    vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(_mm_shuffle_epi32(va1, _MM_SHUFFLE(0, 0, 0, 0)), vb0));
+    vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(_mm_shuffle_epi32(va2, _MM_SHUFFLE(0, 0, 0, 0)), vb0));
+    vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(_mm_shuffle_epi32(va3, _MM_SHUFFLE(0, 0, 0, 0)), vb0));
+
+    const __m128i vb1 = _mm_loadu_si128((const __m128i*) (w + 8));
+    vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(_mm_shuffle_epi32(va0, _MM_SHUFFLE(1, 1, 1, 1)), vb1));
+    vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(_mm_shuffle_epi32(va1, _MM_SHUFFLE(1, 1, 1, 1)), vb1));
+    vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(_mm_shuffle_epi32(va2, _MM_SHUFFLE(1, 1, 1, 1)), vb1));
+    vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(_mm_shuffle_epi32(va3, _MM_SHUFFLE(1, 1, 1, 1)), vb1));
+
+    const __m128i vb2 = _mm_loadu_si128((const __m128i*) (w + 16));
+    vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(_mm_shuffle_epi32(va0, _MM_SHUFFLE(2, 2, 2, 2)), vb2));
+    vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(_mm_shuffle_epi32(va1, _MM_SHUFFLE(2, 2, 2, 2)), vb2));
+    vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(_mm_shuffle_epi32(va2, _MM_SHUFFLE(2, 2, 2, 2)), vb2));
+    vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(_mm_shuffle_epi32(va3, _MM_SHUFFLE(2, 2, 2, 2)), vb2));
+
+    const __m128i vb3 = _mm_loadu_si128((const __m128i*) (w + 24));
+    vacc0x0123 = _mm_add_epi32(vacc0x0123, _mm_madd_epi16(_mm_shuffle_epi32(va0, _MM_SHUFFLE(3, 3, 3, 3)), vb3));
+    vacc1x0123 = _mm_add_epi32(vacc1x0123, _mm_madd_epi16(_mm_shuffle_epi32(va1, _MM_SHUFFLE(3, 3, 3, 3)), vb3));
+    vacc2x0123 = _mm_add_epi32(vacc2x0123, _mm_madd_epi16(_mm_shuffle_epi32(va2, _MM_SHUFFLE(3, 3, 3, 3)), vb3));
+    vacc3x0123 = _mm_add_epi32(vacc3x0123, _mm_madd_epi16(_mm_shuffle_epi32(va3, _MM_SHUFFLE(3, 3, 3, 3)), vb3));
+    w += 32;
+  }
+
+  int32_t* c0 = c;
+  int32_t* c1 = (int32_t*) ((uintptr_t) c0 + c_stride);
+  if (mr < 2) {
+    c1 = c0;
+  }
+  int32_t* c2 = (int32_t*) ((uintptr_t) c1 + c_stride);
+  if (mr <= 2) {
+    c2 = c1;
+  }
+  int32_t* c3 = (int32_t*) ((uintptr_t) c2 + c_stride);
+  if (mr != 4) {
+    c3 = c2;
+  }
+  if (nr == 4) {
+    _mm_storeu_si128((__m128i*) c0, vacc0x0123);
+    _mm_storeu_si128((__m128i*) c1, vacc1x0123);
+    _mm_storeu_si128((__m128i*) c2, vacc2x0123);
+    _mm_storeu_si128((__m128i*) c3, vacc3x0123);
+  } else {
+    if (nr >= 2) {
+      _mm_storel_epi64((__m128i*) c0, vacc0x0123);
+      c0 += 2;
+      _mm_storel_epi64((__m128i*) c1, vacc1x0123);
+      c1 += 2;
+      _mm_storel_epi64((__m128i*) c2, vacc2x0123);
+      c2 += 2;
+      _mm_storel_epi64((__m128i*) c3, vacc3x0123);
+      c3 += 2;
+      vacc0x0123 = _mm_unpackhi_epi64(vacc0x0123, vacc0x0123);
+      vacc1x0123 = _mm_unpackhi_epi64(vacc1x0123, vacc1x0123);
+      vacc2x0123 = _mm_unpackhi_epi64(vacc2x0123, vacc2x0123);
+      vacc3x0123 = _mm_unpackhi_epi64(vacc3x0123, vacc3x0123);
+      nr -= 2;
+    }
+    if (nr != 0) {
+      *c0 = _mm_cvtsi128_si32(vacc0x0123);
+      *c1 = _mm_cvtsi128_si32(vacc1x0123);
+      *c2 = _mm_cvtsi128_si32(vacc2x0123);
+      *c3 = _mm_cvtsi128_si32(vacc3x0123);
+    }
+  }
+}
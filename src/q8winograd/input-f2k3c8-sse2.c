@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <immintrin.h>
+
+#include <qnnpack/q8winograd.h>
+
+
+/*
+ * Computes V = B^T (d - input_zero_point) B for a 4x4 input tile d, where
+ *   B^T = [ 1  0 -1  0 ]
+ *         [ 0  1  1  0 ]
+ *         [ 0 -1  1  0 ]
+ *         [ 0  1  0 -1 ]
+ * Element (i, j) of V for all channels is stored at output + (i * 4 + j) * output_stride.
+ */
+void q8winograd_input_ukernel_f2k3c8__sse2(
+    size_t channels,
+    const uint8_t** input,
+    int16_t* output,
+    size_t output_stride,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const uint8_t* i00 = input[0];
+  const uint8_t* i01 = input[1];
+  const uint8_t* i02 = input[2];
+  const uint8_t* i03 = input[3];
+  const uint8_t* i10 = input[4];
+  const uint8_t* i11 = input[5];
+  const uint8_t* i12 = input[6];
+  const uint8_t* i13 = input[7];
+  const uint8_t* i20 = input[8];
+  const uint8_t* i21 = input[9];
+  const uint8_t* i22 = input[10];
+  const uint8_t* i23 = input[11];
+  const uint8_t* i30 = input[12];
+  const uint8_t* i31 = input[13];
+  const uint8_t* i32 = input[14];
+  const uint8_t* i33 = input[15];
+
+  const __m128i vinput_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.input_zero_point);
+  const __m128i vzero = _mm_setzero_si128();
+  for (; channels >= 8; channels -= 8) {
+    const __m128i vd00 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i00), vzero), vinput_zero_point); i00 += 8;
+    const __m128i vd01 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i01), vzero), vinput_zero_point); i01 += 8;
+    const __m128i vd02 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i02), vzero), vinput_zero_point); i02 += 8;
+    const __m128i vd03 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i03), vzero), vinput_zero_point); i03 += 8;
+    const __m128i vd10 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i10), vzero), vinput_zero_point); i10 += 8;
+    const __m128i vd11 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i11), vzero), vinput_zero_point); i11 += 8;
+    const __m128i vd12 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i12), vzero), vinput_zero_point); i12 += 8;
+    const __m128i vd13 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i13), vzero), vinput_zero_point); i13 += 8;
+    const __m128i vd20 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i20), vzero), vinput_zero_point); i20 += 8;
+    const __m128i vd21 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i21), vzero), vinput_zero_point); i21 += 8;
+    const __m128i vd22 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i22), vzero), vinput_zero_point); i22 += 8;
+    const __m128i vd23 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i23), vzero), vinput_zero_point); i23 += 8;
+    const __m128i vd30 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i30), vzero), vinput_zero_point); i30 += 8;
+    const __m128i vd31 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i31), vzero), vinput_zero_point); i31 += 8;
+    const __m128i vd32 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i32), vzero), vinput_zero_point); i32 += 8;
+    const __m128i vd33 = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) i33), vzero), vinput_zero_point); i33 += 8;
+
+    /* Rows: t = B^T d */
+    const __m128i vt00 = _mm_sub_epi16(vd00, vd20);
+    const __m128i vt01 = _mm_sub_epi16(vd01, vd21);
+    const __m128i vt02 = _mm_sub_epi16(vd02, vd22);
+    const __m128i vt03 = _mm_sub_epi16(vd03, vd23);
+    const __m128i vt10 = _mm_add_epi16(vd10, vd20);
+    const __m128i vt11 = _mm_add_epi16(vd11, vd21);
+    const __m128i vt12 = _mm_add_epi16(vd12, vd22);
+    const __m128i vt13 = _mm_add_epi16(vd13, vd23);
+    const __m128i vt20 = _mm_sub_epi16(vd20, vd10);
+    const __m128i vt21 = _mm_sub_epi16(vd21, vd11);
+    const __m128i vt22 = _mm_sub_epi16(vd22, vd12);
+    const __m128i vt23 = _mm_sub_epi16(vd23, vd13);
+    const __m128i vt30 = _mm_sub_epi16(vd10, vd30);
+    const __m128i vt31 = _mm_sub_epi16(vd11, vd31);
+    const __m128i vt32 = _mm_sub_epi16(vd12, vd32);
+    const __m128i vt33 = _mm_sub_epi16(vd13, vd33);
+
+    /* Columns: v = t B */
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 0 * output_stride), _mm_sub_epi16(vt00, vt02));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 1 * output_stride), _mm_add_epi16(vt01, vt02));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 2 * output_stride), _mm_sub_epi16(vt02, vt01));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 3 * output_stride), _mm_sub_epi16(vt01, vt03));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 4 * output_stride), _mm_sub_epi16(vt10, vt12));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 5 * output_stride), _mm_add_epi16(vt11, vt12));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 6 * output_stride), _mm_sub_epi16(vt12, vt11));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 7 * output_stride), _mm_sub_epi16(vt11, vt13));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 8 * output_stride), _mm_sub_epi16(vt20, vt22));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 9 * output_stride), _mm_add_epi16(vt21, vt22));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 10 * output_stride), _mm_sub_epi16(vt22, vt21));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 11 * output_stride), _mm_sub_epi16(vt21, vt23));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 12 * output_stride), _mm_sub_epi16(vt30, vt32));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 13 * output_stride), _mm_add_epi16(vt31, vt32));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 14 * output_stride), _mm_sub_epi16(vt32, vt31));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) output + 15 * output_stride), _mm_sub_epi16(vt31, vt33));
+    output += 8;
+  }
+  if (channels != 0) {
+    const int16_t input_zero_point = quantization_params->sse2.input_zero_point[0];
+    do {
+      const int16_t d00 = (int16_t) *i00++ - input_zero_point;
+      const int16_t d01 = (int16_t) *i01++ - input_zero_point;
+      const int16_t d02 = (int16_t) *i02++ - input_zero_point;
+      const int16_t d03 = (int16_t) *i03++ - input_zero_point;
+      const int16_t d10 = (int16_t) *i10++ - input_zero_point;
+      const int16_t d11 = (int16_t) *i11++ - input_zero_point;
+      const int16_t d12 = (int16_t) *i12++ - input_zero_point;
+      const int16_t d13 = (int16_t) *i13++ - input_zero_point;
+      const int16_t d20 = (int16_t) *i20++ - input_zero_point;
+      const int16_t d21 = (int16_t) *i21++ - input_zero_point;
+      const int16_t d22 = (int16_t) *i22++ - input_zero_point;
+      const int16_t d23 = (int16_t) *i23++ - input_zero_point;
+      const int16_t d30 = (int16_t) *i30++ - input_zero_point;
+      const int16_t d31 = (int16_t) *i31++ - input_zero_point;
+      const int16_t d32 = (int16_t) *i32++ - input_zero_point;
+      const int16_t d33 = (int16_t) *i33++ - input_zero_point;
+
+      const int16_t t00 = d00 - d20;
+      const int16_t t01 = d01 - d21;
+      const int16_t t02 = d02 - d22;
+      const int16_t t03 = d03 - d23;
+      const int16_t t10 = d10 + d20;
+      const int16_t t11 = d11 + d21;
+      const int16_t t12 = d12 + d22;
+      const int16_t t13 = d13 + d23;
+      const int16_t t20 = d20 - d10;
+      const int16_t t21 = d21 - d11;
+      const int16_t t22 = d22 - d12;
+      const int16_t t23 = d23 - d13;
+      const int16_t t30 = d10 - d30;
+      const int16_t t31 = d11 - d31;
+      const int16_t t32 = d12 - d32;
+      const int16_t t33 = d13 - d33;
+
+      *((int16_t*) ((uintptr_t) output + 0 * output_stride)) = t00 - t02;
+      *((int16_t*) ((uintptr_t) output + 1 * output_stride)) = t01 + t02;
+      *((int16_t*) ((uintptr_t) output + 2 * output_stride)) = t02 - t01;
+      *((int16_t*) ((uintptr_t) output + 3 * output_stride)) = t01 - t03;
+      *((int16_t*) ((uintptr_t) output + 4 * output_stride)) = t10 - t12;
+      *((int16_t*) ((uintptr_t) output + 5 * output_stride)) = t11 + t12;
+      *((int16_t*) ((uintptr_t) output + 6 * output_stride)) = t12 - t11;
+      *((int16_t*) ((uintptr_t) output + 7 * output_stride)) = t11 - t13;
+      *((int16_t*) ((uintptr_t) output + 8 * output_stride)) = t20 - t22;
+      *((int16_t*) ((uintptr_t) output + 9 * output_stride)) = t21 + t22;
+      *((int16_t*) ((uintptr_t) output + 10 * output_stride)) = t22 - t21;
+      *((int16_t*) ((uintptr_t) output + 11 * output_stride)) = t21 - t23;
+      *((int16_t*) ((uintptr_t) output + 12 * output_stride)) = t30 - t32;
+      *((int16_t*) ((uintptr_t) output + 13 * output_stride)) = t31 + t32;
+      *((int16_t*) ((uintptr_t) output + 14 * output_stride)) = t32 - t31;
+      *((int16_t*) ((uintptr_t) output + 15 * output_stride)) = t31 - t33;
+      output += 1;
+    } while (--channels != 0);
+  }
+}
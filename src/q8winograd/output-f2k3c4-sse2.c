@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <immintrin.h>
+
+#include <qnnpack/q8winograd.h>
+
+
+static inline __m128i requantize_f2k3x4(
+    const int32_t* m,
+    size_t m_stride,
+    const int32_t* bias,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m128i vm00 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 0 * m_stride));
+  const __m128i vm01 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 1 * m_stride));
+  const __m128i vm02 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 2 * m_stride));
+  const __m128i vm03 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 3 * m_stride));
+  const __m128i vm10 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 4 * m_stride));
+  const __m128i vm11 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 5 * m_stride));
+  const __m128i vm12 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 6 * m_stride));
+  const __m128i vm13 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 7 * m_stride));
+  const __m128i vm20 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 8 * m_stride));
+  const __m128i vm21 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 9 * m_stride));
+  const __m128i vm22 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 10 * m_stride));
+  const __m128i vm23 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 11 * m_stride));
+  const __m128i vm30 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 12 * m_stride));
+  const __m128i vm31 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 13 * m_stride));
+  const __m128i vm32 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 14 * m_stride));
+  const __m128i vm33 = _mm_loadu_si128((const __m128i*) ((uintptr_t) m + 15 * m_stride));
+
+  /* Rows: s = A^T m */
+  const __m128i vs00 = _mm_add_epi32(_mm_add_epi32(vm00, vm10), vm20);
+  const __m128i vs01 = _mm_add_epi32(_mm_add_epi32(vm01, vm11), vm21);
+  const __m128i vs02 = _mm_add_epi32(_mm_add_epi32(vm02, vm12), vm22);
+  const __m128i vs03 = _mm_add_epi32(_mm_add_epi32(vm03, vm13), vm23);
+  const __m128i vs10 = _mm_sub_epi32(_mm_sub_epi32(vm10, vm20), vm30);
+  const __m128i vs11 = _mm_sub_epi32(_mm_sub_epi32(vm11, vm21), vm31);
+  const __m128i vs12 = _mm_sub_epi32(_mm_sub_epi32(vm12, vm22), vm32);
+  const __m128i vs13 = _mm_sub_epi32(_mm_sub_epi32(vm13, vm23), vm33);
+
+  /*
+   * Columns: y = s A. Weights were transformed with 2G instead of G, so y is exactly 4x the convolution output,
+   * and the arithmetic shift is exact as long as the 4x-scaled accumulator fits into 32 bits.
+   */
+  const __m128i vbias = _mm_loadu_si128((const __m128i*) bias);
+  const __m128i vacc00 = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(vs00, vs01), vs02), 2), vbias);
+  const __m128i vacc01 = _mm_add_epi32(_mm_srai_epi32(_mm_sub_epi32(_mm_sub_epi32(vs01, vs02), vs03), 2), vbias);
+  const __m128i vacc10 = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(vs10, vs11), vs12), 2), vbias);
+  const __m128i vacc11 = _mm_add_epi32(_mm_srai_epi32(_mm_sub_epi32(_mm_sub_epi32(vs11, vs12), vs13), 2), vbias);
+
+  const __m128i vmultiplier = _mm_load_si128((const __m128i*) quantization_params->sse2.multiplier);
+  const __m128i vrounding = _mm_load_si128((const __m128i*) quantization_params->sse2.rounding);
+
+  const __m128i vnmask00 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc00);
+  const __m128i vnmask01 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc01);
+  const __m128i vnmask10 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc10);
+  const __m128i vnmask11 = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc11);
+
+  const __m128i vabsacc00 = _mm_sub_epi32(_mm_xor_si128(vacc00, vnmask00), vnmask00);
+  const __m128i vabsacc01 = _mm_sub_epi32(_mm_xor_si128(vacc01, vnmask01), vnmask01);
+  const __m128i vabsacc10 = _mm_sub_epi32(_mm_xor_si128(vacc10, vnmask10), vnmask10);
+  const __m128i vabsacc11 = _mm_sub_epi32(_mm_xor_si128(vacc11, vnmask11), vnmask11);
+
+  const __m128i vabsprod00x02 = _mm_mul_epu32(vabsacc00, vmultiplier);
+  const __m128i vabsprod01x02 = _mm_mul_epu32(vabsacc01, vmultiplier);
+  const __m128i vabsprod10x02 = _mm_mul_epu32(vabsacc10, vmultiplier);
+  const __m128i vabsprod11x02 = _mm_mul_epu32(vabsacc11, vmultiplier);
+
+  const __m128i vprod00x02 = _mm_sub_epi64(_mm_xor_si128(vabsprod00x02,
+    _mm_shuffle_epi32(vnmask00, _MM_SHUFFLE(2, 2, 0, 0))), _mm_shuffle_epi32(vnmask00, _MM_SHUFFLE(2, 2, 0, 0)));
+  const __m128i vprod01x02 = _mm_sub_epi64(_mm_xor_si128(vabsprod01x02,
+    _mm_shuffle_epi32(vnmask01, _MM_SHUFFLE(2, 2, 0, 0))), _mm_shuffle_epi32(vnmask01, _MM_SHUFFLE(2, 2, 0, 0)));
+  const __m128i vprod10x02 = _mm_sub_epi64(_mm_xor_si128(vabsprod10x02,
+    _mm_shuffle_epi32(vnmask10, _MM_SHUFFLE(2, 2, 0, 0))), _mm_shuffle_epi32(vnmask10, _MM_SHUFFLE(2, 2, 0, 0)));
+  const __m128i vprod11x02 = _mm_sub_epi64(_mm_xor_si128(vabsprod11x02,
+    _mm_shuffle_epi32(vnmask11, _MM_SHUFFLE(2, 2, 0, 0))), _mm_shuffle_epi32(vnmask11, _MM_SHUFFLE(2, 2, 0, 0)));
+
+  const __m128i vq31prod00x02 = _mm_srli_epi64(_mm_add_epi64(vprod00x02, vrounding), 31);
+  const __m128i vq31prod01x02 = _mm_srli_epi64(_mm_add_epi64(vprod01x02, vrounding), 31);
+  const __m128i vq31prod10x02 = _mm_srli_epi64(_mm_add_epi64(vprod10x02, vrounding), 31);
+  const __m128i vq31prod11x02 = _mm_srli_epi64(_mm_add_epi64(vprod11x02, vrounding), 31);
+
+  const __m128i vabsprod00x13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc00, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+  const __m128i vabsprod01x13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc01, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+  const __m128i vabsprod10x13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc10, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+  const __m128i vabsprod11x13 = _mm_mul_epu32(_mm_shuffle_epi32(vabsacc11, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+
+  const __m128i vprod00x13 = _mm_sub_epi64(_mm_xor_si128(vabsprod00x13,
+    _mm_shuffle_epi32(vnmask00, _MM_SHUFFLE(3, 3, 1, 1))), _mm_shuffle_epi32(vnmask00, _MM_SHUFFLE(3, 3, 1, 1)));
+  const __m128i vprod01x13 = _mm_sub_epi64(_mm_xor_si128(vabsprod01x13,
+    _mm_shuffle_epi32(vnmask01, _MM_SHUFFLE(3, 3, 1, 1))), _mm_shuffle_epi32(vnmask01, _MM_SHUFFLE(3, 3, 1, 1)));
+  const __m128i vprod10x13 = _mm_sub_epi64(_mm_xor_si128(vabsprod10x13,
+    _mm_shuffle_epi32(vnmask10, _MM_SHUFFLE(3, 3, 1, 1))), _mm_shuffle_epi32(vnmask10, _MM_SHUFFLE(3, 3, 1, 1)));
+  const __m128i vprod11x13 = _mm_sub_epi64(_mm_xor_si128(vabsprod11x13,
+    _mm_shuffle_epi32(vnmask11, _MM_SHUFFLE(3, 3, 1, 1))), _mm_shuffle_epi32(vnmask11, _MM_SHUFFLE(3, 3, 1, 1)));
+
+  const __m128i vq31prod00x13 = _mm_srli_epi64(_mm_add_epi64(vprod00x13, vrounding), 31);
+  const __m128i vq31prod01x13 = _mm_srli_epi64(_mm_add_epi64(vprod01x13, vrounding), 31);
+  const __m128i vq31prod10x13 = _mm_srli_epi64(_mm_add_epi64(vprod10x13, vrounding), 31);
+  const __m128i vq31prod11x13 = _mm_srli_epi64(_mm_add_epi64(vprod11x13, vrounding), 31);
+
+  const __m128i vq31prod00 = _mm_shuffle_epi32(_mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod00x02), _mm_castsi128_ps(vq31prod00x13), _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+  const __m128i vq31prod01 = _mm_shuffle_epi32(_mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod01x02), _mm_castsi128_ps(vq31prod01x13), _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+  const __m128i vq31prod10 = _mm_shuffle_epi32(_mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod10x02), _mm_castsi128_ps(vq31prod10x13), _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+  const __m128i vq31prod11 = _mm_shuffle_epi32(_mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod11x02), _mm_castsi128_ps(vq31prod11x13), _MM_SHUFFLE(2, 0, 2, 0))), _MM_SHUFFLE(3, 1, 2, 0));
+
+  const __m128i vremainder_mask = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_mask);
+  const __m128i vrem00 =
+    _mm_add_epi32(_mm_and_si128(vq31prod00, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod00));
+  const __m128i vrem01 =
+    _mm_add_epi32(_mm_and_si128(vq31prod01, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod01));
+  const __m128i vrem10 =
+    _mm_add_epi32(_mm_and_si128(vq31prod10, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod10));
+  const __m128i vrem11 =
+    _mm_add_epi32(_mm_and_si128(vq31prod11, vremainder_mask), _mm_cmpgt_epi32(_mm_setzero_si128(), vq31prod11));
+
+  const __m128i vremainder_threshold = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_threshold);
+  const __m128i vshift = _mm_load_si128((const __m128i*) quantization_params->sse2.shift);
+  const __m128i vout00 =
+    _mm_sub_epi32(_mm_sra_epi32(vq31prod00, vshift), _mm_cmpgt_epi32(vrem00, vremainder_threshold));
+  const __m128i vout01 =
+    _mm_sub_epi32(_mm_sra_epi32(vq31prod01, vshift), _mm_cmpgt_epi32(vrem01, vremainder_threshold));
+  const __m128i vout10 =
+    _mm_sub_epi32(_mm_sra_epi32(vq31prod10, vshift), _mm_cmpgt_epi32(vrem10, vremainder_threshold));
+  const __m128i vout11 =
+    _mm_sub_epi32(_mm_sra_epi32(vq31prod11, vshift), _mm_cmpgt_epi32(vrem11, vremainder_threshold));
+
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point);
+  const __m128i vout0 = _mm_adds_epi16(_mm_packs_epi32(vout00, vout01), voutput_zero_point);
+  const __m128i vout1 = _mm_adds_epi16(_mm_packs_epi32(vout10, vout11), voutput_zero_point);
+  __m128i vout = _mm_packus_epi16(vout0, vout1);
+  vout = _mm_min_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_max));
+  vout = _mm_max_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_min));
+  return vout;
+}
+
+/*
+ * Computes the 2x2 output tile A^T m A for 16 transformed accumulators m, where
+ *   A^T = [ 1  1  1  0 ]
+ *         [ 0  1 -1 -1 ]
+ * and requantizes it. Output pointers of pixels outside of the output image must alias output[0], which is stored
+ * last.
+ */
+void q8winograd_output_ukernel_f2k3c4__sse2(
+    size_t channels,
+    const int32_t* input,
+    size_t input_stride,
+    const int32_t* bias,
+    uint8_t** output,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  uint8_t* o00 = output[0];
+  uint8_t* o01 = output[1];
+  uint8_t* o10 = output[2];
+  uint8_t* o11 = output[3];
+  for (; channels >= 4; channels -= 4) {
+    const __m128i vout = requantize_f2k3x4(input, input_stride, bias, quantization_params);
+    input += 4;
+    bias += 4;
+
+    *((uint32_t*) o11) = (uint32_t) _mm_cvtsi128_si32(_mm_srli_si128(vout, 12));
+    o11 += 4;
+    *((uint32_t*) o10) = (uint32_t) _mm_cvtsi128_si32(_mm_srli_si128(vout, 8));
+    o10 += 4;
+    *((uint32_t*) o01) = (uint32_t) _mm_cvtsi128_si32(_mm_srli_si128(vout, 4));
+    o01 += 4;
+    *((uint32_t*) o00) = (uint32_t) _mm_cvtsi128_si32(vout);
+    o00 += 4;
+  }
+  if (channels != 0) {
+    int32_t m[16 * 4] = { 0 };
+    int32_t b[4] = { 0 };
+    for (size_t i = 0; i < 16; i++) {
+      for (size_t c = 0; c < channels; c++) {
+        m[i * 4 + c] = *((const int32_t*) ((uintptr_t) input + i * input_stride) + c);
+      }
+    }
+    for (size_t c = 0; c < channels; c++) {
+      b[c] = bias[c];
+    }
+    __m128i vout = requantize_f2k3x4(m, 4 * sizeof(int32_t), b, quantization_params);
+
+    if (channels & 2) {
+      *((uint16_t*) o11) = (uint16_t) _mm_extract_epi16(vout, 6);
+      o11 += 2;
+      *((uint16_t*) o10) = (uint16_t) _mm_extract_epi16(vout, 4);
+      o10 += 2;
+      *((uint16_t*) o01) = (uint16_t) _mm_extract_epi16(vout, 2);
+      o01 += 2;
+      *((uint16_t*) o00) = (uint16_t) _mm_extract_epi16(vout, 0);
+      o00 += 2;
+      vout = _mm_srli_epi32(vout, 16);
+    }
+    if (channels & 1) {
+      *((uint8_t*) o11) = (uint8_t) _mm_extract_epi16(vout, 6);
+      *((uint8_t*) o10) = (uint8_t) _mm_extract_epi16(vout, 4);
+      *((uint8_t*) o01) = (uint8_t) _mm_extract_epi16(vout, 2);
+      *((uint8_t*) o00) = (uint8_t) _mm_cvtsi128_si32(vout);
+    }
+  }
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack.h>
+#include <qnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef float (*qnnp_lut_function)(float x, const void* params);
+
+/*
+ * Tabulates a float function of the dequantized input for every quantized input value, quantized to the output
+ * parameters and clamped to [output_min, output_max]. The table configures lookup table operators of elementwise
+ * functions; name identifies the operator in error messages about invalid quantization parameters.
+ */
+QNNP_INTERNAL enum qnnp_status qnnp_compute_lut_q8(
+    const char* name,
+    qnnp_lut_function function,
+    const void* function_params,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint8_t table[256]);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include <qnnpack.h>
+#include <qnnpack/params.h>
 #include <qnnpack/requantization.h>
 
 
@@ -23,56 +26,195 @@ enum qnnp_format {
 enum qnnp_ukernel_type {
   qnnp_ukernel_type_none = 0,
   qnnp_ukernel_type_add,
+  qnnp_ukernel_type_add_lut,
+  qnnp_ukernel_type_argmax,
   qnnp_ukernel_type_average_pooling,
+  qnnp_ukernel_type_batch_matmul,
   qnnp_ukernel_type_channel_shuffle,
   qnnp_ukernel_type_clamp,
+  qnnp_ukernel_type_concat,
   qnnp_ukernel_type_conv,
+  qnnp_ukernel_type_depth_to_space,
+  qnnp_ukernel_type_dequantize,
+  qnnp_ukernel_type_direct_conv,
   qnnp_ukernel_type_dwconv,
+  qnnp_ukernel_type_embedding_lookup,
   qnnp_ukernel_type_gemm,
   qnnp_ukernel_type_global_average_pooling,
+  qnnp_ukernel_type_gru_cell,
+  qnnp_ukernel_type_lstm_cell,
   qnnp_ukernel_type_lut,
   qnnp_ukernel_type_max_pooling,
+  qnnp_ukernel_type_normalize,
+  qnnp_ukernel_type_pad,
+  qnnp_ukernel_type_quantize,
+  qnnp_ukernel_type_reduce,
+  qnnp_ukernel_type_resize_bilinear,
+  qnnp_ukernel_type_resize_nearest,
+  qnnp_ukernel_type_row_conv,
   qnnp_ukernel_type_softargmax,
+  qnnp_ukernel_type_space_to_depth,
+  qnnp_ukernel_type_top_k,
+  qnnp_ukernel_type_transpose,
+  qnnp_ukernel_type_winograd,
   qnnp_ukernel_type_xzp_gemm,
 };
 
+/* Grouped GEMM and convolution compute consecutive groups with this many bytes of packed weights in the same task */
+#define QNNP_GROUP_TILE_WEIGHTS_SIZE 16384
+
+/* Arg-max and top-k operators split rows of more channels than this into blocks processed by separate tasks */
+#define QNNP_SELECTION_BLOCK_CHANNELS 16384
+
+/* Reduce operator splits channels of reductions over rows into blocks of this size processed by separate tasks */
+#define QNNP_REDUCE_BLOCK_CHANNELS 1024
+
+/* Reduce operator splits other reductions into blocks of about this many elements, and sums them up in the workspace */
+#define QNNP_REDUCE_BLOCK_ELEMENTS 16384
+
+/* Embedding lookup operator prefetches table rows this many indices ahead when gathering rows without pooling */
+#define QNNP_EMBEDDING_PREFETCH_DISTANCE 8
+
+/* Embedding lookup operator processes this many bags, or gathered rows, per task */
+#define QNNP_EMBEDDING_BLOCK_BAGS 16
+
+/* Recurrent cell operators pack gate weights of every nr hidden units as this many consecutive GEMM column blocks */
+#define QNNP_RNN_GATE_BLOCKS 4
+
+/* Fused add and lookup table operators process blocks of this many elements, with the sum in a stack buffer */
+#define QNNP_ADD_LUT_BLOCK_SIZE 1024
+
+/* Normalize operator quantizes a block of pixels of every channel into a stack buffer of this size before interleaving */
+#define QNNP_NORMALIZE_BLOCK_BYTES 4096
+
+struct qnnp_concat_input {
+  size_t channels;
+  size_t channel_offset;
+  const void* input;
+  size_t input_pixel_stride;
+  /* Input is already stored in its slice of the output, and needs neither copy nor requantization */
+  bool bound;
+  bool requantize;
+  union qnnp_add_quantization_params add_quantization_params;
+};
+
 struct qnnp_operator {
   size_t batch_size;
+  uint32_t input_padding_front;
   uint32_t input_padding_top;
   uint32_t input_padding_right;
+  uint32_t input_padding_back;
   uint32_t input_padding_bottom;
   uint32_t input_padding_left;
   uint32_t adjustment_height;
   uint32_t adjustment_width;
+  uint32_t kernel_depth;
   uint32_t kernel_height;
   uint32_t kernel_width;
+  uint32_t stride_depth;
   uint32_t stride_height;
   uint32_t stride_width;
+  uint32_t dilation_depth;
   uint32_t dilation_height;
   uint32_t dilation_width;
   uint32_t groups;
+  /* Grouped GEMM and convolution: number of consecutive groups computed together for every block of output pixels */
+  uint32_t group_tile;
   size_t group_stride;
   size_t group_channels;
   size_t group_input_channels;
   size_t group_output_channels;
   size_t channels;
 
+  /* Permuted input channels: each group reads input_channel_runs windows of group_input_channels channels at these offsets */
+  size_t input_channel_runs;
+  size_t* input_channel_offsets;
+  /*
+   * Permuted input channels that are not folded into the kernel: before every run, the input pixels at
+   * permuted_input_source are gathered in convolution channel order into permuted_input, which the operator reads.
+   * A non-zero input_shuffle_groups marks a channel shuffle, which the zip micro-kernels gather.
+   */
+  size_t* input_channel_permutation;
+  size_t input_shuffle_groups;
+  void* permuted_input;
+  const void* permuted_input_source;
+  size_t permuted_input_source_stride;
+
+  size_t input_depth;
   size_t input_height;
   size_t input_width;
   size_t input_pixel_stride;
   const void* input;
   const void** indirection_buffer;
   void* a_sum;
+  void* workspace;
+
+  /* Streaming convolution: per image, the retained history frames followed by the frames of the current run */
+  void* stream_buffer;
+  size_t stream_history_width;
+  const void* stream_input;
+  size_t stream_input_pixel_stride;
 
   size_t input2_pixel_stride;
   const void* input2;
 
+  size_t inputs;
+  struct qnnp_concat_input* concat_inputs;
+
+  /* Transpose: output dimensions left after dropping unit dimensions and merging, with input and output strides */
+  size_t transpose_dims;
+  size_t transpose_shape[QNNP_MAX_TRANSPOSE_DIMS];
+  size_t transpose_input_stride[QNNP_MAX_TRANSPOSE_DIMS];
+  size_t transpose_output_stride[QNNP_MAX_TRANSPOSE_DIMS];
+
+  /*
+   * Reduction: kept and reduced dimensions left after dropping unit dimensions and merging, with their input strides.
+   * The last reduced dimension has unit stride if the innermost input dimension is reduced.
+   */
+  enum qnnp_reduce_operation reduce_operation;
+  size_t reduce_output_dims;
+  size_t reduce_output_shape[QNNP_MAX_REDUCE_DIMS];
+  size_t reduce_output_stride[QNNP_MAX_REDUCE_DIMS];
+  size_t reduce_dims;
+  size_t reduce_shape[QNNP_MAX_REDUCE_DIMS];
+  size_t reduce_stride[QNNP_MAX_REDUCE_DIMS];
+
+  /* Embedding lookup: gathered table rows, and offsets of the first index of every bag, or NULL for single rows */
+  size_t embedding_rows;
+  size_t embedding_indices_count;
+  const uint32_t* embedding_indices;
+  const uint32_t* embedding_offsets;
+
+  /*
+   * Recurrent cells: cell state of LSTM cells, read and written alongside the hidden state in input and output.
+   * Lookup table holds 4 float tables indexed by quantized values: sigmoid and tanh of gate pre-activations, tanh of
+   * the cell state, and the dequantized cell (LSTM) or hidden (GRU) state.
+   */
+  const void* cell_state;
+  void* cell_state_output;
+  float cell_scale;
+  uint8_t cell_zero_point;
+
+  size_t output_depth;
   size_t output_height;
   size_t output_width;
   size_t output_pixel_stride;
+  /* Top-k: number of selected channels, and their indices written alongside the output values */
+  size_t top_k;
+  uint32_t* output_indices;
+  /* Distances between output rows and images of NHWC operators which may write into the interior of a larger buffer */
+  size_t output_row_stride;
+  size_t output_image_stride;
   void* output;
 
+  /* Direct convolution: output rows and columns whose kernel windows lie inside the input */
+  size_t interior_output_y_begin;
+  size_t interior_output_y_end;
+  size_t interior_output_x_begin;
+  size_t interior_output_x_end;
+
   void* packed_weights;
+  const struct q8conv_parameters* q8conv_params;
   float input_scale;
   float output_scale;
   uint8_t input_zero_point;
@@ -80,6 +222,8 @@ struct qnnp_operator {
   uint8_t output_zero_point;
   uint8_t output_min;
   uint8_t output_max;
+  enum qnnp_padding_mode padding_mode;
+  uint8_t padding_value;
 
   size_t valid_batch_size;
   size_t last_input_height;
@@ -96,9 +240,12 @@ struct qnnp_operator {
     union qnnp_add_quantization_params add_quantization_params;
     union qnnp_avgpool_quantization_params avgpool_quantization_params;
     union qnnp_u8_clamping_params u8_clamping_params;
+    union qnnp_q8_quantization_params q8_quantization_params;
+    union qnnp_q8_dequantization_params q8_dequantization_params;
   };
   enum qnnp_ukernel_type ukernel_type;
   enum qnnp_format format;
+  uint32_t flags;
 };
 
 static inline uint32_t qnnp_operator_get_log2_output_element_size(const struct qnnp_operator* convolution) {
@@ -116,3 +263,29 @@ static inline uint32_t qnnp_operator_get_log2_kernel_element_size(const struct q
 static inline uint32_t qnnp_operator_get_log2_bias_element_size(const struct qnnp_operator* convolution) {
   return (uint32_t) ((convolution->format >> 24) & UINT32_C(0xFF));
 }
+
+/* Reductions over the middle of three dimensions with the innermost one kept map onto global average pooling kernels */
+static inline bool qnnp_operator_reduces_rows(const struct qnnp_operator* reduce) {
+  return reduce->reduce_dims == 1 && reduce->reduce_output_dims != 0 &&
+    reduce->reduce_output_stride[reduce->reduce_output_dims - 1] == 1;
+}
+
+/*
+ * Gate block of a recurrent cell reduces over *k elements of the concatenated input and hidden state from *k_start:
+ * the input and recurrent halves of the GRU n gate take only the input or only the hidden state.
+ */
+static inline void qnnp_operator_get_rnn_cell_block_range(
+    const struct qnnp_operator* rnn_cell,
+    size_t block,
+    size_t* k_start,
+    size_t* k)
+{
+  const size_t input_size = rnn_cell->group_input_channels;
+  const size_t hidden_size = rnn_cell->group_output_channels;
+  *k_start = 0;
+  *k = input_size + hidden_size;
+  if (rnn_cell->ukernel_type == qnnp_ukernel_type_gru_cell && block >= 2) {
+    *k_start = block == 2 ? 0 : input_size;
+    *k = block == 2 ? input_size : hidden_size;
+  }
+}
@@ -48,6 +48,54 @@ static inline void pack_q8gemm_w(
   }
 }
 
+/*
+ * Packs a B operand computed at run time in the layout of pack_q8gemm_w with zero biases. Element (k, n) of B is
+ * b[k * b_k_stride + n * b_n_stride], so both K x N and N x K matrices are supported. Unlike pack_q8gemm_w, padding
+ * is written too, so the packed buffer can be reused between runs without clearing.
+ */
+static inline void pack_q8gemm_b(
+  size_t nc,
+  size_t kc,
+  uint32_t nr,
+  uint32_t kr,
+  uint8_t izp,
+  uint8_t kzp,
+  const uint8_t* b,
+  size_t b_k_stride,
+  size_t b_n_stride,
+  void* packed_w)
+{
+  const int32_t boff = (int32_t) kc * (int32_t) izp * (int32_t) kzp;
+  for (size_t nr_block_start = 0; nr_block_start < nc; nr_block_start += nr) {
+    const size_t nr_block_size = min(nc - nr_block_start, nr);
+    int32_t* packed_b = (int32_t*) packed_w;
+    for (size_t nr_block_offset = 0; nr_block_offset < nr; nr_block_offset++) {
+      packed_b[nr_block_offset] = nr_block_offset < nr_block_size ? boff : 0;
+    }
+    uint8_t* packed_k = (uint8_t*) (packed_b + nr);
+    for (size_t kr_block_start = 0; kr_block_start < kc; kr_block_start += kr) {
+      const size_t kr_block_size = min(kc - kr_block_start, kr);
+      for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+        const uint8_t* bn = b + (nr_block_start + nr_block_offset) * b_n_stride + kr_block_start * b_k_stride;
+        int32_t ksum = 0;
+        for (size_t kr_block_offset = 0; kr_block_offset < kr_block_size; kr_block_offset++) {
+          const uint8_t kv = bn[kr_block_offset * b_k_stride];
+          ksum += (int32_t) kv;
+          *packed_k++ = kv;
+        }
+        for (size_t kr_block_offset = kr_block_size; kr_block_offset < kr; kr_block_offset++) {
+          *packed_k++ = kzp;
+        }
+        packed_b[nr_block_offset] -= ksum * (int32_t) izp;
+      }
+      for (size_t i = nr_block_size * kr; i < nr * kr; i++) {
+        *packed_k++ = kzp;
+      }
+    }
+    packed_w = (void*) packed_k;
+  }
+}
+
 static inline void pack_q8conv_w(
   size_t n,
   size_t ks,
@@ -166,6 +214,43 @@ static inline void pack_q8dw_w(
   }
 }
 
+static inline void pack_q8dwpx_w(
+  size_t h,
+  size_t w,
+  size_t c,
+  size_t cp,
+  size_t vr,
+  uint8_t izp,
+  uint8_t kzp,
+  const uint8_t* k,
+  const int32_t* b,
+  void* packed_w)
+{
+  /* Lane l of every vector holds channel l % cp; lanes of channels past c get zero bias and zero-point weights */
+  const int32_t boff = (int32_t) h * (int32_t) w * (int32_t) izp * (int32_t) kzp;
+  int32_t* packed_b = (int32_t*) packed_w;
+  for (size_t lane = 0; lane < vr; lane++) {
+    const size_t channel = lane % cp;
+    *((int32_t*) packed_w) = channel < c ? b[channel] + boff : 0;
+    packed_w = (void*) ((uintptr_t) packed_w + sizeof(int32_t));
+  }
+  for (size_t x = 0; x < w; x++) {
+    for (size_t y = 0; y < h; y++) {
+      for (size_t lane = 0; lane < vr; lane++) {
+        const size_t channel = lane % cp;
+        if (channel < c) {
+          const uint8_t kv = k[(channel * h + y) * w + x];
+          packed_b[lane] -= (int32_t) kv * (int32_t) izp;
+          *((uint8_t*) packed_w) = kv;
+        } else {
+          *((uint8_t*) packed_w) = kzp;
+        }
+        packed_w = (void*) ((uintptr_t) packed_w + sizeof(uint8_t));
+      }
+    }
+  }
+}
+
 static inline void pack_q8dw_w_dilation(
   size_t h,
   size_t w,
@@ -255,6 +340,64 @@ static inline void pack_swizzle_q8gemm_b(
   }
 }
 
+/*
+ * Packs a 3x3 kernel for F(2x2, 3x3) Winograd convolution: nc int32 biases padded to a multiple of nr, followed
+ * by 16 matrices U = G' (k - kzp) G'^T, one per transformed position, with G' = 2G to keep the elements integral.
+ * Each matrix is stored as int16 in nr-wide blocks of kr-interleaved k_stride elements; padding must be zeroed by
+ * the caller.
+ */
+static inline void pack_q8winograd_f2k3_w(
+  size_t nc,
+  size_t kc,
+  uint32_t nr,
+  uint32_t kr,
+  size_t k_stride,
+  uint8_t kzp,
+  const uint8_t* k,
+  const int32_t* b,
+  void* packed_w)
+{
+  const size_t n_stride = (nc + (nr - 1)) & -nr;
+  int32_t* packed_b = (int32_t*) packed_w;
+  for (size_t n = 0; n < nc; n++) {
+    packed_b[n] = b[n];
+  }
+
+  int16_t* packed_u = (int16_t*) (packed_b + n_stride);
+  for (size_t n = 0; n < nc; n++) {
+    for (size_t c = 0; c < kc; c++) {
+      int32_t g[3][3];
+      for (size_t y = 0; y < 3; y++) {
+        for (size_t x = 0; x < 3; x++) {
+          g[y][x] = (int32_t) k[((n * 3 + y) * 3 + x) * kc + c] - (int32_t) kzp;
+        }
+      }
+
+      int32_t t[4][3];
+      for (size_t x = 0; x < 3; x++) {
+        t[0][x] = 2 * g[0][x];
+        t[1][x] = g[0][x] + g[1][x] + g[2][x];
+        t[2][x] = g[0][x] - g[1][x] + g[2][x];
+        t[3][x] = 2 * g[2][x];
+      }
+
+      for (size_t i = 0; i < 4; i++) {
+        const int32_t u[4] = {
+          2 * t[i][0],
+          t[i][0] + t[i][1] + t[i][2],
+          t[i][0] - t[i][1] + t[i][2],
+          2 * t[i][2],
+        };
+        for (size_t j = 0; j < 4; j++) {
+          const size_t index =
+            ((i * 4 + j) * n_stride + (n & -nr)) * k_stride + (c & -kr) * nr + (n & (nr - 1)) * kr + (c & (kr - 1));
+          packed_u[index] = (int16_t) u[j];
+        }
+      }
+    }
+  }
+}
+
 static inline void pack_hgemm_w(
   size_t nc,
   size_t kc,
@@ -264,6 +264,53 @@ union qnnp_u8_clamping_params {
 #endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
 };
 
+union qnnp_q8_quantization_params {
+  struct {
+    float scale;
+    float bias;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    int32_t output_zero_point;
+  } scalar;
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  struct {
+    float scale;
+    float bias;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    int32_t magic_less_zero_point;
+  } neon;
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  struct {
+    QNNP_ALIGN(16) float scale[4];
+    QNNP_ALIGN(16) float bias[4];
+    QNNP_ALIGN(16) float output_min_less_zero_point[4];
+    QNNP_ALIGN(16) float output_max_less_zero_point[4];
+    QNNP_ALIGN(16) int16_t output_zero_point[8];
+  } sse2;
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+};
+
+union qnnp_q8_dequantization_params {
+  struct {
+    float scale;
+    int32_t input_zero_point;
+  } scalar;
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  struct {
+    float scale;
+    uint8_t input_zero_point;
+  } neon;
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  struct {
+    QNNP_ALIGN(16) float scale[4];
+    QNNP_ALIGN(16) int16_t input_zero_point[8];
+  } sse2;
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+};
+
 typedef void (*q8gemm_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -286,6 +333,21 @@ typedef void (*q8conv_ukernel_function)(
     size_t c_stride,
     const union qnnp_conv_quantization_params* quantization_params);
 
+typedef void (*q8dconv_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t kc,
+    size_t kh,
+    size_t kw,
+    const uint8_t* a,
+    size_t a_stride,
+    size_t a_row_stride,
+    size_t a_col_stride,
+    const void* w,
+    uint8_t* c,
+    size_t c_stride,
+    const union qnnp_conv_quantization_params* quantization_params);
+
 typedef void (*q8gemm_xzp_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -323,6 +385,18 @@ typedef void (*x8lut_ukernel_function)(
     const uint8_t* t,
     uint8_t* y);
 
+/*
+ * Interpolates n output pixels, each from 4 input pixels (top-left, top-right, bottom-left, bottom-right) with a
+ * horizontal and a vertical weight in Q11 fixed point.
+ */
+typedef void (*u8ibilinear_ukernel_function)(
+    size_t n,
+    size_t channels,
+    const uint8_t** input,
+    const int16_t* weights,
+    uint8_t* output,
+    size_t output_increment);
+
 typedef void (*sgemm_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -355,6 +429,29 @@ typedef void (*q8updw_ukernel_function)(
     size_t output_increment,
     const union qnnp_conv_quantization_params* quantization_params);
 
+typedef void (*q8updwm_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    size_t kernel_size,
+    const uint8_t** input,
+    const void* weights,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union qnnp_conv_quantization_params* quantization_params);
+
+typedef void (*q8dwrow_ukernel_function)(
+    size_t channels,
+    size_t output_width,
+    const uint8_t* input_row0,
+    const uint8_t* input_row1,
+    const uint8_t* input_row2,
+    size_t input_pixel_stride,
+    const void* weights,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    const union qnnp_conv_quantization_params* quantization_params);
+
 typedef void (*q8mpdw_ukernel_function)(
     size_t channels,
     size_t output_width,
@@ -366,6 +463,31 @@ typedef void (*q8mpdw_ukernel_function)(
     size_t output_increment,
     const union qnnp_conv_quantization_params* quantization_params);
 
+typedef void (*q8winograd_input_ukernel_function)(
+    size_t channels,
+    const uint8_t** input,
+    int16_t* output,
+    size_t output_stride,
+    const union qnnp_conv_quantization_params* quantization_params);
+
+typedef void (*q8winograd_gemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const int16_t* a,
+    size_t a_stride,
+    const int16_t* w,
+    int32_t* c,
+    size_t c_stride);
+
+typedef void (*q8winograd_output_ukernel_function)(
+    size_t channels,
+    const int32_t* input,
+    size_t input_stride,
+    const int32_t* bias,
+    uint8_t** output,
+    const union qnnp_conv_quantization_params* quantization_params);
+
 typedef void (*q8gavgpool_up_ukernel_function)(
     size_t m,
     size_t n,
@@ -424,10 +546,45 @@ typedef void (*u8clamp_ukernel_function)(
     uint8_t* y,
     const union qnnp_u8_clamping_params* params);
 
+typedef void (*q8quant_ukernel_function)(
+    size_t n,
+    const float* x,
+    uint8_t* y,
+    const union qnnp_q8_quantization_params* params);
+
+typedef void (*q8dequant_ukernel_function)(
+    size_t n,
+    const uint8_t* x,
+    float* y,
+    const union qnnp_q8_dequantization_params* params);
+
+/* Packs a k x n panel (n <= nr) of a row-major B matrix into the layout of pack_q8gemm_b */
+typedef void (*q8packb_ukernel_function)(
+    size_t k,
+    size_t n,
+    const uint8_t* b,
+    size_t b_stride,
+    uint8_t izp,
+    uint8_t kzp,
+    void* packed_b);
+
+typedef void (*x8transpose_ukernel_function)(
+    size_t rows,
+    size_t columns,
+    const uint8_t* x,
+    size_t x_stride,
+    uint8_t* y,
+    size_t y_stride);
+
 typedef uint8_t (*u8rmax_ukernel_function)(
     size_t n,
     const uint8_t* x);
 
+typedef uint8_t (*u8argmax_ukernel_function)(
+    size_t n,
+    const uint8_t* x,
+    size_t* index);
+
 typedef void (*u8lut32norm_ukernel_function)(
     size_t n,
     const uint8_t* x,
@@ -444,6 +601,10 @@ typedef void (*q8uvadd_ukernel_function)(
 struct q8conv_parameters {
   q8gemm_ukernel_function gemm;
   q8conv_ukernel_function conv;
+  /* Direct convolution over contiguous input windows, with the conv weight layout; NULL if there is none */
+  q8dconv_ukernel_function dconv;
+  /* Packs row-major B operands for the GEMM micro-kernel at run time */
+  q8packb_ukernel_function packb;
   uint8_t mr;
   uint8_t nr;
   uint8_t kr;
@@ -459,11 +620,39 @@ struct q8conv_xzp_parameters {
   size_t kthreshold;
 };
 
+struct q8winograd_parameters {
+  q8winograd_input_ukernel_function input;
+  q8winograd_gemm_ukernel_function gemm;
+  q8winograd_output_ukernel_function output;
+  uint8_t mr;
+  uint8_t nr;
+  uint8_t kr;
+  uint8_t kc;
+  size_t cthreshold;
+};
+
 struct q8updw_parameters {
   q8updw_ukernel_function updw;
   uint8_t cr;
 };
 
+struct q8updwm_parameters {
+  q8updwm_ukernel_function updwm;
+  uint8_t cr;
+};
+
+struct q8dwpx_parameters {
+  q8updwm_ukernel_function updwm;
+  /* Maximum number of channels; each output pixel takes channels rounded up to a power of 2 of the vr lanes */
+  uint8_t cr;
+  uint8_t vr;
+};
+
+struct q8dwrow_parameters {
+  q8dwrow_ukernel_function stride1;
+  q8dwrow_ukernel_function stride2;
+};
+
 struct q8mpdw_parameters {
   q8mpdw_ukernel_function mpdw;
   uint8_t cr;
@@ -512,9 +701,18 @@ struct x8zip_parameters {
 
 struct qnnp_parameters {
   struct q8conv_parameters q8conv;
+  /* Micro-kernels for layers with at most nr output channels; nr is 0 if there are none */
+  struct q8conv_parameters q8conv_narrow;
   struct q8conv_xzp_parameters q8conv_xzp;
+  struct q8winograd_parameters q8winograd;
   struct q8updw_parameters q8dw9;
   struct q8mpdw_parameters q8dw25;
+  /* Depthwise micro-kernel for an arbitrary number of taps */
+  struct q8updwm_parameters q8dwm;
+  /* Depthwise micro-kernel vectorized across output pixels for few channels; cr is 0 if there is none */
+  struct q8dwpx_parameters q8dwpx;
+  /* 3x3 depthwise micro-kernels reading input rows directly, with q8dw9 weight layout; NULL if there are none */
+  struct q8dwrow_parameters q8dw9row;
   struct q8sum_rows_parameters q8sum_rows;
   struct q8add_parameters q8add;
   struct q8gavgpool_parameters q8gavgpool;
@@ -522,8 +720,13 @@ struct qnnp_parameters {
   struct u8maxpool_parameters u8maxpool;
   u8lut32norm_ukernel_function u8lut32norm;
   u8clamp_ukernel_function u8clamp;
+  q8quant_ukernel_function q8quant;
+  q8dequant_ukernel_function q8dequant;
   u8rmax_ukernel_function u8rmax;
+  u8argmax_ukernel_function u8argmax;
+  u8ibilinear_ukernel_function u8ibilinear;
   struct x8zip_parameters x8zip;
+  x8transpose_ukernel_function x8transpose;
   x8lut_ukernel_function x8lut;
   bool initialized;
 };
@@ -35,6 +35,25 @@ DECLARE_Q8CONV_UKERNEL_FUNCTION(q8conv_ukernel_4x8__aarch32_neon)
 DECLARE_Q8CONV_UKERNEL_FUNCTION(q8conv_ukernel_8x8__aarch64_neon)
 DECLARE_Q8CONV_UKERNEL_FUNCTION(q8conv_ukernel_8x8__neon)
 DECLARE_Q8CONV_UKERNEL_FUNCTION(q8conv_ukernel_4x4c2__sse2)
+DECLARE_Q8CONV_UKERNEL_FUNCTION(q8conv_ukernel_8x2c4__sse2)
+
+#define DECLARE_Q8DCONV_UKERNEL_FUNCTION(fn_name)                      \
+  QNNP_INTERNAL void fn_name(                                          \
+      size_t mr,                                                       \
+      size_t nr,                                                       \
+      size_t kc,                                                       \
+      size_t kh,                                                       \
+      size_t kw,                                                       \
+      const uint8_t* a,                                                \
+      size_t a_stride,                                                 \
+      size_t a_row_stride,                                             \
+      size_t a_col_stride,                                             \
+      const void* w,                                                   \
+      uint8_t* c,                                                      \
+      size_t c_stride,                                                 \
+      const union qnnp_conv_quantization_params* quantization_params);
+
+DECLARE_Q8DCONV_UKERNEL_FUNCTION(q8dconv_ukernel_4x4c2__sse2)
 
 #ifdef __cplusplus
 } /* extern "C" */
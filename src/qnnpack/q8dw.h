@@ -33,6 +33,38 @@ DECLARE_Q8UPDW_FUNCTION(q8updw_ukernel_9c8__neon)
 DECLARE_Q8UPDW_FUNCTION(q8updw_ukernel_9c8__aarch32_neon)
 DECLARE_Q8UPDW_FUNCTION(q8updw_ukernel_9c8__sse2)
 
+#define DECLARE_Q8UPDWM_FUNCTION(fn_name)                            \
+  QNNP_INTERNAL void fn_name(                                        \
+    size_t channels,                                                 \
+    size_t output_width,                                             \
+    size_t kernel_size,                                              \
+    const uint8_t** input,                                           \
+    const void* weights,                                             \
+    uint8_t* output,                                                 \
+    size_t input_stride,                                             \
+    size_t output_increment,                                         \
+    const union qnnp_conv_quantization_params* quantization_params);
+
+DECLARE_Q8UPDWM_FUNCTION(q8updw_ukernel_mc8__neon)
+DECLARE_Q8UPDWM_FUNCTION(q8updw_ukernel_mc8__sse2)
+DECLARE_Q8UPDWM_FUNCTION(q8dwpx_ukernel_mc4__sse2)
+
+#define DECLARE_Q8DWROW_FUNCTION(fn_name)                            \
+  QNNP_INTERNAL void fn_name(                                        \
+    size_t channels,                                                 \
+    size_t output_width,                                             \
+    const uint8_t* input_row0,                                       \
+    const uint8_t* input_row1,                                       \
+    const uint8_t* input_row2,                                       \
+    size_t input_pixel_stride,                                       \
+    const void* weights,                                             \
+    uint8_t* output,                                                 \
+    size_t output_pixel_stride,                                      \
+    const union qnnp_conv_quantization_params* quantization_params);
+
+DECLARE_Q8DWROW_FUNCTION(q8dwrow_ukernel_3x3s1c8__sse2)
+DECLARE_Q8DWROW_FUNCTION(q8dwrow_ukernel_3x3s2c8__sse2)
+
 #define DECLARE_Q8MPDW_FUNCTION(fn_name)                             \
   QNNP_INTERNAL void fn_name(                                        \
     size_t channels,                                                 \
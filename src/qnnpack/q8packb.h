@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack/params.h>
+#include <qnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DECLARE_Q8PACKB_UKERNEL_FUNCTION(fn_name) \
+  QNNP_INTERNAL void fn_name(                     \
+      size_t k,                                   \
+      size_t n,                                   \
+      const uint8_t* b,                           \
+      size_t b_stride,                            \
+      uint8_t izp,                                \
+      uint8_t kzp,                                \
+      void* packed_b);
+
+DECLARE_Q8PACKB_UKERNEL_FUNCTION(q8packb_ukernel_8c1__neon)
+DECLARE_Q8PACKB_UKERNEL_FUNCTION(q8packb_ukernel_2c4__sse2)
+DECLARE_Q8PACKB_UKERNEL_FUNCTION(q8packb_ukernel_4c2__sse2)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack/params.h>
+#include <qnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DECLARE_Q8WINOGRAD_INPUT_UKERNEL_FUNCTION(fn_name)           \
+  QNNP_INTERNAL void fn_name(                                        \
+    size_t channels,                                                 \
+    const uint8_t** input,                                           \
+    int16_t* output,                                                 \
+    size_t output_stride,                                            \
+    const union qnnp_conv_quantization_params* quantization_params);
+
+DECLARE_Q8WINOGRAD_INPUT_UKERNEL_FUNCTION(q8winograd_input_ukernel_f2k3c8__sse2)
+
+#define DECLARE_Q8WINOGRAD_GEMM_UKERNEL_FUNCTION(fn_name) \
+  QNNP_INTERNAL void fn_name(                             \
+    size_t mr,                                            \
+    size_t nr,                                            \
+    size_t k,                                             \
+    const int16_t* a,                                     \
+    size_t a_stride,                                      \
+    const int16_t* w,                                     \
+    int32_t* c,                                           \
+    size_t c_stride);
+
+DECLARE_Q8WINOGRAD_GEMM_UKERNEL_FUNCTION(q8winograd_gemm_ukernel_4x4c8__sse2)
+
+#define DECLARE_Q8WINOGRAD_OUTPUT_UKERNEL_FUNCTION(fn_name)          \
+  QNNP_INTERNAL void fn_name(                                        \
+    size_t channels,                                                 \
+    const int32_t* input,                                            \
+    size_t input_stride,                                             \
+    const int32_t* bias,                                             \
+    uint8_t** output,                                                \
+    const union qnnp_conv_quantization_params* quantization_params);
+
+DECLARE_Q8WINOGRAD_OUTPUT_UKERNEL_FUNCTION(q8winograd_output_ukernel_f2k3c4__sse2)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -324,6 +324,78 @@ static inline union qnnp_u8_clamping_params qnnp_compute_u8_clamping_params(
   return params;
 }
 
+static inline union qnnp_q8_quantization_params qnnp_compute_q8_affine_quantization_params(
+  float scale,
+  float bias,
+  uint8_t output_zero_point,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  assert(output_min < output_max);
+
+  /* Inputs are transformed as x * scale + bias, and clamped before rounding so the result fits into int16 */
+  const float output_min_less_zero_point = (float) ((int32_t) (uint32_t) output_min - (int32_t) (uint32_t) output_zero_point);
+  const float output_max_less_zero_point = (float) ((int32_t) (uint32_t) output_max - (int32_t) (uint32_t) output_zero_point);
+
+  union qnnp_q8_quantization_params params;
+  #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.scale[i] = scale;
+      params.sse2.bias[i] = bias;
+      params.sse2.output_min_less_zero_point[i] = output_min_less_zero_point;
+      params.sse2.output_max_less_zero_point[i] = output_max_less_zero_point;
+    }
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.output_zero_point[i] = (int16_t) (uint16_t) output_zero_point;
+    }
+  #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    params.neon.scale = scale;
+    params.neon.bias = bias;
+    params.neon.output_min_less_zero_point = output_min_less_zero_point;
+    params.neon.output_max_less_zero_point = output_max_less_zero_point;
+    params.neon.magic_less_zero_point = INT32_C(0x4B400000) - (int32_t) (uint32_t) output_zero_point;
+  #else
+    params.scalar.scale = scale;
+    params.scalar.bias = bias;
+    params.scalar.output_min_less_zero_point = output_min_less_zero_point;
+    params.scalar.output_max_less_zero_point = output_max_less_zero_point;
+    params.scalar.output_zero_point = (int32_t) (uint32_t) output_zero_point;
+  #endif
+  return params;
+}
+
+static inline union qnnp_q8_quantization_params qnnp_compute_q8_quantization_params(
+  uint8_t output_zero_point,
+  float output_scale,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  return qnnp_compute_q8_affine_quantization_params(
+    1.0f / output_scale, 0.0f, output_zero_point, output_min, output_max);
+}
+
+static inline union qnnp_q8_dequantization_params qnnp_compute_q8_dequantization_params(
+  uint8_t input_zero_point,
+  float input_scale)
+{
+  union qnnp_q8_dequantization_params params;
+  #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.scale[i] = input_scale;
+    }
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.input_zero_point[i] = (int16_t) (uint16_t) input_zero_point;
+    }
+  #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    params.neon.scale = input_scale;
+    params.neon.input_zero_point = input_zero_point;
+  #else
+    params.scalar.scale = input_scale;
+    params.scalar.input_zero_point = (int32_t) (uint32_t) input_zero_point;
+  #endif
+  return params;
+}
+
 static inline union qnnp_add_quantization_params qnnp_compute_add_quantization_params(
   uint8_t a_zero_point,
   uint8_t b_zero_point,
@@ -413,6 +485,28 @@ static inline union qnnp_add_quantization_params qnnp_compute_add_quantization_p
   return params;
 }
 
+/* Replaces the output range of add quantization parameters, e.g. to fold a subsequent clamp into the add */
+static inline void qnnp_update_add_quantization_params_output_range(
+  union qnnp_add_quantization_params* params,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  assert(output_min <= output_max);
+
+  #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    for (uint32_t i = 0; i < 16; i++) {
+      params->sse2.y_max[i] = output_max;
+      params->sse2.y_min[i] = output_min;
+    }
+  #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    params->neon.y_max = output_max;
+    params->neon.y_min = output_min;
+  #else
+    params->scalar.y_max = (int32_t) (uint32_t) output_max;
+    params->scalar.y_min = (int32_t) (uint32_t) output_min;
+  #endif
+}
+
 static inline union qnnp_add_quantization_params qnnp_compute_scalar_add_quantization_params(
   uint8_t a_zero_point,
   uint8_t b_zero_point,
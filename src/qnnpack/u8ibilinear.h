@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack/params.h>
+#include <qnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DECLARE_U8IBILINEAR_UKERNEL_FUNCTION(fn_name) \
+  QNNP_INTERNAL void fn_name(                         \
+      size_t n,                                       \
+      size_t channels,                                \
+      const uint8_t** input,                          \
+      const int16_t* weights,                         \
+      uint8_t* output,                                \
+      size_t output_increment);
+
+DECLARE_U8IBILINEAR_UKERNEL_FUNCTION(u8ibilinear_ukernel_c8__neon)
+DECLARE_U8IBILINEAR_UKERNEL_FUNCTION(u8ibilinear_ukernel_c8__sse2)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack/params.h>
+#include <qnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DECLARE_X8TRANSPOSE_UKERNEL_FUNCTION(fn_name) \
+  QNNP_INTERNAL void fn_name(                         \
+      size_t rows,                                    \
+      size_t columns,                                 \
+      const uint8_t* x,                               \
+      size_t x_stride,                                \
+      uint8_t* y,                                     \
+      size_t y_stride);
+
+DECLARE_X8TRANSPOSE_UKERNEL_FUNCTION(x8transpose_ukernel_8x8__neon)
+DECLARE_X8TRANSPOSE_UKERNEL_FUNCTION(x8transpose_ukernel_8x8__sse2)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
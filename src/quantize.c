@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_quantize_nc_f32_q8(
+    size_t channels,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* quantize_out)
+{
+  qnnp_operator_t quantize_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_quantize_nc_f32_q8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create Quantize operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    qnnp_log_error(
+      "failed to create Quantize operator with %.7g output scale: scale must be finite and positive", output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    qnnp_log_error(
+      "failed to create Quantize operator with [%" PRIu8 ", %" PRIu8 "] output range: range min must be below range max",
+      output_min, output_max);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  if (!isnormal(1.0f / output_scale)) {
+    qnnp_log_error(
+      "failed to create Quantize operator with %.7g output scale: reciprocal scale must be a normalized number",
+      output_scale);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  quantize_op = calloc(1, sizeof(struct qnnp_operator));
+  if (quantize_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  quantize_op->channels = channels;
+  quantize_op->q8_quantization_params =
+    qnnp_compute_q8_quantization_params(output_zero_point, output_scale, output_min, output_max);
+
+  quantize_op->ukernel_type = qnnp_ukernel_type_quantize;
+  quantize_op->format = qnnp_format_quint8;
+
+  *quantize_out = quantize_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(quantize_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_quantize_nc_f32_q8(
+    qnnp_operator_t quantize,
+    size_t batch_size,
+    const float* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_quantize_nc_f32_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup Quantize operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  quantize->batch_size = batch_size;
+  quantize->input = input;
+  quantize->input_pixel_stride = input_stride;
+  quantize->output = output;
+  quantize->output_pixel_stride = output_stride;
+
+  return qnnp_status_success;
+}
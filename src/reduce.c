@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/log.h>
+#include <qnnpack/math.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_reduce_nd_q8(
+    enum qnnp_reduce_operation operation,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    qnnp_operator_t* reduce_out)
+{
+  qnnp_operator_t reduce_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_reduce_nd_q8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  switch (operation) {
+    case qnnp_reduce_operation_sum:
+    case qnnp_reduce_operation_mean:
+    case qnnp_reduce_operation_max:
+    case qnnp_reduce_operation_min:
+      break;
+    default:
+      qnnp_log_error("failed to create reduce operator with operation %d: unknown operation", (int) operation);
+      goto error;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    qnnp_log_error(
+      "failed to create reduce operator with %.7g input scale: scale must be finite and positive", input_scale);
+    goto error;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    qnnp_log_error(
+      "failed to create reduce operator with %.7g output scale: scale must be finite and positive", output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    qnnp_log_error(
+      "failed to create reduce operator with [%" PRIu8 ", %" PRIu8 "] output range: range min must be below range max",
+      output_min, output_max);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  const float input_output_scale = input_scale / output_scale;
+  if (input_output_scale < 0x1.0p-8f || input_output_scale >= 0x1.0p+8f) {
+    qnnp_log_error(
+      "failed to create reduce operator with %.7g input-to-output scale ratio: "
+      "scale ratio must be in [2**-8, 2**8) range",
+      input_output_scale);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  reduce_op = calloc(1, sizeof(struct qnnp_operator));
+  if (reduce_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  if (operation == qnnp_reduce_operation_sum || operation == qnnp_reduce_operation_mean) {
+    void* zero_buffer = calloc(QNNP_REDUCE_BLOCK_CHANNELS, sizeof(uint8_t));
+    if (zero_buffer == NULL) {
+      qnnp_log_error("failed to allocate %zu bytes for zero padding", QNNP_REDUCE_BLOCK_CHANNELS * sizeof(uint8_t));
+      goto error;
+    }
+    reduce_op->zero_buffer = zero_buffer;
+    reduce_op->zero_pointer = zero_buffer;
+  }
+
+  reduce_op->reduce_operation = operation;
+  reduce_op->input_zero_point = input_zero_point;
+  reduce_op->output_zero_point = output_zero_point;
+  reduce_op->input_scale = input_scale;
+  reduce_op->output_scale = output_scale;
+  reduce_op->output_min = output_min;
+  reduce_op->output_max = output_max;
+
+  reduce_op->ukernel_type = qnnp_ukernel_type_reduce;
+  reduce_op->format = qnnp_format_quint8;
+
+  *reduce_out = reduce_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(reduce_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_reduce_nd_q8(
+    qnnp_operator_t reduce_op,
+    size_t num_dims,
+    const size_t* shape,
+    size_t num_axes,
+    const size_t* axes,
+    const uint8_t* input,
+    uint8_t* output)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_reduce_nd_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (num_dims == 0 || num_dims > QNNP_MAX_REDUCE_DIMS) {
+    qnnp_log_error(
+      "failed to setup reduce operator with %zu dimensions: number of dimensions must be in [1, %d] range",
+      num_dims, QNNP_MAX_REDUCE_DIMS);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (num_axes == 0 || num_axes > num_dims) {
+    qnnp_log_error(
+      "failed to setup reduce operator with %zu reduction axes: number of axes must be in [1, %zu] range",
+      num_axes, num_dims);
+    return qnnp_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_dims; i++) {
+    if (shape[i] == 0) {
+      qnnp_log_error(
+        "failed to setup reduce operator with size %zu in dimension #%zu: dimension sizes must be non-zero",
+        shape[i], i);
+      return qnnp_status_invalid_parameter;
+    }
+  }
+
+  bool reduced[QNNP_MAX_REDUCE_DIMS] = { false };
+  for (size_t i = 0; i < num_axes; i++) {
+    if (axes[i] >= num_dims || reduced[axes[i]]) {
+      qnnp_log_error(
+        "failed to setup reduce operator with %zu in axis entry #%zu: "
+        "axes must be distinct dimensions of the input",
+        axes[i], i);
+      return qnnp_status_invalid_parameter;
+    }
+    reduced[axes[i]] = true;
+  }
+
+  /*
+   * Drop the dimensions of size 1 and merge adjacent dimensions which are either both kept or both reduced. What is
+   * left alternates between kept and reduced dimensions, e.g. NHWC reduced over H and W becomes N x (HW) x C.
+   */
+  size_t merged_shape[QNNP_MAX_REDUCE_DIMS];
+  bool merged_reduced[QNNP_MAX_REDUCE_DIMS];
+  size_t merged_dims = 0;
+  for (size_t i = 0; i < num_dims; i++) {
+    if (shape[i] == 1) {
+      continue;
+    }
+
+    if (merged_dims != 0 && merged_reduced[merged_dims - 1] == reduced[i]) {
+      merged_shape[merged_dims - 1] *= shape[i];
+    } else {
+      merged_shape[merged_dims] = shape[i];
+      merged_reduced[merged_dims] = reduced[i];
+      merged_dims += 1;
+    }
+  }
+
+  size_t merged_stride[QNNP_MAX_REDUCE_DIMS];
+  size_t stride = 1;
+  for (size_t i = merged_dims; i != 0; i--) {
+    merged_stride[i - 1] = stride;
+    stride *= merged_shape[i - 1];
+  }
+
+  size_t output_dims = 0;
+  size_t dims = 0;
+  size_t outputs = 1;
+  size_t reduction_size = 1;
+  for (size_t i = 0; i < merged_dims; i++) {
+    if (merged_reduced[i]) {
+      reduce_op->reduce_shape[dims] = merged_shape[i];
+      reduce_op->reduce_stride[dims] = merged_stride[i];
+      dims += 1;
+      reduction_size *= merged_shape[i];
+    } else {
+      reduce_op->reduce_output_shape[output_dims] = merged_shape[i];
+      reduce_op->reduce_output_stride[output_dims] = merged_stride[i];
+      output_dims += 1;
+      outputs *= merged_shape[i];
+    }
+  }
+  reduce_op->reduce_dims = dims;
+  reduce_op->reduce_output_dims = output_dims;
+
+  const enum qnnp_reduce_operation operation = reduce_op->reduce_operation;
+  const bool accumulates = operation == qnnp_reduce_operation_sum || operation == qnnp_reduce_operation_mean;
+  if (accumulates && reduction_size > (size_t) (INT32_MAX / UINT8_MAX)) {
+    qnnp_log_error(
+      "failed to setup reduce operator with %zu reduced elements: "
+      "number of summed elements must not exceed %d",
+      reduction_size, INT32_MAX / UINT8_MAX);
+    return qnnp_status_unsupported_parameter;
+  }
+
+  /* Minimum and maximum commute with requantization, which only needs to subtract the input zero point */
+  int32_t bias = -(int32_t) (uint32_t) reduce_op->input_zero_point;
+  float scale = reduce_op->input_scale / reduce_op->output_scale;
+  if (accumulates) {
+    bias *= (int32_t) reduction_size;
+  }
+  if (operation == qnnp_reduce_operation_mean) {
+    scale /= (float) reduction_size;
+  }
+
+  if (qnnp_operator_reduces_rows(reduce_op)) {
+    if (accumulates) {
+      reduce_op->avgpool_quantization_params = qnnp_compute_avgpool_quantization_params(
+        bias, scale, reduce_op->output_zero_point, reduce_op->output_min, reduce_op->output_max);
+    } else {
+      reduce_op->avgpool_quantization_params = qnnp_compute_scalar_avgpool_quantization_params(
+        bias, scale, reduce_op->output_zero_point, reduce_op->output_min, reduce_op->output_max);
+    }
+  } else {
+    reduce_op->avgpool_quantization_params = qnnp_compute_scalar_avgpool_quantization_params(
+      bias, scale, reduce_op->output_zero_point, reduce_op->output_min, reduce_op->output_max);
+
+    /*
+     * Other reductions are split into blocks of contiguous runs of the innermost reduced dimension, or of chunks of
+     * such runs. Every block produces a partial result in the workspace, and partial results are combined afterwards.
+     */
+    const size_t run = dims != 0 && reduce_op->reduce_stride[dims - 1] == 1 ? reduce_op->reduce_shape[dims - 1] : 1;
+    const size_t run_chunk = min(run, QNNP_REDUCE_BLOCK_ELEMENTS);
+    const size_t segments = reduction_size / run * divide_round_up(run, run_chunk);
+    const size_t blocks = divide_round_up(segments, QNNP_REDUCE_BLOCK_ELEMENTS / run_chunk);
+    const size_t workspace_size = outputs * blocks * sizeof(int32_t);
+    void* workspace = realloc(reduce_op->workspace, workspace_size);
+    if (workspace == NULL) {
+      qnnp_log_error("failed to allocate %zu bytes for reduce operator workspace", workspace_size);
+      return qnnp_status_out_of_memory;
+    }
+    reduce_op->workspace = workspace;
+  }
+
+  reduce_op->input = input;
+  reduce_op->output = output;
+
+  return qnnp_status_success;
+}
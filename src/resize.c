@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/common.h>
+#include <qnnpack/math.h>
+#include <qnnpack/params.h>
+
+
+/*
+ * Maps an output position to the pair of input positions it interpolates between, and the weight of the second one in
+ * Q11 fixed point. Without QNNP_FLAG_ALIGN_CORNERS pixel centers are aligned (half-pixel coordinates).
+ */
+static void compute_bilinear_coordinate(
+    size_t output_index,
+    size_t input_size,
+    size_t output_size,
+    bool align_corners,
+    size_t* input_index0,
+    size_t* input_index1,
+    int16_t* alpha)
+{
+  float input_coordinate = 0.0f;
+  if (align_corners) {
+    if (output_size > 1) {
+      input_coordinate = (float) output_index * ((float) (input_size - 1) / (float) (output_size - 1));
+    }
+  } else {
+    input_coordinate = ((float) output_index + 0.5f) * ((float) input_size / (float) output_size) - 0.5f;
+    if (input_coordinate < 0.0f) {
+      input_coordinate = 0.0f;
+    }
+  }
+  const size_t index0 = min((size_t) input_coordinate, input_size - 1);
+  *input_index0 = index0;
+  *input_index1 = min(index0 + 1, input_size - 1);
+  const long fixed_alpha = lrintf((input_coordinate - (float) index0) * 2048.0f);
+  *alpha = (int16_t) (fixed_alpha < 0 ? 0 : fixed_alpha > 2048 ? 2048 : fixed_alpha);
+}
+
+/*
+ * Nearest input position: rounded for QNNP_FLAG_ALIGN_CORNERS, otherwise the input pixel that contains the center of
+ * the output pixel in half-pixel coordinates, floor((output_index + 0.5) * input_size / output_size).
+ */
+static size_t compute_nearest_coordinate(
+    size_t output_index,
+    size_t input_size,
+    size_t output_size,
+    bool align_corners)
+{
+  if (align_corners) {
+    if (output_size == 1) {
+      return 0;
+    }
+    return (output_index * (input_size - 1) * 2 + (output_size - 1)) / ((output_size - 1) * 2);
+  } else {
+    return min((output_index * 2 + 1) * input_size / (output_size * 2), input_size - 1);
+  }
+}
+
+static enum qnnp_status create_resize_nhwc_q8(
+    size_t channels,
+    uint32_t flags,
+    enum qnnp_ukernel_type ukernel_type,
+    qnnp_operator_t* resize_out)
+{
+  qnnp_operator_t resize = NULL;
+  enum qnnp_status status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create resize operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if ((flags & ~QNNP_FLAG_ALIGN_CORNERS) != 0) {
+    qnnp_log_error(
+      "failed to create resize operator with 0x%08" PRIx32 " flags: only QNNP_FLAG_ALIGN_CORNERS is supported",
+      flags);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  resize = calloc(1, sizeof(struct qnnp_operator));
+  if (resize == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  resize->channels = channels;
+  resize->flags = flags;
+
+  resize->ukernel_type = ukernel_type;
+  resize->format = qnnp_format_quint8;
+
+  *resize_out = resize;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(resize);
+  return status;
+}
+
+static enum qnnp_status setup_resize_nhwc_q8(
+    qnnp_operator_t resize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride)
+{
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup resize operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_width == 0 || input_height == 0) {
+    qnnp_log_error(
+      "failed to setup resize operator with %zux%zu input: input dimensions must be non-zero",
+      input_width, input_height);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_width == 0 || output_height == 0) {
+    qnnp_log_error(
+      "failed to setup resize operator with %zux%zu output: output dimensions must be non-zero",
+      output_width, output_height);
+    return qnnp_status_invalid_parameter;
+  }
+
+  resize->batch_size = batch_size;
+  resize->input_height = input_height;
+  resize->input_width = input_width;
+  resize->input = input;
+  resize->input_pixel_stride = input_pixel_stride;
+  resize->output_height = output_height;
+  resize->output_width = output_width;
+  resize->output = output;
+  resize->output_pixel_stride = output_pixel_stride;
+
+  const bool align_corners = (resize->flags & QNNP_FLAG_ALIGN_CORNERS) != 0;
+  const size_t output_size = batch_size * output_height * output_width;
+  if (resize->ukernel_type == qnnp_ukernel_type_resize_nearest) {
+    const size_t indirection_buffer_size = sizeof(void*) * output_size;
+    const void** indirection_buffer = (const void**) realloc(resize->indirection_buffer, indirection_buffer_size);
+    if (indirection_buffer == NULL) {
+      qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+      return qnnp_status_out_of_memory;
+    }
+    resize->indirection_buffer = indirection_buffer;
+
+    for (size_t image = 0; image < batch_size; image++) {
+      for (size_t output_y = 0; output_y < output_height; output_y++) {
+        const size_t input_y = compute_nearest_coordinate(output_y, input_height, output_height, align_corners);
+        for (size_t output_x = 0; output_x < output_width; output_x++) {
+          const size_t input_x = compute_nearest_coordinate(output_x, input_width, output_width, align_corners);
+          indirection_buffer[(image * output_height + output_y) * output_width + output_x] =
+            input + ((image * input_height + input_y) * input_width + input_x) * input_pixel_stride;
+        }
+      }
+    }
+    return qnnp_status_success;
+  }
+
+  /* Every output pixel reads its 4 neighbours and has a horizontal and a vertical weight */
+  const size_t indirection_buffer_size = sizeof(void*) * output_size * 4;
+  const void** indirection_buffer = (const void**) realloc(resize->indirection_buffer, indirection_buffer_size);
+  if (indirection_buffer == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+    return qnnp_status_out_of_memory;
+  }
+  resize->indirection_buffer = indirection_buffer;
+
+  const size_t weights_size = sizeof(int16_t) * output_size * 2;
+  int16_t* weights = (int16_t*) realloc(resize->packed_weights, weights_size);
+  if (weights == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for interpolation weights", weights_size);
+    return qnnp_status_out_of_memory;
+  }
+  resize->packed_weights = weights;
+
+  for (size_t image = 0; image < batch_size; image++) {
+    for (size_t output_y = 0; output_y < output_height; output_y++) {
+      size_t input_y0, input_y1;
+      int16_t alpha_v;
+      compute_bilinear_coordinate(output_y, input_height, output_height, align_corners, &input_y0, &input_y1, &alpha_v);
+      const uint8_t* input_row0 = input + (image * input_height + input_y0) * input_width * input_pixel_stride;
+      const uint8_t* input_row1 = input + (image * input_height + input_y1) * input_width * input_pixel_stride;
+      for (size_t output_x = 0; output_x < output_width; output_x++) {
+        size_t input_x0, input_x1;
+        int16_t alpha_h;
+        compute_bilinear_coordinate(output_x, input_width, output_width, align_corners, &input_x0, &input_x1, &alpha_h);
+        const size_t index = (image * output_height + output_y) * output_width + output_x;
+        indirection_buffer[index * 4 + 0] = input_row0 + input_x0 * input_pixel_stride;
+        indirection_buffer[index * 4 + 1] = input_row0 + input_x1 * input_pixel_stride;
+        indirection_buffer[index * 4 + 2] = input_row1 + input_x0 * input_pixel_stride;
+        indirection_buffer[index * 4 + 3] = input_row1 + input_x1 * input_pixel_stride;
+        weights[index * 2 + 0] = alpha_h;
+        weights[index * 2 + 1] = alpha_v;
+      }
+    }
+  }
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_create_resize_bilinear2d_nhwc_q8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* resize_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_resize_bilinear2d_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_resize_nhwc_q8(channels, flags, qnnp_ukernel_type_resize_bilinear, resize_out);
+}
+
+enum qnnp_status qnnp_setup_resize_bilinear2d_nhwc_q8(
+    qnnp_operator_t resize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_resize_bilinear2d_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return setup_resize_nhwc_q8(
+    resize,
+    batch_size, input_height, input_width, output_height, output_width,
+    input, input_pixel_stride,
+    output, output_pixel_stride);
+}
+
+enum qnnp_status qnnp_create_resize_nearest2d_nhwc_q8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* resize_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_resize_nearest2d_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_resize_nhwc_q8(channels, flags, qnnp_ukernel_type_resize_nearest, resize_out);
+}
+
+enum qnnp_status qnnp_setup_resize_nearest2d_nhwc_q8(
+    qnnp_operator_t resize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_resize_nearest2d_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return setup_resize_nhwc_q8(
+    resize,
+    batch_size, input_height, input_width, output_height, output_width,
+    input, input_pixel_stride,
+    output, output_pixel_stride);
+}
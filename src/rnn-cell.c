@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/log.h>
+#include <qnnpack/math.h>
+#include <qnnpack/pack.h>
+#include <qnnpack/params.h>
+
+
+static enum qnnp_status create_rnn_cell(
+    enum qnnp_ukernel_type ukernel_type,
+    const char* name,
+    size_t input_size,
+    size_t hidden_size,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* input_weights,
+    const uint8_t* recurrent_weights,
+    const int32_t* input_bias,
+    const int32_t* recurrent_bias,
+    uint8_t cell_zero_point,
+    float cell_scale,
+    qnnp_operator_t* rnn_cell_out)
+{
+  qnnp_operator_t rnn_cell = NULL;
+  uint8_t* cell_weights = NULL;
+  int32_t* cell_bias = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_%s_cell_q8 failed because QNNPACK is not properly initialized", name);
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (input_size == 0 || hidden_size == 0) {
+    qnnp_log_error(
+      "failed to create %s cell operator with %zu input size and %zu hidden size: sizes must be non-zero",
+      name, input_size, hidden_size);
+    goto error;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    qnnp_log_error(
+      "failed to create %s cell operator with %.7g input scale: scale must be finite and positive",
+      name, input_scale);
+    goto error;
+  }
+
+  if (kernel_scale <= 0.0f || !isnormal(kernel_scale)) {
+    qnnp_log_error(
+      "failed to create %s cell operator with %.7g kernel scale: scale must be finite and positive",
+      name, kernel_scale);
+    goto error;
+  }
+
+  if (cell_scale <= 0.0f || !isnormal(cell_scale)) {
+    qnnp_log_error(
+      "failed to create %s cell operator with %.7g cell scale: scale must be finite and positive",
+      name, cell_scale);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  const float requantization_scale = input_scale * kernel_scale / QNNP_RNN_GATE_SCALE;
+  if (requantization_scale >= 1.0f) {
+    qnnp_log_error(
+      "failed to create %s cell operator with %.7g input scale and %.7g kernel scale: "
+      "requantization scale %.7g to gate pre-activations is greater or equal to 1.0",
+      name, input_scale, kernel_scale, requantization_scale);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  rnn_cell = calloc(1, sizeof(struct qnnp_operator));
+  if (rnn_cell == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  /*
+   * Gates are computed by GEMMs over the concatenation of input and hidden state. Weights of every nr hidden units are
+   * packed as QNNP_RNN_GATE_BLOCKS blocks of nr columns: the i, f, g, and o gates of LSTM cells, and the r and z gates
+   * followed by the input and recurrent halves of the n gate of GRU cells, which r scales separately. The n gate
+   * halves reduce over only the input or only the hidden state.
+   */
+  const struct q8conv_parameters* q8conv_params = &qnnp_params.q8conv;
+  if (hidden_size <= qnnp_params.q8conv_narrow.nr) {
+    q8conv_params = &qnnp_params.q8conv_narrow;
+  }
+  rnn_cell->q8conv_params = q8conv_params;
+  rnn_cell->group_input_channels = input_size;
+  rnn_cell->group_output_channels = hidden_size;
+  rnn_cell->ukernel_type = ukernel_type;
+
+  const uint32_t nr = q8conv_params->nr;
+  const uint32_t kr = q8conv_params->kr;
+  const size_t n_stride = (hidden_size + (nr - 1)) & -nr;
+  size_t block_k_start[QNNP_RNN_GATE_BLOCKS];
+  size_t block_k[QNNP_RNN_GATE_BLOCKS];
+  size_t cell_weights_size = 0;
+  size_t packed_tile_size = 0;
+  for (size_t block = 0; block < QNNP_RNN_GATE_BLOCKS; block++) {
+    qnnp_operator_get_rnn_cell_block_range(rnn_cell, block, &block_k_start[block], &block_k[block]);
+    cell_weights_size += hidden_size * block_k[block] * sizeof(uint8_t);
+    packed_tile_size += nr * (((block_k[block] + (kr - 1)) & -kr) * sizeof(uint8_t) + sizeof(int32_t));
+  }
+  const size_t packed_weights_size = n_stride / nr * packed_tile_size;
+  rnn_cell->packed_weights = malloc(packed_weights_size);
+  if (rnn_cell->packed_weights == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
+    goto error;
+  }
+  memset(rnn_cell->packed_weights, kernel_zero_point, packed_weights_size);
+
+  /* Concatenated input and recurrent weights, and combined biases, of every gate block */
+  cell_weights = malloc(cell_weights_size);
+  if (cell_weights == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for concatenated weights", cell_weights_size);
+    goto error;
+  }
+  const size_t cell_bias_size = QNNP_RNN_GATE_BLOCKS * hidden_size * sizeof(int32_t);
+  cell_bias = malloc(cell_bias_size);
+  if (cell_bias == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for combined biases", cell_bias_size);
+    goto error;
+  }
+
+  uint8_t* block_weights[QNNP_RNN_GATE_BLOCKS];
+  uint8_t* next_block_weights = cell_weights;
+  for (size_t block = 0; block < QNNP_RNN_GATE_BLOCKS; block++) {
+    block_weights[block] = next_block_weights;
+    next_block_weights += hidden_size * block_k[block];
+
+    const size_t gate = ukernel_type == qnnp_ukernel_type_gru_cell ? min(block, 2) : block;
+    const bool has_input = block_k_start[block] == 0;
+    const bool has_recurrent = block_k_start[block] + block_k[block] > input_size;
+    for (size_t n = 0; n < hidden_size; n++) {
+      const size_t row = gate * hidden_size + n;
+      uint8_t* cell_weights_row = block_weights[block] + n * block_k[block];
+      if (has_input) {
+        memcpy(cell_weights_row, input_weights + row * input_size, input_size);
+        cell_weights_row += input_size;
+      }
+      if (has_recurrent) {
+        memcpy(cell_weights_row, recurrent_weights + row * hidden_size, hidden_size);
+      }
+      cell_bias[block * hidden_size + n] =
+        (has_input ? input_bias[row] : 0) + (has_recurrent ? recurrent_bias[row] : 0);
+    }
+  }
+
+  for (size_t nr_block_start = 0; nr_block_start < hidden_size; nr_block_start += nr) {
+    const size_t nr_block_size = min(hidden_size - nr_block_start, nr);
+    uintptr_t packed_block = (uintptr_t) rnn_cell->packed_weights + nr_block_start / nr * packed_tile_size;
+    for (size_t block = 0; block < QNNP_RNN_GATE_BLOCKS; block++) {
+      pack_q8gemm_w(
+        nr_block_size, block_k[block],
+        nr, nr, kr,
+        input_zero_point, kernel_zero_point,
+        block_weights[block] + nr_block_start * block_k[block],
+        cell_bias + block * hidden_size + nr_block_start,
+        (void*) packed_block);
+      packed_block += nr * (((block_k[block] + (kr - 1)) & -kr) * sizeof(uint8_t) + sizeof(int32_t));
+    }
+  }
+  free(cell_weights);
+  cell_weights = NULL;
+  free(cell_bias);
+  cell_bias = NULL;
+
+  rnn_cell->lookup_table = malloc(4 * 256 * sizeof(float));
+  if (rnn_cell->lookup_table == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for lookup tables", 4 * 256 * sizeof(float));
+    goto error;
+  }
+  float* lookup_table = rnn_cell->lookup_table;
+  for (int32_t i = 0; i < 256; i++) {
+    const float gate = QNNP_RNN_GATE_SCALE * (float) (i - 128);
+    lookup_table[i] = 1.0f / (1.0f + expf(-gate));
+    lookup_table[256 + i] = tanhf(gate);
+    lookup_table[512 + i] = tanhf(cell_scale * (float) (i - (int32_t) (uint32_t) cell_zero_point));
+    if (ukernel_type == qnnp_ukernel_type_lstm_cell) {
+      lookup_table[768 + i] = cell_scale * (float) (i - (int32_t) (uint32_t) cell_zero_point);
+    } else {
+      lookup_table[768 + i] = input_scale * (float) (i - (int32_t) (uint32_t) input_zero_point);
+    }
+  }
+
+  rnn_cell->input_zero_point = input_zero_point;
+  rnn_cell->input_scale = input_scale;
+  rnn_cell->kernel_zero_point = kernel_zero_point;
+  rnn_cell->cell_zero_point = cell_zero_point;
+  rnn_cell->cell_scale = cell_scale;
+
+  rnn_cell->conv_quantization_params =
+    qnnp_compute_conv_quantization_params(
+      input_zero_point, kernel_zero_point,
+      requantization_scale, 128, 0, 255);
+
+  rnn_cell->format = qnnp_format_quint8;
+
+  *rnn_cell_out = rnn_cell;
+  return qnnp_status_success;
+
+error:
+  free(cell_weights);
+  free(cell_bias);
+  qnnp_delete_operator(rnn_cell);
+  return status;
+}
+
+static enum qnnp_status setup_rnn_cell(
+    qnnp_operator_t rnn_cell,
+    const char* name,
+    size_t batch_size,
+    const uint8_t* input,
+    const uint8_t* hidden,
+    const uint8_t* cell,
+    uint8_t* hidden_output,
+    uint8_t* cell_output)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_%s_cell_q8 failed because QNNPACK is not properly initialized", name);
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup %s cell operator with batch size %zu: batch size must be non-zero", name, batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  /* Input and hidden state are concatenated in the workspace, after 8 bytes which GEMM micro-kernels may read */
+  const size_t cell_input_size = rnn_cell->group_input_channels + rnn_cell->group_output_channels;
+  const size_t workspace_size = 8 + batch_size * cell_input_size * sizeof(uint8_t);
+  void* workspace = realloc(rnn_cell->workspace, workspace_size);
+  if (workspace == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for concatenated input and hidden state", workspace_size);
+    return qnnp_status_out_of_memory;
+  }
+  rnn_cell->workspace = workspace;
+
+  rnn_cell->batch_size = batch_size;
+  rnn_cell->input = input;
+  rnn_cell->input2 = hidden;
+  rnn_cell->cell_state = cell;
+  rnn_cell->output = hidden_output;
+  rnn_cell->cell_state_output = cell_output;
+
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_create_lstm_cell_q8(
+    size_t input_size,
+    size_t hidden_size,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* input_weights,
+    const uint8_t* recurrent_weights,
+    const int32_t* input_bias,
+    const int32_t* recurrent_bias,
+    uint8_t cell_zero_point,
+    float cell_scale,
+    qnnp_operator_t* lstm_cell_out)
+{
+  return create_rnn_cell(
+    qnnp_ukernel_type_lstm_cell, "lstm",
+    input_size, hidden_size,
+    input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale,
+    input_weights, recurrent_weights,
+    input_bias, recurrent_bias,
+    cell_zero_point, cell_scale,
+    lstm_cell_out);
+}
+
+enum qnnp_status qnnp_setup_lstm_cell_q8(
+    qnnp_operator_t lstm_cell,
+    size_t batch_size,
+    const uint8_t* input,
+    const uint8_t* hidden,
+    const uint8_t* cell,
+    uint8_t* hidden_output,
+    uint8_t* cell_output)
+{
+  return setup_rnn_cell(lstm_cell, "lstm", batch_size, input, hidden, cell, hidden_output, cell_output);
+}
+
+enum qnnp_status qnnp_create_gru_cell_q8(
+    size_t input_size,
+    size_t hidden_size,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* input_weights,
+    const uint8_t* recurrent_weights,
+    const int32_t* input_bias,
+    const int32_t* recurrent_bias,
+    qnnp_operator_t* gru_cell_out)
+{
+  /* GRU cells have no cell state: its quantization parameters are placeholders */
+  return create_rnn_cell(
+    qnnp_ukernel_type_gru_cell, "gru",
+    input_size, hidden_size,
+    input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale,
+    input_weights, recurrent_weights,
+    input_bias, recurrent_bias,
+    input_zero_point, input_scale,
+    gru_cell_out);
+}
+
+enum qnnp_status qnnp_setup_gru_cell_q8(
+    qnnp_operator_t gru_cell,
+    size_t batch_size,
+    const uint8_t* input,
+    const uint8_t* hidden,
+    uint8_t* hidden_output)
+{
+  return setup_rnn_cell(gru_cell, "gru", batch_size, input, hidden, NULL, hidden_output, NULL);
+}
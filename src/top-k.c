@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/math.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_top_k_nc_u8(
+    size_t channels,
+    size_t k,
+    qnnp_operator_t* top_k_out)
+{
+  qnnp_operator_t top_k_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_top_k_nc_u8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create Top-K operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (k == 0 || k > channels) {
+    qnnp_log_error(
+      "failed to create Top-K operator with k = %zu and %zu channels: k must be in [1, channels] range",
+      k, channels);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  if (channels > UINT32_MAX) {
+    qnnp_log_error(
+      "failed to create Top-K operator with %zu channels: number of channels must not exceed %" PRIu32,
+      channels, UINT32_MAX);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  top_k_op = calloc(1, sizeof(struct qnnp_operator));
+  if (top_k_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  top_k_op->channels = channels;
+  top_k_op->top_k = k;
+
+  top_k_op->ukernel_type = qnnp_ukernel_type_top_k;
+  top_k_op->format = qnnp_format_quint8;
+
+  *top_k_out = top_k_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(top_k_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_top_k_nc_u8(
+    qnnp_operator_t top_k,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output_values,
+    uint32_t* output_indices,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_top_k_nc_u8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup Top-K operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_stride < top_k->channels) {
+    qnnp_log_error(
+      "failed to setup Top-K operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      input_stride, top_k->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_stride < top_k->top_k) {
+    qnnp_log_error(
+      "failed to setup Top-K operator with output element stride of %zu: "
+      "stride must be at least as large as k (%zu)",
+      output_stride, top_k->top_k);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_indices == NULL) {
+    qnnp_log_error("failed to setup Top-K operator with NULL output indices: output indices are required");
+    return qnnp_status_invalid_parameter;
+  }
+
+  /* Every block of every row keeps a histogram of its values, later turned into output positions for each value */
+  const size_t blocks = divide_round_up(top_k->channels, QNNP_SELECTION_BLOCK_CHANNELS);
+  const size_t workspace_size = batch_size * (blocks * 256 * sizeof(uint32_t) + sizeof(uint8_t));
+  void* workspace = realloc(top_k->workspace, workspace_size);
+  if (workspace == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for Top-K workspace", workspace_size);
+    return qnnp_status_out_of_memory;
+  }
+  top_k->workspace = workspace;
+
+  top_k->batch_size = batch_size;
+  top_k->input = input;
+  top_k->input_pixel_stride = input_stride;
+  top_k->output = output_values;
+  top_k->output_indices = output_indices;
+  top_k->output_pixel_stride = output_stride;
+
+  return qnnp_status_success;
+}
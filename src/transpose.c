@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_transpose_nd_x8(
+    qnnp_operator_t* transpose_out)
+{
+  qnnp_operator_t transpose_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_transpose_nd_x8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  transpose_op = calloc(1, sizeof(struct qnnp_operator));
+  if (transpose_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  transpose_op->ukernel_type = qnnp_ukernel_type_transpose;
+  transpose_op->format = qnnp_format_quint8;
+
+  *transpose_out = transpose_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(transpose_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_transpose_nd_x8(
+    qnnp_operator_t transpose_op,
+    size_t num_dims,
+    const size_t* shape,
+    const size_t* perm,
+    const void* input,
+    void* output)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_transpose_nd_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (num_dims == 0 || num_dims > QNNP_MAX_TRANSPOSE_DIMS) {
+    qnnp_log_error(
+      "failed to setup transpose operator with %zu dimensions: number of dimensions must be in [1, %d] range",
+      num_dims, QNNP_MAX_TRANSPOSE_DIMS);
+    return qnnp_status_invalid_parameter;
+  }
+
+  bool used_dims[QNNP_MAX_TRANSPOSE_DIMS] = { false };
+  for (size_t i = 0; i < num_dims; i++) {
+    if (shape[i] == 0) {
+      qnnp_log_error(
+        "failed to setup transpose operator with size %zu in dimension #%zu: dimension sizes must be non-zero",
+        shape[i], i);
+      return qnnp_status_invalid_parameter;
+    }
+
+    if (perm[i] >= num_dims || used_dims[perm[i]]) {
+      qnnp_log_error(
+        "failed to setup transpose operator with %zu in permutation entry #%zu: "
+        "permutation must list every input dimension exactly once",
+        perm[i], i);
+      return qnnp_status_invalid_parameter;
+    }
+    used_dims[perm[i]] = true;
+  }
+
+  size_t input_stride[QNNP_MAX_TRANSPOSE_DIMS];
+  size_t stride = 1;
+  for (size_t i = num_dims; i != 0; i--) {
+    input_stride[i - 1] = stride;
+    stride *= shape[i - 1];
+  }
+
+  /*
+   * Walk the output dimensions, dropping the ones of size 1 and merging each one into the previous output dimension
+   * when both are laid out contiguously in the input too. This turns, e.g., NHWC to NCHW into a single 3D transpose
+   * of N x (HW) x C, and leaves a 1D copy for identity permutations.
+   */
+  size_t dims = 0;
+  for (size_t i = 0; i < num_dims; i++) {
+    const size_t size = shape[perm[i]];
+    if (size == 1) {
+      continue;
+    }
+
+    const size_t dim_input_stride = input_stride[perm[i]];
+    if (dims != 0 && transpose_op->transpose_input_stride[dims - 1] == dim_input_stride * size) {
+      transpose_op->transpose_shape[dims - 1] *= size;
+      transpose_op->transpose_input_stride[dims - 1] = dim_input_stride;
+    } else {
+      transpose_op->transpose_shape[dims] = size;
+      transpose_op->transpose_input_stride[dims] = dim_input_stride;
+      dims += 1;
+    }
+  }
+  if (dims == 0) {
+    transpose_op->transpose_shape[0] = 1;
+    transpose_op->transpose_input_stride[0] = 1;
+    dims = 1;
+  }
+
+  stride = 1;
+  for (size_t i = dims; i != 0; i--) {
+    transpose_op->transpose_output_stride[i - 1] = stride;
+    stride *= transpose_op->transpose_shape[i - 1];
+  }
+
+  transpose_op->transpose_dims = dims;
+  transpose_op->input = input;
+  transpose_op->output = output;
+
+  return qnnp_status_success;
+}
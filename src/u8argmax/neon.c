@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/u8argmax.h>
+
+
+uint8_t u8argmax_ukernel__neon(
+    size_t n,
+    const uint8_t* x,
+    size_t* index)
+{
+  assert(n != 0);
+
+  if QNNP_LIKELY(n >= 16) {
+    /* First pass finds the maximum value, second pass finds its first position */
+    uint8x16_t vmax = vmovq_n_u8(0);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      vmax = vmaxq_u8(vmax, vld1q_u8(x + i));
+    }
+    if (i != n) {
+      vmax = vmaxq_u8(vmax, vld1q_u8(x + n - 16));
+    }
+    const uint8x8_t vmax8 = vmax_u8(vget_low_u8(vmax), vget_high_u8(vmax));
+    const uint8x8_t vmax4 = vpmax_u8(vmax8, vmax8);
+    const uint8x8_t vmax2 = vpmax_u8(vmax4, vmax4);
+    const uint8x8_t vmax1 = vpmax_u8(vmax2, vmax2);
+    const uint8_t max = vget_lane_u8(vmax1, 0);
+    vmax = vdupq_n_u8(max);
+
+    size_t block_start = n - 16;
+    for (i = 0; i + 16 <= n; i += 16) {
+      const uint8x16_t veq = vceqq_u8(vld1q_u8(x + i), vmax);
+      const uint8x8_t vany = vorr_u8(vget_low_u8(veq), vget_high_u8(veq));
+      if (vget_lane_u64(vreinterpret_u64_u8(vany), 0) != 0) {
+        block_start = i;
+        break;
+      }
+    }
+    /* Elements before position i in the overlapping last block are known to be below the maximum */
+    size_t j = block_start;
+    while (x[j] != max) {
+      j++;
+    }
+    *index = j;
+    return max;
+  } else {
+    uint8_t max = x[0];
+    size_t max_index = 0;
+    for (size_t i = 1; i < n; i++) {
+      if (x[i] > max) {
+        max = x[i];
+        max_index = i;
+      }
+    }
+    *index = max_index;
+    return max;
+  }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/u8argmax.h>
+
+
+uint8_t u8argmax_ukernel__sse2(
+    size_t n,
+    const uint8_t* x,
+    size_t* index)
+{
+  assert(n != 0);
+
+  if QNNP_LIKELY(n >= 16) {
+    /* First pass finds the maximum value, second pass finds its first position */
+    __m128i vmax = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      vmax = _mm_max_epu8(vmax, _mm_loadu_si128((const __m128i*) (x + i)));
+    }
+    if (i != n) {
+      vmax = _mm_max_epu8(vmax, _mm_loadu_si128((const __m128i*) (x + n - 16)));
+    }
+    vmax = _mm_max_epu8(vmax, _mm_unpackhi_epi64(vmax, vmax));
+    vmax = _mm_max_epu8(vmax, _mm_srli_epi64(vmax, 32));
+    vmax = _mm_max_epu8(vmax, _mm_srli_epi32(vmax, 16));
+    vmax = _mm_max_epu8(vmax, _mm_srli_epi16(vmax, 8));
+    const uint8_t max = (uint8_t) _mm_cvtsi128_si32(vmax);
+    vmax = _mm_set1_epi8((char) max);
+
+    for (i = 0; i + 16 <= n; i += 16) {
+      const __m128i vx = _mm_loadu_si128((const __m128i*) (x + i));
+      const uint32_t mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(vx, vmax));
+      if (mask != 0) {
+        *index = i + (size_t) __builtin_ctz(mask);
+        return max;
+      }
+    }
+    /* Elements before position i in the overlapping last block are known to be below the maximum */
+    const __m128i vx = _mm_loadu_si128((const __m128i*) (x + n - 16));
+    const uint32_t mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(vx, vmax));
+    assert(mask != 0);
+    *index = n - 16 + (size_t) __builtin_ctz(mask);
+    return max;
+  } else {
+    uint8_t max = x[0];
+    size_t max_index = 0;
+    for (size_t i = 1; i < n; i++) {
+      if (x[i] > max) {
+        max = x[i];
+        max_index = i;
+      }
+    }
+    *index = max_index;
+    return max;
+  }
+}
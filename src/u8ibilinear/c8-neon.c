@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/u8ibilinear.h>
+
+
+void u8ibilinear_ukernel_c8__neon(
+    size_t n,
+    size_t channels,
+    const uint8_t** input,
+    const int16_t* weights,
+    uint8_t* output,
+    size_t output_increment)
+{
+  assert(n != 0);
+  assert(channels != 0);
+
+  do {
+    const uint8_t* i0 = input[0];
+    const uint8_t* i1 = input[1];
+    const uint8_t* i2 = input[2];
+    const uint8_t* i3 = input[3];
+    input += 4;
+
+    const uint32_t alpha_h = (uint32_t) (uint16_t) weights[0];
+    const uint32_t alpha_v = (uint32_t) (uint16_t) weights[1];
+    weights += 2;
+    const uint16x4_t valpha_h = vdup_n_u16((uint16_t) alpha_h);
+    const uint16x4_t vbeta_h = vdup_n_u16((uint16_t) (2048 - alpha_h));
+    const uint16x4_t valpha_v = vdup_n_u16((uint16_t) alpha_v);
+    const uint16x4_t vbeta_v = vdup_n_u16((uint16_t) (2048 - alpha_v));
+
+    size_t c = channels;
+    for (; c >= 8; c -= 8) {
+      const uint16x8_t vtl = vmovl_u8(vld1_u8(i0)); i0 += 8;
+      const uint16x8_t vtr = vmovl_u8(vld1_u8(i1)); i1 += 8;
+      const uint16x8_t vbl = vmovl_u8(vld1_u8(i2)); i2 += 8;
+      const uint16x8_t vbr = vmovl_u8(vld1_u8(i3)); i3 += 8;
+
+      /* Horizontal interpolation in Q11, rounded to Q7 to keep the vertical products within 32 bits */
+      const uint16x8_t vt = vcombine_u16(
+        vrshrn_n_u32(vmlal_u16(vmull_u16(vget_low_u16(vtl), vbeta_h), vget_low_u16(vtr), valpha_h), 4),
+        vrshrn_n_u32(vmlal_u16(vmull_u16(vget_high_u16(vtl), vbeta_h), vget_high_u16(vtr), valpha_h), 4));
+      const uint16x8_t vb = vcombine_u16(
+        vrshrn_n_u32(vmlal_u16(vmull_u16(vget_low_u16(vbl), vbeta_h), vget_low_u16(vbr), valpha_h), 4),
+        vrshrn_n_u32(vmlal_u16(vmull_u16(vget_high_u16(vbl), vbeta_h), vget_high_u16(vbr), valpha_h), 4));
+
+      const uint32x4_t vacc_lo = vrshrq_n_u32(vmlal_u16(vmull_u16(vget_low_u16(vt), vbeta_v), vget_low_u16(vb), valpha_v), 18);
+      const uint32x4_t vacc_hi = vrshrq_n_u32(vmlal_u16(vmull_u16(vget_high_u16(vt), vbeta_v), vget_high_u16(vb), valpha_v), 18);
+      vst1_u8(output, vqmovn_u16(vcombine_u16(vmovn_u32(vacc_lo), vmovn_u32(vacc_hi))));
+      output += 8;
+    }
+    for (; c != 0; c--) {
+      const uint32_t vt = ((uint32_t) *i0++ * (2048 - alpha_h) + (uint32_t) *i1++ * alpha_h + 8) >> 4;
+      const uint32_t vb = ((uint32_t) *i2++ * (2048 - alpha_h) + (uint32_t) *i3++ * alpha_h + 8) >> 4;
+      *output++ = (uint8_t) ((vt * (2048 - alpha_v) + vb * alpha_v + UINT32_C(0x20000)) >> 18);
+    }
+    output = (uint8_t*) ((uintptr_t) output + output_increment);
+  } while (--n != 0);
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/u8ibilinear.h>
+
+
+/* Loads the last c < 8 elements of a pixel without reading past its end */
+static inline __m128i load_partial(const uint8_t* i, size_t c)
+{
+  i += c;
+  __m128i vi = _mm_setzero_si128();
+  if (c & 1) {
+    i -= 1;
+    vi = _mm_cvtsi32_si128(*i);
+  }
+  if (c & 2) {
+    vi = _mm_slli_epi32(vi, 16);
+    i -= 2;
+    vi = _mm_insert_epi16(vi, *((const uint16_t*) i), 0);
+  }
+  if (c & 4) {
+    i -= 4;
+    vi = _mm_unpacklo_epi32(_mm_cvtsi32_si128((int) *((const uint32_t*) i)), vi);
+  }
+  return vi;
+}
+
+/*
+ * Horizontal interpolation of 8 elements produces Q11 values of at most 19 bits; they are rounded to Q7 so that the
+ * vertical interpolation again fits a 16-bit multiply-add.
+ */
+static inline __m128i interpolate(
+    __m128i vtl,
+    __m128i vtr,
+    __m128i vbl,
+    __m128i vbr,
+    __m128i valpha_h,
+    __m128i valpha_v)
+{
+  const __m128i vzero = _mm_setzero_si128();
+  const __m128i vrounding_h = _mm_set1_epi32(INT32_C(0x8));
+  const __m128i vrounding_v = _mm_set1_epi32(INT32_C(0x20000));
+
+  vtl = _mm_unpacklo_epi8(vtl, vzero);
+  vtr = _mm_unpacklo_epi8(vtr, vzero);
+  vbl = _mm_unpacklo_epi8(vbl, vzero);
+  vbr = _mm_unpacklo_epi8(vbr, vzero);
+
+  const __m128i vt_lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(vtl, vtr), valpha_h), vrounding_h), 4);
+  const __m128i vt_hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(vtl, vtr), valpha_h), vrounding_h), 4);
+  const __m128i vb_lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(vbl, vbr), valpha_h), vrounding_h), 4);
+  const __m128i vb_hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(vbl, vbr), valpha_h), vrounding_h), 4);
+  const __m128i vt = _mm_packs_epi32(vt_lo, vt_hi);
+  const __m128i vb = _mm_packs_epi32(vb_lo, vb_hi);
+
+  const __m128i vacc_lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(vt, vb), valpha_v), vrounding_v), 18);
+  const __m128i vacc_hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(vt, vb), valpha_v), vrounding_v), 18);
+  const __m128i vacc = _mm_packs_epi32(vacc_lo, vacc_hi);
+  return _mm_packus_epi16(vacc, vacc);
+}
+
+void u8ibilinear_ukernel_c8__sse2(
+    size_t n,
+    size_t channels,
+    const uint8_t** input,
+    const int16_t* weights,
+    uint8_t* output,
+    size_t output_increment)
+{
+  assert(n != 0);
+  assert(channels != 0);
+
+  do {
+    const uint8_t* i0 = input[0];
+    const uint8_t* i1 = input[1];
+    const uint8_t* i2 = input[2];
+    const uint8_t* i3 = input[3];
+    input += 4;
+
+    /* Each 32-bit lane holds the pair of weights (1 - alpha, alpha) for the multiply-add */
+    const uint32_t alpha_h = (uint32_t) (uint16_t) weights[0];
+    const uint32_t alpha_v = (uint32_t) (uint16_t) weights[1];
+    weights += 2;
+    const __m128i valpha_h = _mm_set1_epi32((int) ((alpha_h << 16) | (UINT32_C(2048) - alpha_h)));
+    const __m128i valpha_v = _mm_set1_epi32((int) ((alpha_v << 16) | (UINT32_C(2048) - alpha_v)));
+
+    size_t c = channels;
+    for (; c >= 8; c -= 8) {
+      const __m128i vtl = _mm_loadl_epi64((const __m128i*) i0);
+      i0 += 8;
+      const __m128i vtr = _mm_loadl_epi64((const __m128i*) i1);
+      i1 += 8;
+      const __m128i vbl = _mm_loadl_epi64((const __m128i*) i2);
+      i2 += 8;
+      const __m128i vbr = _mm_loadl_epi64((const __m128i*) i3);
+      i3 += 8;
+
+      const __m128i vout = interpolate(vtl, vtr, vbl, vbr, valpha_h, valpha_v);
+      _mm_storel_epi64((__m128i*) output, vout);
+      output += 8;
+    }
+    if (c != 0) {
+      const __m128i vtl = load_partial(i0, c);
+      const __m128i vtr = load_partial(i1, c);
+      const __m128i vbl = load_partial(i2, c);
+      const __m128i vbr = load_partial(i3, c);
+
+      __m128i vout = interpolate(vtl, vtr, vbl, vbr, valpha_h, valpha_v);
+      if (c & 4) {
+        *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout);
+        output += 4;
+        vout = _mm_srli_epi64(vout, 32);
+      }
+      if (c & 2) {
+        *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout, 0);
+        output += 2;
+        vout = _mm_srli_epi32(vout, 16);
+      }
+      if (c & 1) {
+        *((uint8_t*) output) = (uint8_t) _mm_cvtsi128_si32(vout);
+        output += 1;
+      }
+    }
+    output = (uint8_t*) ((uintptr_t) output + output_increment);
+  } while (--n != 0);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <arm_neon.h>
+
+#include <qnnpack/math.h>
+#include <qnnpack/x8transpose.h>
+
+
+void x8transpose_ukernel_8x8__neon(
+    size_t rows,
+    size_t columns,
+    const uint8_t* x,
+    size_t x_stride,
+    uint8_t* y,
+    size_t y_stride)
+{
+  if (rows >= 8 && columns >= 8) {
+    /* The last block in each direction overlaps the previous one instead of falling back to a scalar remainder */
+    for (size_t r = 0; r < rows; r += 8) {
+      const size_t block_r = min(r, rows - 8);
+      for (size_t c = 0; c < columns; c += 8) {
+        const size_t block_c = min(c, columns - 8);
+        const uint8_t* i = x + block_r * x_stride + block_c;
+        uint8_t* o = y + block_c * y_stride + block_r;
+
+        const uint8x8_t vx0 = vld1_u8(i); i += x_stride;
+        const uint8x8_t vx1 = vld1_u8(i); i += x_stride;
+        const uint8x8_t vx2 = vld1_u8(i); i += x_stride;
+        const uint8x8_t vx3 = vld1_u8(i); i += x_stride;
+        const uint8x8_t vx4 = vld1_u8(i); i += x_stride;
+        const uint8x8_t vx5 = vld1_u8(i); i += x_stride;
+        const uint8x8_t vx6 = vld1_u8(i); i += x_stride;
+        const uint8x8_t vx7 = vld1_u8(i);
+
+        /* Transpose 2x2 blocks of bytes, then of 16-bit pairs, then of 32-bit quads */
+        const uint8x8x2_t vx01 = vtrn_u8(vx0, vx1);
+        const uint8x8x2_t vx23 = vtrn_u8(vx2, vx3);
+        const uint8x8x2_t vx45 = vtrn_u8(vx4, vx5);
+        const uint8x8x2_t vx67 = vtrn_u8(vx6, vx7);
+
+        const uint16x4x2_t vx02 = vtrn_u16(vreinterpret_u16_u8(vx01.val[0]), vreinterpret_u16_u8(vx23.val[0]));
+        const uint16x4x2_t vx13 = vtrn_u16(vreinterpret_u16_u8(vx01.val[1]), vreinterpret_u16_u8(vx23.val[1]));
+        const uint16x4x2_t vx46 = vtrn_u16(vreinterpret_u16_u8(vx45.val[0]), vreinterpret_u16_u8(vx67.val[0]));
+        const uint16x4x2_t vx57 = vtrn_u16(vreinterpret_u16_u8(vx45.val[1]), vreinterpret_u16_u8(vx67.val[1]));
+
+        const uint32x2x2_t vy04 = vtrn_u32(vreinterpret_u32_u16(vx02.val[0]), vreinterpret_u32_u16(vx46.val[0]));
+        const uint32x2x2_t vy15 = vtrn_u32(vreinterpret_u32_u16(vx13.val[0]), vreinterpret_u32_u16(vx57.val[0]));
+        const uint32x2x2_t vy26 = vtrn_u32(vreinterpret_u32_u16(vx02.val[1]), vreinterpret_u32_u16(vx46.val[1]));
+        const uint32x2x2_t vy37 = vtrn_u32(vreinterpret_u32_u16(vx13.val[1]), vreinterpret_u32_u16(vx57.val[1]));
+
+        vst1_u8(o, vreinterpret_u8_u32(vy04.val[0])); o += y_stride;
+        vst1_u8(o, vreinterpret_u8_u32(vy15.val[0])); o += y_stride;
+        vst1_u8(o, vreinterpret_u8_u32(vy26.val[0])); o += y_stride;
+        vst1_u8(o, vreinterpret_u8_u32(vy37.val[0])); o += y_stride;
+        vst1_u8(o, vreinterpret_u8_u32(vy04.val[1])); o += y_stride;
+        vst1_u8(o, vreinterpret_u8_u32(vy15.val[1])); o += y_stride;
+        vst1_u8(o, vreinterpret_u8_u32(vy26.val[1])); o += y_stride;
+        vst1_u8(o, vreinterpret_u8_u32(vy37.val[1]));
+      }
+    }
+  } else {
+    for (size_t r = 0; r < rows; r++) {
+      for (size_t c = 0; c < columns; c++) {
+        y[c * y_stride + r] = x[r * x_stride + c];
+      }
+    }
+  }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <emmintrin.h>
+
+#include <qnnpack/math.h>
+#include <qnnpack/x8transpose.h>
+
+
+void x8transpose_ukernel_8x8__sse2(
+    size_t rows,
+    size_t columns,
+    const uint8_t* x,
+    size_t x_stride,
+    uint8_t* y,
+    size_t y_stride)
+{
+  if (rows >= 8 && columns >= 8) {
+    /* The last block in each direction overlaps the previous one instead of falling back to a scalar remainder */
+    for (size_t r = 0; r < rows; r += 8) {
+      const size_t block_r = min(r, rows - 8);
+      for (size_t c = 0; c < columns; c += 8) {
+        const size_t block_c = min(c, columns - 8);
+        const uint8_t* i = x + block_r * x_stride + block_c;
+        uint8_t* o = y + block_c * y_stride + block_r;
+
+        const __m128i vx0 = _mm_loadl_epi64((const __m128i*) i); i += x_stride;
+        const __m128i vx1 = _mm_loadl_epi64((const __m128i*) i); i += x_stride;
+        const __m128i vx2 = _mm_loadl_epi64((const __m128i*) i); i += x_stride;
+        const __m128i vx3 = _mm_loadl_epi64((const __m128i*) i); i += x_stride;
+        const __m128i vx4 = _mm_loadl_epi64((const __m128i*) i); i += x_stride;
+        const __m128i vx5 = _mm_loadl_epi64((const __m128i*) i); i += x_stride;
+        const __m128i vx6 = _mm_loadl_epi64((const __m128i*) i); i += x_stride;
+        const __m128i vx7 = _mm_loadl_epi64((const __m128i*) i);
+
+        /* Pairs of rows, then quads of rows, then all eight rows of every column */
+        const __m128i vx01 = _mm_unpacklo_epi8(vx0, vx1);
+        const __m128i vx23 = _mm_unpacklo_epi8(vx2, vx3);
+        const __m128i vx45 = _mm_unpacklo_epi8(vx4, vx5);
+        const __m128i vx67 = _mm_unpacklo_epi8(vx6, vx7);
+
+        const __m128i vx0123_lo = _mm_unpacklo_epi16(vx01, vx23);
+        const __m128i vx0123_hi = _mm_unpackhi_epi16(vx01, vx23);
+        const __m128i vx4567_lo = _mm_unpacklo_epi16(vx45, vx67);
+        const __m128i vx4567_hi = _mm_unpackhi_epi16(vx45, vx67);
+
+        const __m128i vy01 = _mm_unpacklo_epi32(vx0123_lo, vx4567_lo);
+        const __m128i vy23 = _mm_unpackhi_epi32(vx0123_lo, vx4567_lo);
+        const __m128i vy45 = _mm_unpacklo_epi32(vx0123_hi, vx4567_hi);
+        const __m128i vy67 = _mm_unpackhi_epi32(vx0123_hi, vx4567_hi);
+
+        _mm_storel_epi64((__m128i*) o, vy01); o += y_stride;
+        _mm_storel_epi64((__m128i*) o, _mm_unpackhi_epi64(vy01, vy01)); o += y_stride;
+        _mm_storel_epi64((__m128i*) o, vy23); o += y_stride;
+        _mm_storel_epi64((__m128i*) o, _mm_unpackhi_epi64(vy23, vy23)); o += y_stride;
+        _mm_storel_epi64((__m128i*) o, vy45); o += y_stride;
+        _mm_storel_epi64((__m128i*) o, _mm_unpackhi_epi64(vy45, vy45)); o += y_stride;
+        _mm_storel_epi64((__m128i*) o, vy67); o += y_stride;
+        _mm_storel_epi64((__m128i*) o, _mm_unpackhi_epi64(vy67, vy67));
+      }
+    }
+  } else {
+    for (size_t r = 0; r < rows; r++) {
+      for (size_t c = 0; c < columns; c++) {
+        y[c * y_stride + r] = x[r * x_stride + c];
+      }
+    }
+  }
+}
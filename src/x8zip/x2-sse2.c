@@ -43,6 +43,15 @@ void qnnp_x8zip_x2__sse2(
       _mm_storeu_si128((__m128i*) o, vxy_lo);
       _mm_storeu_si128((__m128i*) o + 1, vxy_hi);
     }
+  } else if (n >= 8) {
+    /* Two overlapping 8-element halves cover all elements */
+    const size_t address_increment = n - 8;
+    const __m128i vx0 = _mm_loadl_epi64((const __m128i*) x);
+    const __m128i vy0 = _mm_loadl_epi64((const __m128i*) y);
+    const __m128i vx1 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) x + address_increment));
+    const __m128i vy1 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) y + address_increment));
+    _mm_storeu_si128((__m128i*) o, _mm_unpacklo_epi8(vx0, vy0));
+    _mm_storeu_si128((__m128i*) ((uintptr_t) o + address_increment * 2), _mm_unpacklo_epi8(vx1, vy1));
   } else {
     do {
       const uint8_t vx = *x++;
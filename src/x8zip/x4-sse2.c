@@ -67,6 +67,26 @@ void qnnp_x8zip_x4__sse2(
       _mm_storeu_si128((__m128i*) o + 2, vxyzw2);
       _mm_storeu_si128((__m128i*) o + 3, vxyzw3);
     }
+  } else if (n >= 8) {
+    /* Two overlapping 8-element halves cover all elements */
+    const size_t address_increment = n - 8;
+    const __m128i vx0 = _mm_loadl_epi64((const __m128i*) x);
+    const __m128i vy0 = _mm_loadl_epi64((const __m128i*) y);
+    const __m128i vz0 = _mm_loadl_epi64((const __m128i*) z);
+    const __m128i vw0 = _mm_loadl_epi64((const __m128i*) w);
+    const __m128i vx1 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) x + address_increment));
+    const __m128i vy1 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) y + address_increment));
+    const __m128i vz1 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) z + address_increment));
+    const __m128i vw1 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + address_increment));
+    const __m128i vxy0 = _mm_unpacklo_epi8(vx0, vy0);
+    const __m128i vzw0 = _mm_unpacklo_epi8(vz0, vw0);
+    const __m128i vxy1 = _mm_unpacklo_epi8(vx1, vy1);
+    const __m128i vzw1 = _mm_unpacklo_epi8(vz1, vw1);
+    _mm_storeu_si128((__m128i*) o, _mm_unpacklo_epi16(vxy0, vzw0));
+    _mm_storeu_si128((__m128i*) o + 1, _mm_unpackhi_epi16(vxy0, vzw0));
+    o = (void*) ((uintptr_t) o + address_increment * 4);
+    _mm_storeu_si128((__m128i*) o, _mm_unpacklo_epi16(vxy1, vzw1));
+    _mm_storeu_si128((__m128i*) o + 1, _mm_unpackhi_epi16(vxy1, vzw1));
   } else {
     do {
       const uint8_t vx = *x++;
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+/* Tester of the quantized elementwise operators implemented as a lookup table of a float function */
+class ActivationOperatorTester {
+ public:
+  enum class Activation {
+    HardSwish,
+    TanH,
+    GELU,
+    ELU,
+  };
+
+  explicit ActivationOperatorTester(Activation activation) : activation_(activation) {
+    /* Default quantization covers the range where each function is not linear or constant */
+    switch (activation) {
+      case Activation::HardSwish:
+        this->outputScale_ = 0.04f;
+        this->outputZeroPoint_ = 20;
+        this->inputScale_ = 0.05f;
+        break;
+      case Activation::TanH:
+        this->outputScale_ = 1.0f / 128.0f;
+        this->outputZeroPoint_ = 128;
+        this->inputScale_ = 0.02f;
+        break;
+      case Activation::GELU:
+        this->outputScale_ = 0.025f;
+        this->outputZeroPoint_ = 24;
+        this->inputScale_ = 0.03f;
+        break;
+      case Activation::ELU:
+        this->outputScale_ = 0.03f;
+        this->outputZeroPoint_ = 40;
+        this->inputScale_ = 0.04f;
+        break;
+    }
+  }
+
+  inline Activation activation() const {
+    return this->activation_;
+  }
+
+  inline ActivationOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline ActivationOperatorTester& inputStride(size_t inputStride) {
+    assert(inputStride != 0);
+    this->inputStride_ = inputStride;
+    return *this;
+  }
+
+  inline size_t inputStride() const {
+    if (this->inputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->inputStride_ >= this->channels_);
+      return this->inputStride_;
+    }
+  }
+
+  inline ActivationOperatorTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->outputStride_ >= this->channels_);
+      return this->outputStride_;
+    }
+  }
+
+  inline ActivationOperatorTester& batchSize(size_t batchSize) {
+    assert(batchSize != 0);
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline ActivationOperatorTester& alpha(float alpha) {
+    assert(activation() == Activation::ELU);
+    assert(alpha > 0.0f);
+    assert(std::isnormal(alpha));
+    this->alpha_ = alpha;
+    return *this;
+  }
+
+  inline float alpha() const {
+    return this->alpha_;
+  }
+
+  inline ActivationOperatorTester& inputScale(float inputScale) {
+    assert(inputScale > 0.0f);
+    assert(std::isnormal(inputScale));
+    this->inputScale_ = inputScale;
+    return *this;
+  }
+
+  inline float inputScale() const {
+    return this->inputScale_;
+  }
+
+  inline ActivationOperatorTester& inputZeroPoint(uint8_t inputZeroPoint) {
+    this->inputZeroPoint_ = inputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t inputZeroPoint() const {
+    return this->inputZeroPoint_;
+  }
+
+  inline ActivationOperatorTester& outputScale(float outputScale) {
+    assert(outputScale > 0.0f);
+    assert(std::isnormal(outputScale));
+    this->outputScale_ = outputScale;
+    return *this;
+  }
+
+  inline float outputScale() const {
+    return this->outputScale_;
+  }
+
+  inline ActivationOperatorTester& outputZeroPoint(uint8_t outputZeroPoint) {
+    this->outputZeroPoint_ = outputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t outputZeroPoint() const {
+    return this->outputZeroPoint_;
+  }
+
+  inline ActivationOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline ActivationOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline ActivationOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testQ8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() - 1) * inputStride() + channels());
+    std::vector<uint8_t> output((batchSize() - 1) * outputStride() + channels());
+    std::vector<float> outputRef(batchSize() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const float x = inputScale() * (int32_t(input[i * inputStride() + c]) - int32_t(inputZeroPoint()));
+          float y = compute(x) / outputScale();
+          y = std::min<float>(y, int32_t(qmax()) - int32_t(outputZeroPoint()));
+          y = std::max<float>(y, int32_t(qmin()) - int32_t(outputZeroPoint()));
+          outputRef[i * channels() + c] = y + float(int32_t(outputZeroPoint()));
+        }
+      }
+
+      /* Create, setup, run, and destroy the operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t activationOp = nullptr;
+
+      ASSERT_EQ(qnnp_status_success, create(&activationOp));
+      ASSERT_NE(nullptr, activationOp);
+
+      ASSERT_EQ(qnnp_status_success,
+        setup(
+          activationOp,
+          batchSize(),
+          input.data(), inputStride(),
+          output.data(), outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(activationOp, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(activationOp));
+      activationOp = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(float(int32_t(output[i * outputStride() + c])), outputRef[i * channels() + c], 0.6f);
+        }
+      }
+    }
+  }
+
+ private:
+  float compute(float x) const {
+    switch (activation()) {
+      case Activation::HardSwish:
+        return x * std::min<float>(std::max<float>(x + 3.0f, 0.0f), 6.0f) / 6.0f;
+      case Activation::TanH:
+        return std::tanh(x);
+      case Activation::GELU:
+        return 0.5f * x * (1.0f + std::erf(x / std::sqrt(2.0f)));
+      case Activation::ELU:
+        return x < 0.0f ? alpha() * std::expm1(x) : x;
+    }
+    return 0.0f;
+  }
+
+  enum qnnp_status create(qnnp_operator_t* activationOp) const {
+    switch (activation()) {
+      case Activation::HardSwish:
+        return qnnp_create_hardswish_nc_q8(
+          channels(),
+          inputZeroPoint(), inputScale(),
+          outputZeroPoint(), outputScale(),
+          qmin(), qmax(),
+          activationOp);
+      case Activation::TanH:
+        return qnnp_create_tanh_nc_q8(
+          channels(),
+          inputZeroPoint(), inputScale(),
+          outputZeroPoint(), outputScale(),
+          qmin(), qmax(),
+          activationOp);
+      case Activation::GELU:
+        return qnnp_create_gelu_nc_q8(
+          channels(),
+          inputZeroPoint(), inputScale(),
+          outputZeroPoint(), outputScale(),
+          qmin(), qmax(),
+          activationOp);
+      case Activation::ELU:
+        return qnnp_create_elu_nc_q8(
+          channels(),
+          alpha(),
+          inputZeroPoint(), inputScale(),
+          outputZeroPoint(), outputScale(),
+          qmin(), qmax(),
+          activationOp);
+    }
+    return qnnp_status_invalid_parameter;
+  }
+
+  enum qnnp_status setup(
+    qnnp_operator_t activationOp,
+    size_t batchSize,
+    const uint8_t* input,
+    size_t inputStride,
+    uint8_t* output,
+    size_t outputStride) const
+  {
+    switch (activation()) {
+      case Activation::HardSwish:
+        return qnnp_setup_hardswish_nc_q8(activationOp, batchSize, input, inputStride, output, outputStride);
+      case Activation::TanH:
+        return qnnp_setup_tanh_nc_q8(activationOp, batchSize, input, inputStride, output, outputStride);
+      case Activation::GELU:
+        return qnnp_setup_gelu_nc_q8(activationOp, batchSize, input, inputStride, output, outputStride);
+      case Activation::ELU:
+        return qnnp_setup_elu_nc_q8(activationOp, batchSize, input, inputStride, output, outputStride);
+    }
+    return qnnp_status_invalid_parameter;
+  }
+
+  Activation activation_;
+  size_t batchSize_{1};
+  size_t channels_{1};
+  size_t inputStride_{0};
+  size_t outputStride_{0};
+  float alpha_{1.0f};
+  float outputScale_{1.0f};
+  uint8_t outputZeroPoint_{0};
+  float inputScale_{1.0f};
+  uint8_t inputZeroPoint_{121};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{15};
+};
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "top-k-operator-tester.h"
+
+
+TEST(ARGMAX_OP, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    TopKOperatorTester()
+      .batchSize(1)
+      .channels(channels)
+      .testArgMaxU8();
+  }
+}
+
+TEST(ARGMAX_OP, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    TopKOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .testArgMaxU8();
+  }
+}
+
+TEST(ARGMAX_OP, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    TopKOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .inputStride(123)
+      .testArgMaxU8();
+  }
+}
+
+TEST(ARGMAX_OP, ties) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    TopKOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .inputMax(3)
+      .testArgMaxU8();
+  }
+}
+
+TEST(ARGMAX_OP, large_vocabulary) {
+  for (size_t channels = 30000; channels <= 50000; channels += 10000) {
+    TopKOperatorTester()
+      .batchSize(2)
+      .channels(channels)
+      .testArgMaxU8();
+    TopKOperatorTester()
+      .batchSize(2)
+      .channels(channels)
+      .inputMax(200)
+      .testArgMaxU8();
+  }
+}
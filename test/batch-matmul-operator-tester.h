@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class BatchMatMulOperatorTester {
+ public:
+  inline BatchMatMulOperatorTester& batchSize(size_t batchSize) {
+    assert(batchSize != 0);
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline BatchMatMulOperatorTester& m(size_t m) {
+    assert(m != 0);
+    this->m_ = m;
+    return *this;
+  }
+
+  inline size_t m() const {
+    return this->m_;
+  }
+
+  inline BatchMatMulOperatorTester& k(size_t k) {
+    assert(k != 0);
+    this->k_ = k;
+    return *this;
+  }
+
+  inline size_t k() const {
+    return this->k_;
+  }
+
+  inline BatchMatMulOperatorTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline BatchMatMulOperatorTester& transposeB(bool transposeB) {
+    this->transposeB_ = transposeB;
+    return *this;
+  }
+
+  inline bool transposeB() const {
+    return this->transposeB_;
+  }
+
+  inline BatchMatMulOperatorTester& aZeroPoint(uint8_t aZeroPoint) {
+    this->aZeroPoint_ = aZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t aZeroPoint() const {
+    return this->aZeroPoint_;
+  }
+
+  inline BatchMatMulOperatorTester& bZeroPoint(uint8_t bZeroPoint) {
+    this->bZeroPoint_ = bZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t bZeroPoint() const {
+    return this->bZeroPoint_;
+  }
+
+  inline BatchMatMulOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline BatchMatMulOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline BatchMatMulOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testQ8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    /* GEMM micro-kernels may read up to 8 bytes before the A operand */
+    std::vector<uint8_t> a(batchSize() * m() * k() + 8);
+    std::vector<uint8_t> b(batchSize() * k() * n());
+    std::vector<uint8_t> output(batchSize() * m() * n());
+    std::vector<int32_t> accumulators(batchSize() * m() * n());
+
+    const uint8_t* aPtr = a.data() + 8;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(u8rng));
+      std::generate(b.begin(), b.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+      std::fill(accumulators.begin(), accumulators.end(), 0);
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t y = 0; y < m(); y++) {
+          for (size_t x = 0; x < n(); x++) {
+            for (size_t z = 0; z < k(); z++) {
+              const uint8_t bValue = transposeB() ?
+                b[(i * n() + x) * k() + z] : b[(i * k() + z) * n() + x];
+              accumulators[(i * m() + y) * n() + x] +=
+                (int32_t(aPtr[(i * m() + y) * k() + z]) - int32_t(aZeroPoint())) *
+                (int32_t(bValue) - int32_t(bZeroPoint()));
+            }
+          }
+        }
+      }
+      const int32_t accumulatorsMin = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const int32_t accumulatorsMax = *std::max_element(accumulators.cbegin(), accumulators.cend());
+
+      const double outputScale = accumulatorsMax == accumulatorsMin ?
+        1.0 : double(uint32_t(accumulatorsMax - accumulatorsMin)) / 255.0;
+      const uint8_t outputZeroPoint = uint8_t(std::max(std::min(
+        lrint(127.5 - 0.5 * double(accumulatorsMin + accumulatorsMax) / outputScale),
+        long(std::numeric_limits<uint8_t>::max())), long(std::numeric_limits<uint8_t>::min())));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t batchMatMul = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_batch_matmul_q8(
+          aZeroPoint(), 1.0f /* A scale */,
+          bZeroPoint(), 1.0f /* B scale */,
+          outputZeroPoint, float(outputScale), qmin(), qmax(),
+          transposeB() ? QNNP_FLAG_TRANSPOSE_B : 0,
+          &batchMatMul));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_batch_matmul_q8(
+          batchMatMul,
+          batchSize(), m(), k(), n(),
+          aPtr, b.data(), output.data()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(batchMatMul, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(batchMatMul));
+      batchMatMul = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t y = 0; y < m(); y++) {
+          for (size_t x = 0; x < n(); x++) {
+            const size_t index = (i * m() + y) * n() + x;
+            const double scaledAccumulator = accumulators[index] / outputScale;
+            const double clampedAccumulator = std::max(std::min(scaledAccumulator,
+              double(qmax()) - double(outputZeroPoint)),
+              double(qmin()) - double(outputZeroPoint));
+            ASSERT_NEAR(
+              clampedAccumulator,
+              (int32_t(output[index]) - outputZeroPoint),
+              0.9) << "batch index = " << i << ", row = " << y << ", column = " << x;
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  size_t batchSize_{1};
+  size_t m_{1};
+  size_t k_{1};
+  size_t n_{1};
+  bool transposeB_{false};
+  uint8_t aZeroPoint_{127};
+  uint8_t bZeroPoint_{127};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{3};
+};
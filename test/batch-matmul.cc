@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "batch-matmul-operator-tester.h"
+
+#include <qnnpack/params.h>
+
+
+TEST(BATCH_MATMUL_OP, unit_batch) {
+  BatchMatMulOperatorTester()
+    .batchSize(1)
+    .m(13)
+    .k(23)
+    .n(19)
+    .testQ8();
+}
+
+TEST(BATCH_MATMUL_OP, unit_batch_with_transposed_b) {
+  BatchMatMulOperatorTester()
+    .batchSize(1)
+    .m(13)
+    .k(23)
+    .n(19)
+    .transposeB(true)
+    .testQ8();
+}
+
+TEST(BATCH_MATMUL_OP, unit_batch_with_qmin) {
+  BatchMatMulOperatorTester()
+    .batchSize(1)
+    .m(13)
+    .k(23)
+    .n(19)
+    .qmin(128)
+    .testQ8();
+}
+
+TEST(BATCH_MATMUL_OP, unit_batch_with_qmax) {
+  BatchMatMulOperatorTester()
+    .batchSize(1)
+    .m(13)
+    .k(23)
+    .n(19)
+    .qmax(128)
+    .testQ8();
+}
+
+TEST(BATCH_MATMUL_OP, unit_batch_with_zero_points) {
+  BatchMatMulOperatorTester()
+    .batchSize(1)
+    .m(13)
+    .k(23)
+    .n(19)
+    .aZeroPoint(3)
+    .bZeroPoint(250)
+    .testQ8();
+}
+
+TEST(BATCH_MATMUL_OP, small_batch) {
+  for (size_t k = 8; k <= 40; k += 3) {
+    BatchMatMulOperatorTester()
+      .batchSize(5)
+      .m(7)
+      .k(k)
+      .n(11)
+      .testQ8();
+  }
+}
+
+TEST(BATCH_MATMUL_OP, small_batch_with_transposed_b) {
+  for (size_t k = 8; k <= 40; k += 3) {
+    BatchMatMulOperatorTester()
+      .batchSize(5)
+      .m(7)
+      .k(k)
+      .n(11)
+      .transposeB(true)
+      .testQ8();
+  }
+}
+
+TEST(BATCH_MATMUL_OP, small_batch_with_few_columns) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  for (size_t n = 1; n <= qnnp_params.q8conv_narrow.nr; n++) {
+    BatchMatMulOperatorTester()
+      .batchSize(3)
+      .m(17)
+      .k(32)
+      .n(n)
+      .testQ8();
+    BatchMatMulOperatorTester()
+      .batchSize(3)
+      .m(17)
+      .k(32)
+      .n(n)
+      .transposeB(true)
+      .testQ8();
+  }
+}
+
+TEST(BATCH_MATMUL_OP, attention_heads) {
+  /* Scores of 4 heads of 16-dimensional queries against keys, then the context from the values */
+  BatchMatMulOperatorTester()
+    .batchSize(4)
+    .m(33)
+    .k(16)
+    .n(33)
+    .transposeB(true)
+    .testQ8();
+  BatchMatMulOperatorTester()
+    .batchSize(4)
+    .m(33)
+    .k(33)
+    .n(16)
+    .testQ8();
+}
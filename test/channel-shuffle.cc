@@ -258,3 +258,29 @@ TEST(CHANNEL_SHUFFLE_OP, many_groups_small_batch_with_input_and_output_stride) {
     }
   }
 }
+
+TEST(CHANNEL_SHUFFLE_OP, two_groups_large_batch_with_input_and_output_stride) {
+  for (size_t groupChannels = 1; groupChannels < 100; groupChannels += 15) {
+    ChannelShuffleOperatorTester()
+      .batchSize(257)
+      .groups(2)
+      .groupChannels(groupChannels)
+      .inputStride(211)
+      .outputStride(213)
+      .iterations(1)
+      .testX8ChannelShuffle();
+  }
+}
+
+TEST(CHANNEL_SHUFFLE_OP, many_groups_large_batch) {
+  for (size_t groups = 5; groups < 12; groups += 3) {
+    for (size_t groupChannels = 1; groupChannels < 100; groupChannels += 15) {
+      ChannelShuffleOperatorTester()
+        .batchSize(257)
+        .groups(groups)
+        .groupChannels(groupChannels)
+        .iterations(1)
+        .testX8ChannelShuffle();
+    }
+  }
+}
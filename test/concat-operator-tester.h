@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class ConcatOperatorTester {
+ public:
+  inline ConcatOperatorTester& inputChannels(std::vector<size_t> inputChannels) {
+    assert(!inputChannels.empty());
+    this->inputChannels_ = std::move(inputChannels);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& inputChannels() const {
+    return this->inputChannels_;
+  }
+
+  inline size_t inputs() const {
+    return this->inputChannels_.size();
+  }
+
+  inline size_t outputChannels() const {
+    return std::accumulate(inputChannels().cbegin(), inputChannels().cend(), size_t(0));
+  }
+
+  inline ConcatOperatorTester& inputStridePadding(size_t inputStridePadding) {
+    this->inputStridePadding_ = inputStridePadding;
+    return *this;
+  }
+
+  inline size_t inputStridePadding() const {
+    return this->inputStridePadding_;
+  }
+
+  inline size_t inputStride(size_t i) const {
+    return inputChannels()[i] + inputStridePadding();
+  }
+
+  inline ConcatOperatorTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return outputChannels();
+    } else {
+      assert(this->outputStride_ >= outputChannels());
+      return this->outputStride_;
+    }
+  }
+
+  inline ConcatOperatorTester& batchSize(size_t batchSize) {
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  /* Odd-numbered inputs get quantization parameters different from the output */
+  inline ConcatOperatorTester& requantizeInputs(bool requantizeInputs) {
+    this->requantizeInputs_ = requantizeInputs;
+    return *this;
+  }
+
+  inline bool requantizeInputs() const {
+    return this->requantizeInputs_;
+  }
+
+  /* Even-numbered inputs are produced directly in their slices of the output */
+  inline ConcatOperatorTester& bindInputs(bool bindInputs) {
+    this->bindInputs_ = bindInputs;
+    return *this;
+  }
+
+  inline bool bindInputs() const {
+    return this->bindInputs_;
+  }
+
+  inline ConcatOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testQ8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    const uint8_t outputZeroPoint = 128;
+    const float outputScale = 1.0f;
+    std::vector<uint8_t> inputZeroPoints(inputs(), outputZeroPoint);
+    std::vector<float> inputScales(inputs(), outputScale);
+    std::vector<size_t> channelOffsets(inputs());
+    for (size_t i = 0; i < inputs(); i++) {
+      if (requantizeInputs() && i % 2 == 1) {
+        inputZeroPoints[i] = uint8_t(97 + 11 * i);
+        inputScales[i] = 0.375f + 0.5f * float(i % 5);
+      }
+      if (i != 0) {
+        channelOffsets[i] = channelOffsets[i - 1] + inputChannels()[i - 1];
+      }
+    }
+
+    std::vector<std::vector<uint8_t>> inputData(inputs());
+    for (size_t i = 0; i < inputs(); i++) {
+      inputData[i].resize((batchSize() - 1) * inputStride(i) + inputChannels()[i]);
+    }
+    std::vector<uint8_t> output((batchSize() - 1) * outputStride() + outputChannels());
+    std::vector<float> outputRef(batchSize() * outputChannels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::fill(output.begin(), output.end(), 0xA5);
+      std::vector<const uint8_t*> inputPointers(inputs());
+      std::vector<size_t> inputStrides(inputs());
+      for (size_t i = 0; i < inputs(); i++) {
+        const bool bound = bindInputs() && i % 2 == 0;
+        if (bound) {
+          for (size_t n = 0; n < batchSize(); n++) {
+            std::generate_n(output.begin() + n * outputStride() + channelOffsets[i], inputChannels()[i], std::ref(u8rng));
+          }
+          inputPointers[i] = output.data() + channelOffsets[i];
+          inputStrides[i] = outputStride();
+        } else {
+          std::generate(inputData[i].begin(), inputData[i].end(), std::ref(u8rng));
+          inputPointers[i] = inputData[i].data();
+          inputStrides[i] = inputStride(i);
+        }
+      }
+
+      /* Compute reference results */
+      for (size_t i = 0; i < inputs(); i++) {
+        for (size_t n = 0; n < batchSize(); n++) {
+          for (size_t c = 0; c < inputChannels()[i]; c++) {
+            const uint8_t x = inputPointers[i][n * inputStrides[i] + c];
+            float y = float(outputZeroPoint) +
+              float(int32_t(x) - int32_t(inputZeroPoints[i])) * (inputScales[i] / outputScale);
+            y = std::min<float>(std::max<float>(y, 0.0f), 255.0f);
+            outputRef[n * outputChannels() + channelOffsets[i] + c] = y;
+          }
+        }
+      }
+
+      /* Create, setup, run, and destroy Concat operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t concat_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_concat_nc_q8(
+          inputs(), inputChannels().data(),
+          inputZeroPoints.data(), inputScales.data(),
+          outputZeroPoint, outputScale,
+          &concat_op));
+      ASSERT_NE(nullptr, concat_op);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_concat_nc_q8(
+          concat_op,
+          batchSize(),
+          inputPointers.data(), inputStrides.data(),
+          output.data(), outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(concat_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(concat_op));
+      concat_op = nullptr;
+
+      /* Verify results */
+      for (size_t n = 0; n < batchSize(); n++) {
+        for (size_t c = 0; c < outputChannels(); c++) {
+          ASSERT_NEAR(float(int32_t(output[n * outputStride() + c])), outputRef[n * outputChannels() + c], 0.6f) <<
+            "batch index " << n << ", channel " << c;
+        }
+        for (size_t c = outputChannels(); c < (n + 1 == batchSize() ? outputChannels() : outputStride()); c++) {
+          ASSERT_EQ(uint32_t(0xA5), uint32_t(output[n * outputStride() + c])) <<
+            "batch index " << n << ", padding channel " << c;
+        }
+      }
+    }
+  }
+
+ private:
+  std::vector<size_t> inputChannels_{1};
+  size_t inputStridePadding_{0};
+  size_t outputStride_{0};
+  size_t batchSize_{1};
+  bool requantizeInputs_{false};
+  bool bindInputs_{false};
+  size_t iterations_{15};
+};
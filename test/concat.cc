@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "concat-operator-tester.h"
+
+
+TEST(CONCAT_OP, single_input) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConcatOperatorTester()
+      .inputChannels({channels})
+      .batchSize(3)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(CONCAT_OP, two_inputs) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConcatOperatorTester()
+      .inputChannels({channels, 17})
+      .batchSize(3)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(CONCAT_OP, many_inputs) {
+  ConcatOperatorTester()
+    .inputChannels({16, 3, 64, 24, 1, 40})
+    .batchSize(5)
+    .testQ8();
+}
+
+TEST(CONCAT_OP, many_inputs_with_strides) {
+  ConcatOperatorTester()
+    .inputChannels({16, 3, 64, 24, 1, 40})
+    .inputStridePadding(7)
+    .outputStride(163)
+    .batchSize(5)
+    .testQ8();
+}
+
+TEST(CONCAT_OP, large_batch) {
+  ConcatOperatorTester()
+    .inputChannels({5, 3, 11})
+    .batchSize(301)
+    .outputStride(23)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(CONCAT_OP, requantized_inputs) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ConcatOperatorTester()
+      .inputChannels({channels, 17, 9, channels})
+      .requantizeInputs(true)
+      .batchSize(3)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(CONCAT_OP, requantized_inputs_with_strides) {
+  ConcatOperatorTester()
+    .inputChannels({16, 3, 64, 24, 1, 40})
+    .inputStridePadding(7)
+    .outputStride(163)
+    .requantizeInputs(true)
+    .batchSize(5)
+    .testQ8();
+}
+
+TEST(CONCAT_OP, bound_inputs) {
+  ConcatOperatorTester()
+    .inputChannels({16, 3, 64, 24, 1, 40})
+    .outputStride(163)
+    .bindInputs(true)
+    .batchSize(5)
+    .testQ8();
+}
+
+TEST(CONCAT_OP, all_inputs_bound) {
+  ConcatOperatorTester()
+    .inputChannels({16})
+    .outputStride(19)
+    .bindInputs(true)
+    .batchSize(5)
+    .testQ8();
+}
+
+TEST(CONCAT_OP, bound_and_requantized_inputs) {
+  ConcatOperatorTester()
+    .inputChannels({16, 3, 64, 24, 1, 40})
+    .inputStridePadding(5)
+    .outputStride(163)
+    .bindInputs(true)
+    .requantizeInputs(true)
+    .batchSize(5)
+    .testQ8();
+}
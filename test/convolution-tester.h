@@ -17,6 +17,7 @@
 #include <vector>
 
 #include <qnnpack.h>
+#include <qnnpack/operator.h>
 
 
 class ConvolutionTester {
@@ -314,6 +315,43 @@ class ConvolutionTester {
     }
   }
 
+  inline ConvolutionTester& inputShuffleGroups(size_t inputShuffleGroups) {
+    this->inputShuffleGroups_ = inputShuffleGroups;
+    return *this;
+  }
+
+  inline size_t inputShuffleGroups() const {
+    return this->inputShuffleGroups_;
+  }
+
+  /* Output is written into the interior of a buffer with outputBorder() extra pixels around every image */
+  inline ConvolutionTester& outputBorder(size_t outputBorder) {
+    this->outputBorder_ = outputBorder;
+    return *this;
+  }
+
+  inline size_t outputBorder() const {
+    return this->outputBorder_;
+  }
+
+  inline ConvolutionTester& reversedInputChannels(bool reversedInputChannels) {
+    this->reversedInputChannels_ = reversedInputChannels;
+    return *this;
+  }
+
+  inline bool reversedInputChannels() const {
+    return this->reversedInputChannels_;
+  }
+
+  inline ConvolutionTester& tiledGroups(bool tiledGroups) {
+    this->tiledGroups_ = tiledGroups;
+    return *this;
+  }
+
+  inline bool tiledGroups() const {
+    return this->tiledGroups_;
+  }
+
   inline ConvolutionTester& qmin(uint8_t qmin) {
     this->qmin_ = qmin;
     return *this;
@@ -347,16 +385,37 @@ class ConvolutionTester {
     auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
     auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
 
-    std::vector<uint8_t> input(batchSize() * ((inputHeight() * inputWidth() - 1) * inputPixelStride() + groups() * groupInputChannels()) + 8);
+    std::vector<uint8_t> input(8 + (batchSize() * inputHeight() * inputWidth() - 1) * inputPixelStride() + groups() * groupInputChannels());
     std::vector<uint8_t> kernel(groups() * groupOutputChannels() * kernelHeight() * kernelWidth() * groupInputChannels());
     std::vector<int32_t> bias(groups() * groupOutputChannels());
-    std::vector<uint8_t> output(batchSize() * ((outputHeight() * outputWidth() - 1) * outputPixelStride() + groups() * groupOutputChannels()));
+    const size_t outputRowStride = (outputBorder() + outputWidth() + outputBorder()) * outputPixelStride();
+    const size_t outputImageStride = (outputBorder() + outputHeight() + outputBorder()) * outputRowStride;
+    const size_t outputOffset = outputBorder() * (outputRowStride + outputPixelStride());
+    std::vector<uint8_t> output(outputBorder() != 0 ? batchSize() * outputImageStride :
+      (batchSize() * outputHeight() * outputWidth() - 1) * outputPixelStride() + groups() * groupOutputChannels());
     std::vector<int32_t> accumulators(batchSize() * outputHeight() * outputWidth() * groups() * groupOutputChannels());
 
     const uint8_t* inputPtr = input.data() + 8;
     const uint8_t inputZeroPoint = 127;
     const uint8_t kernelZeroPoint = 127;
 
+    std::vector<size_t> inputChannelPermutation(groups() * groupInputChannels());
+    for (size_t c = 0; c < inputChannelPermutation.size(); c++) {
+      inputChannelPermutation[c] = c;
+    }
+    if (inputShuffleGroups() != 0) {
+      const size_t shuffleGroupChannels = inputChannelPermutation.size() / inputShuffleGroups();
+      for (size_t g = 0; g < inputShuffleGroups(); g++) {
+        for (size_t c = 0; c < shuffleGroupChannels; c++) {
+          inputChannelPermutation[c * inputShuffleGroups() + g] = g * shuffleGroupChannels + c;
+        }
+      }
+    }
+    if (reversedInputChannels()) {
+      std::reverse(inputChannelPermutation.begin(), inputChannelPermutation.end());
+    }
+    const bool permutedInputChannels = inputShuffleGroups() != 0 || reversedInputChannels();
+
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::generate(input.begin(), input.end(), std::ref(u8rng));
       std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
@@ -389,7 +448,7 @@ class ConvolutionTester {
                       for (size_t oc = 0; oc < groupOutputChannels(); oc++) {
                         for (size_t ic = 0; ic < groupInputChannels(); ic++) {
                           accumulators[(((i * outputHeight() + oy) * outputWidth() + ox) * groups() + g) * groupOutputChannels() + oc] +=
-                            (int32_t(inputPtr[((i * inputHeight() + iy) * inputWidth() + ix) * inputPixelStride() + g * groupInputChannels() + ic]) - int32_t(inputZeroPoint)) *
+                            (int32_t(inputPtr[((i * inputHeight() + iy) * inputWidth() + ix) * inputPixelStride() + inputChannelPermutation[g * groupInputChannels() + ic]]) - int32_t(inputZeroPoint)) *
                             (int32_t(kernel[(((g * groupOutputChannels() + oc) * kernelHeight() + ky) * kernelWidth() + kx) * groupInputChannels() + ic]) - int32_t(kernelZeroPoint));
                         }
                       }
@@ -413,18 +472,46 @@ class ConvolutionTester {
       qnnp_operator_t convolution = nullptr;
 
 
-      ASSERT_EQ(qnnp_status_success,
-        qnnp_create_convolution2d_nhwc_q8(
-          paddingTop(), paddingRight(), paddingBottom(), paddingLeft(),
-          kernelHeight(), kernelWidth(),
-          subsamplingHeight(), subsamplingWidth(),
-          dilationHeight(), dilationWidth(),
-          groups(), groupInputChannels(), groupOutputChannels(),
-          inputZeroPoint, 1.0f /* input scale */,
-          kernelZeroPoint, 1.0f /* kernel scale */,
-          kernel.data(), bias.data(),
-          outputZeroPoint, outputScale, qmin(), qmax(),
-          &convolution));
+      if (permutedInputChannels) {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_create_permuted_convolution2d_nhwc_q8(
+            paddingTop(), paddingRight(), paddingBottom(), paddingLeft(),
+            kernelHeight(), kernelWidth(),
+            subsamplingHeight(), subsamplingWidth(),
+            dilationHeight(), dilationWidth(),
+            groups(), groupInputChannels(), groupOutputChannels(),
+            inputChannelPermutation.data(),
+            inputZeroPoint, 1.0f /* input scale */,
+            kernelZeroPoint, 1.0f /* kernel scale */,
+            kernel.data(), bias.data(),
+            outputZeroPoint, outputScale, qmin(), qmax(),
+            &convolution));
+      } else {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_create_convolution2d_nhwc_q8(
+            paddingTop(), paddingRight(), paddingBottom(), paddingLeft(),
+            kernelHeight(), kernelWidth(),
+            subsamplingHeight(), subsamplingWidth(),
+            dilationHeight(), dilationWidth(),
+            groups(), groupInputChannels(), groupOutputChannels(),
+            inputZeroPoint, 1.0f /* input scale */,
+            kernelZeroPoint, 1.0f /* kernel scale */,
+            kernel.data(), bias.data(),
+            outputZeroPoint, outputScale, qmin(), qmax(),
+            &convolution));
+      }
+
+      if (tiledGroups()) {
+        /* Several groups are computed for every block of output pixels */
+        ASSERT_GT(convolution->group_tile, 1);
+      }
+      if (convolution->input_channel_offsets != nullptr) {
+        /* Folded permutations pad the reduction over input channels by at most an eighth */
+        const size_t kr = convolution->q8conv_params->kr;
+        const size_t paddedGroupInputChannels = (groupInputChannels() + kr - 1) / kr * kr;
+        ASSERT_LE(convolution->input_channel_runs * convolution->group_input_channels * 8,
+          paddedGroupInputChannels * 8 + groupInputChannels());
+      }
 
       ASSERT_EQ(qnnp_status_success,
         qnnp_setup_convolution2d_nhwc_q8(
@@ -434,10 +521,15 @@ class ConvolutionTester {
           inputWidth(),
           inputPtr,
           inputPixelStride(),
-          output.data(),
+          output.data() + outputOffset,
           outputPixelStride(),
           nullptr /* thread pool */));
 
+      if (outputBorder() != 0) {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_set_output_row_stride(convolution, outputRowStride, outputImageStride));
+      }
+
       ASSERT_EQ(qnnp_status_success,
         qnnp_run_operator(convolution, nullptr /* thread pool */));
 
@@ -457,13 +549,30 @@ class ConvolutionTester {
                   double(qmin()) - double(outputZeroPoint));
                 ASSERT_NEAR(
                   clampedAccumulator,
-                  (int32_t(output[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + g * groupOutputChannels() + c]) - outputZeroPoint),
+                  (int32_t(output[outputOffset + i * outputImageStride + y * outputRowStride + x * outputPixelStride() + g * groupOutputChannels() + c]) - outputZeroPoint),
                   0.9) << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
               }
             }
           }
         }
       }
+
+      if (outputBorder() != 0) {
+        /* Pixels around the output are left untouched */
+        for (size_t i = 0; i < batchSize(); i++) {
+          for (size_t y = 0; y < outputBorder() + outputHeight() + outputBorder(); y++) {
+            for (size_t x = 0; x < outputBorder() + outputWidth() + outputBorder(); x++) {
+              if (y - outputBorder() < outputHeight() && x - outputBorder() < outputWidth()) {
+                continue;
+              }
+              for (size_t c = 0; c < outputPixelStride(); c++) {
+                ASSERT_EQ(0xA5, uint32_t(output[i * outputImageStride + y * outputRowStride + x * outputPixelStride() + c]))
+                  << "(x, y) = (" << x << ", " << y << "), channel = " << c;
+              }
+            }
+          }
+        }
+      }
     }
   }
 
@@ -486,6 +595,10 @@ class ConvolutionTester {
   uint32_t dilationWidth_{1};
   uint32_t subsamplingHeight_{1};
   uint32_t subsamplingWidth_{1};
+  size_t inputShuffleGroups_{0};
+  bool reversedInputChannels_{false};
+  size_t outputBorder_{0};
+  bool tiledGroups_{false};
   uint8_t qmin_{0};
   uint8_t qmax_{255};
   size_t iterations_{1};
@@ -333,238 +333,1427 @@ TEST(CONVOLUTION, 3x3_with_batch) {
     .test();
 }
 
+TEST(CONVOLUTION, 3x3_with_large_padding) {
+  ConvolutionTester()
+    .inputSize(6, 7)
+    .padding(3)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3_with_asymmetric_padding) {
+  ConvolutionTester()
+    .inputSize(13, 12)
+    .paddingTop(2)
+    .paddingRight(3)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 5x5_with_input_smaller_than_kernel) {
+  ConvolutionTester()
+    .inputSize(3, 4)
+    .padding(2)
+    .kernelSize(5, 5)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 1x1_with_padding) {
+  ConvolutionTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(1, 1)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2_with_odd_padding) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .paddingTop(1)
+    .paddingBottom(2)
+    .paddingRight(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3d2_with_padding_and_input_stride) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .padding(2)
+    .kernelSize(3, 3)
+    .dilation(2)
+    .inputPixelStride(23)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_batch_and_output_stride) {
+  ConvolutionTester()
+    .batchSize(3)
+    .inputSize(10, 9)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(2)
+    .outputPixelStride(41)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, winograd_3x3) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8winograd.cthreshold != SIZE_MAX) {
+    ConvolutionTester()
+      .inputSize(13, 12)
+      .padding(1)
+      .kernelSize(3, 3)
+      .groupInputChannels(qnnp_params.q8winograd.cthreshold + 3)
+      .groupOutputChannels(qnnp_params.q8winograd.cthreshold + 5)
+      .iterations(3)
+      .test();
+  }
+}
+
+TEST(CONVOLUTION, winograd_3x3_without_padding) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8winograd.cthreshold != SIZE_MAX) {
+    ConvolutionTester()
+      .inputSize(13, 12)
+      .kernelSize(3, 3)
+      .groupInputChannels(qnnp_params.q8winograd.cthreshold + 3)
+      .groupOutputChannels(qnnp_params.q8winograd.cthreshold + 5)
+      .iterations(3)
+      .test();
+  }
+}
+
+TEST(CONVOLUTION, winograd_3x3_with_left_padding) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8winograd.cthreshold != SIZE_MAX) {
+    ConvolutionTester()
+      .inputSize(13, 12)
+      .paddingLeft(1)
+      .kernelSize(3, 3)
+      .groupInputChannels(qnnp_params.q8winograd.cthreshold + 3)
+      .groupOutputChannels(qnnp_params.q8winograd.cthreshold + 5)
+      .iterations(3)
+      .test();
+  }
+}
+
+TEST(CONVOLUTION, winograd_3x3_with_bottom_padding) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8winograd.cthreshold != SIZE_MAX) {
+    ConvolutionTester()
+      .inputSize(13, 12)
+      .paddingBottom(1)
+      .kernelSize(3, 3)
+      .groupInputChannels(qnnp_params.q8winograd.cthreshold + 3)
+      .groupOutputChannels(qnnp_params.q8winograd.cthreshold + 5)
+      .iterations(3)
+      .test();
+  }
+}
+
+TEST(CONVOLUTION, winograd_3x3_with_qmin) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8winograd.cthreshold != SIZE_MAX) {
+    ConvolutionTester()
+      .inputSize(13, 12)
+      .padding(1)
+      .kernelSize(3, 3)
+      .qmin(128)
+      .groupInputChannels(qnnp_params.q8winograd.cthreshold + 3)
+      .groupOutputChannels(qnnp_params.q8winograd.cthreshold + 5)
+      .iterations(3)
+      .test();
+  }
+}
+
+TEST(CONVOLUTION, winograd_3x3_with_qmax) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8winograd.cthreshold != SIZE_MAX) {
+    ConvolutionTester()
+      .inputSize(13, 12)
+      .padding(1)
+      .kernelSize(3, 3)
+      .qmax(128)
+      .groupInputChannels(qnnp_params.q8winograd.cthreshold + 3)
+      .groupOutputChannels(qnnp_params.q8winograd.cthreshold + 5)
+      .iterations(3)
+      .test();
+  }
+}
+
+TEST(CONVOLUTION, winograd_3x3_with_input_stride) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8winograd.cthreshold != SIZE_MAX) {
+    ConvolutionTester()
+      .inputSize(13, 12)
+      .padding(1)
+      .kernelSize(3, 3)
+      .inputPixelStride(qnnp_params.q8winograd.cthreshold + 7)
+      .groupInputChannels(qnnp_params.q8winograd.cthreshold + 3)
+      .groupOutputChannels(qnnp_params.q8winograd.cthreshold + 5)
+      .iterations(3)
+      .test();
+  }
+}
+
+TEST(CONVOLUTION, winograd_3x3_with_output_stride) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8winograd.cthreshold != SIZE_MAX) {
+    ConvolutionTester()
+      .inputSize(13, 12)
+      .padding(1)
+      .kernelSize(3, 3)
+      .outputPixelStride(qnnp_params.q8winograd.cthreshold + 9)
+      .groupInputChannels(qnnp_params.q8winograd.cthreshold + 3)
+      .groupOutputChannels(qnnp_params.q8winograd.cthreshold + 5)
+      .iterations(3)
+      .test();
+  }
+}
+
+TEST(CONVOLUTION, winograd_3x3_with_batch) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8winograd.cthreshold != SIZE_MAX) {
+    ConvolutionTester()
+      .inputSize(10, 9)
+      .padding(1)
+      .kernelSize(3, 3)
+      .batchSize(3)
+      .groupInputChannels(qnnp_params.q8winograd.cthreshold + 3)
+      .groupOutputChannels(qnnp_params.q8winograd.cthreshold + 5)
+      .iterations(3)
+      .test();
+  }
+}
+
+TEST(CONVOLUTION, 3x3s2_with_3_input_channels) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2_with_3_input_channels_without_padding) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2_with_3_input_channels_with_left_padding) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .paddingLeft(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2_with_3_input_channels_with_right_padding) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .paddingRight(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2_with_3_input_channels_with_input_stride) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .inputPixelStride(5)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2_with_3_input_channels_with_output_stride) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .groupOutputChannels(17)
+    .outputPixelStride(23)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2_with_3_input_channels_with_batch) {
+  ConvolutionTester()
+    .inputSize(17, 15)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .groupOutputChannels(17)
+    .batchSize(3)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2_with_3_input_channels_with_qmin) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .groupOutputChannels(17)
+    .qmin(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2_with_3_input_channels_with_qmax) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .groupOutputChannels(17)
+    .qmax(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 7x7s2_with_3_input_channels) {
+  ConvolutionTester()
+    .inputSize(31, 33)
+    .padding(3)
+    .kernelSize(7, 7)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 5x5s1x2_with_2_input_channels) {
+  ConvolutionTester()
+    .inputSize(19, 18)
+    .padding(2)
+    .kernelSize(5, 5)
+    .subsampling(1, 2)
+    .dilationHeight(2)
+    .groupInputChannels(2)
+    .groupOutputChannels(11)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 1x1_with_1_output_channel) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .kernelSize(1, 1)
+    .groupInputChannels(23)
+    .groupOutputChannels(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 1x1_with_2_output_channels) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .kernelSize(1, 1)
+    .groupInputChannels(23)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3_with_1_output_channel) {
+  ConvolutionTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3_with_2_output_channels) {
+  ConvolutionTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3_with_2_output_channels_with_qmin) {
+  ConvolutionTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(2)
+    .qmin(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3_with_2_output_channels_with_qmax) {
+  ConvolutionTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(2)
+    .qmax(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3_with_2_output_channels_with_output_stride) {
+  ConvolutionTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .outputPixelStride(5)
+    .groupInputChannels(15)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3_with_2_output_channels_with_batch) {
+  ConvolutionTester()
+    .inputSize(10, 9)
+    .padding(1)
+    .kernelSize(3, 3)
+    .batchSize(3)
+    .groupInputChannels(15)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_2_output_channels) {
+  ConvolutionTester()
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(2)
+    .groupInputChannels(14)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2_with_3_input_channels_and_2_output_channels) {
+  ConvolutionTester()
+    .inputSize(27, 29)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(3)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
 TEST(CONVOLUTION, grouped_3x3) {
   ConvolutionTester()
-    .inputSize(10, 11)
-    .padding(1)
-    .kernelSize(3, 3)
-    .groups(2)
-    .groupInputChannels(14)
-    .groupOutputChannels(13)
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(2)
+    .groupInputChannels(14)
+    .groupOutputChannels(13)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_1x1_with_small_groups) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groups(8)
+    .groupInputChannels(2)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_1x1_with_single_channel_groups) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groups(12)
+    .groupInputChannels(1)
+    .groupOutputChannels(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_1x1_with_small_groups_with_batch) {
+  ConvolutionTester()
+    .batchSize(3)
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groups(8)
+    .groupInputChannels(2)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_1x1_with_shufflenet_groups) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groups(8)
+    .groupInputChannels(3)
+    .groupOutputChannels(11)
+    .tiledGroups(true)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_1x1_with_shufflenet_groups_with_batch) {
+  ConvolutionTester()
+    .batchSize(3)
+    .inputSize(5, 7)
+    .kernelSize(1, 1)
+    .groups(8)
+    .groupInputChannels(12)
+    .groupOutputChannels(48)
+    .tiledGroups(true)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_1x1_with_shufflenet_groups_with_output_stride) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groups(3)
+    .groupInputChannels(20)
+    .groupOutputChannels(80)
+    .outputPixelStride(251)
+    .tiledGroups(true)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_shufflenet_groups_with_batch) {
+  ConvolutionTester()
+    .batchSize(3)
+    .inputSize(5, 7)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(8)
+    .groupInputChannels(12)
+    .groupOutputChannels(2)
+    .tiledGroups(true)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_small_groups) {
+  ConvolutionTester()
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(8)
+    .groupInputChannels(2)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_small_groups_with_odd_groups) {
+  ConvolutionTester()
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(9)
+    .groupInputChannels(2)
+    .groupOutputChannels(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3s2_with_small_groups) {
+  ConvolutionTester()
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groups(8)
+    .groupInputChannels(2)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_small_groups_with_qmin) {
+  ConvolutionTester()
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(8)
+    .groupInputChannels(2)
+    .groupOutputChannels(2)
+    .qmin(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_small_groups_with_qmax) {
+  ConvolutionTester()
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(8)
+    .groupInputChannels(2)
+    .groupOutputChannels(2)
+    .qmax(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_small_groups_with_input_stride) {
+  ConvolutionTester()
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(8)
+    .groupInputChannels(2)
+    .groupOutputChannels(2)
+    .inputPixelStride(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_small_groups_with_output_stride) {
+  ConvolutionTester()
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(8)
+    .groupInputChannels(2)
+    .groupOutputChannels(2)
+    .outputPixelStride(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_small_groups_with_batch) {
+  ConvolutionTester()
+    .batchSize(3)
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(8)
+    .groupInputChannels(2)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2) {
+  ConvolutionTester()
+    .inputSize(19, 21)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s1x2) {
+  ConvolutionTester()
+    .inputSize(13, 13)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(1, 2)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3s2x1) {
+  ConvolutionTester()
+    .inputSize(13, 13)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2, 1)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3d2) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .padding(2)
+    .kernelSize(3, 3)
+    .dilation(2)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3d1x2) {
+  ConvolutionTester()
+    .inputSize(14, 15)
+    .padding(1, 2)
+    .kernelSize(3, 3)
+    .dilation(1, 2)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3d2x1) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(2, 1)
+    .kernelSize(3, 3)
+    .dilation(2, 1)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3s2) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3_without_padding) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .kernelSize(3, 3)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3_with_asymmetric_padding) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .paddingTop(0)
+    .paddingRight(2)
+    .paddingBottom(1)
+    .paddingLeft(2)
+    .kernelSize(3, 3)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3_with_few_channels) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(3)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3_with_input_stride) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(27)
+    .inputPixelStride(31)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3_with_batch) {
+  ConvolutionTester()
+    .batchSize(3)
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3_with_narrow_input) {
+  ConvolutionTester()
+    .inputSize(15, 2)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3s2_without_padding) {
+  ConvolutionTester()
+    .inputSize(15, 15)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3s2_with_odd_padded_width) {
+  ConvolutionTester()
+    .inputSize(15, 13)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3s2_with_few_channels) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groups(5)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3s2_with_output_stride) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groups(27)
+    .outputPixelStride(31)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3s1x2) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .subsampling(1, 2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3s2x1) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .subsampling(2, 1)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3d2) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .dilation(2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3d1x2) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .dilation(1, 2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3d2x1) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .dilation(2, 1)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_5x5) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(2, 2)
+    .kernelSize(5, 5)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_5x5s2) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(2, 2)
+    .kernelSize(5, 5)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_5x5s1x2) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(2, 2)
+    .kernelSize(5, 5)
+    .subsampling(1, 2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_5x5s2x1) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(2, 2)
+    .kernelSize(5, 5)
+    .subsampling(2, 1)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_5x5d2) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(2, 2)
+    .kernelSize(5, 5)
+    .dilation(2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_5x5d1x2) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(2, 2)
+    .kernelSize(5, 5)
+    .dilation(1, 2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_5x5d2x1) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(2, 2)
+    .kernelSize(5, 5)
+    .dilation(2, 1)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_1x1) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .kernelSize(1, 1)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x1) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(1, 0)
+    .kernelSize(3, 1)
+    .groups(27)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, 3x3s2) {
+TEST(CONVOLUTION, depthwise_1x7) {
   ConvolutionTester()
-    .inputSize(19, 21)
-    .padding(1)
-    .kernelSize(3, 3)
-    .subsampling(2)
-    .groupInputChannels(27)
-    .groupOutputChannels(19)
+    .inputSize(15, 14)
+    .padding(0, 3)
+    .kernelSize(1, 7)
+    .groups(27)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, 3x3s1x2) {
+TEST(CONVOLUTION, depthwise_1x25) {
   ConvolutionTester()
-    .inputSize(13, 13)
-    .padding(1)
-    .kernelSize(3, 3)
-    .subsampling(1, 2)
-    .groupInputChannels(27)
-    .groupOutputChannels(19)
+    .inputSize(3, 37)
+    .padding(0, 12)
+    .kernelSize(1, 25)
+    .groups(27)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, 3x3s2x1) {
+TEST(CONVOLUTION, depthwise_25x1) {
   ConvolutionTester()
-    .inputSize(13, 13)
-    .padding(1)
-    .kernelSize(3, 3)
-    .subsampling(2, 1)
-    .groupInputChannels(27)
-    .groupOutputChannels(19)
+    .inputSize(37, 3)
+    .padding(12, 0)
+    .kernelSize(25, 1)
+    .groups(27)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, 3x3d2) {
+TEST(CONVOLUTION, depthwise_7x7) {
   ConvolutionTester()
-    .inputSize(13, 14)
-    .padding(2)
-    .kernelSize(3, 3)
-    .dilation(2)
-    .groupInputChannels(27)
-    .groupOutputChannels(19)
+    .inputSize(15, 14)
+    .padding(3, 3)
+    .kernelSize(7, 7)
+    .groups(27)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, 3x3d1x2) {
+TEST(CONVOLUTION, depthwise_7x7s2) {
   ConvolutionTester()
-    .inputSize(14, 15)
-    .padding(1, 2)
-    .kernelSize(3, 3)
-    .dilation(1, 2)
-    .groupInputChannels(27)
-    .groupOutputChannels(19)
+    .inputSize(15, 14)
+    .padding(3, 3)
+    .kernelSize(7, 7)
+    .subsampling(2)
+    .groups(27)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, 3x3d2x1) {
+TEST(CONVOLUTION, depthwise_7x7d2) {
   ConvolutionTester()
     .inputSize(15, 14)
-    .padding(2, 1)
-    .kernelSize(3, 3)
-    .dilation(2, 1)
-    .groupInputChannels(27)
-    .groupOutputChannels(19)
+    .padding(6, 6)
+    .kernelSize(7, 7)
+    .dilation(2)
+    .groups(27)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_3x3) {
+TEST(CONVOLUTION, depthwise_7x7_with_few_channels) {
+  ConvolutionTester()
+    .inputSize(15, 14)
+    .padding(3, 3)
+    .kernelSize(7, 7)
+    .groups(5)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, depthwise_3x3_with_2_channels) {
   ConvolutionTester()
     .inputSize(15, 14)
     .padding(1, 1)
     .kernelSize(3, 3)
-    .groups(27)
+    .groups(2)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_3x3s2) {
+TEST(CONVOLUTION, depthwise_3x3_with_3_channels) {
   ConvolutionTester()
     .inputSize(15, 14)
     .padding(1, 1)
     .kernelSize(3, 3)
-    .subsampling(2)
-    .groups(27)
+    .groups(3)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_3x3s1x2) {
+TEST(CONVOLUTION, depthwise_3x3_with_4_channels) {
   ConvolutionTester()
     .inputSize(15, 14)
     .padding(1, 1)
     .kernelSize(3, 3)
-    .subsampling(1, 2)
-    .groups(27)
+    .groups(4)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_3x3s2x1) {
+TEST(CONVOLUTION, depthwise_3x3s2_with_4_channels) {
   ConvolutionTester()
     .inputSize(15, 14)
     .padding(1, 1)
     .kernelSize(3, 3)
-    .subsampling(2, 1)
-    .groups(27)
+    .subsampling(2)
+    .groups(4)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_3x3d2) {
+TEST(CONVOLUTION, depthwise_3x3_with_2_channels_and_input_stride) {
   ConvolutionTester()
     .inputSize(15, 14)
     .padding(1, 1)
     .kernelSize(3, 3)
-    .dilation(2)
-    .groups(27)
+    .groups(2)
+    .inputPixelStride(5)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_3x3d1x2) {
+TEST(CONVOLUTION, depthwise_3x3_with_3_channels_and_output_stride) {
   ConvolutionTester()
     .inputSize(15, 14)
     .padding(1, 1)
     .kernelSize(3, 3)
-    .dilation(1, 2)
-    .groups(27)
+    .groups(3)
+    .outputPixelStride(7)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_3x3d2x1) {
+TEST(CONVOLUTION, depthwise_3x3_with_4_channels_and_batch) {
   ConvolutionTester()
+    .batchSize(3)
     .inputSize(15, 14)
     .padding(1, 1)
     .kernelSize(3, 3)
-    .dilation(2, 1)
-    .groups(27)
+    .groups(4)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_5x5) {
+TEST(CONVOLUTION, depthwise_3x3d2_with_4_channels) {
   ConvolutionTester()
     .inputSize(15, 14)
     .padding(2, 2)
-    .kernelSize(5, 5)
-    .groups(27)
+    .kernelSize(3, 3)
+    .dilation(2)
+    .groups(4)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_5x5s2) {
+TEST(CONVOLUTION, depthwise_5x5_with_3_channels) {
   ConvolutionTester()
     .inputSize(15, 14)
     .padding(2, 2)
     .kernelSize(5, 5)
-    .subsampling(2)
-    .groups(27)
+    .groups(3)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_5x5s1x2) {
+TEST(CONVOLUTION, depthwise_7x7s2_with_2_channels) {
   ConvolutionTester()
     .inputSize(15, 14)
-    .padding(2, 2)
-    .kernelSize(5, 5)
-    .subsampling(1, 2)
-    .groups(27)
+    .padding(3, 3)
+    .kernelSize(7, 7)
+    .subsampling(2)
+    .groups(2)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_5x5s2x1) {
+TEST(CONVOLUTION, shuffled_1x1) {
   ConvolutionTester()
-    .inputSize(15, 14)
-    .padding(2, 2)
-    .kernelSize(5, 5)
-    .subsampling(2, 1)
-    .groups(27)
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groupInputChannels(24)
+    .groupOutputChannels(19)
+    .inputShuffleGroups(3)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_5x5d2) {
+TEST(CONVOLUTION, shuffled_grouped_1x1) {
   ConvolutionTester()
-    .inputSize(15, 14)
-    .padding(2, 2)
-    .kernelSize(5, 5)
-    .dilation(2)
-    .groups(27)
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groups(3)
+    .groupInputChannels(24)
+    .groupOutputChannels(17)
+    .inputShuffleGroups(3)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_5x5d1x2) {
+TEST(CONVOLUTION, shuffled_grouped_1x1_with_uneven_runs) {
   ConvolutionTester()
-    .inputSize(15, 14)
-    .padding(2, 2)
-    .kernelSize(5, 5)
-    .dilation(1, 2)
-    .groups(27)
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groups(4)
+    .groupInputChannels(6)
+    .groupOutputChannels(9)
+    .inputShuffleGroups(3)
     .iterations(3)
     .test();
 }
 
-TEST(CONVOLUTION, depthwise_5x5d2x1) {
+TEST(CONVOLUTION, shuffled_grouped_1x1_with_3_groups) {
   ConvolutionTester()
-    .inputSize(15, 14)
-    .padding(2, 2)
-    .kernelSize(5, 5)
-    .dilation(2, 1)
-    .groups(27)
+    .inputSize(7, 8)
+    .kernelSize(1, 1)
+    .groups(3)
+    .groupInputChannels(80)
+    .groupOutputChannels(20)
+    .inputShuffleGroups(3)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, shuffled_grouped_3x3_with_3_groups) {
+  ConvolutionTester()
+    .inputSize(7, 8)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(3)
+    .groupInputChannels(80)
+    .groupOutputChannels(20)
+    .inputShuffleGroups(3)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, shuffled_grouped_1x1_with_short_runs) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groups(8)
+    .groupInputChannels(24)
+    .groupOutputChannels(8)
+    .inputShuffleGroups(8)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, reversed_grouped_1x1) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groups(2)
+    .groupInputChannels(16)
+    .groupOutputChannels(11)
+    .reversedInputChannels(true)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, reversed_shuffled_grouped_3x3_with_input_stride) {
+  ConvolutionTester()
+    .inputSize(10, 9)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(2)
+    .groupInputChannels(16)
+    .groupOutputChannels(11)
+    .inputShuffleGroups(16)
+    .reversedInputChannels(true)
+    .inputPixelStride(37)
+    .batchSize(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, shuffled_grouped_1x1_with_input_stride) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groups(2)
+    .groupInputChannels(16)
+    .groupOutputChannels(11)
+    .inputShuffleGroups(4)
+    .inputPixelStride(37)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, shuffled_grouped_3x3_with_batch) {
+  ConvolutionTester()
+    .inputSize(10, 9)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(2)
+    .groupInputChannels(16)
+    .groupOutputChannels(13)
+    .inputShuffleGroups(2)
+    .batchSize(3)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, shuffled_depthwise_3x3) {
+  ConvolutionTester()
+    .inputSize(10, 9)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(24)
+    .inputShuffleGroups(4)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 1x1_with_output_border) {
+  ConvolutionTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .outputBorder(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_1x1_with_output_border_and_batch) {
+  ConvolutionTester()
+    .inputSize(5, 7)
+    .kernelSize(1, 1)
+    .groups(8)
+    .groupInputChannels(3)
+    .groupOutputChannels(11)
+    .batchSize(2)
+    .outputBorder(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3_with_output_border) {
+  ConvolutionTester()
+    .inputSize(10, 9)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .outputBorder(2)
     .iterations(3)
     .test();
 }
+
+TEST(CONVOLUTION, 3x3_with_few_output_channels_and_output_border) {
+  ConvolutionTester()
+    .inputSize(10, 9)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(2)
+    .batchSize(2)
+    .outputBorder(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, grouped_3x3_with_output_border_and_batch) {
+  ConvolutionTester()
+    .inputSize(7, 5)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(8)
+    .groupInputChannels(12)
+    .groupOutputChannels(2)
+    .batchSize(2)
+    .outputBorder(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, 3x3_with_few_input_channels_and_output_border) {
+  ConvolutionTester()
+    .inputSize(10, 9)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groupInputChannels(3)
+    .groupOutputChannels(17)
+    .outputBorder(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION, winograd_3x3_with_output_border) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8winograd.cthreshold != SIZE_MAX) {
+    ConvolutionTester()
+      .inputSize(13, 12)
+      .padding(1)
+      .kernelSize(3, 3)
+      .groupInputChannels(qnnp_params.q8winograd.cthreshold + 3)
+      .groupOutputChannels(qnnp_params.q8winograd.cthreshold + 5)
+      .batchSize(2)
+      .outputBorder(2)
+      .iterations(3)
+      .test();
+  }
+}
@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class Convolution1DTester {
+ public:
+  inline Convolution1DTester& padding(uint32_t padding) {
+    this->paddingLeft_ = padding;
+    this->paddingRight_ = padding;
+    return *this;
+  }
+
+  inline Convolution1DTester& paddingLeft(uint32_t paddingLeft) {
+    this->paddingLeft_ = paddingLeft;
+    return *this;
+  }
+
+  inline uint32_t paddingLeft() const {
+    if (causal() || streaming()) {
+      return (kernelWidth() - 1) * dilation();
+    } else {
+      return this->paddingLeft_;
+    }
+  }
+
+  inline Convolution1DTester& paddingRight(uint32_t paddingRight) {
+    this->paddingRight_ = paddingRight;
+    return *this;
+  }
+
+  inline uint32_t paddingRight() const {
+    return this->paddingRight_;
+  }
+
+  inline Convolution1DTester& causal(bool causal) {
+    this->causal_ = causal;
+    return *this;
+  }
+
+  inline bool causal() const {
+    return this->causal_;
+  }
+
+  inline Convolution1DTester& streaming(bool streaming) {
+    this->streaming_ = streaming;
+    return *this;
+  }
+
+  inline bool streaming() const {
+    return this->streaming_;
+  }
+
+  inline Convolution1DTester& chunkWidths(std::vector<size_t> chunkWidths) {
+    this->chunkWidths_ = chunkWidths;
+    return *this;
+  }
+
+  inline const std::vector<size_t>& chunkWidths() const {
+    return this->chunkWidths_;
+  }
+
+  inline Convolution1DTester& resetAfter(size_t resetAfter) {
+    this->resetAfter_ = resetAfter;
+    return *this;
+  }
+
+  inline size_t resetAfter() const {
+    return this->resetAfter_;
+  }
+
+  inline Convolution1DTester& inputWidth(size_t inputWidth) {
+    assert(inputWidth >= 1);
+    this->inputWidth_ = inputWidth;
+    return *this;
+  }
+
+  inline size_t inputWidth() const {
+    return this->inputWidth_;
+  }
+
+  inline Convolution1DTester& groups(uint32_t groups) {
+    assert(groups >= 1);
+    this->groups_ = groups;
+    return *this;
+  }
+
+  inline uint32_t groups() const {
+    return this->groups_;
+  }
+
+  inline Convolution1DTester& groupInputChannels(size_t groupInputChannels) {
+    assert(groupInputChannels >= 1);
+    this->groupInputChannels_ = groupInputChannels;
+    return *this;
+  }
+
+  inline size_t groupInputChannels() const {
+    return this->groupInputChannels_;
+  }
+
+  inline Convolution1DTester& groupOutputChannels(size_t groupOutputChannels) {
+    assert(groupOutputChannels >= 1);
+    this->groupOutputChannels_ = groupOutputChannels;
+    return *this;
+  }
+
+  inline size_t groupOutputChannels() const {
+    return this->groupOutputChannels_;
+  }
+
+  inline Convolution1DTester& batchSize(size_t batchSize) {
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline Convolution1DTester& kernelWidth(uint32_t kernelWidth) {
+    assert(kernelWidth >= 1);
+    this->kernelWidth_ = kernelWidth;
+    return *this;
+  }
+
+  inline uint32_t kernelWidth() const {
+    return this->kernelWidth_;
+  }
+
+  inline Convolution1DTester& dilation(uint32_t dilation) {
+    assert(dilation >= 1);
+    this->dilation_ = dilation;
+    return *this;
+  }
+
+  inline uint32_t dilation() const {
+    return this->dilation_;
+  }
+
+  inline Convolution1DTester& subsampling(uint32_t subsampling) {
+    assert(subsampling >= 1);
+    this->subsampling_ = subsampling;
+    return *this;
+  }
+
+  inline uint32_t subsampling() const {
+    return this->subsampling_;
+  }
+
+  inline Convolution1DTester& inputPixelStride(size_t inputPixelStride) {
+    assert(inputPixelStride >= 1);
+    this->inputPixelStride_ = inputPixelStride;
+    return *this;
+  }
+
+  inline size_t inputPixelStride() const {
+    if (this->inputPixelStride_ == 0) {
+      return groupInputChannels() * groups();
+    } else {
+      assert(this->inputPixelStride_ >= groupInputChannels() * groups());
+      return this->inputPixelStride_;
+    }
+  }
+
+  inline Convolution1DTester& outputPixelStride(size_t outputPixelStride) {
+    assert(outputPixelStride >= 1);
+    this->outputPixelStride_ = outputPixelStride;
+    return *this;
+  }
+
+  inline size_t outputPixelStride() const {
+    if (this->outputPixelStride_ == 0) {
+      return groupOutputChannels() * groups();
+    } else {
+      assert(this->outputPixelStride_ >= groupOutputChannels() * groups());
+      return this->outputPixelStride_;
+    }
+  }
+
+  inline uint32_t dilatedKernelWidth() const {
+    return (kernelWidth() - 1) * dilation() + 1;
+  }
+
+  inline size_t outputWidth() const {
+    const size_t paddedInputWidth = paddingLeft() + inputWidth() + paddingRight();
+    if (paddedInputWidth <= dilatedKernelWidth()) {
+      return 1;
+    } else {
+      return (paddedInputWidth - dilatedKernelWidth()) / subsampling() + 1;
+    }
+  }
+
+  inline Convolution1DTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline Convolution1DTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline Convolution1DTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void test() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input(batchSize() * ((inputWidth() - 1) * inputPixelStride() + groups() * groupInputChannels()) + 8);
+    std::vector<uint8_t> kernel(groups() * groupOutputChannels() * kernelWidth() * groupInputChannels());
+    std::vector<int32_t> bias(groups() * groupOutputChannels());
+    std::vector<uint8_t> output(batchSize() * ((outputWidth() - 1) * outputPixelStride() + groups() * groupOutputChannels()));
+    std::vector<int32_t> accumulators(batchSize() * outputWidth() * groups() * groupOutputChannels());
+
+    const uint8_t* inputPtr = input.data() + 8;
+    const uint8_t inputZeroPoint = 127;
+    const uint8_t kernelZeroPoint = 127;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t ox = 0; ox < outputWidth(); ox++) {
+          for (size_t g = 0; g < groups(); g++) {
+            for (size_t oc = 0; oc < groupOutputChannels(); oc++) {
+              int32_t acc = bias[g * groupOutputChannels() + oc];
+              for (size_t kx = 0; kx < kernelWidth(); kx++) {
+                const size_t ix = ox * subsampling() + kx * dilation() - paddingLeft();
+                if (ix < inputWidth()) {
+                  for (size_t ic = 0; ic < groupInputChannels(); ic++) {
+                    acc +=
+                      (int32_t(inputPtr[(i * inputWidth() + ix) * inputPixelStride() + g * groupInputChannels() + ic]) - int32_t(inputZeroPoint)) *
+                      (int32_t(kernel[((g * groupOutputChannels() + oc) * kernelWidth() + kx) * groupInputChannels() + ic]) - int32_t(kernelZeroPoint));
+                  }
+                }
+              }
+              accumulators[((i * outputWidth() + ox) * groups() + g) * groupOutputChannels() + oc] = acc;
+            }
+          }
+        }
+      }
+      const int32_t accumulatorsMin = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const int32_t accumulatorsMax = *std::max_element(accumulators.cbegin(), accumulators.cend());
+
+      const double outputScale = double(uint32_t(accumulatorsMax - accumulatorsMin)) / 255.0;
+      const uint8_t outputZeroPoint = uint8_t(std::max(std::min(
+        lrint(127.5 - 0.5 * double(accumulatorsMin + accumulatorsMax) / outputScale),
+        long(std::numeric_limits<uint8_t>::max())), long(std::numeric_limits<uint8_t>::min())));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t convolution = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_convolution1d_nwc_q8(
+          causal() ? 0 : paddingLeft(), causal() ? 0 : paddingRight(),
+          kernelWidth(), subsampling(), dilation(),
+          groups(), groupInputChannels(), groupOutputChannels(),
+          inputZeroPoint, 1.0f /* input scale */,
+          kernelZeroPoint, 1.0f /* kernel scale */,
+          kernel.data(), bias.data(),
+          outputZeroPoint, outputScale, qmin(), qmax(),
+          causal() ? QNNP_FLAG_CAUSAL_PADDING : 0,
+          &convolution));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_convolution1d_nwc_q8(
+          convolution,
+          batchSize(),
+          inputWidth(),
+          inputPtr,
+          inputPixelStride(),
+          output.data(),
+          outputPixelStride(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(convolution, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(convolution));
+      convolution = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t x = 0; x < outputWidth(); x++) {
+          for (size_t g = 0; g < groups(); g++) {
+            for (size_t c = 0; c < groupOutputChannels(); c++) {
+              const double scaledAccumulator =
+                accumulators[((i * outputWidth() + x) * groups() + g) * groupOutputChannels() + c] / outputScale;
+              const double clampedAccumulator = std::max(std::min(scaledAccumulator,
+                double(qmax()) - double(outputZeroPoint)),
+                double(qmin()) - double(outputZeroPoint));
+              ASSERT_NEAR(
+                clampedAccumulator,
+                (int32_t(output[(i * outputWidth() + x) * outputPixelStride() + g * groupOutputChannels() + c]) - outputZeroPoint),
+                0.9) << "x = " << x << ", group = " << g << ", channel = " << c;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /*
+   * Feeds the input to a streaming operator in chunks of chunkWidths() frames (cycling through the list), and checks
+   * that the concatenated outputs match a causal convolution over the whole sequence. If resetAfter() is non-zero,
+   * the operator state is reset after that many frames, and the remainder of the sequence is checked as a new stream.
+   */
+  void testStreaming() const {
+    ASSERT_TRUE(streaming());
+    ASSERT_FALSE(chunkWidths().empty());
+
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input(batchSize() * inputWidth() * inputPixelStride() + 8);
+    std::vector<uint8_t> kernel(groups() * groupOutputChannels() * kernelWidth() * groupInputChannels());
+    std::vector<int32_t> bias(groups() * groupOutputChannels());
+    std::vector<uint8_t> output(batchSize() * inputWidth() * outputPixelStride());
+    std::vector<int32_t> accumulators(batchSize() * inputWidth() * groups() * groupOutputChannels());
+
+    const uint8_t* inputPtr = input.data() + 8;
+    const uint8_t inputZeroPoint = 127;
+    const uint8_t kernelZeroPoint = 127;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      ASSERT_EQ(0, inputWidth() % subsampling());
+      ASSERT_EQ(0, resetAfter() % subsampling());
+      const size_t outputWidth = inputWidth() / subsampling();
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t ox = 0; ox < outputWidth; ox++) {
+          /* Frames before the reset point are invisible after the reset */
+          const size_t streamStart = resetAfter() != 0 && ox * subsampling() >= resetAfter() ? resetAfter() : 0;
+          for (size_t g = 0; g < groups(); g++) {
+            for (size_t oc = 0; oc < groupOutputChannels(); oc++) {
+              int32_t acc = bias[g * groupOutputChannels() + oc];
+              for (size_t kx = 0; kx < kernelWidth(); kx++) {
+                const size_t ix = ox * subsampling() + kx * dilation() - paddingLeft();
+                if (ix < inputWidth() && ix >= streamStart) {
+                  for (size_t ic = 0; ic < groupInputChannels(); ic++) {
+                    acc +=
+                      (int32_t(inputPtr[(i * inputWidth() + ix) * inputPixelStride() + g * groupInputChannels() + ic]) - int32_t(inputZeroPoint)) *
+                      (int32_t(kernel[((g * groupOutputChannels() + oc) * kernelWidth() + kx) * groupInputChannels() + ic]) - int32_t(kernelZeroPoint));
+                  }
+                }
+              }
+              accumulators[((i * outputWidth + ox) * groups() + g) * groupOutputChannels() + oc] = acc;
+            }
+          }
+        }
+      }
+      const int32_t accumulatorsMin = *std::min_element(accumulators.cbegin(), accumulators.cbegin() + batchSize() * outputWidth * groups() * groupOutputChannels());
+      const int32_t accumulatorsMax = *std::max_element(accumulators.cbegin(), accumulators.cbegin() + batchSize() * outputWidth * groups() * groupOutputChannels());
+
+      const double outputScale = double(uint32_t(accumulatorsMax - accumulatorsMin)) / 255.0;
+      const uint8_t outputZeroPoint = uint8_t(std::max(std::min(
+        lrint(127.5 - 0.5 * double(accumulatorsMin + accumulatorsMax) / outputScale),
+        long(std::numeric_limits<uint8_t>::max())), long(std::numeric_limits<uint8_t>::min())));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t convolution = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_convolution1d_nwc_q8(
+          0, 0,
+          kernelWidth(), subsampling(), dilation(),
+          groups(), groupInputChannels(), groupOutputChannels(),
+          inputZeroPoint, 1.0f /* input scale */,
+          kernelZeroPoint, 1.0f /* kernel scale */,
+          kernel.data(), bias.data(),
+          outputZeroPoint, outputScale, qmin(), qmax(),
+          QNNP_FLAG_STREAMING,
+          &convolution));
+
+      /* Chunks of the input are gathered into a separate buffer, as a real-time pipeline would receive them */
+      std::vector<uint8_t> chunkInput(8 + batchSize() * inputWidth() * inputPixelStride());
+      std::vector<uint8_t> chunkOutput(batchSize() * outputWidth * outputPixelStride());
+      for (size_t frame = 0, chunk = 0; frame < inputWidth(); chunk++) {
+        if (resetAfter() != 0 && frame == resetAfter()) {
+          ASSERT_EQ(qnnp_status_success, qnnp_reset_convolution1d_nwc_q8(convolution));
+        }
+        size_t chunkWidth = std::min(chunkWidths()[chunk % chunkWidths().size()], inputWidth() - frame);
+        if (resetAfter() != 0 && frame < resetAfter()) {
+          chunkWidth = std::min(chunkWidth, resetAfter() - frame);
+        }
+        ASSERT_EQ(0, chunkWidth % subsampling());
+
+        for (size_t i = 0; i < batchSize(); i++) {
+          std::copy(
+            inputPtr + (i * inputWidth() + frame) * inputPixelStride(),
+            inputPtr + (i * inputWidth() + frame + chunkWidth) * inputPixelStride(),
+            chunkInput.begin() + 8 + i * chunkWidth * inputPixelStride());
+        }
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_setup_convolution1d_nwc_q8(
+            convolution,
+            batchSize(),
+            chunkWidth,
+            chunkInput.data() + 8,
+            inputPixelStride(),
+            chunkOutput.data(),
+            outputPixelStride(),
+            nullptr /* thread pool */));
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_run_operator(convolution, nullptr /* thread pool */));
+
+        const size_t chunkOutputWidth = chunkWidth / subsampling();
+        for (size_t i = 0; i < batchSize(); i++) {
+          std::copy(
+            chunkOutput.cbegin() + i * chunkOutputWidth * outputPixelStride(),
+            chunkOutput.cbegin() + (i + 1) * chunkOutputWidth * outputPixelStride(),
+            output.begin() + (i * outputWidth + frame / subsampling()) * outputPixelStride());
+        }
+        frame += chunkWidth;
+      }
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(convolution));
+      convolution = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t x = 0; x < outputWidth; x++) {
+          for (size_t g = 0; g < groups(); g++) {
+            for (size_t c = 0; c < groupOutputChannels(); c++) {
+              const double scaledAccumulator =
+                accumulators[((i * outputWidth + x) * groups() + g) * groupOutputChannels() + c] / outputScale;
+              const double clampedAccumulator = std::max(std::min(scaledAccumulator,
+                double(qmax()) - double(outputZeroPoint)),
+                double(qmin()) - double(outputZeroPoint));
+              ASSERT_NEAR(
+                clampedAccumulator,
+                (int32_t(output[(i * outputWidth + x) * outputPixelStride() + g * groupOutputChannels() + c]) - outputZeroPoint),
+                0.9) << "x = " << x << ", group = " << g << ", channel = " << c;
+            }
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  uint32_t paddingLeft_{0};
+  uint32_t paddingRight_{0};
+  bool causal_{false};
+  bool streaming_{false};
+  std::vector<size_t> chunkWidths_;
+  size_t resetAfter_{0};
+  size_t inputWidth_{1};
+  uint32_t groups_{1};
+  size_t groupInputChannels_{1};
+  size_t inputPixelStride_{0};
+  size_t groupOutputChannels_{1};
+  size_t outputPixelStride_{0};
+  size_t batchSize_{1};
+  uint32_t kernelWidth_{1};
+  uint32_t dilation_{1};
+  uint32_t subsampling_{1};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{1};
+};
@@ -0,0 +1,557 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "convolution1d-tester.h"
+
+
+TEST(CONVOLUTION_1D, k1) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(1)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k1_with_batch) {
+  Convolution1DTester()
+    .batchSize(3)
+    .inputWidth(37)
+    .kernelWidth(1)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .padding(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3_without_padding) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3_with_left_padding) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .paddingLeft(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3_with_right_padding) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .paddingRight(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3_with_causal_padding) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .causal(true)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3_with_input_stride) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .padding(1)
+    .inputPixelStride(28)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3_with_output_stride) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .padding(1)
+    .outputPixelStride(29)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3_with_batch) {
+  Convolution1DTester()
+    .batchSize(3)
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .padding(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3_with_qmin) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .padding(1)
+    .qmin(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3_with_qmax) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .padding(1)
+    .qmax(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3s2) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .padding(1)
+    .subsampling(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3d2) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .padding(2)
+    .dilation(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k3d4_with_causal_padding) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .dilation(4)
+    .causal(true)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k5_with_few_input_channels) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(5)
+    .padding(2)
+    .groupInputChannels(2)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, k10s4_with_single_input_channel) {
+  Convolution1DTester()
+    .inputWidth(160)
+    .kernelWidth(10)
+    .subsampling(4)
+    .groupInputChannels(1)
+    .groupOutputChannels(16)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, grouped_k3) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .padding(1)
+    .groups(2)
+    .groupInputChannels(14)
+    .groupOutputChannels(13)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k3) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groups(24)
+    .padding(1)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k3_with_causal_padding) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groups(24)
+    .causal(true)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k3s2) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groups(24)
+    .padding(1)
+    .subsampling(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k3d2) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(3)
+    .groups(24)
+    .padding(2)
+    .dilation(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k5) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(5)
+    .groups(24)
+    .padding(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k7) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(7)
+    .groups(24)
+    .padding(3)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k7_with_few_channels) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(7)
+    .groups(5)
+    .padding(3)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k9) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(9)
+    .groups(24)
+    .padding(4)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k15_with_causal_padding) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(15)
+    .groups(24)
+    .causal(true)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k15d2_with_causal_padding) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(15)
+    .groups(24)
+    .dilation(2)
+    .causal(true)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k25) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(25)
+    .groups(17)
+    .padding(12)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k31) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(31)
+    .groups(17)
+    .padding(15)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k7_with_input_stride) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(7)
+    .groups(24)
+    .padding(3)
+    .inputPixelStride(29)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k7_with_output_stride) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(7)
+    .groups(24)
+    .padding(3)
+    .outputPixelStride(29)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k7_with_batch) {
+  Convolution1DTester()
+    .batchSize(3)
+    .inputWidth(37)
+    .kernelWidth(7)
+    .groups(24)
+    .padding(3)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k7_with_qmin) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(7)
+    .groups(24)
+    .padding(3)
+    .qmin(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_1D, depthwise_k7_with_qmax) {
+  Convolution1DTester()
+    .inputWidth(37)
+    .kernelWidth(7)
+    .groups(24)
+    .padding(3)
+    .qmax(128)
+    .iterations(3)
+    .test();
+}
+
+
+TEST(CONVOLUTION_1D, streaming_k3) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .chunkWidths({8})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_k3_with_single_frame_chunks) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .chunkWidths({1})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_k3_with_varying_chunks) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .chunkWidths({5, 1, 12, 2})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_k3_with_reset) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .chunkWidths({7})
+    .resetAfter(30)
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_k3_with_batch) {
+  Convolution1DTester()
+    .batchSize(3)
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .chunkWidths({6, 10})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_k3_with_input_stride) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .inputPixelStride(28)
+    .chunkWidths({6, 10})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_k3_with_output_stride) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .outputPixelStride(29)
+    .chunkWidths({6, 10})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_k3s2) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(3)
+    .subsampling(2)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .chunkWidths({4, 2, 10})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_k3d4) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(3)
+    .dilation(4)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .chunkWidths({3, 5})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_k1) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(1)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .chunkWidths({8})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_k5_with_few_input_channels) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(5)
+    .groupInputChannels(2)
+    .groupOutputChannels(17)
+    .chunkWidths({4, 9})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_depthwise_k15) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(15)
+    .groups(24)
+    .chunkWidths({4, 9})
+    .iterations(3)
+    .testStreaming();
+}
+
+TEST(CONVOLUTION_1D, streaming_depthwise_k3d2_with_few_channels) {
+  Convolution1DTester()
+    .streaming(true)
+    .inputWidth(64)
+    .kernelWidth(3)
+    .dilation(2)
+    .groups(5)
+    .chunkWidths({1, 3})
+    .iterations(3)
+    .testStreaming();
+}
@@ -0,0 +1,499 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class Convolution3DTester {
+ public:
+  inline Convolution3DTester& padding(uint32_t padding) {
+    this->paddingFront_ = padding;
+    this->paddingTop_ = padding;
+    this->paddingRight_ = padding;
+    this->paddingBack_ = padding;
+    this->paddingBottom_ = padding;
+    this->paddingLeft_ = padding;
+    return *this;
+  }
+
+  inline Convolution3DTester& padding(uint32_t paddingDepth, uint32_t paddingHeight, uint32_t paddingWidth) {
+    this->paddingFront_ = paddingDepth;
+    this->paddingTop_ = paddingHeight;
+    this->paddingRight_ = paddingWidth;
+    this->paddingBack_ = paddingDepth;
+    this->paddingBottom_ = paddingHeight;
+    this->paddingLeft_ = paddingWidth;
+    return *this;
+  }
+
+  inline Convolution3DTester& paddingFront(uint32_t paddingFront) {
+    this->paddingFront_ = paddingFront;
+    return *this;
+  }
+
+  inline uint32_t paddingFront() const {
+    return this->paddingFront_;
+  }
+
+  inline Convolution3DTester& paddingTop(uint32_t paddingTop) {
+    this->paddingTop_ = paddingTop;
+    return *this;
+  }
+
+  inline uint32_t paddingTop() const {
+    return this->paddingTop_;
+  }
+
+  inline Convolution3DTester& paddingRight(uint32_t paddingRight) {
+    this->paddingRight_ = paddingRight;
+    return *this;
+  }
+
+  inline uint32_t paddingRight() const {
+    return this->paddingRight_;
+  }
+
+  inline Convolution3DTester& paddingBack(uint32_t paddingBack) {
+    this->paddingBack_ = paddingBack;
+    return *this;
+  }
+
+  inline uint32_t paddingBack() const {
+    return this->paddingBack_;
+  }
+
+  inline Convolution3DTester& paddingBottom(uint32_t paddingBottom) {
+    this->paddingBottom_ = paddingBottom;
+    return *this;
+  }
+
+  inline uint32_t paddingBottom() const {
+    return this->paddingBottom_;
+  }
+
+  inline Convolution3DTester& paddingLeft(uint32_t paddingLeft) {
+    this->paddingLeft_ = paddingLeft;
+    return *this;
+  }
+
+  inline uint32_t paddingLeft() const {
+    return this->paddingLeft_;
+  }
+
+  inline Convolution3DTester& inputSize(uint32_t inputDepth, uint32_t inputHeight, uint32_t inputWidth) {
+    assert(inputDepth >= 1);
+    assert(inputHeight >= 1);
+    assert(inputWidth >= 1);
+    this->inputDepth_ = inputDepth;
+    this->inputHeight_ = inputHeight;
+    this->inputWidth_ = inputWidth;
+    return *this;
+  }
+
+  inline uint32_t inputDepth() const {
+    return this->inputDepth_;
+  }
+
+  inline uint32_t inputHeight() const {
+    return this->inputHeight_;
+  }
+
+  inline uint32_t inputWidth() const {
+    return this->inputWidth_;
+  }
+
+  inline Convolution3DTester& groups(uint32_t groups) {
+    assert(groups >= 1);
+    this->groups_ = groups;
+    return *this;
+  }
+
+  inline uint32_t groups() const {
+    return this->groups_;
+  }
+
+  inline Convolution3DTester& groupInputChannels(size_t groupInputChannels) {
+    assert(groupInputChannels >= 1);
+    this->groupInputChannels_ = groupInputChannels;
+    return *this;
+  }
+
+  inline size_t groupInputChannels() const {
+    return this->groupInputChannels_;
+  }
+
+  inline Convolution3DTester& groupOutputChannels(size_t groupOutputChannels) {
+    assert(groupOutputChannels >= 1);
+    this->groupOutputChannels_ = groupOutputChannels;
+    return *this;
+  }
+
+  inline size_t groupOutputChannels() const {
+    return this->groupOutputChannels_;
+  }
+
+  inline Convolution3DTester& batchSize(size_t batchSize) {
+    assert(batchSize >= 1);
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline Convolution3DTester& kernelSize(uint32_t kernelSize) {
+    assert(kernelSize >= 1);
+    this->kernelDepth_ = kernelSize;
+    this->kernelHeight_ = kernelSize;
+    this->kernelWidth_ = kernelSize;
+    return *this;
+  }
+
+  inline Convolution3DTester& kernelSize(uint32_t kernelDepth, uint32_t kernelHeight, uint32_t kernelWidth) {
+    assert(kernelDepth >= 1);
+    assert(kernelHeight >= 1);
+    assert(kernelWidth >= 1);
+    this->kernelDepth_ = kernelDepth;
+    this->kernelHeight_ = kernelHeight;
+    this->kernelWidth_ = kernelWidth;
+    return *this;
+  }
+
+  inline uint32_t kernelDepth() const {
+    return this->kernelDepth_;
+  }
+
+  inline uint32_t kernelHeight() const {
+    return this->kernelHeight_;
+  }
+
+  inline uint32_t kernelWidth() const {
+    return this->kernelWidth_;
+  }
+
+  inline Convolution3DTester& dilation(uint32_t dilation) {
+    assert(dilation >= 1);
+    this->dilationDepth_ = dilation;
+    this->dilationHeight_ = dilation;
+    this->dilationWidth_ = dilation;
+    return *this;
+  }
+
+  inline Convolution3DTester& dilation(uint32_t dilationDepth, uint32_t dilationHeight, uint32_t dilationWidth) {
+    assert(dilationDepth >= 1);
+    assert(dilationHeight >= 1);
+    assert(dilationWidth >= 1);
+    this->dilationDepth_ = dilationDepth;
+    this->dilationHeight_ = dilationHeight;
+    this->dilationWidth_ = dilationWidth;
+    return *this;
+  }
+
+  inline uint32_t dilationDepth() const {
+    return this->dilationDepth_;
+  }
+
+  inline uint32_t dilationHeight() const {
+    return this->dilationHeight_;
+  }
+
+  inline uint32_t dilationWidth() const {
+    return this->dilationWidth_;
+  }
+
+  inline Convolution3DTester& subsampling(uint32_t subsampling) {
+    assert(subsampling >= 1);
+    this->subsamplingDepth_ = subsampling;
+    this->subsamplingHeight_ = subsampling;
+    this->subsamplingWidth_ = subsampling;
+    return *this;
+  }
+
+  inline Convolution3DTester& subsampling(uint32_t subsamplingDepth, uint32_t subsamplingHeight, uint32_t subsamplingWidth) {
+    assert(subsamplingDepth >= 1);
+    assert(subsamplingHeight >= 1);
+    assert(subsamplingWidth >= 1);
+    this->subsamplingDepth_ = subsamplingDepth;
+    this->subsamplingHeight_ = subsamplingHeight;
+    this->subsamplingWidth_ = subsamplingWidth;
+    return *this;
+  }
+
+  inline uint32_t subsamplingDepth() const {
+    return this->subsamplingDepth_;
+  }
+
+  inline uint32_t subsamplingHeight() const {
+    return this->subsamplingHeight_;
+  }
+
+  inline uint32_t subsamplingWidth() const {
+    return this->subsamplingWidth_;
+  }
+
+  inline Convolution3DTester& inputPixelStride(size_t inputPixelStride) {
+    assert(inputPixelStride >= 1);
+    this->inputPixelStride_ = inputPixelStride;
+    return *this;
+  }
+
+  inline size_t inputPixelStride() const {
+    if (this->inputPixelStride_ == 0) {
+      return groupInputChannels() * groups();
+    } else {
+      assert(this->inputPixelStride_ >= groupInputChannels() * groups());
+      return this->inputPixelStride_;
+    }
+  }
+
+  inline Convolution3DTester& outputPixelStride(size_t outputPixelStride) {
+    assert(outputPixelStride >= 1);
+    this->outputPixelStride_ = outputPixelStride;
+    return *this;
+  }
+
+  inline size_t outputPixelStride() const {
+    if (this->outputPixelStride_ == 0) {
+      return groupOutputChannels() * groups();
+    } else {
+      assert(this->outputPixelStride_ >= groupOutputChannels() * groups());
+      return this->outputPixelStride_;
+    }
+  }
+
+  inline size_t outputDepth() const {
+    return outputDimension(paddingFront() + inputDepth() + paddingBack(), kernelDepth(), dilationDepth(), subsamplingDepth());
+  }
+
+  inline size_t outputHeight() const {
+    return outputDimension(paddingTop() + inputHeight() + paddingBottom(), kernelHeight(), dilationHeight(), subsamplingHeight());
+  }
+
+  inline size_t outputWidth() const {
+    return outputDimension(paddingLeft() + inputWidth() + paddingRight(), kernelWidth(), dilationWidth(), subsamplingWidth());
+  }
+
+  inline Convolution3DTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline Convolution3DTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline Convolution3DTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void test() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    const size_t inputPixels = inputDepth() * inputHeight() * inputWidth();
+    const size_t outputPixels = outputDepth() * outputHeight() * outputWidth();
+    const size_t kernelSize = kernelDepth() * kernelHeight() * kernelWidth();
+    std::vector<uint8_t> input(batchSize() * ((inputPixels - 1) * inputPixelStride() + groups() * groupInputChannels()) + 8);
+    std::vector<uint8_t> kernel(groups() * groupOutputChannels() * kernelSize * groupInputChannels());
+    std::vector<int32_t> bias(groups() * groupOutputChannels());
+    std::vector<uint8_t> output(batchSize() * ((outputPixels - 1) * outputPixelStride() + groups() * groupOutputChannels()));
+    std::vector<int32_t> accumulators(batchSize() * outputPixels * groups() * groupOutputChannels());
+
+    const uint8_t* inputPtr = input.data() + 8;
+    const uint8_t inputZeroPoint = 127;
+    const uint8_t kernelZeroPoint = 127;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t o = 0; o < outputPixels; o++) {
+          for (size_t g = 0; g < groups(); g++) {
+            for (size_t oc = 0; oc < groupOutputChannels(); oc++) {
+              accumulators[((i * outputPixels + o) * groups() + g) * groupOutputChannels() + oc] =
+                bias[g * groupOutputChannels() + oc];
+            }
+          }
+        }
+      }
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t oz = 0; oz < outputDepth(); oz++) {
+          for (size_t oy = 0; oy < outputHeight(); oy++) {
+            for (size_t ox = 0; ox < outputWidth(); ox++) {
+              const size_t o = (oz * outputHeight() + oy) * outputWidth() + ox;
+              for (size_t kz = 0; kz < kernelDepth(); kz++) {
+                const size_t iz = oz * subsamplingDepth() + kz * dilationDepth() - paddingFront();
+                if (iz >= inputDepth()) {
+                  continue;
+                }
+                for (size_t ky = 0; ky < kernelHeight(); ky++) {
+                  const size_t iy = oy * subsamplingHeight() + ky * dilationHeight() - paddingTop();
+                  if (iy >= inputHeight()) {
+                    continue;
+                  }
+                  for (size_t kx = 0; kx < kernelWidth(); kx++) {
+                    const size_t ix = ox * subsamplingWidth() + kx * dilationWidth() - paddingLeft();
+                    if (ix >= inputWidth()) {
+                      continue;
+                    }
+                    const size_t k = (kz * kernelHeight() + ky) * kernelWidth() + kx;
+                    const size_t inputIndex = ((i * inputDepth() + iz) * inputHeight() + iy) * inputWidth() + ix;
+                    for (size_t g = 0; g < groups(); g++) {
+                      for (size_t oc = 0; oc < groupOutputChannels(); oc++) {
+                        for (size_t ic = 0; ic < groupInputChannels(); ic++) {
+                          accumulators[((i * outputPixels + o) * groups() + g) * groupOutputChannels() + oc] +=
+                            (int32_t(inputPtr[inputIndex * inputPixelStride() + g * groupInputChannels() + ic]) - int32_t(inputZeroPoint)) *
+                            (int32_t(kernel[((g * groupOutputChannels() + oc) * kernelSize + k) * groupInputChannels() + ic]) - int32_t(kernelZeroPoint));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+      const int32_t accumulatorsMin = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const int32_t accumulatorsMax = *std::max_element(accumulators.cbegin(), accumulators.cend());
+
+      const double outputScale = double(uint32_t(accumulatorsMax - accumulatorsMin)) / 255.0;
+      const uint8_t outputZeroPoint = uint8_t(std::max(std::min(
+        lrint(127.5 - 0.5 * double(accumulatorsMin + accumulatorsMax) / outputScale),
+        long(std::numeric_limits<uint8_t>::max())), long(std::numeric_limits<uint8_t>::min())));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t convolution = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_convolution3d_ndhwc_q8(
+          paddingFront(), paddingTop(), paddingRight(), paddingBack(), paddingBottom(), paddingLeft(),
+          kernelDepth(), kernelHeight(), kernelWidth(),
+          subsamplingDepth(), subsamplingHeight(), subsamplingWidth(),
+          dilationDepth(), dilationHeight(), dilationWidth(),
+          groups(), groupInputChannels(), groupOutputChannels(),
+          inputZeroPoint, 1.0f /* input scale */,
+          kernelZeroPoint, 1.0f /* kernel scale */,
+          kernel.data(), bias.data(),
+          outputZeroPoint, outputScale, qmin(), qmax(),
+          &convolution));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_convolution3d_ndhwc_q8(
+          convolution,
+          batchSize(),
+          inputDepth(),
+          inputHeight(),
+          inputWidth(),
+          inputPtr,
+          inputPixelStride(),
+          output.data(),
+          outputPixelStride(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(convolution, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(convolution));
+      convolution = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t z = 0; z < outputDepth(); z++) {
+          for (size_t y = 0; y < outputHeight(); y++) {
+            for (size_t x = 0; x < outputWidth(); x++) {
+              const size_t o = (z * outputHeight() + y) * outputWidth() + x;
+              for (size_t g = 0; g < groups(); g++) {
+                for (size_t c = 0; c < groupOutputChannels(); c++) {
+                  const double scaledAccumulator =
+                    accumulators[((i * outputPixels + o) * groups() + g) * groupOutputChannels() + c] / outputScale;
+                  const double clampedAccumulator = std::max(std::min(scaledAccumulator,
+                    double(qmax()) - double(outputZeroPoint)),
+                    double(qmin()) - double(outputZeroPoint));
+                  ASSERT_NEAR(
+                    clampedAccumulator,
+                    (int32_t(output[(i * outputPixels + o) * outputPixelStride() + g * groupOutputChannels() + c]) - outputZeroPoint),
+                    0.9) << "(x, y, z) = (" << x << ", " << y << ", " << z << "), group = " << g << ", channel = " << c;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  static inline size_t outputDimension(size_t paddedInputSize, uint32_t kernelSize, uint32_t dilation, uint32_t subsampling) {
+    const size_t dilatedKernelSize = (kernelSize - 1) * dilation + 1;
+    if (paddedInputSize <= dilatedKernelSize) {
+      return 1;
+    } else {
+      return (paddedInputSize - dilatedKernelSize) / subsampling + 1;
+    }
+  }
+
+  uint32_t paddingFront_{0};
+  uint32_t paddingTop_{0};
+  uint32_t paddingRight_{0};
+  uint32_t paddingBack_{0};
+  uint32_t paddingBottom_{0};
+  uint32_t paddingLeft_{0};
+  size_t inputDepth_{1};
+  size_t inputHeight_{1};
+  size_t inputWidth_{1};
+  uint32_t groups_{1};
+  size_t groupInputChannels_{1};
+  size_t inputPixelStride_{0};
+  size_t groupOutputChannels_{1};
+  size_t outputPixelStride_{0};
+  size_t batchSize_{1};
+  uint32_t kernelDepth_{1};
+  uint32_t kernelHeight_{1};
+  uint32_t kernelWidth_{1};
+  uint32_t dilationDepth_{1};
+  uint32_t dilationHeight_{1};
+  uint32_t dilationWidth_{1};
+  uint32_t subsamplingDepth_{1};
+  uint32_t subsamplingHeight_{1};
+  uint32_t subsamplingWidth_{1};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{1};
+};
@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "convolution3d-tester.h"
+
+
+TEST(CONVOLUTION_3D, 1x1x1) {
+  Convolution3DTester()
+    .inputSize(5, 7, 6)
+    .kernelSize(1)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 1x1x1_with_batch) {
+  Convolution3DTester()
+    .batchSize(3)
+    .inputSize(5, 7, 6)
+    .kernelSize(1)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 1x3x3) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(1, 3, 3)
+    .padding(0, 1, 1)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3_without_padding) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3_with_front_padding) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .paddingFront(2)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3_with_back_padding) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .paddingBack(2)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3_with_input_stride) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .inputPixelStride(22)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3_with_output_stride) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .outputPixelStride(23)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3_with_batch) {
+  Convolution3DTester()
+    .batchSize(3)
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3_with_qmin) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .qmin(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3_with_qmax) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .qmax(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3s2) {
+  Convolution3DTester()
+    .inputSize(7, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .subsampling(2)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3_with_depth_subsampling) {
+  Convolution3DTester()
+    .inputSize(7, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .subsampling(2, 1, 1)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x3x3d2) {
+  Convolution3DTester()
+    .inputSize(7, 9, 8)
+    .kernelSize(3)
+    .padding(2)
+    .dilation(2)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 3x1x1) {
+  Convolution3DTester()
+    .inputSize(7, 5, 6)
+    .kernelSize(3, 1, 1)
+    .padding(1, 0, 0)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, 2x3x5_with_few_input_channels) {
+  Convolution3DTester()
+    .inputSize(6, 7, 9)
+    .kernelSize(2, 3, 5)
+    .padding(1, 1, 2)
+    .groupInputChannels(3)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, grouped_3x3x3) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groups(2)
+    .groupInputChannels(14)
+    .groupOutputChannels(13)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, grouped_3x3x3_with_small_groups) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groups(6)
+    .groupInputChannels(2)
+    .groupOutputChannels(3)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_1x3x3) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(1, 3, 3)
+    .padding(0, 1, 1)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_1x5x5) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(1, 5, 5)
+    .padding(0, 2, 2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_3x3x3) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_3x3x3_with_few_channels) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groups(3)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_3x3x3s2) {
+  Convolution3DTester()
+    .inputSize(7, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .subsampling(2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_3x3x3d2) {
+  Convolution3DTester()
+    .inputSize(7, 9, 8)
+    .kernelSize(3)
+    .padding(2)
+    .dilation(2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_3x3x1) {
+  Convolution3DTester()
+    .inputSize(7, 9, 8)
+    .kernelSize(3, 3, 1)
+    .padding(1, 1, 0)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_5x1x5) {
+  Convolution3DTester()
+    .inputSize(7, 9, 8)
+    .kernelSize(5, 1, 5)
+    .padding(2, 0, 2)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_3x3x3_with_input_stride) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groups(27)
+    .inputPixelStride(31)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_3x3x3_with_output_stride) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groups(27)
+    .outputPixelStride(31)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_3x3x3_with_batch) {
+  Convolution3DTester()
+    .batchSize(3)
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groups(27)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_3x3x3_with_qmin) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groups(27)
+    .qmin(128)
+    .iterations(3)
+    .test();
+}
+
+TEST(CONVOLUTION_3D, depthwise_3x3x3_with_qmax) {
+  Convolution3DTester()
+    .inputSize(5, 9, 8)
+    .kernelSize(3)
+    .padding(1)
+    .groups(27)
+    .qmax(128)
+    .iterations(3)
+    .test();
+}
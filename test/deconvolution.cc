@@ -180,6 +180,29 @@ TEST(DECONVOLUTION, 3x3_with_batch) {
     .test();
 }
 
+TEST(DECONVOLUTION, 3x3_with_2_output_channels) {
+  DeconvolutionTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(DECONVOLUTION, 3x3s2_with_1_output_channel) {
+  DeconvolutionTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .stride(2)
+    .groupInputChannels(15)
+    .groupOutputChannels(1)
+    .iterations(3)
+    .test();
+}
+
 TEST(DECONVOLUTION, grouped_3x3) {
   DeconvolutionTester()
     .inputSize(10, 11)
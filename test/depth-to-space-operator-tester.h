@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+/*
+ * Tests depth-to-space and space-to-depth on the same geometry: the depth image has height x width pixels of
+ * blockSize * blockSize * channels channels, and the space image has (height * blockSize) x (width * blockSize)
+ * pixels of channels channels.
+ */
+class DepthToSpaceOperatorTester {
+ public:
+  inline DepthToSpaceOperatorTester& batchSize(size_t batchSize) {
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline DepthToSpaceOperatorTester& height(size_t height) {
+    assert(height != 0);
+    this->height_ = height;
+    return *this;
+  }
+
+  inline size_t height() const {
+    return this->height_;
+  }
+
+  inline DepthToSpaceOperatorTester& width(size_t width) {
+    assert(width != 0);
+    this->width_ = width;
+    return *this;
+  }
+
+  inline size_t width() const {
+    return this->width_;
+  }
+
+  inline DepthToSpaceOperatorTester& blockSize(uint32_t blockSize) {
+    assert(blockSize >= 2);
+    this->blockSize_ = blockSize;
+    return *this;
+  }
+
+  inline uint32_t blockSize() const {
+    return this->blockSize_;
+  }
+
+  inline DepthToSpaceOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline size_t depthChannels() const {
+    return blockSize() * blockSize() * channels();
+  }
+
+  inline DepthToSpaceOperatorTester& depthPixelStride(size_t depthPixelStride) {
+    assert(depthPixelStride != 0);
+    this->depthPixelStride_ = depthPixelStride;
+    return *this;
+  }
+
+  inline size_t depthPixelStride() const {
+    if (this->depthPixelStride_ == 0) {
+      return depthChannels();
+    } else {
+      assert(this->depthPixelStride_ >= depthChannels());
+      return this->depthPixelStride_;
+    }
+  }
+
+  inline DepthToSpaceOperatorTester& spacePixelStride(size_t spacePixelStride) {
+    assert(spacePixelStride != 0);
+    this->spacePixelStride_ = spacePixelStride;
+    return *this;
+  }
+
+  inline size_t spacePixelStride() const {
+    if (this->spacePixelStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->spacePixelStride_ >= channels());
+      return this->spacePixelStride_;
+    }
+  }
+
+  inline DepthToSpaceOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testDepthToSpaceX8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    const size_t depthPixels = batchSize() * height() * width();
+    const size_t spacePixels = depthPixels * blockSize() * blockSize();
+    std::vector<uint8_t> input((depthPixels - 1) * depthPixelStride() + depthChannels());
+    std::vector<uint8_t> output((spacePixels - 1) * spacePixelStride() + channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Create, setup, run, and destroy Depth-to-Space operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t depth_to_space_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_depth_to_space_nhwc_x8(
+          channels(), blockSize(),
+          &depth_to_space_op));
+      ASSERT_NE(nullptr, depth_to_space_op);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_depth_to_space_nhwc_x8(
+          depth_to_space_op,
+          batchSize(), height(), width(),
+          input.data(), depthPixelStride(),
+          output.data(), spacePixelStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(depth_to_space_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(depth_to_space_op));
+      depth_to_space_op = nullptr;
+
+      /* Verify results */
+      verify(input.data(), output.data());
+    }
+  }
+
+  void testSpaceToDepthX8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    const size_t depthPixels = batchSize() * height() * width();
+    const size_t spacePixels = depthPixels * blockSize() * blockSize();
+    std::vector<uint8_t> input((spacePixels - 1) * spacePixelStride() + channels());
+    std::vector<uint8_t> output((depthPixels - 1) * depthPixelStride() + depthChannels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Create, setup, run, and destroy Space-to-Depth operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t space_to_depth_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_space_to_depth_nhwc_x8(
+          channels(), blockSize(),
+          &space_to_depth_op));
+      ASSERT_NE(nullptr, space_to_depth_op);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_space_to_depth_nhwc_x8(
+          space_to_depth_op,
+          batchSize(), height() * blockSize(), width() * blockSize(),
+          input.data(), spacePixelStride(),
+          output.data(), depthPixelStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(space_to_depth_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(space_to_depth_op));
+      space_to_depth_op = nullptr;
+
+      /* Verify results */
+      verify(output.data(), input.data());
+    }
+  }
+
+ private:
+  void verify(const uint8_t* depth, const uint8_t* space) const {
+    const size_t spaceWidth = width() * blockSize();
+    const size_t spaceHeight = height() * blockSize();
+    for (size_t i = 0; i < batchSize(); i++) {
+      for (size_t y = 0; y < height(); y++) {
+        for (size_t x = 0; x < width(); x++) {
+          for (size_t by = 0; by < blockSize(); by++) {
+            for (size_t bx = 0; bx < blockSize(); bx++) {
+              for (size_t c = 0; c < channels(); c++) {
+                const size_t depthIndex =
+                  ((i * height() + y) * width() + x) * depthPixelStride() + (by * blockSize() + bx) * channels() + c;
+                const size_t spaceIndex =
+                  ((i * spaceHeight + y * blockSize() + by) * spaceWidth + x * blockSize() + bx) * spacePixelStride() + c;
+                ASSERT_EQ(uint32_t(depth[depthIndex]), uint32_t(space[spaceIndex]))
+                  << "batch index = " << i << ", depth pixel = (" << y << ", " << x << "), "
+                  << "block offset = (" << by << ", " << bx << "), channel = " << c;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  size_t batchSize_{1};
+  size_t height_{1};
+  size_t width_{1};
+  uint32_t blockSize_{2};
+  size_t channels_{1};
+  size_t depthPixelStride_{0};
+  size_t spacePixelStride_{0};
+  size_t iterations_{3};
+};
@@ -67,7 +67,21 @@ class DepthwiseMicrokernelTester {
     return this->cr_;
   }
 
+  /* Number of lanes shared by several output pixels in pixel-packed weights, or 0 for channel blocks of cr */
+  inline DepthwiseMicrokernelTester& vr(uint32_t vr) {
+    assert((vr & (vr - 1)) == 0);
+    this->vr_ = vr;
+    return *this;
+  }
+
+  inline uint32_t vr() const {
+    return this->vr_;
+  }
+
   inline uint32_t packedChannels() const {
+    if (vr() != 0) {
+      return vr();
+    }
     return (channels() | (cr() - 1)) + 1;
   }
 
@@ -263,6 +277,198 @@ class DepthwiseMicrokernelTester {
     }
   }
 
+  void test(q8updwm_ukernel_function q8updwm) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((kernelSize() + (width() * subsampling() - 1) * kernelHeight() - 1) * inputStride() + channels() + 8);
+    std::vector<uint8_t> kernel(channels() * kernelSize());
+    std::vector<uint8_t, AlignedAllocator<uint8_t, 32>> packedWeights((kernelSize() + sizeof(int32_t) / sizeof(uint8_t)) * packedChannels());
+    std::vector<int32_t> bias(packedChannels());
+    std::vector<int32_t> accumulators(width() * channels());
+    auto channel_stride = (channels() + (cr() - 1)) & -cr();
+    std::vector<int32_t> outacc32(width() * channel_stride);
+    std::vector<uint8_t> output((width() - 1) * outputStride() + channels());
+    std::vector<const uint8_t*> indirectInput(kernelSize() + (width() * subsampling() - 1) * kernelHeight());
+
+    const uint8_t* inputPtr = input.data() + 8;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(accumulators.begin(), accumulators.end(), 0);
+      std::fill(outacc32.begin(), outacc32.end(), 0);
+
+      ASSERT_NE(*std::max_element(input.cbegin(), input.cend()), *std::min_element(input.cbegin(), input.cend()));
+      ASSERT_NE(*std::max_element(kernel.cbegin(), kernel.cend()), *std::min_element(kernel.cbegin(), kernel.cend()));
+
+      std::fill(packedWeights.begin(), packedWeights.end(), 0xA5);
+
+      if (vr() != 0) {
+        ASSERT_LE(channels(), cr());
+        pack_q8dwpx_w(
+          kernelHeight(), kernelWidth(), channels(), channels() > 2 ? 4 : channels(), vr(),
+          inputZeroPoint(), kernelZeroPoint(),
+          kernel.data(), bias.data(), packedWeights.data());
+      } else {
+        pack_q8dw_w(
+          kernelHeight(), kernelWidth(), channels(), cr(),
+          inputZeroPoint(), kernelZeroPoint(),
+          kernel.data(), bias.data(), packedWeights.data());
+      }
+      for (size_t i = 0; i < kernelSize() + (width() * subsampling() - 1) * kernelHeight(); i++) {
+        indirectInput[i] = inputPtr + i * inputStride();
+      }
+      std::shuffle(indirectInput.begin(), indirectInput.end(), rng);
+
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          int32_t acc = bias[c];
+          for (size_t kx = 0; kx < kernelWidth(); kx++) {
+            for (size_t ky = 0; ky < kernelHeight(); ky++) {
+              acc +=
+                (int32_t(indirectInput[(x * subsampling() + kx) * kernelHeight() + ky][c]) - int32_t(inputZeroPoint())) *
+                (int32_t(kernel[(c * kernelHeight() + ky) * kernelWidth() + kx]) - int32_t(kernelZeroPoint()));
+            }
+          }
+          accumulators[x * channels() + c] = acc;
+        }
+      }
+      const int32_t accumulatorsMin = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const int32_t accumulatorsMax = *std::max_element(accumulators.cbegin(), accumulators.cend());
+      const uint32_t accumulatorsRange = uint32_t(accumulatorsMax) - uint32_t(accumulatorsMin);
+      ASSERT_NE(0, accumulatorsRange);
+
+      const double outputScale = accumulatorsRange >= 256 ? double(accumulatorsRange) / 255.0 : 1.00001;
+      const uint8_t outputZeroPoint = uint8_t(std::max(std::min(
+        lrint(127.5 - 0.5 * double(accumulatorsMin + accumulatorsMax) / outputScale),
+        long(std::numeric_limits<uint8_t>::max())), long(std::numeric_limits<uint8_t>::min())));
+
+      const float requantizationScale = 1.0f / float(outputScale);
+      const union qnnp_conv_quantization_params quantizationParams =
+        qnnp_compute_conv_quantization_params(
+          inputZeroPoint(), kernelZeroPoint(),
+          requantizationScale, outputZeroPoint, qmin(), qmax());
+      const union qnnp_q31_requantization_params scalarRequantizationParams =
+        qnnp_compute_scalar_requantization_params(
+          requantizationScale, outputZeroPoint, qmin(), qmax());
+
+      q8updwm(
+        channels(), width(), kernelSize(),
+        indirectInput.data(), packedWeights.data(), output.data(),
+        kernelHeight() * subsampling() * sizeof(void*),
+        (outputStride() - channels()) * sizeof(uint8_t),
+        &quantizationParams);
+
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const double scaledAccumulator = accumulators[x * channels() + c] / outputScale;
+          const double clampedAccumulator = std::max(std::min(scaledAccumulator,
+            double(qmax()) - double(outputZeroPoint)),
+            double(qmin()) - double(outputZeroPoint));
+          ASSERT_NEAR(
+            clampedAccumulator,
+            (int32_t(output[x * outputStride() + c]) - outputZeroPoint),
+            0.6) << "x = " << x << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void test(q8dwrow_ukernel_function q8dwrow) const {
+    ASSERT_EQ(9, kernelSize()) << "only 3x3 microkernels are currently supported";
+
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    const size_t inputWidth = (width() - 1) * subsampling() + kernelWidth();
+    const size_t inputRowSize = (inputWidth - 1) * inputStride() + channels();
+    std::vector<uint8_t> input(kernelHeight() * inputRowSize + 8);
+    std::vector<uint8_t> kernel(channels() * kernelSize());
+    std::vector<uint8_t, AlignedAllocator<uint8_t, 32>> packedWeights((kernelSize() + sizeof(int32_t) / sizeof(uint8_t)) * packedChannels());
+    std::vector<int32_t> bias(packedChannels());
+    std::vector<int32_t> accumulators(width() * channels());
+    std::vector<uint8_t> output((width() - 1) * outputStride() + channels());
+
+    const uint8_t* inputRows[3] = {
+      input.data() + 8,
+      input.data() + 8 + inputRowSize,
+      input.data() + 8 + 2 * inputRowSize,
+    };
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      ASSERT_NE(*std::max_element(input.cbegin(), input.cend()), *std::min_element(input.cbegin(), input.cend()));
+      ASSERT_NE(*std::max_element(kernel.cbegin(), kernel.cend()), *std::min_element(kernel.cbegin(), kernel.cend()));
+
+      std::fill(packedWeights.begin(), packedWeights.end(), 0xA5);
+
+      pack_q8dw_w(
+        kernelHeight(), kernelWidth(), channels(), cr(),
+        inputZeroPoint(), kernelZeroPoint(),
+        kernel.data(), bias.data(), packedWeights.data());
+
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          int32_t acc = bias[c];
+          for (size_t ky = 0; ky < kernelHeight(); ky++) {
+            for (size_t kx = 0; kx < kernelWidth(); kx++) {
+              acc +=
+                (int32_t(inputRows[ky][(x * subsampling() + kx) * inputStride() + c]) - int32_t(inputZeroPoint())) *
+                (int32_t(kernel[(c * kernelHeight() + ky) * kernelWidth() + kx]) - int32_t(kernelZeroPoint()));
+            }
+          }
+          accumulators[x * channels() + c] = acc;
+        }
+      }
+      const int32_t accumulatorsMin = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const int32_t accumulatorsMax = *std::max_element(accumulators.cbegin(), accumulators.cend());
+      const uint32_t accumulatorsRange = uint32_t(accumulatorsMax) - uint32_t(accumulatorsMin);
+      ASSERT_NE(0, accumulatorsRange);
+
+      const double outputScale = accumulatorsRange >= 256 ? double(accumulatorsRange) / 255.0 : 1.00001;
+      const uint8_t outputZeroPoint = uint8_t(std::max(std::min(
+        lrint(127.5 - 0.5 * double(accumulatorsMin + accumulatorsMax) / outputScale),
+        long(std::numeric_limits<uint8_t>::max())), long(std::numeric_limits<uint8_t>::min())));
+
+      const float requantizationScale = 1.0f / float(outputScale);
+      const union qnnp_conv_quantization_params quantizationParams =
+        qnnp_compute_conv_quantization_params(
+          inputZeroPoint(), kernelZeroPoint(),
+          requantizationScale, outputZeroPoint, qmin(), qmax());
+
+      q8dwrow(
+        channels(), width(),
+        inputRows[0], inputRows[1], inputRows[2],
+        inputStride() * sizeof(uint8_t),
+        packedWeights.data(), output.data(),
+        outputStride() * sizeof(uint8_t),
+        &quantizationParams);
+
+      for (size_t x = 0; x < width(); x++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const double scaledAccumulator = accumulators[x * channels() + c] / outputScale;
+          const double clampedAccumulator = std::max(std::min(scaledAccumulator,
+            double(qmax()) - double(outputZeroPoint)),
+            double(qmin()) - double(outputZeroPoint));
+          ASSERT_NEAR(
+            clampedAccumulator,
+            (int32_t(output[x * outputStride() + c]) - outputZeroPoint),
+            0.6) << "x = " << x << ", channel = " << c;
+        }
+      }
+    }
+  }
+
   void test(q8mpdw_ukernel_function q8mpdw) const {
     ASSERT_EQ(25, kernelSize()) << "only 5x5 microkernel is currently supported";
 
@@ -370,6 +576,7 @@ class DepthwiseMicrokernelTester {
  private:
   uint32_t channels_{1};
   uint32_t cr_{1};
+  uint32_t vr_{0};
   uint32_t width_{1};
   uint32_t subsampling_{1};
   uint32_t kernelHeight_{1};
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "quantize-operator-tester.h"
+
+
+TEST(DEQUANTIZE_OP, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    QuantizeOperatorTester()
+      .batchSize(1)
+      .channels(channels)
+      .iterations(3)
+      .testDequantize();
+  }
+}
+
+TEST(DEQUANTIZE_OP, unit_batch_with_scale) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    for (float scale : {0.001f, 0.1f, 1.0f, 2.5f, 40.0f}) {
+      QuantizeOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .scale(scale)
+        .iterations(3)
+        .testDequantize();
+    }
+  }
+}
+
+TEST(DEQUANTIZE_OP, unit_batch_with_zero_point) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    for (int32_t zeroPoint = 0; zeroPoint <= 255; zeroPoint += 51) {
+      QuantizeOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .zeroPoint(uint8_t(zeroPoint))
+        .iterations(3)
+        .testDequantize();
+    }
+  }
+}
+
+TEST(DEQUANTIZE_OP, small_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    QuantizeOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .iterations(3)
+      .testDequantize();
+  }
+}
+
+TEST(DEQUANTIZE_OP, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    QuantizeOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .inputStride(129)
+      .iterations(3)
+      .testDequantize();
+  }
+}
+
+TEST(DEQUANTIZE_OP, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    QuantizeOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .outputStride(117)
+      .iterations(3)
+      .testDequantize();
+  }
+}
+
+TEST(DEQUANTIZE_OP, large_batch) {
+  QuantizeOperatorTester()
+    .batchSize(1024)
+    .channels(33)
+    .iterations(1)
+    .testDequantize();
+}
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class ElementwiseChainOperatorTester {
+ public:
+  enum class Step {
+    Clamp,
+    Sigmoid,
+    LeakyReLU,
+  };
+
+  inline ElementwiseChainOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline ElementwiseChainOperatorTester& inputStride(size_t inputStride) {
+    assert(inputStride != 0);
+    this->inputStride_ = inputStride;
+    return *this;
+  }
+
+  inline size_t inputStride() const {
+    if (this->inputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->inputStride_ >= this->channels_);
+      return this->inputStride_;
+    }
+  }
+
+  inline ElementwiseChainOperatorTester& input2Stride(size_t input2Stride) {
+    assert(input2Stride != 0);
+    this->input2Stride_ = input2Stride;
+    return *this;
+  }
+
+  inline size_t input2Stride() const {
+    if (this->input2Stride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->input2Stride_ >= this->channels_);
+      return this->input2Stride_;
+    }
+  }
+
+  inline ElementwiseChainOperatorTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->outputStride_ >= this->channels_);
+      return this->outputStride_;
+    }
+  }
+
+  inline ElementwiseChainOperatorTester& batchSize(size_t batchSize) {
+    assert(batchSize != 0);
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline ElementwiseChainOperatorTester& add(bool add) {
+    this->add_ = add;
+    return *this;
+  }
+
+  inline bool add() const {
+    return this->add_;
+  }
+
+  inline ElementwiseChainOperatorTester& step(Step step) {
+    this->steps_.push_back(step);
+    return *this;
+  }
+
+  inline const std::vector<Step>& steps() const {
+    return this->steps_;
+  }
+
+  inline ElementwiseChainOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline ElementwiseChainOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline ElementwiseChainOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testQ8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() - 1) * inputStride() + channels());
+    std::vector<uint8_t> input2((batchSize() - 1) * input2Stride() + channels());
+    std::vector<uint8_t> output((batchSize() - 1) * outputStride() + channels());
+    std::vector<uint8_t> outputRef(batchSize() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(input2.begin(), input2.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+
+      /* Create the chained operators, passing quantization parameters from every operator to the next */
+      std::vector<qnnp_operator_t> operators;
+      uint8_t zeroPoint = 128;
+      float scale = 1.0f / 16.0f;
+      if (add()) {
+        qnnp_operator_t addOp = nullptr;
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_create_add_nc_q8(
+            channels(),
+            121, 0.05f, 137, 0.075f,
+            zeroPoint, scale, 0, 255,
+            &addOp));
+        operators.push_back(addOp);
+      }
+      for (Step step : steps()) {
+        qnnp_operator_t stepOp = nullptr;
+        switch (step) {
+          case Step::Clamp:
+            ASSERT_EQ(qnnp_status_success,
+              qnnp_create_clamp_nc_u8(channels(), qmin(), qmax(), &stepOp));
+            break;
+          case Step::Sigmoid:
+            ASSERT_EQ(qnnp_status_success,
+              qnnp_create_sigmoid_nc_q8(
+                channels(),
+                zeroPoint, scale,
+                0, 1.0f / 256.0f, 0, 255,
+                &stepOp));
+            zeroPoint = 0;
+            scale = 1.0f / 256.0f;
+            break;
+          case Step::LeakyReLU:
+            ASSERT_EQ(qnnp_status_success,
+              qnnp_create_leaky_relu_nc_q8(
+                channels(), 0.5f,
+                zeroPoint, scale,
+                zeroPoint / 2 + 64, scale, 0, 255,
+                &stepOp));
+            zeroPoint = zeroPoint / 2 + 64;
+            break;
+        }
+        operators.push_back(stepOp);
+      }
+
+      /* Compute reference results by running the operators one after another, in place after the first one */
+      for (size_t i = 0; i < operators.size(); i++) {
+        const uint8_t* stepInput = i == 0 ? input.data() : outputRef.data();
+        const size_t stepInputStride = i == 0 ? inputStride() : channels();
+        if (i == 0 && add()) {
+          ASSERT_EQ(qnnp_status_success,
+            qnnp_setup_add_nc_q8(
+              operators[i], batchSize(),
+              input.data(), inputStride(),
+              input2.data(), input2Stride(),
+              outputRef.data(), channels()));
+        } else {
+          switch (steps()[add() ? i - 1 : i]) {
+            case Step::Clamp:
+              ASSERT_EQ(qnnp_status_success,
+                qnnp_setup_clamp_nc_u8(
+                  operators[i], batchSize(), stepInput, stepInputStride, outputRef.data(), channels()));
+              break;
+            case Step::Sigmoid:
+              ASSERT_EQ(qnnp_status_success,
+                qnnp_setup_sigmoid_nc_q8(
+                  operators[i], batchSize(), stepInput, stepInputStride, outputRef.data(), channels()));
+              break;
+            case Step::LeakyReLU:
+              ASSERT_EQ(qnnp_status_success,
+                qnnp_setup_leaky_relu_nc_q8(
+                  operators[i], batchSize(), stepInput, stepInputStride, outputRef.data(), channels()));
+              break;
+          }
+        }
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_run_operator(operators[i], nullptr /* thread pool */));
+      }
+
+      /* Create, setup, run, and destroy elementwise chain operator */
+      qnnp_operator_t elementwiseChain = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_elementwise_chain_nc_q8(
+          operators.size(), operators.data(),
+          &elementwiseChain));
+      ASSERT_NE(nullptr, elementwiseChain);
+
+      for (qnnp_operator_t op : operators) {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_delete_operator(op));
+      }
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_elementwise_chain_nc_q8(
+          elementwiseChain,
+          batchSize(),
+          input.data(), inputStride(),
+          add() ? input2.data() : nullptr, input2Stride(),
+          output.data(), outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(elementwiseChain, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(elementwiseChain));
+      elementwiseChain = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_EQ(uint32_t(outputRef[i * channels() + c]), uint32_t(output[i * outputStride() + c])) <<
+            "at batch index " << i << " / " << batchSize() << ", channel " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
+ private:
+  size_t batchSize_{1};
+  size_t channels_{1};
+  size_t inputStride_{0};
+  size_t input2Stride_{0};
+  size_t outputStride_{0};
+  bool add_{false};
+  std::vector<Step> steps_;
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{3};
+};
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "elementwise-chain-operator-tester.h"
+
+
+using Step = ElementwiseChainOperatorTester::Step;
+
+TEST(ELEMENTWISE_CHAIN_OP, clamp) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .step(Step::Clamp)
+      .qmin(64)
+      .qmax(192)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, clamp_sigmoid) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .step(Step::Clamp)
+      .step(Step::Sigmoid)
+      .qmin(64)
+      .qmax(192)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, clamp_leaky_relu) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .step(Step::Clamp)
+      .step(Step::LeakyReLU)
+      .qmin(64)
+      .qmax(192)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, leaky_relu_sigmoid_clamp) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .step(Step::LeakyReLU)
+      .step(Step::Sigmoid)
+      .step(Step::Clamp)
+      .qmin(64)
+      .qmax(192)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, unary_with_strides) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .inputStride(129)
+      .outputStride(117)
+      .step(Step::Clamp)
+      .step(Step::Sigmoid)
+      .qmin(64)
+      .qmax(192)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, add_only) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .add(true)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, add_clamp) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .add(true)
+      .step(Step::Clamp)
+      .qmin(64)
+      .qmax(192)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, add_sigmoid) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .add(true)
+      .step(Step::Sigmoid)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, add_clamp_sigmoid) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .add(true)
+      .step(Step::Clamp)
+      .step(Step::Sigmoid)
+      .qmin(64)
+      .qmax(192)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, add_leaky_relu_clamp) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .add(true)
+      .step(Step::LeakyReLU)
+      .step(Step::Clamp)
+      .qmin(64)
+      .qmax(192)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, add_sigmoid_with_strides) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    ElementwiseChainOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .inputStride(129)
+      .input2Stride(123)
+      .outputStride(117)
+      .add(true)
+      .step(Step::Sigmoid)
+      .testQ8();
+  }
+}
+
+TEST(ELEMENTWISE_CHAIN_OP, add_sigmoid_large_blocks) {
+  ElementwiseChainOperatorTester()
+    .batchSize(3)
+    .channels(2500)
+    .add(true)
+    .step(Step::Sigmoid)
+    .testQ8();
+  ElementwiseChainOperatorTester()
+    .batchSize(3)
+    .channels(2500)
+    .inputStride(2600)
+    .add(true)
+    .step(Step::Sigmoid)
+    .testQ8();
+}
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class EmbeddingLookupOperatorTester {
+ public:
+  inline EmbeddingLookupOperatorTester& embeddingDim(size_t embeddingDim) {
+    assert(embeddingDim != 0);
+    this->embeddingDim_ = embeddingDim;
+    return *this;
+  }
+
+  inline size_t embeddingDim() const {
+    return this->embeddingDim_;
+  }
+
+  inline EmbeddingLookupOperatorTester& numEmbeddings(size_t numEmbeddings) {
+    assert(numEmbeddings != 0);
+    this->numEmbeddings_ = numEmbeddings;
+    return *this;
+  }
+
+  inline size_t numEmbeddings() const {
+    return this->numEmbeddings_;
+  }
+
+  inline EmbeddingLookupOperatorTester& tableStride(size_t tableStride) {
+    assert(tableStride != 0);
+    this->tableStride_ = tableStride;
+    return *this;
+  }
+
+  inline size_t tableStride() const {
+    if (this->tableStride_ == 0) {
+      return embeddingDim();
+    } else {
+      assert(this->tableStride_ >= embeddingDim());
+      return this->tableStride_;
+    }
+  }
+
+  inline EmbeddingLookupOperatorTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return embeddingDim();
+    } else {
+      assert(this->outputStride_ >= embeddingDim());
+      return this->outputStride_;
+    }
+  }
+
+  inline EmbeddingLookupOperatorTester& bags(size_t bags) {
+    assert(bags != 0);
+    this->bags_ = bags;
+    return *this;
+  }
+
+  inline size_t bags() const {
+    return this->bags_;
+  }
+
+  /* Without bag sizes, every index forms a bag of its own and the operator gathers table rows */
+  inline EmbeddingLookupOperatorTester& maxBagSize(size_t maxBagSize) {
+    this->maxBagSize_ = maxBagSize;
+    return *this;
+  }
+
+  inline size_t maxBagSize() const {
+    return this->maxBagSize_;
+  }
+
+  inline EmbeddingLookupOperatorTester& pooling(qnnp_reduce_operation pooling) {
+    this->pooling_ = pooling;
+    return *this;
+  }
+
+  inline qnnp_reduce_operation pooling() const {
+    return this->pooling_;
+  }
+
+  inline EmbeddingLookupOperatorTester& tableScale(float tableScale) {
+    assert(tableScale > 0.0f);
+    assert(std::isnormal(tableScale));
+    this->tableScale_ = tableScale;
+    return *this;
+  }
+
+  inline float tableScale() const {
+    return this->tableScale_;
+  }
+
+  inline EmbeddingLookupOperatorTester& tableZeroPoint(uint8_t tableZeroPoint) {
+    this->tableZeroPoint_ = tableZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t tableZeroPoint() const {
+    return this->tableZeroPoint_;
+  }
+
+  inline EmbeddingLookupOperatorTester& outputScale(float outputScale) {
+    assert(outputScale > 0.0f);
+    assert(std::isnormal(outputScale));
+    this->outputScale_ = outputScale;
+    return *this;
+  }
+
+  inline float outputScale() const {
+    return this->outputScale_;
+  }
+
+  inline EmbeddingLookupOperatorTester& outputZeroPoint(uint8_t outputZeroPoint) {
+    this->outputZeroPoint_ = outputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t outputZeroPoint() const {
+    return this->outputZeroPoint_;
+  }
+
+  inline EmbeddingLookupOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline EmbeddingLookupOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline EmbeddingLookupOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testQ8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+    auto indexRng = std::bind(std::uniform_int_distribution<uint32_t>(0, uint32_t(numEmbeddings() - 1)), rng);
+    auto bagSizeRng = std::bind(std::uniform_int_distribution<uint32_t>(0, uint32_t(maxBagSize())), rng);
+
+    std::vector<uint8_t> table((numEmbeddings() - 1) * tableStride() + embeddingDim());
+    std::vector<uint32_t> offsets(bags() + 1);
+    std::vector<uint32_t> indices;
+    std::vector<uint8_t> output((bags() - 1) * outputStride() + embeddingDim());
+    std::vector<float> outputRef(bags() * embeddingDim());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), std::ref(u8rng));
+      /* Offsets need not start at zero */
+      offsets[0] = maxBagSize() == 0 ? 0 : bagSizeRng();
+      for (size_t b = 0; b < bags(); b++) {
+        offsets[b + 1] = offsets[b] + (maxBagSize() == 0 ? 1 : bagSizeRng());
+      }
+      indices.resize(offsets[bags()]);
+      std::generate(indices.begin(), indices.end(), std::ref(indexRng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference results */
+      const double scale = double(tableScale()) / double(outputScale());
+      for (size_t b = 0; b < bags(); b++) {
+        const size_t bagSize = offsets[b + 1] - offsets[b];
+        for (size_t c = 0; c < embeddingDim(); c++) {
+          double acc = 0.0;
+          for (size_t i = offsets[b]; i < offsets[b + 1]; i++) {
+            acc += double(int32_t(table[indices[i] * tableStride() + c]) - int32_t(tableZeroPoint()));
+          }
+          if (pooling() == qnnp_reduce_operation_mean && bagSize != 0) {
+            acc /= double(bagSize);
+          }
+          const double value = acc * scale + double(outputZeroPoint());
+          outputRef[b * embeddingDim() + c] =
+            float(std::min<double>(std::max<double>(value, double(qmin())), double(qmax())));
+        }
+      }
+
+      /* Create, setup, run, and destroy embedding lookup operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t embeddingLookup = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_embedding_lookup_q8(
+          embeddingDim(), pooling(),
+          tableZeroPoint(), tableScale(),
+          outputZeroPoint(), outputScale(),
+          qmin(), qmax(),
+          &embeddingLookup));
+      ASSERT_NE(nullptr, embeddingLookup);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_embedding_lookup_q8(
+          embeddingLookup,
+          numEmbeddings(), table.data(), tableStride(),
+          indices.size(), indices.data(),
+          bags(), maxBagSize() == 0 ? nullptr : offsets.data(),
+          output.data(), outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(embeddingLookup, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(embeddingLookup));
+      embeddingLookup = nullptr;
+
+      /* Verify results */
+      for (size_t b = 0; b < bags(); b++) {
+        for (size_t c = 0; c < embeddingDim(); c++) {
+          ASSERT_LE(uint32_t(output[b * outputStride() + c]), uint32_t(qmax()));
+          ASSERT_GE(uint32_t(output[b * outputStride() + c]), uint32_t(qmin()));
+          ASSERT_NEAR(float(int32_t(output[b * outputStride() + c])), outputRef[b * embeddingDim() + c], 0.80f) <<
+            "bag " << b << " / " << bags() << ", channel " << c << " / " << embeddingDim();
+        }
+      }
+    }
+  }
+
+ private:
+  size_t embeddingDim_{1};
+  size_t numEmbeddings_{1};
+  size_t tableStride_{0};
+  size_t outputStride_{0};
+  size_t bags_{1};
+  size_t maxBagSize_{0};
+  qnnp_reduce_operation pooling_{qnnp_reduce_operation_sum};
+  float tableScale_{1.0f};
+  uint8_t tableZeroPoint_{121};
+  float outputScale_{1.0f};
+  uint8_t outputZeroPoint_{133};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{3};
+};
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "embedding-lookup-operator-tester.h"
+
+
+TEST(EMBEDDING_LOOKUP_OP, gather_small_dim) {
+  for (size_t embeddingDim = 1; embeddingDim < 8; embeddingDim++) {
+    EmbeddingLookupOperatorTester()
+      .embeddingDim(embeddingDim)
+      .numEmbeddings(37)
+      .bags(43)
+      .tableZeroPoint(133)
+      .testQ8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_OP, gather_large_dim) {
+  for (size_t embeddingDim = 8; embeddingDim <= 128; embeddingDim += 15) {
+    EmbeddingLookupOperatorTester()
+      .embeddingDim(embeddingDim)
+      .numEmbeddings(37)
+      .bags(43)
+      .tableZeroPoint(133)
+      .testQ8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_OP, gather_with_table_stride) {
+  EmbeddingLookupOperatorTester()
+    .embeddingDim(27)
+    .numEmbeddings(37)
+    .tableStride(41)
+    .outputStride(31)
+    .bags(43)
+    .tableZeroPoint(133)
+    .testQ8();
+}
+
+TEST(EMBEDDING_LOOKUP_OP, gather_with_requantization) {
+  for (size_t embeddingDim = 1; embeddingDim <= 32; embeddingDim += 3) {
+    EmbeddingLookupOperatorTester()
+      .embeddingDim(embeddingDim)
+      .numEmbeddings(37)
+      .bags(43)
+      .tableScale(0.75f)
+      .testQ8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_OP, gather_with_qmin) {
+  EmbeddingLookupOperatorTester()
+    .embeddingDim(19)
+    .numEmbeddings(37)
+    .bags(43)
+    .tableZeroPoint(133)
+    .qmin(128)
+    .testQ8();
+}
+
+TEST(EMBEDDING_LOOKUP_OP, gather_with_qmax) {
+  EmbeddingLookupOperatorTester()
+    .embeddingDim(19)
+    .numEmbeddings(37)
+    .bags(43)
+    .tableZeroPoint(133)
+    .qmax(128)
+    .testQ8();
+}
+
+TEST(EMBEDDING_LOOKUP_OP, sum_small_dim) {
+  for (size_t embeddingDim = 1; embeddingDim < 8; embeddingDim++) {
+    EmbeddingLookupOperatorTester()
+      .embeddingDim(embeddingDim)
+      .numEmbeddings(37)
+      .bags(23)
+      .maxBagSize(7)
+      .outputScale(4.0f)
+      .pooling(qnnp_reduce_operation_sum)
+      .testQ8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_OP, sum_large_dim) {
+  for (size_t embeddingDim = 8; embeddingDim <= 128; embeddingDim += 15) {
+    EmbeddingLookupOperatorTester()
+      .embeddingDim(embeddingDim)
+      .numEmbeddings(37)
+      .bags(23)
+      .maxBagSize(7)
+      .outputScale(4.0f)
+      .pooling(qnnp_reduce_operation_sum)
+      .testQ8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_OP, sum_large_bags) {
+  for (size_t embeddingDim = 1; embeddingDim <= 64; embeddingDim += 9) {
+    EmbeddingLookupOperatorTester()
+      .embeddingDim(embeddingDim)
+      .numEmbeddings(37)
+      .bags(23)
+      .maxBagSize(40)
+      .outputScale(16.0f)
+      .pooling(qnnp_reduce_operation_sum)
+      .testQ8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_OP, sum_with_table_stride) {
+  EmbeddingLookupOperatorTester()
+    .embeddingDim(27)
+    .numEmbeddings(37)
+    .tableStride(41)
+    .outputStride(31)
+    .bags(23)
+    .maxBagSize(17)
+    .outputScale(8.0f)
+    .pooling(qnnp_reduce_operation_sum)
+    .testQ8();
+}
+
+TEST(EMBEDDING_LOOKUP_OP, mean_small_dim) {
+  for (size_t embeddingDim = 1; embeddingDim < 8; embeddingDim++) {
+    EmbeddingLookupOperatorTester()
+      .embeddingDim(embeddingDim)
+      .numEmbeddings(37)
+      .bags(23)
+      .maxBagSize(7)
+      .pooling(qnnp_reduce_operation_mean)
+      .testQ8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_OP, mean_large_dim) {
+  for (size_t embeddingDim = 8; embeddingDim <= 128; embeddingDim += 15) {
+    EmbeddingLookupOperatorTester()
+      .embeddingDim(embeddingDim)
+      .numEmbeddings(37)
+      .bags(23)
+      .maxBagSize(7)
+      .pooling(qnnp_reduce_operation_mean)
+      .testQ8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_OP, mean_large_bags) {
+  for (size_t embeddingDim = 1; embeddingDim <= 64; embeddingDim += 9) {
+    EmbeddingLookupOperatorTester()
+      .embeddingDim(embeddingDim)
+      .numEmbeddings(37)
+      .bags(23)
+      .maxBagSize(40)
+      .pooling(qnnp_reduce_operation_mean)
+      .testQ8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_OP, mean_with_scale) {
+  EmbeddingLookupOperatorTester()
+    .embeddingDim(19)
+    .numEmbeddings(37)
+    .bags(23)
+    .maxBagSize(17)
+    .tableScale(0.5f)
+    .outputScale(1.5f)
+    .pooling(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(EMBEDDING_LOOKUP_OP, mean_with_qmin) {
+  EmbeddingLookupOperatorTester()
+    .embeddingDim(19)
+    .numEmbeddings(37)
+    .bags(23)
+    .maxBagSize(17)
+    .qmin(128)
+    .pooling(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(EMBEDDING_LOOKUP_OP, mean_with_qmax) {
+  EmbeddingLookupOperatorTester()
+    .embeddingDim(19)
+    .numEmbeddings(37)
+    .bags(23)
+    .maxBagSize(17)
+    .qmax(128)
+    .pooling(qnnp_reduce_operation_mean)
+    .testQ8();
+}
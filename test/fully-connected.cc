@@ -110,3 +110,21 @@ TEST(FULLY_CONNECTED, small_batch_with_output_stride) {
     .iterations(3)
     .test();
 }
+
+TEST(FULLY_CONNECTED, small_batch_with_2_output_channels) {
+  FullyConnectedTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .outputChannels(2)
+    .iterations(3)
+    .test();
+}
+
+TEST(FULLY_CONNECTED, small_batch_with_1_output_channel) {
+  FullyConnectedTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .outputChannels(1)
+    .iterations(3)
+    .test();
+}
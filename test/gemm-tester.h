@@ -105,6 +105,19 @@ class GemmTester {
     return this->ks_;
   }
 
+  inline GemmTester& kw(size_t kw) {
+    this->kw_ = kw;
+    return *this;
+  }
+
+  inline size_t kw() const {
+    return this->kw_;
+  }
+
+  inline size_t kh() const {
+    return ks() / kw();
+  }
+
   inline size_t packedK() const {
     return k() % kr() == 0 ? k() : (k() / kr() + 1) * kr();
   }
@@ -398,6 +411,113 @@ class GemmTester {
     }
   }
 
+  void testMicroKernel(q8dconv_ukernel_function qdconv) const {
+    ASSERT_LE(m(), mr());
+    ASSERT_LE(n(), nr());
+    ASSERT_GE(k(), kr());
+    ASSERT_EQ(0, ks() % kw());
+
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    /* Windows of adjacent output pixels overlap as in a stride-1 convolution over rows of mr + kw pixels */
+    const size_t aPixelStride = aStride();
+    const size_t aRowStride = (mr() + kw()) * aPixelStride;
+    std::vector<uint8_t> a((kh() - 1) * aRowStride + (mr() + kw() - 2) * aPixelStride + k() + 8);
+    std::vector<uint8_t> b(n() * ks() * k());
+    std::vector<uint8_t, AlignedAllocator<uint8_t, 32>> packedW((ks() * packedK() + sizeof(int32_t) / sizeof(uint8_t)) * packedN());
+    std::vector<int32_t> bias(nr());
+    std::vector<uint8_t> c((m() - 1) * cStride() + n());
+    std::vector<int32_t> acc(m() * n());
+    std::vector<uint8_t> cRef(m() * n());
+
+    const uint8_t* aPtr = a.data() + 8;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(u8rng));
+      std::generate(b.begin(), b.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(c.begin(), c.end(), 0xA5);
+
+      std::fill(packedW.begin(), packedW.end(), bZeroPoint());
+      pack_q8conv_w(n(), ks(), k(), np(), kr(),
+        aZeroPoint(), bZeroPoint(),
+        b.data(), bias.data(), packedW.data());
+
+      ASSERT_NE(*std::max_element(a.cbegin(), a.cend()), *std::min_element(a.cbegin(), a.cend()));
+      ASSERT_NE(*std::max_element(b.cbegin(), b.cend()), *std::min_element(b.cbegin(), b.cend()));
+
+      /* Compute 32-bit results and output quantization arguments */
+      std::fill(acc.begin(), acc.end(), 0);
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          for (size_t kyIndex = 0; kyIndex < kh(); kyIndex++) {
+            for (size_t kxIndex = 0; kxIndex < kw(); kxIndex++) {
+              const uint8_t* aWindow = aPtr + kyIndex * aRowStride + (mIndex + kxIndex) * aPixelStride;
+              const size_t ksIndex = kyIndex * kw() + kxIndex;
+              for (size_t kIndex = 0; kIndex < k(); kIndex++) {
+                acc[mIndex * n() + nIndex] +=
+                  (int32_t(aWindow[kIndex]) - int32_t(aZeroPoint())) *
+                  (int32_t(b[(nIndex * ks() + ksIndex) * k() + kIndex]) - int32_t(bZeroPoint()));
+              }
+            }
+          }
+          acc[mIndex * n() + nIndex] += bias[nIndex];
+        }
+      }
+
+      const int32_t accMin = *std::min_element(acc.cbegin(), acc.cend());
+      const int32_t accMax = *std::max_element(acc.cbegin(), acc.cend());
+      if (m() * n() >= 3) {
+        ASSERT_NE(accMax, accMin)
+            << "Mr x Nr x Kr = " << mr() << " x " << nr() << " x " << kr() << ", M x N x K = " << m() << " x " << n()
+            << " x " << k();
+      }
+
+      const double cScale = uint32_t(accMax - accMin) >= 256 ? double(uint32_t(accMax - accMin)) / 255.0 : 1.00001;
+      const uint8_t cZeroPoint = uint8_t(std::max(std::min(
+        lrint(127.5 - 0.5 * double(accMin + accMax) / cScale),
+        long(std::numeric_limits<uint8_t>::max())), long(std::numeric_limits<uint8_t>::min())));
+
+      const float requantizationScale = 1.0f / float(cScale);
+      const union qnnp_conv_quantization_params quantizationParams =
+        qnnp_compute_conv_quantization_params(
+          aZeroPoint(), bZeroPoint(),
+          requantizationScale, cZeroPoint, qmin(), qmax());
+      const union qnnp_q31_requantization_params scalarRequantizationParams =
+        qnnp_compute_scalar_requantization_params(
+          requantizationScale, cZeroPoint, qmin(), qmax());
+
+      qdconv(
+        m(), n(), k(), kh(), kw(),
+        aPtr, aPixelStride * sizeof(uint8_t), aRowStride * sizeof(uint8_t), aPixelStride * sizeof(uint8_t),
+        packedW.data(),
+        c.data(), cStride() * sizeof(uint8_t),
+        &quantizationParams);
+
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          cRef[mIndex * n() + nIndex] = qnnp_q31_requantize(acc[mIndex * n() + nIndex], scalarRequantizationParams);
+        }
+      }
+
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          ASSERT_LE(uint32_t(c[mIndex * cStride() + nIndex]), uint32_t(qmax()));
+          ASSERT_GE(uint32_t(c[mIndex * cStride() + nIndex]), uint32_t(qmin()));
+          ASSERT_EQ(uint32_t(c[mIndex * cStride() + nIndex]), uint32_t(cRef[mIndex * n() + nIndex]))
+              << "at " << mIndex << ", " << nIndex << ": reference = " << uint32_t(cRef[mIndex * n() + nIndex])
+              << " (accumulator = " << acc[mIndex * n() + nIndex]
+              << "), optimized = " << uint32_t(c[mIndex * cStride() + nIndex]) << ", Mr x Nr x Kr = " << mr() << " x "
+              << nr() << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k()
+              << ", requantization scale = " << requantizationScale << ", output zero point = " << int32_t(cZeroPoint);
+        }
+      }
+    }
+  }
+
   static void q8gemm_compute_row_sum(
     const uint8_t* a,
     size_t m,
@@ -726,6 +846,7 @@ class GemmTester {
   size_t n_{1};
   size_t k_{1};
   size_t ks_{1};
+  size_t kw_{1};
   size_t aStride_{0};
   size_t cStride_{0};
   uint8_t aZeroPoint_{127};
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack/params.h>
+
+
+class IBilinearMicrokernelTester {
+ public:
+  inline IBilinearMicrokernelTester& pixels(size_t pixels) {
+    assert(pixels != 0);
+    this->pixels_ = pixels;
+    return *this;
+  }
+
+  inline size_t pixels() const {
+    return this->pixels_;
+  }
+
+  inline IBilinearMicrokernelTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline IBilinearMicrokernelTester& inputStride(size_t inputStride) {
+    assert(inputStride != 0);
+    this->inputStride_ = inputStride;
+    return *this;
+  }
+
+  inline size_t inputStride() const {
+    if (this->inputStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->inputStride_ >= channels());
+      return this->inputStride_;
+    }
+  }
+
+  inline IBilinearMicrokernelTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->outputStride_ >= channels());
+      return this->outputStride_;
+    }
+  }
+
+  inline IBilinearMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void test(u8ibilinear_ukernel_function ibilinear) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+    auto alphaRng = std::bind(std::uniform_int_distribution<int16_t>(0, 2048), rng);
+
+    std::vector<uint8_t> input((pixels() * 4 - 1) * inputStride() + channels());
+    std::vector<const uint8_t*> indirectInput(pixels() * 4);
+    std::vector<int16_t> weights(pixels() * 2);
+    std::vector<uint8_t> output((pixels() - 1) * outputStride() + channels());
+    std::vector<double> outputRef(pixels() * channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(weights.begin(), weights.end(), std::ref(alphaRng));
+      std::fill(output.begin(), output.end(), 0xA5);
+      for (size_t i = 0; i < indirectInput.size(); i++) {
+        indirectInput[i] = input.data() + i * inputStride();
+      }
+      std::shuffle(indirectInput.begin(), indirectInput.end(), rng);
+
+      /* Compute reference results */
+      for (size_t i = 0; i < pixels(); i++) {
+        const double alphaH = double(weights[i * 2 + 0]) / 2048.0;
+        const double alphaV = double(weights[i * 2 + 1]) / 2048.0;
+        for (size_t c = 0; c < channels(); c++) {
+          const double top =
+            double(indirectInput[i * 4 + 0][c]) * (1.0 - alphaH) + double(indirectInput[i * 4 + 1][c]) * alphaH;
+          const double bottom =
+            double(indirectInput[i * 4 + 2][c]) * (1.0 - alphaH) + double(indirectInput[i * 4 + 3][c]) * alphaH;
+          outputRef[i * channels() + c] = top * (1.0 - alphaV) + bottom * alphaV;
+        }
+      }
+
+      /* Call optimized micro-kernel */
+      ibilinear(
+        pixels(), channels(),
+        indirectInput.data(), weights.data(),
+        output.data(), (outputStride() - channels()) * sizeof(uint8_t));
+
+      /* Verify results */
+      for (size_t i = 0; i < pixels(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(outputRef[i * channels() + c], double(output[i * outputStride() + c]), 0.51)
+            << "at pixel " << i << ", channel " << c << ", pixels = " << pixels() << ", channels = " << channels();
+        }
+      }
+    }
+  }
+
+ private:
+  size_t pixels_{1};
+  size_t channels_{1};
+  size_t inputStride_{0};
+  size_t outputStride_{0};
+  size_t iterations_{3};
+};
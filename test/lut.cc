@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "lut-operator-tester.h"
+
+#include <qnnpack/params.h>
+
+
+TEST(LUT_OP, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LUTOperatorTester()
+      .batchSize(1)
+      .channels(channels)
+      .iterations(3)
+      .testX8();
+  }
+}
+
+TEST(LUT_OP, small_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    LUTOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .iterations(3)
+      .testX8();
+  }
+}
+
+TEST(LUT_OP, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LUTOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .inputStride(129)
+      .iterations(3)
+      .testX8();
+  }
+}
+
+TEST(LUT_OP, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LUTOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .outputStride(117)
+      .iterations(3)
+      .testX8();
+  }
+}
+
+TEST(LUT_OP, small_batch_with_input_and_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LUTOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .inputStride(129)
+      .outputStride(117)
+      .iterations(3)
+      .testX8();
+  }
+}
+
+TEST(LUT_OP, large_batch) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    LUTOperatorTester()
+      .batchSize(257)
+      .channels(channels)
+      .iterations(3)
+      .testX8();
+  }
+}
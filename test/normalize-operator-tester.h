@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class NormalizeOperatorTester {
+ public:
+  inline NormalizeOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline NormalizeOperatorTester& inputSize(size_t inputHeight, size_t inputWidth) {
+    assert(inputHeight >= 1);
+    assert(inputWidth >= 1);
+    this->inputHeight_ = inputHeight;
+    this->inputWidth_ = inputWidth;
+    return *this;
+  }
+
+  inline size_t inputHeight() const {
+    return this->inputHeight_;
+  }
+
+  inline size_t inputWidth() const {
+    return this->inputWidth_;
+  }
+
+  inline NormalizeOperatorTester& outputPixelStride(size_t outputPixelStride) {
+    assert(outputPixelStride != 0);
+    this->outputPixelStride_ = outputPixelStride;
+    return *this;
+  }
+
+  inline size_t outputPixelStride() const {
+    if (this->outputPixelStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->outputPixelStride_ >= channels());
+      return this->outputPixelStride_;
+    }
+  }
+
+  inline NormalizeOperatorTester& batchSize(size_t batchSize) {
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline NormalizeOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline NormalizeOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline NormalizeOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testF32() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(0.0f, 1.0f), rng);
+    auto meanRng = std::bind(std::uniform_real_distribution<float>(0.3f, 0.6f), rng);
+    auto stddevRng = std::bind(std::uniform_real_distribution<float>(0.2f, 0.3f), rng);
+
+    std::vector<float> input(batchSize() * channels() * inputHeight() * inputWidth());
+    std::vector<float> mean(channels());
+    std::vector<float> stddev(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(mean.begin(), mean.end(), std::ref(meanRng));
+      std::generate(stddev.begin(), stddev.end(), std::ref(stddevRng));
+
+      std::vector<uint8_t> output;
+      ASSERT_NO_FATAL_FAILURE(
+        run(mean, stddev, output,
+          qnnp_create_normalize_nchw_f32_nhwc_q8, qnnp_setup_normalize_nchw_f32_nhwc_q8, input.data()));
+      verify(input, mean, stddev, output);
+    }
+  }
+
+  void testU8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+    auto meanRng = std::bind(std::uniform_real_distribution<float>(100.0f, 150.0f), rng);
+    auto stddevRng = std::bind(std::uniform_real_distribution<float>(50.0f, 70.0f), rng);
+
+    std::vector<uint8_t> input(batchSize() * channels() * inputHeight() * inputWidth());
+    std::vector<float> mean(channels());
+    std::vector<float> stddev(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(mean.begin(), mean.end(), std::ref(meanRng));
+      std::generate(stddev.begin(), stddev.end(), std::ref(stddevRng));
+
+      std::vector<uint8_t> output;
+      ASSERT_NO_FATAL_FAILURE(
+        run(mean, stddev, output,
+          qnnp_create_normalize_nchw_u8_nhwc_q8, qnnp_setup_normalize_nchw_u8_nhwc_q8, input.data()));
+      verify(input, mean, stddev, output);
+    }
+  }
+
+ private:
+  template<class CreateFunction, class SetupFunction, class InputType>
+  void run(
+      const std::vector<float>& mean, const std::vector<float>& stddev, std::vector<uint8_t>& output,
+      CreateFunction createFunction, SetupFunction setupFunction, const InputType* input) const
+  {
+    output.assign((batchSize() * inputHeight() * inputWidth() - 1) * outputPixelStride() + channels(), 0xA5);
+
+    /* Create, setup, run, and destroy Normalize operator */
+    ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+    qnnp_operator_t normalize_op = nullptr;
+
+    ASSERT_EQ(qnnp_status_success,
+      createFunction(
+        channels(), mean.data(), stddev.data(),
+        outputZeroPoint(), outputScale(), qmin(), qmax(),
+        &normalize_op));
+    ASSERT_NE(nullptr, normalize_op);
+
+    ASSERT_EQ(qnnp_status_success,
+      setupFunction(
+        normalize_op,
+        batchSize(), inputHeight(), inputWidth(),
+        input, output.data(), outputPixelStride()));
+
+    ASSERT_EQ(qnnp_status_success,
+      qnnp_run_operator(normalize_op, nullptr /* thread pool */));
+
+    ASSERT_EQ(qnnp_status_success,
+      qnnp_delete_operator(normalize_op));
+    normalize_op = nullptr;
+  }
+
+  template<class InputType>
+  void verify(
+      const std::vector<InputType>& input, const std::vector<float>& mean, const std::vector<float>& stddev,
+      const std::vector<uint8_t>& output) const
+  {
+    for (size_t i = 0; i < batchSize(); i++) {
+      for (size_t y = 0; y < inputHeight(); y++) {
+        for (size_t x = 0; x < inputWidth(); x++) {
+          const size_t pixel = (i * inputHeight() + y) * inputWidth() + x;
+          for (size_t c = 0; c < channels(); c++) {
+            const double inputValue =
+              double(input[((i * channels() + c) * inputHeight() + y) * inputWidth() + x]);
+            double outputRef = double(outputZeroPoint()) + (inputValue - double(mean[c])) / double(stddev[c]) / double(outputScale());
+            outputRef = std::min<double>(std::max<double>(outputRef, double(qmin())), double(qmax()));
+            ASSERT_NEAR(outputRef, double(output[pixel * outputPixelStride() + c]), 0.51) <<
+              "batch index " << i << ", pixel (" << y << ", " << x << "), channel " << c;
+          }
+        }
+      }
+    }
+  }
+
+  inline uint8_t outputZeroPoint() const {
+    return 128;
+  }
+
+  inline float outputScale() const {
+    return 0.02f;
+  }
+
+  size_t channels_{3};
+  size_t inputHeight_{1};
+  size_t inputWidth_{1};
+  size_t outputPixelStride_{0};
+  size_t batchSize_{1};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{3};
+};
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "normalize-operator-tester.h"
+
+
+TEST(NORMALIZE_NCHW_F32_NHWC_Q8, small_image) {
+  for (size_t channels = 1; channels <= 8; channels++) {
+    NormalizeOperatorTester()
+      .channels(channels)
+      .inputSize(7, 13)
+      .testF32();
+  }
+}
+
+TEST(NORMALIZE_NCHW_F32_NHWC_Q8, wide_image) {
+  for (size_t channels = 1; channels <= 4; channels++) {
+    NormalizeOperatorTester()
+      .channels(channels)
+      .inputSize(3, 1531)
+      .testF32();
+  }
+}
+
+TEST(NORMALIZE_NCHW_F32_NHWC_Q8, many_channels) {
+  NormalizeOperatorTester()
+    .channels(37)
+    .inputSize(5, 211)
+    .testF32();
+}
+
+TEST(NORMALIZE_NCHW_F32_NHWC_Q8, with_batch) {
+  NormalizeOperatorTester()
+    .batchSize(3)
+    .channels(3)
+    .inputSize(9, 17)
+    .testF32();
+}
+
+TEST(NORMALIZE_NCHW_F32_NHWC_Q8, with_output_stride) {
+  for (size_t channels = 1; channels <= 8; channels++) {
+    NormalizeOperatorTester()
+      .batchSize(2)
+      .channels(channels)
+      .inputSize(5, 19)
+      .outputPixelStride(11)
+      .testF32();
+  }
+}
+
+TEST(NORMALIZE_NCHW_F32_NHWC_Q8, with_qmin) {
+  NormalizeOperatorTester()
+    .channels(3)
+    .inputSize(9, 17)
+    .qmin(128)
+    .testF32();
+}
+
+TEST(NORMALIZE_NCHW_F32_NHWC_Q8, with_qmax) {
+  NormalizeOperatorTester()
+    .channels(3)
+    .inputSize(9, 17)
+    .qmax(128)
+    .testF32();
+}
+
+TEST(NORMALIZE_NCHW_U8_NHWC_Q8, small_image) {
+  for (size_t channels = 1; channels <= 8; channels++) {
+    NormalizeOperatorTester()
+      .channels(channels)
+      .inputSize(7, 13)
+      .testU8();
+  }
+}
+
+TEST(NORMALIZE_NCHW_U8_NHWC_Q8, wide_image) {
+  for (size_t channels = 1; channels <= 4; channels++) {
+    NormalizeOperatorTester()
+      .channels(channels)
+      .inputSize(3, 1531)
+      .testU8();
+  }
+}
+
+TEST(NORMALIZE_NCHW_U8_NHWC_Q8, with_batch) {
+  NormalizeOperatorTester()
+    .batchSize(3)
+    .channels(3)
+    .inputSize(9, 17)
+    .testU8();
+}
+
+TEST(NORMALIZE_NCHW_U8_NHWC_Q8, with_output_stride) {
+  for (size_t channels = 1; channels <= 8; channels++) {
+    NormalizeOperatorTester()
+      .batchSize(2)
+      .channels(channels)
+      .inputSize(5, 19)
+      .outputPixelStride(11)
+      .testU8();
+  }
+}
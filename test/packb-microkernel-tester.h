@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack/params.h>
+#include <qnnpack/pack.h>
+
+
+class PackBMicrokernelTester {
+ public:
+  inline PackBMicrokernelTester& k(size_t k) {
+    assert(k != 0);
+    this->k_ = k;
+    return *this;
+  }
+
+  inline size_t k() const {
+    return this->k_;
+  }
+
+  inline PackBMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline PackBMicrokernelTester& nr(uint32_t nr) {
+    this->nr_ = nr;
+    return *this;
+  }
+
+  inline uint32_t nr() const {
+    return this->nr_;
+  }
+
+  inline PackBMicrokernelTester& kr(uint32_t kr) {
+    this->kr_ = kr;
+    return *this;
+  }
+
+  inline uint32_t kr() const {
+    return this->kr_;
+  }
+
+  inline size_t packedK() const {
+    return (k() + (kr() - 1)) & -kr();
+  }
+
+  inline PackBMicrokernelTester& bStride(size_t bStride) {
+    assert(bStride != 0);
+    this->bStride_ = bStride;
+    return *this;
+  }
+
+  inline size_t bStride() const {
+    if (this->bStride_ == 0) {
+      return n();
+    } else {
+      assert(this->bStride_ >= n());
+      return this->bStride_;
+    }
+  }
+
+  inline PackBMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void test(q8packb_ukernel_function q8packb) const {
+    ASSERT_LE(n(), nr());
+
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> b((k() - 1) * bStride() + n());
+    const size_t packedSize = nr() * (packedK() * sizeof(uint8_t) + sizeof(int32_t));
+    std::vector<uint8_t> packedB(packedSize);
+    std::vector<uint8_t> packedBRef(packedSize);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(b.begin(), b.end(), std::ref(u8rng));
+      std::fill(packedB.begin(), packedB.end(), 0xA5);
+      std::fill(packedBRef.begin(), packedBRef.end(), 0xA5);
+      const uint8_t izp = u8rng();
+      const uint8_t kzp = u8rng();
+
+      /* Compute reference results */
+      pack_q8gemm_b(n(), k(), nr(), kr(), izp, kzp, b.data(), bStride(), 1, packedBRef.data());
+
+      /* Call optimized micro-kernel */
+      q8packb(k(), n(), b.data(), bStride(), izp, kzp, packedB.data());
+
+      /* Verify results */
+      const int32_t* bias = reinterpret_cast<const int32_t*>(packedB.data());
+      const int32_t* biasRef = reinterpret_cast<const int32_t*>(packedBRef.data());
+      for (size_t c = 0; c < nr(); c++) {
+        ASSERT_EQ(biasRef[c], bias[c])
+          << "at bias of column " << c << " of " << k() << "x" << n() << " panel";
+      }
+      const uint8_t* packedWeights = reinterpret_cast<const uint8_t*>(bias + nr());
+      const uint8_t* packedWeightsRef = reinterpret_cast<const uint8_t*>(biasRef + nr());
+      for (size_t i = 0; i < nr() * packedK(); i++) {
+        ASSERT_EQ(uint32_t(packedWeightsRef[i]), uint32_t(packedWeights[i]))
+          << "at packed byte " << i << " of " << k() << "x" << n() << " panel";
+      }
+    }
+  }
+
+ private:
+  size_t k_{1};
+  size_t n_{1};
+  uint32_t nr_{1};
+  uint32_t kr_{1};
+  size_t bStride_{0};
+  size_t iterations_{3};
+};
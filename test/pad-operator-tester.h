@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class PadOperatorTester {
+ public:
+  inline PadOperatorTester& padding(uint32_t padding) {
+    this->paddingTop_ = padding;
+    this->paddingRight_ = padding;
+    this->paddingBottom_ = padding;
+    this->paddingLeft_ = padding;
+    return *this;
+  }
+
+  inline PadOperatorTester& paddingTop(uint32_t paddingTop) {
+    this->paddingTop_ = paddingTop;
+    return *this;
+  }
+
+  inline uint32_t paddingTop() const {
+    return this->paddingTop_;
+  }
+
+  inline PadOperatorTester& paddingRight(uint32_t paddingRight) {
+    this->paddingRight_ = paddingRight;
+    return *this;
+  }
+
+  inline uint32_t paddingRight() const {
+    return this->paddingRight_;
+  }
+
+  inline PadOperatorTester& paddingBottom(uint32_t paddingBottom) {
+    this->paddingBottom_ = paddingBottom;
+    return *this;
+  }
+
+  inline uint32_t paddingBottom() const {
+    return this->paddingBottom_;
+  }
+
+  inline PadOperatorTester& paddingLeft(uint32_t paddingLeft) {
+    this->paddingLeft_ = paddingLeft;
+    return *this;
+  }
+
+  inline uint32_t paddingLeft() const {
+    return this->paddingLeft_;
+  }
+
+  inline PadOperatorTester& inputSize(size_t inputHeight, size_t inputWidth) {
+    assert(inputHeight >= 1);
+    assert(inputWidth >= 1);
+    this->inputHeight_ = inputHeight;
+    this->inputWidth_ = inputWidth;
+    return *this;
+  }
+
+  inline size_t inputHeight() const {
+    return this->inputHeight_;
+  }
+
+  inline size_t inputWidth() const {
+    return this->inputWidth_;
+  }
+
+  inline size_t outputHeight() const {
+    return paddingTop() + inputHeight() + paddingBottom();
+  }
+
+  inline size_t outputWidth() const {
+    return paddingLeft() + inputWidth() + paddingRight();
+  }
+
+  inline PadOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline PadOperatorTester& batchSize(size_t batchSize) {
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline PadOperatorTester& inputPixelStride(size_t inputPixelStride) {
+    assert(inputPixelStride != 0);
+    this->inputPixelStride_ = inputPixelStride;
+    return *this;
+  }
+
+  inline size_t inputPixelStride() const {
+    if (this->inputPixelStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->inputPixelStride_ >= channels());
+      return this->inputPixelStride_;
+    }
+  }
+
+  inline PadOperatorTester& outputPixelStride(size_t outputPixelStride) {
+    assert(outputPixelStride != 0);
+    this->outputPixelStride_ = outputPixelStride;
+    return *this;
+  }
+
+  inline size_t outputPixelStride() const {
+    if (this->outputPixelStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->outputPixelStride_ >= channels());
+      return this->outputPixelStride_;
+    }
+  }
+
+  inline PadOperatorTester& paddingMode(qnnp_padding_mode paddingMode) {
+    this->paddingMode_ = paddingMode;
+    return *this;
+  }
+
+  inline qnnp_padding_mode paddingMode() const {
+    return this->paddingMode_;
+  }
+
+  inline PadOperatorTester& paddingValue(uint8_t paddingValue) {
+    this->paddingValue_ = paddingValue;
+    return *this;
+  }
+
+  inline uint8_t paddingValue() const {
+    return this->paddingValue_;
+  }
+
+  inline PadOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testX8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() * inputHeight() * inputWidth() - 1) * inputPixelStride() + channels());
+    std::vector<uint8_t> output((batchSize() * outputHeight() * outputWidth() - 1) * outputPixelStride() + channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Create, setup, run, and destroy Pad operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t pad_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_pad_nhwc_x8(
+          paddingTop(), paddingRight(), paddingBottom(), paddingLeft(),
+          channels(), paddingMode(), paddingValue(),
+          &pad_op));
+      ASSERT_NE(nullptr, pad_op);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_pad_nhwc_x8(
+          pad_op,
+          batchSize(), inputHeight(), inputWidth(),
+          input.data(), inputPixelStride(),
+          output.data(), outputPixelStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(pad_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(pad_op));
+      pad_op = nullptr;
+
+      /* Verify results */
+      verify(input.data(), inputWidth() * inputPixelStride(), inputHeight() * inputWidth() * inputPixelStride(),
+        output.data(), outputWidth() * outputPixelStride(), outputHeight() * outputWidth() * outputPixelStride());
+    }
+  }
+
+  /*
+   * A max pooling producer with 2x2 windows writes directly into the interior of the output, and the Pad operator
+   * fills only the border pixels around it.
+   */
+  void testX8FusedMaxPooling() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    const size_t poolingInputHeight = inputHeight() * 2;
+    const size_t poolingInputWidth = inputWidth() * 2;
+    std::vector<uint8_t> poolingInput(batchSize() * poolingInputHeight * poolingInputWidth * channels());
+    std::vector<uint8_t> input(batchSize() * inputHeight() * inputWidth() * channels());
+    std::vector<uint8_t> output((batchSize() * outputHeight() * outputWidth() - 1) * outputPixelStride() + channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(poolingInput.begin(), poolingInput.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference max pooling results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t y = 0; y < inputHeight(); y++) {
+          for (size_t x = 0; x < inputWidth(); x++) {
+            for (size_t c = 0; c < channels(); c++) {
+              uint8_t maxValue = 0;
+              for (size_t py = 0; py < 2; py++) {
+                for (size_t px = 0; px < 2; px++) {
+                  maxValue = std::max(maxValue,
+                    poolingInput[((i * poolingInputHeight + y * 2 + py) * poolingInputWidth + x * 2 + px) * channels() + c]);
+                }
+              }
+              input[((i * inputHeight() + y) * inputWidth() + x) * channels() + c] = maxValue;
+            }
+          }
+        }
+      }
+
+      /* Create, setup, and run Max Pooling operator into the interior of the output */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t max_pooling_op = nullptr;
+      qnnp_operator_t pad_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_max_pooling2d_nhwc_u8(
+          0, 0, 0, 0,
+          2, 2,
+          2, 2,
+          1, 1,
+          channels(), 0, 255,
+          &max_pooling_op));
+      ASSERT_NE(nullptr, max_pooling_op);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_pad_nhwc_x8(
+          paddingTop(), paddingRight(), paddingBottom(), paddingLeft(),
+          channels(), paddingMode(), paddingValue(),
+          &pad_op));
+      ASSERT_NE(nullptr, pad_op);
+
+      const size_t outputRowStride = outputWidth() * outputPixelStride();
+      const size_t outputImageStride = outputHeight() * outputRowStride;
+      uint8_t* interior = output.data() + paddingTop() * outputRowStride + paddingLeft() * outputPixelStride();
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_max_pooling2d_nhwc_u8(
+          max_pooling_op,
+          batchSize(), poolingInputHeight, poolingInputWidth,
+          poolingInput.data(), channels(),
+          interior, outputPixelStride(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_set_output_row_stride(max_pooling_op, outputRowStride, outputImageStride));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_pad_nhwc_x8(
+          pad_op,
+          batchSize(), inputHeight(), inputWidth(),
+          interior, outputPixelStride(),
+          output.data(), outputPixelStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(max_pooling_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(pad_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(max_pooling_op));
+      max_pooling_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(pad_op));
+      pad_op = nullptr;
+
+      /* Verify results */
+      verify(input.data(), inputWidth() * channels(), inputHeight() * inputWidth() * channels(),
+        output.data(), outputRowStride, outputImageStride, channels());
+    }
+  }
+
+ private:
+  void verify(
+      const uint8_t* input, size_t inputRowStride, size_t inputImageStride,
+      const uint8_t* output, size_t outputRowStride, size_t outputImageStride,
+      size_t inputPixelStride = 0) const
+  {
+    if (inputPixelStride == 0) {
+      inputPixelStride = this->inputPixelStride();
+    }
+    for (size_t i = 0; i < batchSize(); i++) {
+      for (size_t oy = 0; oy < outputHeight(); oy++) {
+        for (size_t ox = 0; ox < outputWidth(); ox++) {
+          const ptrdiff_t iy = ptrdiff_t(oy) - ptrdiff_t(paddingTop());
+          const ptrdiff_t ix = ptrdiff_t(ox) - ptrdiff_t(paddingLeft());
+          const bool inside = iy >= 0 && iy < ptrdiff_t(inputHeight()) && ix >= 0 && ix < ptrdiff_t(inputWidth());
+          const size_t sy = sourceIndex(iy, inputHeight());
+          const size_t sx = sourceIndex(ix, inputWidth());
+          for (size_t c = 0; c < channels(); c++) {
+            const uint8_t y = output[i * outputImageStride + oy * outputRowStride + ox * outputPixelStride() + c];
+            if (!inside && paddingMode() == qnnp_padding_mode_constant) {
+              ASSERT_EQ(uint32_t(paddingValue()), uint32_t(y))
+                << "batch index = " << i << ", output pixel = (" << oy << ", " << ox << "), channel = " << c;
+            } else {
+              ASSERT_EQ(uint32_t(input[i * inputImageStride + sy * inputRowStride + sx * inputPixelStride + c]), uint32_t(y))
+                << "batch index = " << i << ", output pixel = (" << oy << ", " << ox << "), channel = " << c;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  inline size_t sourceIndex(ptrdiff_t index, size_t size) const {
+    if (index < 0) {
+      return paddingMode() == qnnp_padding_mode_reflect ? size_t(-index) : 0;
+    } else if (size_t(index) >= size) {
+      return paddingMode() == qnnp_padding_mode_reflect ? 2 * (size - 1) - size_t(index) : size - 1;
+    } else {
+      return size_t(index);
+    }
+  }
+
+  uint32_t paddingTop_{0};
+  uint32_t paddingRight_{0};
+  uint32_t paddingBottom_{0};
+  uint32_t paddingLeft_{0};
+  size_t inputHeight_{1};
+  size_t inputWidth_{1};
+  size_t channels_{1};
+  size_t batchSize_{1};
+  size_t inputPixelStride_{0};
+  size_t outputPixelStride_{0};
+  qnnp_padding_mode paddingMode_{qnnp_padding_mode_constant};
+  uint8_t paddingValue_{0};
+  size_t iterations_{3};
+};
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "pad-operator-tester.h"
+
+
+TEST(PAD_OP, constant_unit_batch) {
+  for (size_t channels = 1; channels < 40; channels += 7) {
+    for (uint32_t padding = 1; padding <= 3; padding++) {
+      PadOperatorTester()
+        .batchSize(1)
+        .inputSize(7, 9)
+        .padding(padding)
+        .channels(channels)
+        .paddingMode(qnnp_padding_mode_constant)
+        .paddingValue(127)
+        .testX8();
+    }
+  }
+}
+
+TEST(PAD_OP, constant_asymmetric_padding) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(1)
+      .inputSize(7, 9)
+      .paddingTop(1)
+      .paddingRight(3)
+      .paddingBottom(0)
+      .paddingLeft(2)
+      .channels(channels)
+      .paddingMode(qnnp_padding_mode_constant)
+      .paddingValue(127)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, constant_small_batch) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(3)
+      .inputSize(5, 6)
+      .padding(2)
+      .channels(channels)
+      .paddingMode(qnnp_padding_mode_constant)
+      .paddingValue(127)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, constant_with_input_stride) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(3)
+      .inputSize(5, 6)
+      .padding(2)
+      .channels(channels)
+      .inputPixelStride(channels + 5)
+      .paddingMode(qnnp_padding_mode_constant)
+      .paddingValue(127)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, constant_with_output_stride) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(3)
+      .inputSize(5, 6)
+      .padding(2)
+      .channels(channels)
+      .outputPixelStride(channels + 3)
+      .paddingMode(qnnp_padding_mode_constant)
+      .paddingValue(127)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, constant_fused_max_pooling) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(2)
+      .inputSize(5, 6)
+      .paddingTop(1)
+      .paddingRight(2)
+      .paddingBottom(3)
+      .paddingLeft(1)
+      .channels(channels)
+      .paddingMode(qnnp_padding_mode_constant)
+      .paddingValue(127)
+      .testX8FusedMaxPooling();
+    PadOperatorTester()
+      .batchSize(2)
+      .inputSize(5, 6)
+      .padding(1)
+      .channels(channels)
+      .outputPixelStride(channels + 3)
+      .paddingMode(qnnp_padding_mode_constant)
+      .paddingValue(127)
+      .testX8FusedMaxPooling();
+  }
+}
+
+TEST(PAD_OP, reflect_unit_batch) {
+  for (size_t channels = 1; channels < 40; channels += 7) {
+    for (uint32_t padding = 1; padding <= 3; padding++) {
+      PadOperatorTester()
+        .batchSize(1)
+        .inputSize(7, 9)
+        .padding(padding)
+        .channels(channels)
+        .paddingMode(qnnp_padding_mode_reflect)
+        .testX8();
+    }
+  }
+}
+
+TEST(PAD_OP, reflect_asymmetric_padding) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(1)
+      .inputSize(7, 9)
+      .paddingTop(1)
+      .paddingRight(3)
+      .paddingBottom(0)
+      .paddingLeft(2)
+      .channels(channels)
+      .paddingMode(qnnp_padding_mode_reflect)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, reflect_small_batch) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(3)
+      .inputSize(5, 6)
+      .padding(2)
+      .channels(channels)
+      .paddingMode(qnnp_padding_mode_reflect)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, reflect_with_input_stride) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(3)
+      .inputSize(5, 6)
+      .padding(2)
+      .channels(channels)
+      .inputPixelStride(channels + 5)
+      .paddingMode(qnnp_padding_mode_reflect)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, reflect_with_output_stride) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(3)
+      .inputSize(5, 6)
+      .padding(2)
+      .channels(channels)
+      .outputPixelStride(channels + 3)
+      .paddingMode(qnnp_padding_mode_reflect)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, reflect_fused_max_pooling) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(2)
+      .inputSize(5, 6)
+      .paddingTop(1)
+      .paddingRight(2)
+      .paddingBottom(3)
+      .paddingLeft(1)
+      .channels(channels)
+      .paddingMode(qnnp_padding_mode_reflect)
+      .testX8FusedMaxPooling();
+    PadOperatorTester()
+      .batchSize(2)
+      .inputSize(5, 6)
+      .padding(1)
+      .channels(channels)
+      .outputPixelStride(channels + 3)
+      .paddingMode(qnnp_padding_mode_reflect)
+      .testX8FusedMaxPooling();
+  }
+}
+
+TEST(PAD_OP, edge_unit_batch) {
+  for (size_t channels = 1; channels < 40; channels += 7) {
+    for (uint32_t padding = 1; padding <= 3; padding++) {
+      PadOperatorTester()
+        .batchSize(1)
+        .inputSize(7, 9)
+        .padding(padding)
+        .channels(channels)
+        .paddingMode(qnnp_padding_mode_edge)
+        .testX8();
+    }
+  }
+}
+
+TEST(PAD_OP, edge_asymmetric_padding) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(1)
+      .inputSize(7, 9)
+      .paddingTop(1)
+      .paddingRight(3)
+      .paddingBottom(0)
+      .paddingLeft(2)
+      .channels(channels)
+      .paddingMode(qnnp_padding_mode_edge)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, edge_small_batch) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(3)
+      .inputSize(5, 6)
+      .padding(2)
+      .channels(channels)
+      .paddingMode(qnnp_padding_mode_edge)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, edge_with_input_stride) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(3)
+      .inputSize(5, 6)
+      .padding(2)
+      .channels(channels)
+      .inputPixelStride(channels + 5)
+      .paddingMode(qnnp_padding_mode_edge)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, edge_with_output_stride) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(3)
+      .inputSize(5, 6)
+      .padding(2)
+      .channels(channels)
+      .outputPixelStride(channels + 3)
+      .paddingMode(qnnp_padding_mode_edge)
+      .testX8();
+  }
+}
+
+TEST(PAD_OP, edge_fused_max_pooling) {
+  for (size_t channels = 1; channels < 40; channels += 13) {
+    PadOperatorTester()
+      .batchSize(2)
+      .inputSize(5, 6)
+      .paddingTop(1)
+      .paddingRight(2)
+      .paddingBottom(3)
+      .paddingLeft(1)
+      .channels(channels)
+      .paddingMode(qnnp_padding_mode_edge)
+      .testX8FusedMaxPooling();
+    PadOperatorTester()
+      .batchSize(2)
+      .inputSize(5, 6)
+      .padding(1)
+      .channels(channels)
+      .outputPixelStride(channels + 3)
+      .paddingMode(qnnp_padding_mode_edge)
+      .testX8FusedMaxPooling();
+  }
+}
+
+TEST(PAD_OP, edge_unit_input) {
+  PadOperatorTester()
+    .batchSize(2)
+    .inputSize(1, 1)
+    .padding(3)
+    .channels(5)
+    .paddingMode(qnnp_padding_mode_edge)
+    .testX8();
+}
@@ -1106,3 +1106,549 @@
     }
   }
 #endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(Q8CONV_8x2c4_SSE2, k_eq_8) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .aStride(37)
+      .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_eq_8_strided_c) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .aStride(37)
+      .cStride(17)
+      .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_eq_8_qmin128) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .qmin(128)
+      .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_eq_8_qmax128) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .qmax(128)
+      .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_eq_8_azp_only) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .aZeroPoint(255)
+      .bZeroPoint(0)
+      .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_eq_8_bzp_only) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .aZeroPoint(0)
+      .bZeroPoint(255)
+      .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_gt_8) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .aStride(37)
+        .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_gt_8_strided_c) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .aStride(37)
+        .cStride(17)
+        .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_gt_8_azp_only) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .aStride(37)
+        .aZeroPoint(255)
+        .bZeroPoint(0)
+        .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_gt_8_bzp_only) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .aStride(37)
+        .aZeroPoint(0)
+        .bZeroPoint(255)
+        .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_gt_8_subtile) {
+    for (size_t k = 9; k < 16; k++) {
+      for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t n = 1; n <= 2; n++) {
+          GemmTester()
+            .mr(8)
+            .nr(2)
+            .np(2)
+            .kr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .aStride(37)
+            .iterations(3)
+            .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_div_8) {
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .aStride(171)
+        .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_div_8_strided_c) {
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .aStride(171)
+        .cStride(17)
+        .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8CONV_8x2c4_SSE2, k_div_8_subtile) {
+    for (size_t k = 16; k < 128; k += 24) {
+      for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t n = 1; n <= 2; n++) {
+          GemmTester()
+            .mr(8)
+            .nr(2)
+            .np(2)
+            .kr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .aStride(171)
+            .iterations(3)
+            .testMicroKernel(q8conv_ukernel_8x2c4__sse2);
+        }
+      }
+    }
+  }
+#endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(Q8DCONV_4x4c2_SSE2, k_eq_8) {
+    GemmTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .ks(9)
+      .kw(3)
+      .aStride(37)
+      .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_eq_8_strided_c) {
+    GemmTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .ks(9)
+      .kw(3)
+      .aStride(37)
+      .cStride(17)
+      .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_eq_8_qmin128) {
+    GemmTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .ks(9)
+      .kw(3)
+      .qmin(128)
+      .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_eq_8_qmax128) {
+    GemmTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .ks(9)
+      .kw(3)
+      .qmax(128)
+      .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_eq_8_azp_only) {
+    GemmTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .ks(9)
+      .kw(3)
+      .aZeroPoint(255)
+      .bZeroPoint(0)
+      .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_eq_8_bzp_only) {
+    GemmTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .ks(9)
+      .kw(3)
+      .aZeroPoint(0)
+      .bZeroPoint(255)
+      .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_gt_8) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(4)
+        .nr(4)
+        .np(4)
+        .kr(2)
+        .m(4)
+        .n(4)
+        .k(k)
+        .ks(9)
+        .kw(3)
+        .aStride(37)
+        .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_gt_8_strided_c) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(4)
+        .nr(4)
+        .np(4)
+        .kr(2)
+        .m(4)
+        .n(4)
+        .k(k)
+        .ks(9)
+        .kw(3)
+        .aStride(37)
+        .cStride(17)
+        .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_gt_8_azp_only) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(4)
+        .nr(4)
+        .np(4)
+        .kr(2)
+        .m(4)
+        .n(4)
+        .k(k)
+        .ks(9)
+        .kw(3)
+        .aStride(37)
+        .aZeroPoint(255)
+        .bZeroPoint(0)
+        .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_gt_8_bzp_only) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(4)
+        .nr(4)
+        .np(4)
+        .kr(2)
+        .m(4)
+        .n(4)
+        .k(k)
+        .ks(9)
+        .kw(3)
+        .aStride(37)
+        .aZeroPoint(0)
+        .bZeroPoint(255)
+        .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_gt_8_subtile) {
+    for (size_t k = 9; k < 16; k++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmTester()
+            .mr(4)
+            .nr(4)
+            .np(4)
+            .kr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .ks(9)
+            .kw(3)
+            .aStride(37)
+            .iterations(3)
+            .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_div_8) {
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmTester()
+        .mr(4)
+        .nr(4)
+        .np(4)
+        .kr(2)
+        .m(4)
+        .n(4)
+        .k(k)
+        .ks(9)
+        .kw(3)
+        .aStride(171)
+        .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_div_8_strided_c) {
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmTester()
+        .mr(4)
+        .nr(4)
+        .np(4)
+        .kr(2)
+        .m(4)
+        .n(4)
+        .k(k)
+        .ks(9)
+        .kw(3)
+        .aStride(171)
+        .cStride(17)
+        .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, k_div_8_subtile) {
+    for (size_t k = 16; k < 128; k += 24) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmTester()
+            .mr(4)
+            .nr(4)
+            .np(4)
+            .kr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .ks(9)
+            .kw(3)
+            .aStride(171)
+            .iterations(3)
+            .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, kernel_1x1) {
+    for (size_t k = 2; k < 24; k += 5) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmTester()
+          .mr(4)
+          .nr(4)
+          .np(4)
+          .kr(2)
+          .m(m)
+          .n(4)
+          .k(k)
+          .ks(1)
+          .kw(1)
+          .aStride(37)
+          .iterations(3)
+          .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+      }
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, kernel_1x7) {
+    for (size_t k = 2; k < 24; k += 5) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmTester()
+          .mr(4)
+          .nr(4)
+          .np(4)
+          .kr(2)
+          .m(m)
+          .n(4)
+          .k(k)
+          .ks(7)
+          .kw(7)
+          .aStride(37)
+          .iterations(3)
+          .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+      }
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, kernel_7x1) {
+    for (size_t k = 2; k < 24; k += 5) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmTester()
+          .mr(4)
+          .nr(4)
+          .np(4)
+          .kr(2)
+          .m(m)
+          .n(4)
+          .k(k)
+          .ks(7)
+          .kw(1)
+          .aStride(37)
+          .iterations(3)
+          .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+      }
+    }
+  }
+
+  TEST(Q8DCONV_4x4c2_SSE2, kernel_5x5) {
+    for (size_t k = 2; k < 24; k += 5) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmTester()
+          .mr(4)
+          .nr(4)
+          .np(4)
+          .kr(2)
+          .m(m)
+          .n(4)
+          .k(k)
+          .ks(25)
+          .kw(5)
+          .aStride(37)
+          .iterations(3)
+          .testMicroKernel(q8dconv_ukernel_4x4c2__sse2);
+      }
+    }
+  }
+#endif
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <qnnpack/q8dequant.h>
+
+#include "quantize-microkernel-tester.h"
+
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+TEST(Q8DEQUANT__NEON, n_eq_16) {
+  QuantizeMicrokernelTester()
+    .n(16)
+    .testDequantize(q8dequant_ukernel__neon);
+}
+
+TEST(Q8DEQUANT__NEON, n_div_16) {
+  for (size_t n = 16; n < 512; n += 16) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testDequantize(q8dequant_ukernel__neon);
+  }
+}
+
+TEST(Q8DEQUANT__NEON, n_gt_16) {
+  for (size_t n = 17; n < 32; n++) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testDequantize(q8dequant_ukernel__neon);
+  }
+}
+
+TEST(Q8DEQUANT__NEON, n_lt_16) {
+  for (size_t n = 1; n < 16; n++) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testDequantize(q8dequant_ukernel__neon);
+  }
+}
+
+TEST(Q8DEQUANT__NEON, scale) {
+  for (size_t n = 1; n < 128; n += 5) {
+    for (float scale : {0.001f, 0.1f, 1.0f, 2.5f, 40.0f}) {
+      QuantizeMicrokernelTester()
+        .n(n)
+        .scale(scale)
+        .testDequantize(q8dequant_ukernel__neon);
+    }
+  }
+}
+
+TEST(Q8DEQUANT__NEON, zero_point) {
+  for (size_t n = 1; n < 128; n += 5) {
+    for (int32_t zeroPoint = 0; zeroPoint <= 255; zeroPoint += 51) {
+      QuantizeMicrokernelTester()
+        .n(n)
+        .zeroPoint(uint8_t(zeroPoint))
+        .testDequantize(q8dequant_ukernel__neon);
+    }
+  }
+}
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+TEST(Q8DEQUANT__SSE2, n_eq_16) {
+  QuantizeMicrokernelTester()
+    .n(16)
+    .testDequantize(q8dequant_ukernel__sse2);
+}
+
+TEST(Q8DEQUANT__SSE2, n_div_16) {
+  for (size_t n = 16; n < 512; n += 16) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testDequantize(q8dequant_ukernel__sse2);
+  }
+}
+
+TEST(Q8DEQUANT__SSE2, n_gt_16) {
+  for (size_t n = 17; n < 32; n++) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testDequantize(q8dequant_ukernel__sse2);
+  }
+}
+
+TEST(Q8DEQUANT__SSE2, n_lt_16) {
+  for (size_t n = 1; n < 16; n++) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testDequantize(q8dequant_ukernel__sse2);
+  }
+}
+
+TEST(Q8DEQUANT__SSE2, scale) {
+  for (size_t n = 1; n < 128; n += 5) {
+    for (float scale : {0.001f, 0.1f, 1.0f, 2.5f, 40.0f}) {
+      QuantizeMicrokernelTester()
+        .n(n)
+        .scale(scale)
+        .testDequantize(q8dequant_ukernel__sse2);
+    }
+  }
+}
+
+TEST(Q8DEQUANT__SSE2, zero_point) {
+  for (size_t n = 1; n < 128; n += 5) {
+    for (int32_t zeroPoint = 0; zeroPoint <= 255; zeroPoint += 51) {
+      QuantizeMicrokernelTester()
+        .n(n)
+        .zeroPoint(uint8_t(zeroPoint))
+        .testDequantize(q8dequant_ukernel__sse2);
+    }
+  }
+}
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <depthwise-microkernel-tester.h>
+#include <qnnpack/q8dw.h>
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(Q8DWPX_mc4_SSE2, single_output) {
+    for (uint32_t channels = 2; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(1)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, single_output_with_qmin) {
+    for (uint32_t channels = 2; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(1)
+        .qmin(128)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, single_output_with_qmax) {
+    for (uint32_t channels = 2; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(1)
+        .qmax(128)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, single_output_with_input_zero_point_only) {
+    for (uint32_t channels = 2; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(1)
+        .inputZeroPoint(255)
+        .kernelZeroPoint(0)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, single_output_with_kernel_zero_point_only) {
+    for (uint32_t channels = 2; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(1)
+        .inputZeroPoint(0)
+        .kernelZeroPoint(255)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, multi_output) {
+    for (uint32_t channels = 1; channels <= 4; channels++) {
+      for (uint32_t width = 2; width <= 17; width++) {
+        DepthwiseMicrokernelTester()
+          .kernelHeight(3)
+          .kernelWidth(3)
+          .cr(4)
+          .vr(8)
+          .channels(channels)
+          .width(width)
+          .test(q8dwpx_ukernel_mc4__sse2);
+      }
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, multi_output_with_qmin) {
+    for (uint32_t channels = 1; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(11)
+        .qmin(128)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, multi_output_with_qmax) {
+    for (uint32_t channels = 1; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(11)
+        .qmax(128)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, multi_output_with_subsampling) {
+    for (uint32_t channels = 1; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(11)
+        .subsampling(2)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, multi_output_with_input_stride) {
+    for (uint32_t channels = 1; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(11)
+        .inputStride(7)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, multi_output_with_output_stride) {
+    for (uint32_t channels = 1; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(11)
+        .outputStride(7)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, multi_output_with_kernel_1x1) {
+    for (uint32_t channels = 2; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(1)
+        .kernelWidth(1)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(11)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, multi_output_with_kernel_1x15) {
+    for (uint32_t channels = 2; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(1)
+        .kernelWidth(15)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(11)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, multi_output_with_kernel_5x5) {
+    for (uint32_t channels = 1; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(11)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+
+  TEST(Q8DWPX_mc4_SSE2, multi_output_with_kernel_7x7) {
+    for (uint32_t channels = 1; channels <= 4; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(7)
+        .kernelWidth(7)
+        .cr(4)
+        .vr(8)
+        .channels(channels)
+        .width(11)
+        .test(q8dwpx_ukernel_mc4__sse2);
+    }
+  }
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
@@ -2504,3 +2504,281 @@
     }
   }
 #endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(Q8GEMM_8x2c4_SSE2, k_eq_8) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_eq_8_strided_a) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .aStride(37)
+      .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_eq_8_strided_c) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .cStride(17)
+      .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_eq_8_qmin128) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .qmin(128)
+      .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_eq_8_qmax128) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .qmax(128)
+      .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_eq_8_azp0) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .aZeroPoint(0)
+      .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_eq_8_bzp0) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .bZeroPoint(0)
+      .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_eq_8_nozp) {
+    GemmTester()
+      .mr(8)
+      .nr(2)
+      .np(2)
+      .kr(4)
+      .m(8)
+      .n(2)
+      .k(8)
+      .aZeroPoint(0)
+      .bZeroPoint(0)
+      .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_gt_8) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_gt_8_strided_a) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .aStride(37)
+        .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_gt_8_strided_c) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .cStride(17)
+        .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_gt_8_azp0) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .aZeroPoint(0)
+        .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_gt_8_bzp0) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .bZeroPoint(0)
+        .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_gt_8_nozp) {
+    for (size_t k = 9; k < 16; k++) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .aZeroPoint(0)
+        .bZeroPoint(0)
+        .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_gt_8_subtile) {
+    for (size_t k = 9; k < 16; k++) {
+      for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t n = 1; n <= 2; n++) {
+          GemmTester()
+            .mr(8)
+            .nr(2)
+            .np(2)
+            .kr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(3)
+            .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_div_8) {
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_div_8_strided_a) {
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .aStride(171)
+        .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_div_8_strided_c) {
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmTester()
+        .mr(8)
+        .nr(2)
+        .np(2)
+        .kr(4)
+        .m(8)
+        .n(2)
+        .k(k)
+        .cStride(17)
+        .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_8x2c4_SSE2, k_div_8_subtile) {
+    for (size_t k = 16; k < 128; k += 24) {
+      for (uint32_t m = 1; m <= 8; m++) {
+        for (uint32_t n = 1; n <= 2; n++) {
+          GemmTester()
+            .mr(8)
+            .nr(2)
+            .np(2)
+            .kr(4)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(3)
+            .testMicroKernel(q8gemm_ukernel_8x2c4__sse2);
+        }
+      }
+    }
+  }
+#endif
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <packb-microkernel-tester.h>
+#include <qnnpack/q8packb.h>
+
+// clang-format off
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(Q8PACKB_8C1__NEON, k_eq_1) {
+    PackBMicrokernelTester()
+      .k(1)
+      .n(8)
+      .nr(8)
+      .kr(1)
+      .test(q8packb_ukernel_8c1__neon);
+  }
+
+  TEST(Q8PACKB_8C1__NEON, k_lt_8) {
+    for (size_t k = 1; k < 8; k++) {
+      PackBMicrokernelTester()
+        .k(k)
+        .n(8)
+        .nr(8)
+        .kr(1)
+        .test(q8packb_ukernel_8c1__neon);
+    }
+  }
+
+  TEST(Q8PACKB_8C1__NEON, k_div_8) {
+    for (size_t k = 8; k <= 64; k += 8) {
+      PackBMicrokernelTester()
+        .k(k)
+        .n(8)
+        .nr(8)
+        .kr(1)
+        .test(q8packb_ukernel_8c1__neon);
+    }
+  }
+
+  TEST(Q8PACKB_8C1__NEON, k_gt_8) {
+    for (size_t k = 9; k < 32; k++) {
+      PackBMicrokernelTester()
+        .k(k)
+        .n(8)
+        .nr(8)
+        .kr(1)
+        .test(q8packb_ukernel_8c1__neon);
+    }
+  }
+
+  TEST(Q8PACKB_8C1__NEON, n_lt_8) {
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t k = 1; k < 32; k++) {
+        PackBMicrokernelTester()
+          .k(k)
+          .n(n)
+          .nr(8)
+          .kr(1)
+          .test(q8packb_ukernel_8c1__neon);
+      }
+    }
+  }
+
+  TEST(Q8PACKB_8C1__NEON, b_stride) {
+    for (size_t n = 1; n <= 8; n++) {
+      for (size_t k = 1; k < 32; k++) {
+        PackBMicrokernelTester()
+          .k(k)
+          .n(n)
+          .nr(8)
+          .kr(1)
+          .bStride(37)
+          .test(q8packb_ukernel_8c1__neon);
+      }
+    }
+  }
+
+  TEST(Q8PACKB_8C1__NEON, k_large) {
+    PackBMicrokernelTester()
+      .k(1027)
+      .n(8)
+      .nr(8)
+      .kr(1)
+      .test(q8packb_ukernel_8c1__neon);
+  }
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(Q8PACKB_4C2__SSE2, k_eq_2) {
+    PackBMicrokernelTester()
+      .k(2)
+      .n(4)
+      .nr(4)
+      .kr(2)
+      .test(q8packb_ukernel_4c2__sse2);
+  }
+
+  TEST(Q8PACKB_4C2__SSE2, k_lt_8) {
+    for (size_t k = 1; k < 8; k++) {
+      PackBMicrokernelTester()
+        .k(k)
+        .n(4)
+        .nr(4)
+        .kr(2)
+        .test(q8packb_ukernel_4c2__sse2);
+    }
+  }
+
+  TEST(Q8PACKB_4C2__SSE2, k_div_8) {
+    for (size_t k = 8; k <= 64; k += 8) {
+      PackBMicrokernelTester()
+        .k(k)
+        .n(4)
+        .nr(4)
+        .kr(2)
+        .test(q8packb_ukernel_4c2__sse2);
+    }
+  }
+
+  TEST(Q8PACKB_4C2__SSE2, k_gt_8) {
+    for (size_t k = 9; k < 32; k++) {
+      PackBMicrokernelTester()
+        .k(k)
+        .n(4)
+        .nr(4)
+        .kr(2)
+        .test(q8packb_ukernel_4c2__sse2);
+    }
+  }
+
+  TEST(Q8PACKB_4C2__SSE2, n_lt_4) {
+    for (size_t n = 1; n < 4; n++) {
+      for (size_t k = 1; k < 32; k++) {
+        PackBMicrokernelTester()
+          .k(k)
+          .n(n)
+          .nr(4)
+          .kr(2)
+          .test(q8packb_ukernel_4c2__sse2);
+      }
+    }
+  }
+
+  TEST(Q8PACKB_4C2__SSE2, b_stride) {
+    for (size_t n = 1; n <= 4; n++) {
+      for (size_t k = 1; k < 32; k++) {
+        PackBMicrokernelTester()
+          .k(k)
+          .n(n)
+          .nr(4)
+          .kr(2)
+          .bStride(37)
+          .test(q8packb_ukernel_4c2__sse2);
+      }
+    }
+  }
+
+  TEST(Q8PACKB_4C2__SSE2, k_large) {
+    PackBMicrokernelTester()
+      .k(1027)
+      .n(4)
+      .nr(4)
+      .kr(2)
+      .test(q8packb_ukernel_4c2__sse2);
+  }
+
+  TEST(Q8PACKB_2C4__SSE2, k_eq_4) {
+    PackBMicrokernelTester()
+      .k(4)
+      .n(2)
+      .nr(2)
+      .kr(4)
+      .test(q8packb_ukernel_2c4__sse2);
+  }
+
+  TEST(Q8PACKB_2C4__SSE2, k_lt_8) {
+    for (size_t k = 1; k < 8; k++) {
+      PackBMicrokernelTester()
+        .k(k)
+        .n(2)
+        .nr(2)
+        .kr(4)
+        .test(q8packb_ukernel_2c4__sse2);
+    }
+  }
+
+  TEST(Q8PACKB_2C4__SSE2, k_div_8) {
+    for (size_t k = 8; k <= 64; k += 8) {
+      PackBMicrokernelTester()
+        .k(k)
+        .n(2)
+        .nr(2)
+        .kr(4)
+        .test(q8packb_ukernel_2c4__sse2);
+    }
+  }
+
+  TEST(Q8PACKB_2C4__SSE2, k_gt_8) {
+    for (size_t k = 9; k < 32; k++) {
+      PackBMicrokernelTester()
+        .k(k)
+        .n(2)
+        .nr(2)
+        .kr(4)
+        .test(q8packb_ukernel_2c4__sse2);
+    }
+  }
+
+  TEST(Q8PACKB_2C4__SSE2, n_lt_2) {
+    for (size_t n = 1; n < 2; n++) {
+      for (size_t k = 1; k < 32; k++) {
+        PackBMicrokernelTester()
+          .k(k)
+          .n(n)
+          .nr(2)
+          .kr(4)
+          .test(q8packb_ukernel_2c4__sse2);
+      }
+    }
+  }
+
+  TEST(Q8PACKB_2C4__SSE2, b_stride) {
+    for (size_t n = 1; n <= 2; n++) {
+      for (size_t k = 1; k < 32; k++) {
+        PackBMicrokernelTester()
+          .k(k)
+          .n(n)
+          .nr(2)
+          .kr(4)
+          .bStride(37)
+          .test(q8packb_ukernel_2c4__sse2);
+      }
+    }
+  }
+
+  TEST(Q8PACKB_2C4__SSE2, k_large) {
+    PackBMicrokernelTester()
+      .k(1027)
+      .n(2)
+      .nr(2)
+      .kr(4)
+      .test(q8packb_ukernel_2c4__sse2);
+  }
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
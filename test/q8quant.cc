@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <qnnpack/q8quant.h>
+
+#include "quantize-microkernel-tester.h"
+
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+TEST(Q8QUANT__NEON, n_eq_16) {
+  QuantizeMicrokernelTester()
+    .n(16)
+    .testQuantize(q8quant_ukernel__neon);
+}
+
+TEST(Q8QUANT__NEON, n_div_16) {
+  for (size_t n = 16; n < 512; n += 16) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testQuantize(q8quant_ukernel__neon);
+  }
+}
+
+TEST(Q8QUANT__NEON, n_gt_16) {
+  for (size_t n = 17; n < 32; n++) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testQuantize(q8quant_ukernel__neon);
+  }
+}
+
+TEST(Q8QUANT__NEON, n_lt_16) {
+  for (size_t n = 1; n < 16; n++) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testQuantize(q8quant_ukernel__neon);
+  }
+}
+
+TEST(Q8QUANT__NEON, scale) {
+  for (size_t n = 1; n < 128; n += 5) {
+    for (float scale : {0.001f, 0.1f, 1.0f, 2.5f, 40.0f}) {
+      QuantizeMicrokernelTester()
+        .n(n)
+        .scale(scale)
+        .testQuantize(q8quant_ukernel__neon);
+    }
+  }
+}
+
+TEST(Q8QUANT__NEON, zero_point) {
+  for (size_t n = 1; n < 128; n += 5) {
+    for (int32_t zeroPoint = 0; zeroPoint <= 255; zeroPoint += 51) {
+      QuantizeMicrokernelTester()
+        .n(n)
+        .zeroPoint(uint8_t(zeroPoint))
+        .testQuantize(q8quant_ukernel__neon);
+    }
+  }
+}
+
+TEST(Q8QUANT__NEON, bias) {
+  for (size_t n = 1; n < 128; n += 5) {
+    for (float bias : {-100.25f, -0.5f, 0.5f, 37.75f}) {
+      QuantizeMicrokernelTester()
+        .n(n)
+        .bias(bias)
+        .testQuantize(q8quant_ukernel__neon);
+    }
+  }
+}
+
+TEST(Q8QUANT__NEON, qmin) {
+  for (size_t n = 1; n < 128; n += 5) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .qmin(128)
+      .testQuantize(q8quant_ukernel__neon);
+  }
+}
+
+TEST(Q8QUANT__NEON, qmax) {
+  for (size_t n = 1; n < 128; n += 5) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .qmax(128)
+      .testQuantize(q8quant_ukernel__neon);
+  }
+}
+
+TEST(Q8QUANT__NEON, nan) {
+  for (size_t n = 1; n < 128; n += 5) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .qmin(17)
+      .nanInputs(true)
+      .testQuantize(q8quant_ukernel__neon);
+  }
+}
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+TEST(Q8QUANT__SSE2, n_eq_16) {
+  QuantizeMicrokernelTester()
+    .n(16)
+    .testQuantize(q8quant_ukernel__sse2);
+}
+
+TEST(Q8QUANT__SSE2, n_div_16) {
+  for (size_t n = 16; n < 512; n += 16) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testQuantize(q8quant_ukernel__sse2);
+  }
+}
+
+TEST(Q8QUANT__SSE2, n_gt_16) {
+  for (size_t n = 17; n < 32; n++) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testQuantize(q8quant_ukernel__sse2);
+  }
+}
+
+TEST(Q8QUANT__SSE2, n_lt_16) {
+  for (size_t n = 1; n < 16; n++) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .testQuantize(q8quant_ukernel__sse2);
+  }
+}
+
+TEST(Q8QUANT__SSE2, scale) {
+  for (size_t n = 1; n < 128; n += 5) {
+    for (float scale : {0.001f, 0.1f, 1.0f, 2.5f, 40.0f}) {
+      QuantizeMicrokernelTester()
+        .n(n)
+        .scale(scale)
+        .testQuantize(q8quant_ukernel__sse2);
+    }
+  }
+}
+
+TEST(Q8QUANT__SSE2, zero_point) {
+  for (size_t n = 1; n < 128; n += 5) {
+    for (int32_t zeroPoint = 0; zeroPoint <= 255; zeroPoint += 51) {
+      QuantizeMicrokernelTester()
+        .n(n)
+        .zeroPoint(uint8_t(zeroPoint))
+        .testQuantize(q8quant_ukernel__sse2);
+    }
+  }
+}
+
+TEST(Q8QUANT__SSE2, bias) {
+  for (size_t n = 1; n < 128; n += 5) {
+    for (float bias : {-100.25f, -0.5f, 0.5f, 37.75f}) {
+      QuantizeMicrokernelTester()
+        .n(n)
+        .bias(bias)
+        .testQuantize(q8quant_ukernel__sse2);
+    }
+  }
+}
+
+TEST(Q8QUANT__SSE2, qmin) {
+  for (size_t n = 1; n < 128; n += 5) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .qmin(128)
+      .testQuantize(q8quant_ukernel__sse2);
+  }
+}
+
+TEST(Q8QUANT__SSE2, qmax) {
+  for (size_t n = 1; n < 128; n += 5) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .qmax(128)
+      .testQuantize(q8quant_ukernel__sse2);
+  }
+}
+
+TEST(Q8QUANT__SSE2, nan) {
+  for (size_t n = 1; n < 128; n += 5) {
+    QuantizeMicrokernelTester()
+      .n(n)
+      .qmin(17)
+      .nanInputs(true)
+      .testQuantize(q8quant_ukernel__sse2);
+  }
+}
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
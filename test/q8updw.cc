@@ -251,6 +251,281 @@
         .test(q8updw_ukernel_9c8__neon);
     }
   }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_eq_8) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(1)
+      .test(q8updw_ukernel_mc8__neon);
+  }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_eq_8_with_qmin) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(1)
+      .qmin(128)
+      .test(q8updw_ukernel_mc8__neon);
+  }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_eq_8_with_qmax) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(1)
+      .qmax(128)
+      .test(q8updw_ukernel_mc8__neon);
+  }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_eq_8_with_input_zero_point_only) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(1)
+      .inputZeroPoint(255)
+      .kernelZeroPoint(0)
+      .test(q8updw_ukernel_mc8__neon);
+  }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_eq_8_with_kernel_zero_point_only) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(1)
+      .inputZeroPoint(0)
+      .kernelZeroPoint(255)
+      .test(q8updw_ukernel_mc8__neon);
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_eq_8) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(5)
+      .test(q8updw_ukernel_mc8__neon);
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_eq_8_with_subsampling) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .subsampling(2)
+      .cr(8)
+      .channels(8)
+      .width(5)
+      .test(q8updw_ukernel_mc8__neon);
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_eq_8_with_input_stride) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(5)
+      .inputStride(17)
+      .test(q8updw_ukernel_mc8__neon);
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_eq_8_with_output_stride) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(5)
+      .outputStride(19)
+      .test(q8updw_ukernel_mc8__neon);
+  }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_div_8) {
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_div_8) {
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_div_8_with_output_stride) {
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .outputStride(171)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_gt_8) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_gt_8_with_qmin) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .qmin(128)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_gt_8_with_qmax) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .qmax(128)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_gt_8_with_input_zero_point_only) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .inputZeroPoint(255)
+        .kernelZeroPoint(0)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, single_output_channels_gt_8_with_kernel_zero_point_only) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .inputZeroPoint(0)
+        .kernelZeroPoint(255)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_gt_8) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_gt_8_with_output_stride) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .outputStride(17)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_gt_8_with_kernel_1x1) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(1)
+        .kernelWidth(1)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_gt_8_with_kernel_1x15) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(1)
+        .kernelWidth(15)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_gt_8_with_kernel_3x3) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
+
+  TEST(Q8DW_mc8_NEON, multi_output_channels_gt_8_with_kernel_5x5) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__neon);
+    }
+  }
 #endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
 
 #if CPUINFO_ARCH_ARM
@@ -709,4 +984,279 @@
         .test(q8updw_ukernel_9c8__sse2);
     }
   }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_eq_8) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(1)
+      .test(q8updw_ukernel_mc8__sse2);
+  }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_eq_8_with_qmin) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(1)
+      .qmin(128)
+      .test(q8updw_ukernel_mc8__sse2);
+  }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_eq_8_with_qmax) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(1)
+      .qmax(128)
+      .test(q8updw_ukernel_mc8__sse2);
+  }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_eq_8_with_input_zero_point_only) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(1)
+      .inputZeroPoint(255)
+      .kernelZeroPoint(0)
+      .test(q8updw_ukernel_mc8__sse2);
+  }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_eq_8_with_kernel_zero_point_only) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(1)
+      .inputZeroPoint(0)
+      .kernelZeroPoint(255)
+      .test(q8updw_ukernel_mc8__sse2);
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_eq_8) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(5)
+      .test(q8updw_ukernel_mc8__sse2);
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_eq_8_with_subsampling) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .subsampling(2)
+      .cr(8)
+      .channels(8)
+      .width(5)
+      .test(q8updw_ukernel_mc8__sse2);
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_eq_8_with_input_stride) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(5)
+      .inputStride(17)
+      .test(q8updw_ukernel_mc8__sse2);
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_eq_8_with_output_stride) {
+    DepthwiseMicrokernelTester()
+      .kernelHeight(1)
+      .kernelWidth(7)
+      .cr(8)
+      .channels(8)
+      .width(5)
+      .outputStride(19)
+      .test(q8updw_ukernel_mc8__sse2);
+  }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_div_8) {
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_div_8) {
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_div_8_with_output_stride) {
+    for (uint32_t channels = 16; channels < 128; channels += 24) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .outputStride(171)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_gt_8) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_gt_8_with_qmin) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .qmin(128)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_gt_8_with_qmax) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .qmax(128)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_gt_8_with_input_zero_point_only) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .inputZeroPoint(255)
+        .kernelZeroPoint(0)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, single_output_channels_gt_8_with_kernel_zero_point_only) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(1)
+        .inputZeroPoint(0)
+        .kernelZeroPoint(255)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_gt_8) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_gt_8_with_output_stride) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .outputStride(17)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_gt_8_with_kernel_1x1) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(1)
+        .kernelWidth(1)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_gt_8_with_kernel_1x15) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(1)
+        .kernelWidth(15)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_gt_8_with_kernel_3x3) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
+
+  TEST(Q8DW_mc8_SSE2, multi_output_channels_gt_8_with_kernel_5x5) {
+    for (uint32_t channels = 9; channels < 16; channels++) {
+      DepthwiseMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(8)
+        .channels(channels)
+        .width(5)
+        .test(q8updw_ukernel_mc8__sse2);
+    }
+  }
 #endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
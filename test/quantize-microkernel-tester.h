@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack/params.h>
+#include <qnnpack/requantization.h>
+
+
+class QuantizeMicrokernelTester {
+ public:
+  inline QuantizeMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline QuantizeMicrokernelTester& scale(float scale) {
+    assert(scale > 0.0f);
+    this->scale_ = scale;
+    return *this;
+  }
+
+  inline float scale() const {
+    return this->scale_;
+  }
+
+  inline QuantizeMicrokernelTester& bias(float bias) {
+    this->bias_ = bias;
+    return *this;
+  }
+
+  inline float bias() const {
+    return this->bias_;
+  }
+
+  inline QuantizeMicrokernelTester& zeroPoint(uint8_t zeroPoint) {
+    this->zeroPoint_ = zeroPoint;
+    return *this;
+  }
+
+  inline uint8_t zeroPoint() const {
+    return this->zeroPoint_;
+  }
+
+  inline QuantizeMicrokernelTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline QuantizeMicrokernelTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline QuantizeMicrokernelTester& nanInputs(bool nanInputs) {
+    this->nanInputs_ = nanInputs;
+    return *this;
+  }
+
+  inline bool nanInputs() const {
+    return this->nanInputs_;
+  }
+
+  inline QuantizeMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testQuantize(q8quant_ukernel_function q8quant) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    /* Inputs cover the whole quantized range and overflow it on both sides */
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-384.0f * scale(), 384.0f * scale()), rng);
+
+    std::vector<float> x(n());
+    std::vector<uint8_t> y(n());
+    std::vector<uint8_t> yRef(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      if (nanInputs()) {
+        for (size_t i = 0; i < n(); i += 3) {
+          x[i] = std::nanf("");
+        }
+      }
+      std::fill(y.begin(), y.end(), 0xA5);
+
+      /* Prepare quantization parameters */
+      const union qnnp_q8_quantization_params quantizationParams =
+          qnnp_compute_q8_affine_quantization_params(1.0f / scale(), bias(), zeroPoint(), qmin(), qmax());
+
+      /* Compute reference results: scaled values are rounded to nearest with ties to even, and NaN maps to qmin */
+      const float reciprocalScale = 1.0f / scale();
+      for (size_t i = 0; i < n(); i++) {
+        float scaledX = x[i] * reciprocalScale + bias();
+        if (std::isnan(scaledX)) {
+          scaledX = float(int32_t(qmin()) - int32_t(zeroPoint()));
+        }
+        scaledX = std::max<float>(scaledX, float(int32_t(qmin()) - int32_t(zeroPoint())));
+        scaledX = std::min<float>(scaledX, float(int32_t(qmax()) - int32_t(zeroPoint())));
+        yRef[i] = uint8_t(int32_t(std::nearbyint(scaledX)) + int32_t(zeroPoint()));
+      }
+
+      /* Call optimized micro-kernel */
+      q8quant(n(), x.data(), y.data(), &quantizationParams);
+
+      /* Verify results */
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_EQ(uint32_t(yRef[i]), uint32_t(y[i]))
+          << "at position " << i << ", n = " << n() << ", x = " << x[i];
+      }
+    }
+  }
+
+  void testDequantize(q8dequant_ukernel_function q8dequant) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> x(n());
+    std::vector<float> y(n());
+    std::vector<float> yRef(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(u8rng));
+      std::fill(y.begin(), y.end(), std::nanf(""));
+
+      /* Prepare dequantization parameters */
+      const union qnnp_q8_dequantization_params dequantizationParams =
+          qnnp_compute_q8_dequantization_params(zeroPoint(), scale());
+
+      /* Compute reference results */
+      for (size_t i = 0; i < n(); i++) {
+        yRef[i] = float(int32_t(x[i]) - int32_t(zeroPoint())) * scale();
+      }
+
+      /* Call optimized micro-kernel */
+      q8dequant(n(), x.data(), y.data(), &dequantizationParams);
+
+      /* Verify results */
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_EQ(yRef[i], y[i])
+          << "at position " << i << ", n = " << n() << ", x = " << uint32_t(x[i]);
+      }
+    }
+  }
+
+ private:
+  size_t n_{1};
+  float scale_{0.75f};
+  float bias_{0.0f};
+  uint8_t zeroPoint_{121};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  bool nanInputs_{false};
+  size_t iterations_{15};
+};
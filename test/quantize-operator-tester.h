@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class QuantizeOperatorTester {
+ public:
+  inline QuantizeOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline QuantizeOperatorTester& inputStride(size_t inputStride) {
+    assert(inputStride != 0);
+    this->inputStride_ = inputStride;
+    return *this;
+  }
+
+  inline size_t inputStride() const {
+    if (this->inputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->inputStride_ >= this->channels_);
+      return this->inputStride_;
+    }
+  }
+
+  inline QuantizeOperatorTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->outputStride_ >= this->channels_);
+      return this->outputStride_;
+    }
+  }
+
+  inline QuantizeOperatorTester& batchSize(size_t batchSize) {
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline QuantizeOperatorTester& scale(float scale) {
+    assert(scale > 0.0f);
+    assert(std::isnormal(scale));
+    this->scale_ = scale;
+    return *this;
+  }
+
+  inline float scale() const {
+    return this->scale_;
+  }
+
+  inline QuantizeOperatorTester& zeroPoint(uint8_t zeroPoint) {
+    this->zeroPoint_ = zeroPoint;
+    return *this;
+  }
+
+  inline uint8_t zeroPoint() const {
+    return this->zeroPoint_;
+  }
+
+  inline QuantizeOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline QuantizeOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline QuantizeOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testQuantize() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-320.0f * scale(), 320.0f * scale()), rng);
+
+    std::vector<float> input((batchSize() - 1) * inputStride() + channels());
+    std::vector<uint8_t> output((batchSize() - 1) * outputStride() + channels());
+    std::vector<float> outputRef(batchSize() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const float y = float(zeroPoint()) + input[i * inputStride() + c] / scale();
+          outputRef[i * channels() + c] = std::min<float>(std::max<float>(y, float(qmin())), float(qmax()));
+        }
+      }
+
+      /* Create, setup, run, and destroy Quantize operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t quantize_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_quantize_nc_f32_q8(
+          channels(), zeroPoint(), scale(), qmin(), qmax(),
+          &quantize_op));
+      ASSERT_NE(nullptr, quantize_op);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_quantize_nc_f32_q8(
+          quantize_op,
+          batchSize(),
+          input.data(), inputStride(),
+          output.data(), outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(quantize_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(quantize_op));
+      quantize_op = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_LE(uint32_t(output[i * outputStride() + c]), uint32_t(qmax()));
+          ASSERT_GE(uint32_t(output[i * outputStride() + c]), uint32_t(qmin()));
+          ASSERT_NEAR(float(int32_t(output[i * outputStride() + c])), outputRef[i * channels() + c], 0.5001f)
+            << "at batch index " << i << ", channel " << c << ", input " << input[i * inputStride() + c];
+        }
+      }
+    }
+  }
+
+  void testDequantize() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() - 1) * inputStride() + channels());
+    std::vector<float> output((batchSize() - 1) * outputStride() + channels());
+    std::vector<float> outputRef(batchSize() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      /* Compute reference results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          outputRef[i * channels() + c] = float(int32_t(input[i * inputStride() + c]) - int32_t(zeroPoint())) * scale();
+        }
+      }
+
+      /* Create, setup, run, and destroy Dequantize operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t dequantize_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_dequantize_nc_q8_f32(
+          channels(), zeroPoint(), scale(),
+          &dequantize_op));
+      ASSERT_NE(nullptr, dequantize_op);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_dequantize_nc_q8_f32(
+          dequantize_op,
+          batchSize(),
+          input.data(), inputStride(),
+          output.data(), outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(dequantize_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(dequantize_op));
+      dequantize_op = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_EQ(outputRef[i * channels() + c], output[i * outputStride() + c])
+            << "at batch index " << i << ", channel " << c;
+        }
+      }
+    }
+  }
+
+ private:
+  size_t batchSize_{1};
+  size_t channels_{1};
+  size_t inputStride_{0};
+  size_t outputStride_{0};
+  float scale_{0.75f};
+  uint8_t zeroPoint_{121};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{15};
+};
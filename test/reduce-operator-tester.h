@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class ReduceOperatorTester {
+ public:
+  inline ReduceOperatorTester& shape(std::initializer_list<size_t> shape) {
+    assert(shape.size() != 0);
+    assert(shape.size() <= QNNP_MAX_REDUCE_DIMS);
+    this->shape_ = std::vector<size_t>(shape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& shape() const {
+    return this->shape_;
+  }
+
+  inline ReduceOperatorTester& axes(std::initializer_list<size_t> axes) {
+    assert(axes.size() != 0);
+    this->axes_ = std::vector<size_t>(axes);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& axes() const {
+    return this->axes_;
+  }
+
+  inline ReduceOperatorTester& operation(qnnp_reduce_operation operation) {
+    this->operation_ = operation;
+    return *this;
+  }
+
+  inline qnnp_reduce_operation operation() const {
+    return this->operation_;
+  }
+
+  inline ReduceOperatorTester& inputScale(float inputScale) {
+    assert(inputScale > 0.0f);
+    assert(std::isnormal(inputScale));
+    this->inputScale_ = inputScale;
+    return *this;
+  }
+
+  inline float inputScale() const {
+    return this->inputScale_;
+  }
+
+  inline ReduceOperatorTester& inputZeroPoint(uint8_t inputZeroPoint) {
+    this->inputZeroPoint_ = inputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t inputZeroPoint() const {
+    return this->inputZeroPoint_;
+  }
+
+  inline ReduceOperatorTester& outputScale(float outputScale) {
+    assert(outputScale > 0.0f);
+    assert(std::isnormal(outputScale));
+    this->outputScale_ = outputScale;
+    return *this;
+  }
+
+  inline float outputScale() const {
+    return this->outputScale_;
+  }
+
+  inline ReduceOperatorTester& outputZeroPoint(uint8_t outputZeroPoint) {
+    this->outputZeroPoint_ = outputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t outputZeroPoint() const {
+    return this->outputZeroPoint_;
+  }
+
+  inline ReduceOperatorTester& outputMin(uint8_t outputMin) {
+    this->outputMin_ = outputMin;
+    return *this;
+  }
+
+  inline uint8_t outputMin() const {
+    return this->outputMin_;
+  }
+
+  inline ReduceOperatorTester& outputMax(uint8_t outputMax) {
+    this->outputMax_ = outputMax;
+    return *this;
+  }
+
+  inline uint8_t outputMax() const {
+    return this->outputMax_;
+  }
+
+  inline ReduceOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testQ8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    const size_t dims = shape().size();
+    std::vector<bool> reduced(dims, false);
+    for (size_t axis : axes()) {
+      reduced[axis] = true;
+    }
+
+    size_t inputElements = 1;
+    size_t outputElements = 1;
+    size_t reductionSize = 1;
+    for (size_t i = 0; i < dims; i++) {
+      inputElements *= shape()[i];
+      if (reduced[i]) {
+        reductionSize *= shape()[i];
+      } else {
+        outputElements *= shape()[i];
+      }
+    }
+
+    /* Global average pooling micro-kernels may read up to 7 bytes past the last reduced row */
+    std::vector<uint8_t> input(inputElements + 7);
+    std::vector<uint8_t> output(outputElements);
+    std::vector<double> accumulators(outputElements);
+    std::vector<float> outputRef(outputElements);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference results */
+      switch (operation()) {
+        case qnnp_reduce_operation_sum:
+        case qnnp_reduce_operation_mean:
+          std::fill(accumulators.begin(), accumulators.end(), 0.0);
+          break;
+        case qnnp_reduce_operation_max:
+          std::fill(accumulators.begin(), accumulators.end(), -std::numeric_limits<double>::infinity());
+          break;
+        case qnnp_reduce_operation_min:
+          std::fill(accumulators.begin(), accumulators.end(), std::numeric_limits<double>::infinity());
+          break;
+      }
+      for (size_t i = 0; i < inputElements; i++) {
+        size_t index = i;
+        size_t outputIndex = 0;
+        size_t outputStride = 1;
+        for (size_t d = dims; d != 0; d--) {
+          const size_t coordinate = index % shape()[d - 1];
+          index /= shape()[d - 1];
+          if (!reduced[d - 1]) {
+            outputIndex += coordinate * outputStride;
+            outputStride *= shape()[d - 1];
+          }
+        }
+
+        const double x = double(int32_t(input[i]) - int32_t(inputZeroPoint()));
+        switch (operation()) {
+          case qnnp_reduce_operation_sum:
+          case qnnp_reduce_operation_mean:
+            accumulators[outputIndex] += x;
+            break;
+          case qnnp_reduce_operation_max:
+            accumulators[outputIndex] = std::max(accumulators[outputIndex], x);
+            break;
+          case qnnp_reduce_operation_min:
+            accumulators[outputIndex] = std::min(accumulators[outputIndex], x);
+            break;
+        }
+      }
+      double scale = double(inputScale()) / double(outputScale());
+      if (operation() == qnnp_reduce_operation_mean) {
+        scale /= double(reductionSize);
+      }
+      for (size_t i = 0; i < outputElements; i++) {
+        outputRef[i] = float(accumulators[i] * scale + double(outputZeroPoint()));
+        outputRef[i] = std::min<float>(outputRef[i], float(outputMax()));
+        outputRef[i] = std::max<float>(outputRef[i], float(outputMin()));
+      }
+
+      /* Create, setup, run, and destroy Reduce operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t reduceOp = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_reduce_nd_q8(
+          operation(),
+          inputZeroPoint(), inputScale(),
+          outputZeroPoint(), outputScale(),
+          outputMin(), outputMax(),
+          &reduceOp));
+      ASSERT_NE(nullptr, reduceOp);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_reduce_nd_q8(
+          reduceOp,
+          dims, shape().data(),
+          axes().size(), axes().data(),
+          input.data(), output.data()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(reduceOp, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(reduceOp));
+      reduceOp = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < outputElements; i++) {
+        ASSERT_LE(uint32_t(output[i]), uint32_t(outputMax()));
+        ASSERT_GE(uint32_t(output[i]), uint32_t(outputMin()));
+        ASSERT_NEAR(float(int32_t(output[i])), outputRef[i], 0.80f) << "at output index " << i;
+      }
+    }
+  }
+
+ private:
+  std::vector<size_t> shape_;
+  std::vector<size_t> axes_;
+  qnnp_reduce_operation operation_{qnnp_reduce_operation_mean};
+  float inputScale_{1.0f};
+  float outputScale_{1.0f};
+  uint8_t inputZeroPoint_{121};
+  uint8_t outputZeroPoint_{133};
+  uint8_t outputMin_{0};
+  uint8_t outputMax_{255};
+  size_t iterations_{3};
+};
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reduce-operator-tester.h"
+
+
+TEST(REDUCE_OP, sum_over_rows_few_rows) {
+  ReduceOperatorTester()
+    .shape({2, 3, 2, 24})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_sum)
+    .outputScale(16.0f)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, sum_over_rows_many_rows) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 19})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_sum)
+    .outputScale(16.0f)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, sum_over_rows_few_channels) {
+  ReduceOperatorTester()
+    .shape({3, 9, 5})
+    .axes({1})
+    .operation(qnnp_reduce_operation_sum)
+    .outputScale(16.0f)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, sum_over_rows_many_channels) {
+  ReduceOperatorTester()
+    .shape({2, 3, 3, 1030})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_sum)
+    .outputScale(16.0f)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, sum_over_innermost) {
+  ReduceOperatorTester()
+    .shape({3, 5, 37})
+    .axes({2})
+    .operation(qnnp_reduce_operation_sum)
+    .outputScale(16.0f)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, sum_over_long_innermost) {
+  ReduceOperatorTester()
+    .shape({2, 40000})
+    .axes({1})
+    .operation(qnnp_reduce_operation_sum)
+    .outputScale(16.0f)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, sum_over_all) {
+  ReduceOperatorTester()
+    .shape({3, 50, 70, 11})
+    .axes({0, 1, 2, 3})
+    .operation(qnnp_reduce_operation_sum)
+    .outputScale(16.0f)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, sum_over_alternate_outer) {
+  ReduceOperatorTester()
+    .shape({4, 5, 6, 7})
+    .axes({0, 2})
+    .operation(qnnp_reduce_operation_sum)
+    .outputScale(16.0f)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, sum_over_alternate_inner) {
+  ReduceOperatorTester()
+    .shape({4, 5, 6, 7})
+    .axes({1, 3})
+    .operation(qnnp_reduce_operation_sum)
+    .outputScale(16.0f)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, sum_over_unit_dims) {
+  ReduceOperatorTester()
+    .shape({1, 7, 1, 9})
+    .axes({0, 2})
+    .operation(qnnp_reduce_operation_sum)
+    .outputScale(16.0f)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_over_rows_few_rows) {
+  ReduceOperatorTester()
+    .shape({2, 3, 2, 24})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_over_rows_many_rows) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 19})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_over_rows_few_channels) {
+  ReduceOperatorTester()
+    .shape({3, 9, 5})
+    .axes({1})
+    .operation(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_over_rows_many_channels) {
+  ReduceOperatorTester()
+    .shape({2, 3, 3, 1030})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_over_innermost) {
+  ReduceOperatorTester()
+    .shape({3, 5, 37})
+    .axes({2})
+    .operation(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_over_long_innermost) {
+  ReduceOperatorTester()
+    .shape({2, 40000})
+    .axes({1})
+    .operation(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_over_all) {
+  ReduceOperatorTester()
+    .shape({3, 50, 70, 11})
+    .axes({0, 1, 2, 3})
+    .operation(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_over_alternate_outer) {
+  ReduceOperatorTester()
+    .shape({4, 5, 6, 7})
+    .axes({0, 2})
+    .operation(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_over_alternate_inner) {
+  ReduceOperatorTester()
+    .shape({4, 5, 6, 7})
+    .axes({1, 3})
+    .operation(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_over_unit_dims) {
+  ReduceOperatorTester()
+    .shape({1, 7, 1, 9})
+    .axes({0, 2})
+    .operation(qnnp_reduce_operation_mean)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_with_scales_and_zero_points) {
+  ReduceOperatorTester()
+    .shape({5, 6, 7, 8})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_mean)
+    .inputScale(0.25f)
+    .inputZeroPoint(7)
+    .outputScale(0.5f)
+    .outputZeroPoint(200)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, mean_with_qmin_and_qmax) {
+  ReduceOperatorTester()
+    .shape({5, 6, 7})
+    .axes({0, 2})
+    .operation(qnnp_reduce_operation_mean)
+    .outputMin(128)
+    .outputMax(160)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_over_rows_few_rows) {
+  ReduceOperatorTester()
+    .shape({2, 3, 2, 24})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_max)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_over_rows_many_rows) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 19})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_max)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_over_rows_few_channels) {
+  ReduceOperatorTester()
+    .shape({3, 9, 5})
+    .axes({1})
+    .operation(qnnp_reduce_operation_max)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_over_rows_many_channels) {
+  ReduceOperatorTester()
+    .shape({2, 3, 3, 1030})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_max)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_over_innermost) {
+  ReduceOperatorTester()
+    .shape({3, 5, 37})
+    .axes({2})
+    .operation(qnnp_reduce_operation_max)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_over_long_innermost) {
+  ReduceOperatorTester()
+    .shape({2, 40000})
+    .axes({1})
+    .operation(qnnp_reduce_operation_max)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_over_all) {
+  ReduceOperatorTester()
+    .shape({3, 50, 70, 11})
+    .axes({0, 1, 2, 3})
+    .operation(qnnp_reduce_operation_max)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_over_alternate_outer) {
+  ReduceOperatorTester()
+    .shape({4, 5, 6, 7})
+    .axes({0, 2})
+    .operation(qnnp_reduce_operation_max)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_over_alternate_inner) {
+  ReduceOperatorTester()
+    .shape({4, 5, 6, 7})
+    .axes({1, 3})
+    .operation(qnnp_reduce_operation_max)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_over_unit_dims) {
+  ReduceOperatorTester()
+    .shape({1, 7, 1, 9})
+    .axes({0, 2})
+    .operation(qnnp_reduce_operation_max)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_with_scales_and_zero_points) {
+  ReduceOperatorTester()
+    .shape({5, 6, 7, 8})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_max)
+    .inputScale(0.25f)
+    .inputZeroPoint(7)
+    .outputScale(0.5f)
+    .outputZeroPoint(200)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, max_with_qmin_and_qmax) {
+  ReduceOperatorTester()
+    .shape({5, 6, 7})
+    .axes({0, 2})
+    .operation(qnnp_reduce_operation_max)
+    .outputMin(128)
+    .outputMax(160)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, min_over_rows_few_rows) {
+  ReduceOperatorTester()
+    .shape({2, 3, 2, 24})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_min)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, min_over_rows_many_rows) {
+  ReduceOperatorTester()
+    .shape({2, 5, 7, 19})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_min)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, min_over_rows_few_channels) {
+  ReduceOperatorTester()
+    .shape({3, 9, 5})
+    .axes({1})
+    .operation(qnnp_reduce_operation_min)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, min_over_rows_many_channels) {
+  ReduceOperatorTester()
+    .shape({2, 3, 3, 1030})
+    .axes({1, 2})
+    .operation(qnnp_reduce_operation_min)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, min_over_innermost) {
+  ReduceOperatorTester()
+    .shape({3, 5, 37})
+    .axes({2})
+    .operation(qnnp_reduce_operation_min)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, min_over_long_innermost) {
+  ReduceOperatorTester()
+    .shape({2, 40000})
+    .axes({1})
+    .operation(qnnp_reduce_operation_min)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, min_over_all) {
+  ReduceOperatorTester()
+    .shape({3, 50, 70, 11})
+    .axes({0, 1, 2, 3})
+    .operation(qnnp_reduce_operation_min)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, min_over_alternate_outer) {
+  ReduceOperatorTester()
+    .shape({4, 5, 6, 7})
+    .axes({0, 2})
+    .operation(qnnp_reduce_operation_min)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, min_over_alternate_inner) {
+  ReduceOperatorTester()
+    .shape({4, 5, 6, 7})
+    .axes({1, 3})
+    .operation(qnnp_reduce_operation_min)
+    .testQ8();
+}
+
+TEST(REDUCE_OP, min_over_unit_dims) {
+  ReduceOperatorTester()
+    .shape({1, 7, 1, 9})
+    .axes({0, 2})
+    .operation(qnnp_reduce_operation_min)
+    .testQ8();
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class ResizeOperatorTester {
+ public:
+  inline ResizeOperatorTester& inputSize(size_t inputHeight, size_t inputWidth) {
+    assert(inputHeight >= 1);
+    assert(inputWidth >= 1);
+    this->inputHeight_ = inputHeight;
+    this->inputWidth_ = inputWidth;
+    return *this;
+  }
+
+  inline size_t inputHeight() const {
+    return this->inputHeight_;
+  }
+
+  inline size_t inputWidth() const {
+    return this->inputWidth_;
+  }
+
+  inline ResizeOperatorTester& outputSize(size_t outputHeight, size_t outputWidth) {
+    assert(outputHeight >= 1);
+    assert(outputWidth >= 1);
+    this->outputHeight_ = outputHeight;
+    this->outputWidth_ = outputWidth;
+    return *this;
+  }
+
+  inline size_t outputHeight() const {
+    return this->outputHeight_;
+  }
+
+  inline size_t outputWidth() const {
+    return this->outputWidth_;
+  }
+
+  inline ResizeOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline ResizeOperatorTester& batchSize(size_t batchSize) {
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline ResizeOperatorTester& inputPixelStride(size_t inputPixelStride) {
+    assert(inputPixelStride != 0);
+    this->inputPixelStride_ = inputPixelStride;
+    return *this;
+  }
+
+  inline size_t inputPixelStride() const {
+    if (this->inputPixelStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->inputPixelStride_ >= channels());
+      return this->inputPixelStride_;
+    }
+  }
+
+  inline ResizeOperatorTester& outputPixelStride(size_t outputPixelStride) {
+    assert(outputPixelStride != 0);
+    this->outputPixelStride_ = outputPixelStride;
+    return *this;
+  }
+
+  inline size_t outputPixelStride() const {
+    if (this->outputPixelStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->outputPixelStride_ >= channels());
+      return this->outputPixelStride_;
+    }
+  }
+
+  inline ResizeOperatorTester& alignCorners(bool alignCorners) {
+    this->alignCorners_ = alignCorners;
+    return *this;
+  }
+
+  inline bool alignCorners() const {
+    return this->alignCorners_;
+  }
+
+  inline ResizeOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testBilinear() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() * inputHeight() * inputWidth() - 1) * inputPixelStride() + channels());
+    std::vector<uint8_t> output((batchSize() * outputHeight() * outputWidth() - 1) * outputPixelStride() + channels());
+    std::vector<double> outputRef(batchSize() * outputHeight() * outputWidth() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t oy = 0; oy < outputHeight(); oy++) {
+          size_t iy0, iy1;
+          double alphaV;
+          sourceCoordinate(oy, inputHeight(), outputHeight(), iy0, iy1, alphaV);
+          for (size_t ox = 0; ox < outputWidth(); ox++) {
+            size_t ix0, ix1;
+            double alphaH;
+            sourceCoordinate(ox, inputWidth(), outputWidth(), ix0, ix1, alphaH);
+            for (size_t c = 0; c < channels(); c++) {
+              const double tl = double(input[((i * inputHeight() + iy0) * inputWidth() + ix0) * inputPixelStride() + c]);
+              const double tr = double(input[((i * inputHeight() + iy0) * inputWidth() + ix1) * inputPixelStride() + c]);
+              const double bl = double(input[((i * inputHeight() + iy1) * inputWidth() + ix0) * inputPixelStride() + c]);
+              const double br = double(input[((i * inputHeight() + iy1) * inputWidth() + ix1) * inputPixelStride() + c]);
+              const double top = tl + (tr - tl) * alphaH;
+              const double bottom = bl + (br - bl) * alphaH;
+              outputRef[((i * outputHeight() + oy) * outputWidth() + ox) * channels() + c] = top + (bottom - top) * alphaV;
+            }
+          }
+        }
+      }
+
+      /* Create, setup, run, and destroy Resize operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t resizeOp = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_resize_bilinear2d_nhwc_q8(
+          channels(), alignCorners() ? QNNP_FLAG_ALIGN_CORNERS : 0,
+          &resizeOp));
+      ASSERT_NE(nullptr, resizeOp);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_resize_bilinear2d_nhwc_q8(
+          resizeOp,
+          batchSize(), inputHeight(), inputWidth(), outputHeight(), outputWidth(),
+          input.data(), inputPixelStride(),
+          output.data(), outputPixelStride(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(resizeOp, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(resizeOp));
+      resizeOp = nullptr;
+
+      /* Verify results: interpolation weights are rounded to 11 fractional bits */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t y = 0; y < outputHeight(); y++) {
+          for (size_t x = 0; x < outputWidth(); x++) {
+            for (size_t c = 0; c < channels(); c++) {
+              ASSERT_NEAR(
+                  outputRef[((i * outputHeight() + y) * outputWidth() + x) * channels() + c],
+                  double(output[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + c]),
+                  0.65) <<
+                "in batch index " << i << ", pixel (" << y << ", " << x << "), channel " << c;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void testNearest() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() * inputHeight() * inputWidth() - 1) * inputPixelStride() + channels());
+    std::vector<uint8_t> output((batchSize() * outputHeight() * outputWidth() - 1) * outputPixelStride() + channels());
+    std::vector<uint8_t> outputRef(batchSize() * outputHeight() * outputWidth() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t oy = 0; oy < outputHeight(); oy++) {
+          const size_t iy = nearestCoordinate(oy, inputHeight(), outputHeight());
+          for (size_t ox = 0; ox < outputWidth(); ox++) {
+            const size_t ix = nearestCoordinate(ox, inputWidth(), outputWidth());
+            for (size_t c = 0; c < channels(); c++) {
+              outputRef[((i * outputHeight() + oy) * outputWidth() + ox) * channels() + c] =
+                input[((i * inputHeight() + iy) * inputWidth() + ix) * inputPixelStride() + c];
+            }
+          }
+        }
+      }
+
+      /* Create, setup, run, and destroy Resize operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t resizeOp = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_resize_nearest2d_nhwc_q8(
+          channels(), alignCorners() ? QNNP_FLAG_ALIGN_CORNERS : 0,
+          &resizeOp));
+      ASSERT_NE(nullptr, resizeOp);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_resize_nearest2d_nhwc_q8(
+          resizeOp,
+          batchSize(), inputHeight(), inputWidth(), outputHeight(), outputWidth(),
+          input.data(), inputPixelStride(),
+          output.data(), outputPixelStride(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(resizeOp, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(resizeOp));
+      resizeOp = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t y = 0; y < outputHeight(); y++) {
+          for (size_t x = 0; x < outputWidth(); x++) {
+            for (size_t c = 0; c < channels(); c++) {
+              ASSERT_EQ(
+                  uint32_t(outputRef[((i * outputHeight() + y) * outputWidth() + x) * channels() + c]),
+                  uint32_t(output[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + c])) <<
+                "in batch index " << i << ", pixel (" << y << ", " << x << "), channel " << c;
+            }
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  void sourceCoordinate(
+      size_t outputIndex, size_t inputSize, size_t outputSize,
+      size_t& inputIndex0, size_t& inputIndex1, double& alpha) const
+  {
+    float inputCoordinate = 0.0f;
+    if (alignCorners()) {
+      if (outputSize > 1) {
+        inputCoordinate = float(outputIndex) * (float(inputSize - 1) / float(outputSize - 1));
+      }
+    } else {
+      inputCoordinate = std::max((float(outputIndex) + 0.5f) * (float(inputSize) / float(outputSize)) - 0.5f, 0.0f);
+    }
+    inputIndex0 = std::min(size_t(inputCoordinate), inputSize - 1);
+    inputIndex1 = std::min(inputIndex0 + 1, inputSize - 1);
+    alpha = double(inputCoordinate) - double(inputIndex0);
+  }
+
+  size_t nearestCoordinate(size_t outputIndex, size_t inputSize, size_t outputSize) const {
+    double inputCoordinate = 0.0;
+    if (alignCorners()) {
+      if (outputSize > 1) {
+        inputCoordinate = std::floor(double(outputIndex) * double(inputSize - 1) / double(outputSize - 1) + 0.5);
+      }
+    } else {
+      inputCoordinate = std::floor((double(outputIndex) + 0.5) * double(inputSize) / double(outputSize));
+    }
+    return std::min(size_t(inputCoordinate), inputSize - 1);
+  }
+
+  size_t inputHeight_{1};
+  size_t inputWidth_{1};
+  size_t outputHeight_{1};
+  size_t outputWidth_{1};
+  size_t channels_{1};
+  size_t batchSize_{1};
+  size_t inputPixelStride_{0};
+  size_t outputPixelStride_{0};
+  bool alignCorners_{false};
+  size_t iterations_{3};
+};
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "resize-operator-tester.h"
+
+
+TEST(RESIZE_BILINEAR_OP, upsample_2x) {
+  for (size_t channels = 1; channels <= 40; channels += 3) {
+    ResizeOperatorTester()
+      .inputSize(7, 9)
+      .outputSize(14, 18)
+      .channels(channels)
+      .testBilinear();
+  }
+}
+
+TEST(RESIZE_BILINEAR_OP, upsample_2x_with_align_corners) {
+  for (size_t channels = 1; channels <= 40; channels += 3) {
+    ResizeOperatorTester()
+      .inputSize(7, 9)
+      .outputSize(14, 18)
+      .channels(channels)
+      .alignCorners(true)
+      .testBilinear();
+  }
+}
+
+TEST(RESIZE_BILINEAR_OP, arbitrary_scale) {
+  for (size_t outputHeight = 1; outputHeight <= 13; outputHeight += 4) {
+    for (size_t outputWidth = 1; outputWidth <= 13; outputWidth += 3) {
+      ResizeOperatorTester()
+        .inputSize(5, 6)
+        .outputSize(outputHeight, outputWidth)
+        .channels(19)
+        .testBilinear();
+    }
+  }
+}
+
+TEST(RESIZE_BILINEAR_OP, arbitrary_scale_with_align_corners) {
+  for (size_t outputHeight = 1; outputHeight <= 13; outputHeight += 4) {
+    for (size_t outputWidth = 1; outputWidth <= 13; outputWidth += 3) {
+      ResizeOperatorTester()
+        .inputSize(5, 6)
+        .outputSize(outputHeight, outputWidth)
+        .channels(19)
+        .alignCorners(true)
+        .testBilinear();
+    }
+  }
+}
+
+TEST(RESIZE_BILINEAR_OP, unit_input) {
+  ResizeOperatorTester()
+    .inputSize(1, 1)
+    .outputSize(5, 4)
+    .channels(17)
+    .testBilinear();
+}
+
+TEST(RESIZE_BILINEAR_OP, with_batch_and_strides) {
+  ResizeOperatorTester()
+    .batchSize(3)
+    .inputSize(6, 5)
+    .outputSize(12, 11)
+    .channels(21)
+    .inputPixelStride(29)
+    .outputPixelStride(27)
+    .testBilinear();
+}
+
+TEST(RESIZE_NEAREST_OP, upsample_2x) {
+  for (size_t channels = 1; channels <= 40; channels += 3) {
+    ResizeOperatorTester()
+      .inputSize(7, 9)
+      .outputSize(14, 18)
+      .channels(channels)
+      .testNearest();
+  }
+}
+
+TEST(RESIZE_NEAREST_OP, arbitrary_scale) {
+  for (size_t outputHeight = 1; outputHeight <= 13; outputHeight += 4) {
+    for (size_t outputWidth = 1; outputWidth <= 13; outputWidth += 3) {
+      ResizeOperatorTester()
+        .inputSize(5, 6)
+        .outputSize(outputHeight, outputWidth)
+        .channels(19)
+        .testNearest();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_OP, downsample) {
+  for (size_t outputHeight = 1; outputHeight <= 9; outputHeight++) {
+    ResizeOperatorTester()
+      .inputSize(10, 17)
+      .outputSize(outputHeight, 4)
+      .channels(7)
+      .testNearest();
+  }
+}
+
+TEST(RESIZE_NEAREST_OP, arbitrary_scale_with_align_corners) {
+  for (size_t outputHeight = 1; outputHeight <= 13; outputHeight += 4) {
+    for (size_t outputWidth = 1; outputWidth <= 13; outputWidth += 3) {
+      ResizeOperatorTester()
+        .inputSize(5, 6)
+        .outputSize(outputHeight, outputWidth)
+        .channels(19)
+        .alignCorners(true)
+        .testNearest();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_OP, with_batch_and_strides) {
+  ResizeOperatorTester()
+    .batchSize(3)
+    .inputSize(6, 5)
+    .outputSize(12, 11)
+    .channels(21)
+    .inputPixelStride(29)
+    .outputPixelStride(27)
+    .testNearest();
+}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 
 #include <algorithm>
@@ -63,6 +64,35 @@ class RMaxMicrokernelTester {
     }
   }
 
+  void test(u8argmax_ukernel_function u8argmax) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> x(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(u8rng));
+
+      /* Compute reference results */
+      uint8_t yRef = x[0];
+      size_t indexRef = 0;
+      for (size_t i = 1; i < n(); i++) {
+        if (x[i] > yRef) {
+          yRef = x[i];
+          indexRef = i;
+        }
+      }
+
+      /* Call optimized micro-kernel */
+      size_t index = SIZE_MAX;
+      const uint8_t y = u8argmax(n(), x.data(), &index);
+
+      /* Verify results */
+      ASSERT_EQ(yRef, y) << "n = " << n();
+      ASSERT_EQ(indexRef, index) << "n = " << n();
+    }
+  }
+
  private:
   size_t n_{1};
   size_t iterations_{15};
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+#include <qnnpack/requantization.h>
+
+
+class RnnCellOperatorTester {
+ public:
+  inline RnnCellOperatorTester& batchSize(size_t batchSize) {
+    assert(batchSize != 0);
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline RnnCellOperatorTester& inputSize(size_t inputSize) {
+    assert(inputSize != 0);
+    this->inputSize_ = inputSize;
+    return *this;
+  }
+
+  inline size_t inputSize() const {
+    return this->inputSize_;
+  }
+
+  inline RnnCellOperatorTester& hiddenSize(size_t hiddenSize) {
+    assert(hiddenSize != 0);
+    this->hiddenSize_ = hiddenSize;
+    return *this;
+  }
+
+  inline size_t hiddenSize() const {
+    return this->hiddenSize_;
+  }
+
+  inline RnnCellOperatorTester& inPlace(bool inPlace) {
+    this->inPlace_ = inPlace;
+    return *this;
+  }
+
+  inline bool inPlace() const {
+    return this->inPlace_;
+  }
+
+  inline RnnCellOperatorTester& inputZeroPoint(uint8_t inputZeroPoint) {
+    this->inputZeroPoint_ = inputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t inputZeroPoint() const {
+    return this->inputZeroPoint_;
+  }
+
+  inline RnnCellOperatorTester& kernelZeroPoint(uint8_t kernelZeroPoint) {
+    this->kernelZeroPoint_ = kernelZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t kernelZeroPoint() const {
+    return this->kernelZeroPoint_;
+  }
+
+  inline RnnCellOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testLSTMQ8() const {
+    test(4);
+  }
+
+  void testGRUQ8() const {
+    test(3);
+  }
+
+ private:
+  void test(size_t gates) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    const bool lstm = gates == 4;
+    const size_t cellInputSize = inputSize() + hiddenSize();
+    /* Scales are chosen for gate pre-activations of about 3.0 standard deviation */
+    const float inputScale = 1.0f / 128.0f;
+    const float kernelScale = 3.0f / (std::sqrt(float(cellInputSize)) * 5476.0f * inputScale);
+    const float cellScale = 1.0f / 32.0f;
+    const uint8_t cellZeroPoint = 128;
+    const int32_t biasRange = int32_t(1.0f / (inputScale * kernelScale));
+    auto i32rng = std::bind(std::uniform_int_distribution<int32_t>(-biasRange, biasRange), rng);
+
+    std::vector<uint8_t> input(batchSize() * inputSize());
+    std::vector<uint8_t> hidden(batchSize() * hiddenSize());
+    std::vector<uint8_t> cell(batchSize() * hiddenSize());
+    std::vector<uint8_t> inputWeights(gates * hiddenSize() * inputSize());
+    std::vector<uint8_t> recurrentWeights(gates * hiddenSize() * hiddenSize());
+    std::vector<int32_t> inputBias(gates * hiddenSize());
+    std::vector<int32_t> recurrentBias(gates * hiddenSize());
+    std::vector<uint8_t> hiddenOutput(batchSize() * hiddenSize());
+    std::vector<uint8_t> cellOutput(batchSize() * hiddenSize());
+    std::vector<int32_t> inputAccumulators(batchSize() * gates * hiddenSize());
+    std::vector<int32_t> recurrentAccumulators(batchSize() * gates * hiddenSize());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(hidden.begin(), hidden.end(), std::ref(u8rng));
+      std::generate(cell.begin(), cell.end(), std::ref(u8rng));
+      std::generate(inputWeights.begin(), inputWeights.end(), std::ref(u8rng));
+      std::generate(recurrentWeights.begin(), recurrentWeights.end(), std::ref(u8rng));
+      std::generate(inputBias.begin(), inputBias.end(), std::ref(i32rng));
+      std::generate(recurrentBias.begin(), recurrentBias.end(), std::ref(i32rng));
+      std::fill(hiddenOutput.begin(), hiddenOutput.end(), 0xA5);
+      std::fill(cellOutput.begin(), cellOutput.end(), 0xA5);
+
+      /* Compute gate accumulators */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t row = 0; row < gates * hiddenSize(); row++) {
+          int32_t inputAccumulator = inputBias[row];
+          for (size_t k = 0; k < inputSize(); k++) {
+            inputAccumulator +=
+              (int32_t(input[i * inputSize() + k]) - int32_t(inputZeroPoint())) *
+              (int32_t(inputWeights[row * inputSize() + k]) - int32_t(kernelZeroPoint()));
+          }
+          int32_t recurrentAccumulator = recurrentBias[row];
+          for (size_t k = 0; k < hiddenSize(); k++) {
+            recurrentAccumulator +=
+              (int32_t(hidden[i * hiddenSize() + k]) - int32_t(inputZeroPoint())) *
+              (int32_t(recurrentWeights[row * hiddenSize() + k]) - int32_t(kernelZeroPoint()));
+          }
+          inputAccumulators[i * gates * hiddenSize() + row] = inputAccumulator;
+          recurrentAccumulators[i * gates * hiddenSize() + row] = recurrentAccumulator;
+        }
+      }
+
+      /* Create, setup, run, and destroy recurrent cell operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t rnnCell = nullptr;
+
+      uint8_t* hiddenOutputData = inPlace() ? hidden.data() : hiddenOutput.data();
+      uint8_t* cellOutputData = inPlace() ? cell.data() : cellOutput.data();
+      const std::vector<uint8_t> hiddenRef(hidden);
+      const std::vector<uint8_t> cellRef(cell);
+      if (lstm) {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_create_lstm_cell_q8(
+            inputSize(), hiddenSize(),
+            inputZeroPoint(), inputScale,
+            kernelZeroPoint(), kernelScale,
+            inputWeights.data(), recurrentWeights.data(),
+            inputBias.data(), recurrentBias.data(),
+            cellZeroPoint, cellScale,
+            &rnnCell));
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_setup_lstm_cell_q8(
+            rnnCell,
+            batchSize(),
+            input.data(), hidden.data(), cell.data(),
+            hiddenOutputData, cellOutputData));
+      } else {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_create_gru_cell_q8(
+            inputSize(), hiddenSize(),
+            inputZeroPoint(), inputScale,
+            kernelZeroPoint(), kernelScale,
+            inputWeights.data(), recurrentWeights.data(),
+            inputBias.data(), recurrentBias.data(),
+            &rnnCell));
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_setup_gru_cell_q8(
+            rnnCell,
+            batchSize(),
+            input.data(), hidden.data(),
+            hiddenOutputData));
+      }
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(rnnCell, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(rnnCell));
+      rnnCell = nullptr;
+
+      /* Gate pre-activations are requantized exactly as in GEMM micro-kernels */
+      const union qnnp_q31_requantization_params requantizationParams =
+        qnnp_compute_scalar_requantization_params(inputScale * kernelScale / QNNP_RNN_GATE_SCALE, 128, 0, 255);
+      auto gate = [&](size_t i, size_t g, size_t n, bool input, bool recurrent) -> int32_t {
+        const size_t index = i * gates * hiddenSize() + g * hiddenSize() + n;
+        const int32_t accumulator =
+          (input ? inputAccumulators[index] : 0) + (recurrent ? recurrentAccumulators[index] : 0);
+        return int32_t(qnnp_q31_requantize(accumulator, requantizationParams)) - 128;
+      };
+      auto sigmoid = [](int32_t q) -> double {
+        return 1.0 / (1.0 + std::exp(-double(QNNP_RNN_GATE_SCALE) * double(q)));
+      };
+      auto clamp = [](double q) -> double {
+        return std::min<double>(std::max<double>(q, 0.0), 255.0);
+      };
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t n = 0; n < hiddenSize(); n++) {
+          const uint8_t hiddenValue = hiddenOutputData[i * hiddenSize() + n];
+          const double hiddenPrev = double(inputScale) * (int32_t(hiddenRef[i * hiddenSize() + n]) - int32_t(inputZeroPoint()));
+          if (lstm) {
+            const double inputGate = sigmoid(gate(i, 0, n, true, true));
+            const double forgetGate = sigmoid(gate(i, 1, n, true, true));
+            const double cellGate = std::tanh(double(QNNP_RNN_GATE_SCALE) * double(gate(i, 2, n, true, true)));
+            const double outputGate = sigmoid(gate(i, 3, n, true, true));
+            const double cellPrev = double(cellScale) * (int32_t(cellRef[i * hiddenSize() + n]) - int32_t(cellZeroPoint));
+            const double cellNext = forgetGate * cellPrev + inputGate * cellGate;
+            const uint8_t cellValue = cellOutputData[i * hiddenSize() + n];
+            ASSERT_NEAR(double(cellValue), clamp(cellNext / double(cellScale) + double(cellZeroPoint)), 0.6) <<
+              "cell state at batch index " << i << " / " << batchSize() << ", hidden unit " << n << " / " << hiddenSize();
+
+            /* Hidden state follows the quantized cell state */
+            const double hiddenNext =
+              outputGate * std::tanh(double(cellScale) * (int32_t(cellValue) - int32_t(cellZeroPoint)));
+            ASSERT_NEAR(double(hiddenValue), clamp(hiddenNext / double(inputScale) + double(inputZeroPoint())), 0.6) <<
+              "hidden state at batch index " << i << " / " << batchSize() << ", hidden unit " << n << " / " << hiddenSize();
+          } else {
+            const double resetGate = sigmoid(gate(i, 0, n, true, true));
+            const double updateGate = sigmoid(gate(i, 1, n, true, true));
+            /* New gate pre-activation is requantized too, and either rounding is accepted at ties */
+            const double newGate = double(gate(i, 2, n, true, false)) + resetGate * double(gate(i, 2, n, false, true));
+            double minError = 256.0;
+            for (const double newGateQuantized : {std::floor(newGate), std::ceil(newGate)}) {
+              if (std::abs(newGateQuantized - newGate) > 0.501) {
+                continue;
+              }
+              const double newValue =
+                std::tanh(double(QNNP_RNN_GATE_SCALE) * std::min<double>(std::max<double>(newGateQuantized, -128.0), 127.0));
+              const double hiddenNext = (1.0 - updateGate) * newValue + updateGate * hiddenPrev;
+              minError = std::min(minError,
+                std::abs(double(hiddenValue) - clamp(hiddenNext / double(inputScale) + double(inputZeroPoint()))));
+            }
+            ASSERT_LE(minError, 0.6) <<
+              "hidden state at batch index " << i << " / " << batchSize() << ", hidden unit " << n << " / " << hiddenSize();
+          }
+        }
+      }
+    }
+  }
+
+  size_t batchSize_{1};
+  size_t inputSize_{1};
+  size_t hiddenSize_{1};
+  bool inPlace_{false};
+  uint8_t inputZeroPoint_{127};
+  uint8_t kernelZeroPoint_{127};
+  size_t iterations_{3};
+};
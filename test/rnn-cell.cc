@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "rnn-cell-operator-tester.h"
+
+
+TEST(LSTM_CELL_OP, unit_batch) {
+  for (size_t hiddenSize = 1; hiddenSize <= 19; hiddenSize += 3) {
+    RnnCellOperatorTester()
+      .batchSize(1)
+      .inputSize(23)
+      .hiddenSize(hiddenSize)
+      .testLSTMQ8();
+  }
+}
+
+TEST(LSTM_CELL_OP, small_batch) {
+  for (size_t batchSize = 2; batchSize <= 11; batchSize++) {
+    RnnCellOperatorTester()
+      .batchSize(batchSize)
+      .inputSize(17)
+      .hiddenSize(13)
+      .testLSTMQ8();
+  }
+}
+
+TEST(LSTM_CELL_OP, small_input) {
+  for (size_t inputSize = 1; inputSize <= 8; inputSize++) {
+    RnnCellOperatorTester()
+      .batchSize(3)
+      .inputSize(inputSize)
+      .hiddenSize(5)
+      .testLSTMQ8();
+  }
+}
+
+TEST(LSTM_CELL_OP, large_hidden) {
+  RnnCellOperatorTester()
+    .batchSize(5)
+    .inputSize(37)
+    .hiddenSize(67)
+    .testLSTMQ8();
+}
+
+TEST(LSTM_CELL_OP, in_place) {
+  RnnCellOperatorTester()
+    .batchSize(5)
+    .inputSize(17)
+    .hiddenSize(13)
+    .inPlace(true)
+    .testLSTMQ8();
+}
+
+TEST(LSTM_CELL_OP, with_zero_points) {
+  RnnCellOperatorTester()
+    .batchSize(5)
+    .inputSize(17)
+    .hiddenSize(13)
+    .inputZeroPoint(111)
+    .kernelZeroPoint(143)
+    .testLSTMQ8();
+}
+
+TEST(GRU_CELL_OP, unit_batch) {
+  for (size_t hiddenSize = 1; hiddenSize <= 19; hiddenSize += 3) {
+    RnnCellOperatorTester()
+      .batchSize(1)
+      .inputSize(23)
+      .hiddenSize(hiddenSize)
+      .testGRUQ8();
+  }
+}
+
+TEST(GRU_CELL_OP, small_batch) {
+  for (size_t batchSize = 2; batchSize <= 11; batchSize++) {
+    RnnCellOperatorTester()
+      .batchSize(batchSize)
+      .inputSize(17)
+      .hiddenSize(13)
+      .testGRUQ8();
+  }
+}
+
+TEST(GRU_CELL_OP, small_input) {
+  for (size_t inputSize = 1; inputSize <= 8; inputSize++) {
+    RnnCellOperatorTester()
+      .batchSize(3)
+      .inputSize(inputSize)
+      .hiddenSize(5)
+      .testGRUQ8();
+  }
+}
+
+TEST(GRU_CELL_OP, large_hidden) {
+  RnnCellOperatorTester()
+    .batchSize(5)
+    .inputSize(37)
+    .hiddenSize(67)
+    .testGRUQ8();
+}
+
+TEST(GRU_CELL_OP, in_place) {
+  RnnCellOperatorTester()
+    .batchSize(5)
+    .inputSize(17)
+    .hiddenSize(13)
+    .inPlace(true)
+    .testGRUQ8();
+}
+
+TEST(GRU_CELL_OP, with_zero_points) {
+  RnnCellOperatorTester()
+    .batchSize(5)
+    .inputSize(17)
+    .hiddenSize(13)
+    .inputZeroPoint(111)
+    .kernelZeroPoint(143)
+    .testGRUQ8();
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "depth-to-space-operator-tester.h"
+
+
+TEST(SPACE_TO_DEPTH_OP, unit_batch) {
+  for (uint32_t blockSize = 2; blockSize <= 4; blockSize++) {
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      DepthToSpaceOperatorTester()
+        .batchSize(1)
+        .height(5)
+        .width(7)
+        .blockSize(blockSize)
+        .channels(channels)
+        .testSpaceToDepthX8();
+    }
+  }
+}
+
+TEST(SPACE_TO_DEPTH_OP, small_batch) {
+  for (uint32_t blockSize = 2; blockSize <= 4; blockSize++) {
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      DepthToSpaceOperatorTester()
+        .batchSize(3)
+        .height(5)
+        .width(7)
+        .blockSize(blockSize)
+        .channels(channels)
+        .testSpaceToDepthX8();
+    }
+  }
+}
+
+TEST(SPACE_TO_DEPTH_OP, unit_pixel) {
+  for (uint32_t blockSize = 2; blockSize <= 4; blockSize++) {
+    DepthToSpaceOperatorTester()
+      .batchSize(2)
+      .blockSize(blockSize)
+      .channels(5)
+      .testSpaceToDepthX8();
+  }
+}
+
+TEST(SPACE_TO_DEPTH_OP, depth_pixel_stride) {
+  for (uint32_t blockSize = 2; blockSize <= 4; blockSize++) {
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      DepthToSpaceOperatorTester()
+        .batchSize(3)
+        .height(5)
+        .width(7)
+        .blockSize(blockSize)
+        .channels(channels)
+        .depthPixelStride(blockSize * blockSize * channels + 7)
+        .testSpaceToDepthX8();
+    }
+  }
+}
+
+TEST(SPACE_TO_DEPTH_OP, space_pixel_stride) {
+  for (uint32_t blockSize = 2; blockSize <= 4; blockSize++) {
+    for (size_t channels = 1; channels < 20; channels += 3) {
+      DepthToSpaceOperatorTester()
+        .batchSize(3)
+        .height(5)
+        .width(7)
+        .blockSize(blockSize)
+        .channels(channels)
+        .spacePixelStride(channels + 5)
+        .testSpaceToDepthX8();
+    }
+  }
+}
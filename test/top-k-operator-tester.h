@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class TopKOperatorTester {
+ public:
+  inline TopKOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline TopKOperatorTester& k(size_t k) {
+    assert(k != 0);
+    this->k_ = k;
+    return *this;
+  }
+
+  inline size_t k() const {
+    return this->k_;
+  }
+
+  inline TopKOperatorTester& inputStride(size_t inputStride) {
+    assert(inputStride != 0);
+    this->inputStride_ = inputStride;
+    return *this;
+  }
+
+  inline size_t inputStride() const {
+    if (this->inputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->inputStride_ >= this->channels_);
+      return this->inputStride_;
+    }
+  }
+
+  inline TopKOperatorTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return this->k_;
+    } else {
+      assert(this->outputStride_ >= this->k_);
+      return this->outputStride_;
+    }
+  }
+
+  inline TopKOperatorTester& batchSize(size_t batchSize) {
+    assert(batchSize != 0);
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline TopKOperatorTester& inputMax(uint8_t inputMax) {
+    this->inputMax_ = inputMax;
+    return *this;
+  }
+
+  inline uint8_t inputMax() const {
+    return this->inputMax_;
+  }
+
+  inline TopKOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testArgMaxU8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, inputMax()), rng);
+
+    std::vector<uint8_t> input((batchSize() - 1) * inputStride() + channels());
+    std::vector<uint32_t> output(batchSize());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), UINT32_C(0xA5A5A5A5));
+
+      /* Create, setup, run, and destroy ArgMax operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t argmax_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_argmax_nc_u8(
+          channels(), &argmax_op));
+      ASSERT_NE(nullptr, argmax_op);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_argmax_nc_u8(
+          argmax_op,
+          batchSize(),
+          input.data(), inputStride(),
+          output.data()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(argmax_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(argmax_op));
+      argmax_op = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        const uint8_t* row = input.data() + i * inputStride();
+        const size_t indexRef = std::max_element(row, row + channels()) - row;
+        ASSERT_EQ(indexRef, output[i]) << "batch index " << i;
+      }
+    }
+  }
+
+  void testTopKU8(bool values = true) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, inputMax()), rng);
+
+    std::vector<uint8_t> input((batchSize() - 1) * inputStride() + channels());
+    std::vector<uint8_t> outputValues((batchSize() - 1) * outputStride() + k());
+    std::vector<uint32_t> outputIndices((batchSize() - 1) * outputStride() + k());
+    std::vector<uint32_t> indicesRef(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(outputValues.begin(), outputValues.end(), 0xA5);
+      std::fill(outputIndices.begin(), outputIndices.end(), UINT32_C(0xA5A5A5A5));
+
+      /* Create, setup, run, and destroy Top-K operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t top_k_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_top_k_nc_u8(
+          channels(), k(), &top_k_op));
+      ASSERT_NE(nullptr, top_k_op);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_top_k_nc_u8(
+          top_k_op,
+          batchSize(),
+          input.data(), inputStride(),
+          values ? outputValues.data() : nullptr, outputIndices.data(), outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(top_k_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(top_k_op));
+      top_k_op = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        const uint8_t* row = input.data() + i * inputStride();
+        std::iota(indicesRef.begin(), indicesRef.end(), 0);
+        std::stable_sort(indicesRef.begin(), indicesRef.end(),
+          [row](uint32_t a, uint32_t b) { return row[a] > row[b]; });
+        for (size_t j = 0; j < k(); j++) {
+          ASSERT_EQ(indicesRef[j], outputIndices[i * outputStride() + j])
+            << "batch index " << i << ", output " << j;
+          if (values) {
+            ASSERT_EQ(uint32_t(row[indicesRef[j]]), uint32_t(outputValues[i * outputStride() + j]))
+              << "batch index " << i << ", output " << j;
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  size_t batchSize_{1};
+  size_t channels_{1};
+  size_t k_{1};
+  size_t inputStride_{0};
+  size_t outputStride_{0};
+  uint8_t inputMax_{255};
+  size_t iterations_{3};
+};
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "top-k-operator-tester.h"
+
+
+TEST(TOP_K_OP, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels += 3) {
+    for (size_t k = 1; k <= channels; k += 5) {
+      TopKOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .k(k)
+        .testTopKU8();
+    }
+  }
+}
+
+TEST(TOP_K_OP, k_eq_channels) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    TopKOperatorTester()
+      .batchSize(1)
+      .channels(channels)
+      .k(channels)
+      .testTopKU8();
+  }
+}
+
+TEST(TOP_K_OP, small_batch) {
+  for (size_t k = 1; k <= 100; k += 11) {
+    TopKOperatorTester()
+      .batchSize(3)
+      .channels(1000)
+      .k(k)
+      .testTopKU8();
+  }
+}
+
+TEST(TOP_K_OP, small_batch_with_strides) {
+  for (size_t k = 1; k <= 100; k += 11) {
+    TopKOperatorTester()
+      .batchSize(3)
+      .channels(1000)
+      .k(k)
+      .inputStride(1013)
+      .outputStride(117)
+      .testTopKU8();
+  }
+}
+
+TEST(TOP_K_OP, ties) {
+  for (size_t k = 1; k <= 100; k += 11) {
+    TopKOperatorTester()
+      .batchSize(3)
+      .channels(1000)
+      .k(k)
+      .inputMax(5)
+      .testTopKU8();
+  }
+}
+
+TEST(TOP_K_OP, indices_only) {
+  for (size_t k = 1; k <= 100; k += 11) {
+    TopKOperatorTester()
+      .batchSize(3)
+      .channels(1000)
+      .k(k)
+      .testTopKU8(false);
+  }
+}
+
+TEST(TOP_K_OP, large_vocabulary) {
+  for (size_t k = 1; k <= 100; k += 33) {
+    TopKOperatorTester()
+      .batchSize(2)
+      .channels(40000)
+      .k(k)
+      .testTopKU8();
+    TopKOperatorTester()
+      .batchSize(2)
+      .channels(40000)
+      .k(k)
+      .inputMax(7)
+      .testTopKU8();
+  }
+}
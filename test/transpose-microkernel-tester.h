@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack/params.h>
+
+
+class TransposeMicrokernelTester {
+ public:
+  inline TransposeMicrokernelTester& rows(size_t rows) {
+    assert(rows != 0);
+    this->rows_ = rows;
+    return *this;
+  }
+
+  inline size_t rows() const {
+    return this->rows_;
+  }
+
+  inline TransposeMicrokernelTester& columns(size_t columns) {
+    assert(columns != 0);
+    this->columns_ = columns;
+    return *this;
+  }
+
+  inline size_t columns() const {
+    return this->columns_;
+  }
+
+  inline TransposeMicrokernelTester& xStride(size_t xStride) {
+    assert(xStride != 0);
+    this->xStride_ = xStride;
+    return *this;
+  }
+
+  inline size_t xStride() const {
+    if (this->xStride_ == 0) {
+      return columns();
+    } else {
+      assert(this->xStride_ >= columns());
+      return this->xStride_;
+    }
+  }
+
+  inline TransposeMicrokernelTester& yStride(size_t yStride) {
+    assert(yStride != 0);
+    this->yStride_ = yStride;
+    return *this;
+  }
+
+  inline size_t yStride() const {
+    if (this->yStride_ == 0) {
+      return rows();
+    } else {
+      assert(this->yStride_ >= rows());
+      return this->yStride_;
+    }
+  }
+
+  inline TransposeMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void test(x8transpose_ukernel_function x8transpose) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> x((rows() - 1) * xStride() + columns());
+    std::vector<uint8_t> y((columns() - 1) * yStride() + rows());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(u8rng));
+      std::fill(y.begin(), y.end(), 0xA5);
+
+      /* Call optimized micro-kernel */
+      x8transpose(rows(), columns(), x.data(), xStride(), y.data(), yStride());
+
+      /* Verify results */
+      for (size_t c = 0; c < columns(); c++) {
+        for (size_t r = 0; r < rows(); r++) {
+          ASSERT_EQ(uint32_t(y[c * yStride() + r]), uint32_t(x[r * xStride() + c]))
+            << "at row " << r << ", column " << c << " of " << rows() << "x" << columns() << " matrix";
+        }
+        for (size_t r = rows(); r < yStride() && c + 1 < columns(); r++) {
+          ASSERT_EQ(uint32_t(y[c * yStride() + r]), 0xA5)
+            << "at padding " << r << " after column " << c;
+        }
+      }
+    }
+  }
+
+ private:
+  size_t rows_{1};
+  size_t columns_{1};
+  size_t xStride_{0};
+  size_t yStride_{0};
+  size_t iterations_{3};
+};
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class TransposeOperatorTester {
+ public:
+  inline TransposeOperatorTester& shape(std::vector<size_t> shape) {
+    assert(shape.size() <= QNNP_MAX_TRANSPOSE_DIMS);
+    this->shape_ = std::move(shape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& shape() const {
+    return this->shape_;
+  }
+
+  inline TransposeOperatorTester& perm(std::vector<size_t> perm) {
+    assert(perm.size() <= QNNP_MAX_TRANSPOSE_DIMS);
+    this->perm_ = std::move(perm);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& perm() const {
+    return this->perm_;
+  }
+
+  inline size_t numDims() const {
+    return this->shape_.size();
+  }
+
+  inline size_t numElements() const {
+    size_t elements = 1;
+    for (size_t size : shape()) {
+      elements *= size;
+    }
+    return elements;
+  }
+
+  inline TransposeOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testX8() const {
+    ASSERT_EQ(numDims(), perm().size());
+
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<size_t> inputStrides(numDims());
+    std::vector<size_t> outputShape(numDims());
+    size_t stride = 1;
+    for (size_t i = numDims(); i != 0; i--) {
+      inputStrides[i - 1] = stride;
+      stride *= shape()[i - 1];
+    }
+    for (size_t i = 0; i < numDims(); i++) {
+      outputShape[i] = shape()[perm()[i]];
+    }
+
+    std::vector<uint8_t> input(numElements());
+    std::vector<uint8_t> output(numElements());
+    std::vector<uint8_t> outputRef(numElements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference results */
+      for (size_t o = 0; o < numElements(); o++) {
+        size_t index = o;
+        size_t inputOffset = 0;
+        for (size_t i = numDims(); i != 0; i--) {
+          const size_t coordinate = index % outputShape[i - 1];
+          index /= outputShape[i - 1];
+          inputOffset += coordinate * inputStrides[perm()[i - 1]];
+        }
+        outputRef[o] = input[inputOffset];
+      }
+
+      /* Create, setup, run, and destroy Transpose operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t transpose_op = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_transpose_nd_x8(&transpose_op));
+      ASSERT_NE(nullptr, transpose_op);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_transpose_nd_x8(
+          transpose_op,
+          numDims(), shape().data(), perm().data(),
+          input.data(), output.data()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(transpose_op, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(transpose_op));
+      transpose_op = nullptr;
+
+      /* Verify results */
+      for (size_t o = 0; o < numElements(); o++) {
+        ASSERT_EQ(uint32_t(outputRef[o]), uint32_t(output[o]))
+          << "at output element " << o << " of " << numElements();
+      }
+    }
+  }
+
+ private:
+  std::vector<size_t> shape_;
+  std::vector<size_t> perm_;
+  size_t iterations_{3};
+};
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "transpose-operator-tester.h"
+
+
+TEST(TRANSPOSE_OP, identity_1d) {
+  for (size_t n = 1; n < 100; n += 7) {
+    TransposeOperatorTester()
+      .shape({n})
+      .perm({0})
+      .testX8();
+  }
+}
+
+TEST(TRANSPOSE_OP, identity_4d) {
+  TransposeOperatorTester()
+    .shape({2, 3, 5, 7})
+    .perm({0, 1, 2, 3})
+    .testX8();
+}
+
+TEST(TRANSPOSE_OP, matrix) {
+  for (size_t rows = 1; rows < 40; rows += 3) {
+    for (size_t columns = 1; columns < 40; columns += 5) {
+      TransposeOperatorTester()
+        .shape({rows, columns})
+        .perm({1, 0})
+        .testX8();
+    }
+  }
+}
+
+TEST(TRANSPOSE_OP, large_matrix) {
+  TransposeOperatorTester()
+    .shape({131, 257})
+    .perm({1, 0})
+    .testX8();
+}
+
+TEST(TRANSPOSE_OP, unit_dims) {
+  TransposeOperatorTester()
+    .shape({1, 19, 1, 23})
+    .perm({3, 2, 0, 1})
+    .testX8();
+  TransposeOperatorTester()
+    .shape({1, 1, 1})
+    .perm({2, 0, 1})
+    .testX8();
+}
+
+TEST(TRANSPOSE_OP, nhwc_to_nchw) {
+  for (size_t channels = 1; channels < 20; channels += 3) {
+    TransposeOperatorTester()
+      .shape({2, 7, 9, channels})
+      .perm({0, 3, 1, 2})
+      .testX8();
+  }
+}
+
+TEST(TRANSPOSE_OP, nchw_to_nhwc) {
+  for (size_t channels = 1; channels < 20; channels += 3) {
+    TransposeOperatorTester()
+      .shape({2, channels, 7, 9})
+      .perm({0, 2, 3, 1})
+      .testX8();
+  }
+}
+
+TEST(TRANSPOSE_OP, copy_runs_3d) {
+  TransposeOperatorTester()
+    .shape({5, 7, 11})
+    .perm({1, 0, 2})
+    .testX8();
+}
+
+TEST(TRANSPOSE_OP, reverse_5d) {
+  TransposeOperatorTester()
+    .shape({2, 3, 4, 5, 6})
+    .perm({4, 3, 2, 1, 0})
+    .testX8();
+}
+
+TEST(TRANSPOSE_OP, all_permutations_4d) {
+  std::vector<size_t> perm{0, 1, 2, 3};
+  do {
+    TransposeOperatorTester()
+      .shape({3, 5, 7, 11})
+      .perm(perm)
+      .iterations(1)
+      .testX8();
+  } while (std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TRANSPOSE_OP, rotate_6d) {
+  TransposeOperatorTester()
+    .shape({2, 3, 2, 5, 3, 4})
+    .perm({1, 2, 3, 4, 5, 0})
+    .testX8();
+  TransposeOperatorTester()
+    .shape({2, 3, 2, 5, 3, 4})
+    .perm({5, 0, 1, 2, 3, 4})
+    .testX8();
+}
+
+TEST(TRANSPOSE_OP, pixel_shuffle) {
+  for (size_t block = 2; block <= 4; block++) {
+    TransposeOperatorTester()
+      .shape({2, 5, 7, 3, block, block})
+      .perm({0, 1, 4, 2, 5, 3})
+      .testX8();
+  }
+}
+
+TEST(TRANSPOSE_OP, pixel_unshuffle) {
+  for (size_t block = 2; block <= 4; block++) {
+    TransposeOperatorTester()
+      .shape({2, 5, block, 7, block, 3})
+      .perm({0, 1, 3, 5, 2, 4})
+      .testX8();
+  }
+}
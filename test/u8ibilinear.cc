@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <ibilinear-microkernel-tester.h>
+#include <qnnpack/u8ibilinear.h>
+
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+TEST(U8IBILINEAR_C8__NEON, channels_eq_8) {
+  IBilinearMicrokernelTester()
+    .pixels(1)
+    .channels(8)
+    .test(u8ibilinear_ukernel_c8__neon);
+}
+
+TEST(U8IBILINEAR_C8__NEON, channels_div_8) {
+  for (size_t channels = 16; channels < 128; channels += 8) {
+    IBilinearMicrokernelTester()
+      .pixels(1)
+      .channels(channels)
+      .test(u8ibilinear_ukernel_c8__neon);
+  }
+}
+
+TEST(U8IBILINEAR_C8__NEON, channels_lt_8) {
+  for (size_t channels = 1; channels < 8; channels++) {
+    IBilinearMicrokernelTester()
+      .pixels(1)
+      .channels(channels)
+      .test(u8ibilinear_ukernel_c8__neon);
+  }
+}
+
+TEST(U8IBILINEAR_C8__NEON, channels_gt_8) {
+  for (size_t channels = 9; channels < 16; channels++) {
+    IBilinearMicrokernelTester()
+      .pixels(1)
+      .channels(channels)
+      .test(u8ibilinear_ukernel_c8__neon);
+  }
+}
+
+TEST(U8IBILINEAR_C8__NEON, multiple_pixels) {
+  for (size_t pixels = 2; pixels <= 5; pixels++) {
+    for (size_t channels = 1; channels <= 40; channels += 3) {
+      IBilinearMicrokernelTester()
+        .pixels(pixels)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c8__neon);
+    }
+  }
+}
+
+TEST(U8IBILINEAR_C8__NEON, multiple_pixels_with_input_stride) {
+  for (size_t pixels = 2; pixels <= 5; pixels++) {
+    for (size_t channels = 1; channels <= 40; channels += 3) {
+      IBilinearMicrokernelTester()
+        .pixels(pixels)
+        .channels(channels)
+        .inputStride(47)
+        .test(u8ibilinear_ukernel_c8__neon);
+    }
+  }
+}
+
+TEST(U8IBILINEAR_C8__NEON, multiple_pixels_with_output_stride) {
+  for (size_t pixels = 2; pixels <= 5; pixels++) {
+    for (size_t channels = 1; channels <= 40; channels += 3) {
+      IBilinearMicrokernelTester()
+        .pixels(pixels)
+        .channels(channels)
+        .outputStride(43)
+        .test(u8ibilinear_ukernel_c8__neon);
+    }
+  }
+}
+#endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+TEST(U8IBILINEAR_C8__SSE2, channels_eq_8) {
+  IBilinearMicrokernelTester()
+    .pixels(1)
+    .channels(8)
+    .test(u8ibilinear_ukernel_c8__sse2);
+}
+
+TEST(U8IBILINEAR_C8__SSE2, channels_div_8) {
+  for (size_t channels = 16; channels < 128; channels += 8) {
+    IBilinearMicrokernelTester()
+      .pixels(1)
+      .channels(channels)
+      .test(u8ibilinear_ukernel_c8__sse2);
+  }
+}
+
+TEST(U8IBILINEAR_C8__SSE2, channels_lt_8) {
+  for (size_t channels = 1; channels < 8; channels++) {
+    IBilinearMicrokernelTester()
+      .pixels(1)
+      .channels(channels)
+      .test(u8ibilinear_ukernel_c8__sse2);
+  }
+}
+
+TEST(U8IBILINEAR_C8__SSE2, channels_gt_8) {
+  for (size_t channels = 9; channels < 16; channels++) {
+    IBilinearMicrokernelTester()
+      .pixels(1)
+      .channels(channels)
+      .test(u8ibilinear_ukernel_c8__sse2);
+  }
+}
+
+TEST(U8IBILINEAR_C8__SSE2, multiple_pixels) {
+  for (size_t pixels = 2; pixels <= 5; pixels++) {
+    for (size_t channels = 1; channels <= 40; channels += 3) {
+      IBilinearMicrokernelTester()
+        .pixels(pixels)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c8__sse2);
+    }
+  }
+}
+
+TEST(U8IBILINEAR_C8__SSE2, multiple_pixels_with_input_stride) {
+  for (size_t pixels = 2; pixels <= 5; pixels++) {
+    for (size_t channels = 1; channels <= 40; channels += 3) {
+      IBilinearMicrokernelTester()
+        .pixels(pixels)
+        .channels(channels)
+        .inputStride(47)
+        .test(u8ibilinear_ukernel_c8__sse2);
+    }
+  }
+}
+
+TEST(U8IBILINEAR_C8__SSE2, multiple_pixels_with_output_stride) {
+  for (size_t pixels = 2; pixels <= 5; pixels++) {
+    for (size_t channels = 1; channels <= 40; channels += 3) {
+      IBilinearMicrokernelTester()
+        .pixels(pixels)
+        .channels(channels)
+        .outputStride(43)
+        .test(u8ibilinear_ukernel_c8__sse2);
+    }
+  }
+}
+#endif
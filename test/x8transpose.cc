@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cpuinfo.h>
+#include <transpose-microkernel-tester.h>
+#include <qnnpack/x8transpose.h>
+
+// clang-format off
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(X8TRANSPOSE_8X8__SSE2, rows_eq_8_columns_eq_8) {
+    TransposeMicrokernelTester()
+      .rows(8)
+      .columns(8)
+      .test(x8transpose_ukernel_8x8__sse2);
+  }
+
+  TEST(X8TRANSPOSE_8X8__SSE2, rows_div_8_columns_div_8) {
+    for (size_t rows = 8; rows <= 32; rows += 8) {
+      for (size_t columns = 8; columns <= 32; columns += 8) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .test(x8transpose_ukernel_8x8__sse2);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE_8X8__SSE2, rows_gt_8_columns_gt_8) {
+    for (size_t rows = 9; rows < 24; rows++) {
+      for (size_t columns = 9; columns < 24; columns++) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .test(x8transpose_ukernel_8x8__sse2);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE_8X8__SSE2, rows_lt_8) {
+    for (size_t rows = 1; rows < 8; rows++) {
+      for (size_t columns = 1; columns < 24; columns++) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .test(x8transpose_ukernel_8x8__sse2);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE_8X8__SSE2, columns_lt_8) {
+    for (size_t rows = 1; rows < 24; rows++) {
+      for (size_t columns = 1; columns < 8; columns++) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .test(x8transpose_ukernel_8x8__sse2);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE_8X8__SSE2, x_stride) {
+    for (size_t rows = 1; rows < 24; rows += 5) {
+      for (size_t columns = 1; columns < 24; columns += 3) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .xStride(29)
+          .test(x8transpose_ukernel_8x8__sse2);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE_8X8__SSE2, y_stride) {
+    for (size_t rows = 1; rows < 24; rows += 5) {
+      for (size_t columns = 1; columns < 24; columns += 3) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .yStride(31)
+          .test(x8transpose_ukernel_8x8__sse2);
+      }
+    }
+  }
+#endif
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(X8TRANSPOSE_8X8__NEON, rows_eq_8_columns_eq_8) {
+    TransposeMicrokernelTester()
+      .rows(8)
+      .columns(8)
+      .test(x8transpose_ukernel_8x8__neon);
+  }
+
+  TEST(X8TRANSPOSE_8X8__NEON, rows_div_8_columns_div_8) {
+    for (size_t rows = 8; rows <= 32; rows += 8) {
+      for (size_t columns = 8; columns <= 32; columns += 8) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .test(x8transpose_ukernel_8x8__neon);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE_8X8__NEON, rows_gt_8_columns_gt_8) {
+    for (size_t rows = 9; rows < 24; rows++) {
+      for (size_t columns = 9; columns < 24; columns++) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .test(x8transpose_ukernel_8x8__neon);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE_8X8__NEON, rows_lt_8) {
+    for (size_t rows = 1; rows < 8; rows++) {
+      for (size_t columns = 1; columns < 24; columns++) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .test(x8transpose_ukernel_8x8__neon);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE_8X8__NEON, columns_lt_8) {
+    for (size_t rows = 1; rows < 24; rows++) {
+      for (size_t columns = 1; columns < 8; columns++) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .test(x8transpose_ukernel_8x8__neon);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE_8X8__NEON, x_stride) {
+    for (size_t rows = 1; rows < 24; rows += 5) {
+      for (size_t columns = 1; columns < 24; columns += 3) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .xStride(29)
+          .test(x8transpose_ukernel_8x8__neon);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE_8X8__NEON, y_stride) {
+    for (size_t rows = 1; rows < 24; rows += 5) {
+      for (size_t columns = 1; columns < 24; columns += 3) {
+        TransposeMicrokernelTester()
+          .rows(rows)
+          .columns(columns)
+          .yStride(31)
+          .test(x8transpose_ukernel_8x8__neon);
+      }
+    }
+  }
+#endif